@@ -0,0 +1,116 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdlib.h>
+#include "bench.h"
+
+#define NLIVE	64
+
+static void *live[NLIVE];
+
+/* Allocate and immediately free one block of a fixed size */
+static void
+bench_pair(void *arg, long iters)
+{
+    size_t size = *(size_t *) arg;
+
+    while (iters--) {
+        void *p = malloc(size);
+        bench_keep((uintptr_t) p);
+        free(p);
+    }
+}
+
+/*
+ * Keep NLIVE blocks allocated, replacing a random one each
+ * iteration with a block of random size up to 'max'
+ */
+static void
+bench_mix(void *arg, long iters)
+{
+    size_t max = *(size_t *) arg;
+    int i;
+
+    while (iters--) {
+        uint32_t r = bench_random();
+        void **slot = &live[r % NLIVE];
+
+        free(*slot);
+        *slot = malloc((r >> 8) % max + 1);
+        bench_keep((uintptr_t) *slot);
+    }
+    for (i = 0; i < NLIVE; i++) {
+        free(live[i]);
+        live[i] = NULL;
+    }
+}
+
+/* Grow a block with realloc, as a string builder would */
+static void
+bench_realloc(void *arg, long iters)
+{
+    size_t max = *(size_t *) arg;
+
+    while (iters--) {
+        void *p = NULL;
+        size_t size;
+
+        for (size = 16; size <= max; size += size / 2) {
+            void *n = realloc(p, size);
+            if (!n)
+                break;
+            p = n;
+        }
+        bench_keep((uintptr_t) p);
+        free(p);
+    }
+}
+
+static const size_t sizes[] = { 16, 256, 4096 };
+
+int
+main(void)
+{
+    size_t i;
+
+    for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        size_t size = sizes[i];
+
+        bench_run("malloc-free", (long) size, bench_pair, &size);
+        bench_run("malloc-mix", (long) size, bench_mix, &size);
+        bench_run("realloc-grow", (long) size, bench_realloc, &size);
+    }
+    return 0;
+}
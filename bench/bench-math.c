@@ -0,0 +1,140 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <math.h>
+#include "bench.h"
+
+#define NINPUTS	256
+
+static double dinput[NINPUTS];
+static float finput[NINPUTS];
+
+/* Sum the results so the loop can't be removed */
+#define BENCH_D1(func)                                                  \
+    static void bench_##func(void *arg, long iters) {                   \
+        double sum = 0;                                                 \
+        (void) arg;                                                     \
+        while (iters--)                                                 \
+            sum += func(dinput[iters % NINPUTS]);                       \
+        bench_keep_double(sum);                                         \
+    }
+
+#define BENCH_D2(func)                                                  \
+    static void bench_##func(void *arg, long iters) {                   \
+        double sum = 0;                                                 \
+        (void) arg;                                                     \
+        while (iters--)                                                 \
+            sum += func(dinput[iters % NINPUTS],                        \
+                        dinput[(iters + 1) % NINPUTS]);                 \
+        bench_keep_double(sum);                                         \
+    }
+
+#define BENCH_F1(func)                                                  \
+    static void bench_##func(void *arg, long iters) {                   \
+        float sum = 0;                                                  \
+        (void) arg;                                                     \
+        while (iters--)                                                 \
+            sum += func(finput[iters % NINPUTS]);                       \
+        bench_keep_float(sum);                                          \
+    }
+
+#define BENCH_F2(func)                                                  \
+    static void bench_##func(void *arg, long iters) {                   \
+        float sum = 0;                                                  \
+        (void) arg;                                                     \
+        while (iters--)                                                 \
+            sum += func(finput[iters % NINPUTS],                        \
+                        finput[(iters + 1) % NINPUTS]);                 \
+        bench_keep_float(sum);                                          \
+    }
+
+BENCH_D1(sin)
+BENCH_D1(cos)
+BENCH_D1(tan)
+BENCH_D1(atan)
+BENCH_D1(exp)
+BENCH_D1(log)
+BENCH_D1(sqrt)
+BENCH_D2(pow)
+BENCH_D2(atan2)
+BENCH_D2(fmod)
+
+BENCH_F1(sinf)
+BENCH_F1(cosf)
+BENCH_F1(tanf)
+BENCH_F1(atanf)
+BENCH_F1(expf)
+BENCH_F1(logf)
+BENCH_F1(sqrtf)
+BENCH_F2(powf)
+BENCH_F2(atan2f)
+BENCH_F2(fmodf)
+
+#define RUN(func)	bench_run(#func, 0, bench_##func, NULL)
+
+int
+main(void)
+{
+    int i;
+
+    /* Positive inputs spread over (0, 10] keep every function in domain */
+    for (i = 0; i < NINPUTS; i++) {
+        dinput[i] = (double) (bench_random() % 100000 + 1) / 10000.0;
+        finput[i] = (float) dinput[i];
+    }
+
+    RUN(sin);
+    RUN(cos);
+    RUN(tan);
+    RUN(atan);
+    RUN(exp);
+    RUN(log);
+    RUN(sqrt);
+    RUN(pow);
+    RUN(atan2);
+    RUN(fmod);
+
+    RUN(sinf);
+    RUN(cosf);
+    RUN(tanf);
+    RUN(atanf);
+    RUN(expf);
+    RUN(logf);
+    RUN(sqrtf);
+    RUN(powf);
+    RUN(atan2f);
+    RUN(fmodf);
+    return 0;
+}
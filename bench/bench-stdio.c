@@ -0,0 +1,123 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+
+static char buf[128];
+
+static void
+bench_printf_int(void *arg, long iters)
+{
+    (void) arg;
+    while (iters--)
+        bench_keep((uintptr_t) snprintf(buf, sizeof(buf), "%d %x", (int) iters, (unsigned) iters));
+}
+
+static void
+bench_printf_str(void *arg, long iters)
+{
+    (void) arg;
+    while (iters--)
+        bench_keep((uintptr_t) snprintf(buf, sizeof(buf), "%s: %-10s|", "name", "value"));
+}
+
+static void
+bench_printf_double(void *arg, long iters)
+{
+    (void) arg;
+    while (iters--)
+        bench_keep((uintptr_t) snprintf(buf, sizeof(buf), "%g %.3f", (double) iters * 1.25, 3.14159));
+}
+
+static void
+bench_scanf_int(void *arg, long iters)
+{
+    int a, b;
+
+    (void) arg;
+    while (iters--) {
+        bench_keep((uintptr_t) sscanf("12345 -678", "%d %d", &a, &b));
+        bench_keep((uintptr_t) (a + b));
+    }
+}
+
+static void
+bench_scanf_double(void *arg, long iters)
+{
+    double d;
+
+    (void) arg;
+    while (iters--) {
+        bench_keep((uintptr_t) sscanf("6.02214076e23", "%lf", &d));
+        bench_keep_double(d);
+    }
+}
+
+static const char *const strtod_inputs[] = {
+    "1", "0.1", "3.14159265358979", "6.02214076e23", "1e-300", "123456789012345678901234567890",
+};
+
+#define NINPUTS (sizeof(strtod_inputs) / sizeof(strtod_inputs[0]))
+
+static void
+bench_strtod(void *arg, long iters)
+{
+    (void) arg;
+    while (iters--)
+        bench_keep_double(strtod(strtod_inputs[iters % NINPUTS], NULL));
+}
+
+static void
+bench_strtof(void *arg, long iters)
+{
+    (void) arg;
+    while (iters--)
+        bench_keep_float(strtof(strtod_inputs[iters % (NINPUTS - 1)], NULL));
+}
+
+int
+main(void)
+{
+    bench_run("snprintf-int", 0, bench_printf_int, NULL);
+    bench_run("snprintf-str", 0, bench_printf_str, NULL);
+    bench_run("snprintf-double", 0, bench_printf_double, NULL);
+    bench_run("sscanf-int", 0, bench_scanf_int, NULL);
+    bench_run("sscanf-double", 0, bench_scanf_double, NULL);
+    bench_run("strtod", 0, bench_strtod, NULL);
+    bench_run("strtof", 0, bench_strtof, NULL);
+    return 0;
+}
@@ -0,0 +1,101 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include "bench.h"
+
+#define MAX_LEN	4096
+
+static char src[MAX_LEN + 1], dst[MAX_LEN + 1];
+static size_t len;
+
+static void
+bench_memcpy(void *arg, long iters)
+{
+    (void) arg;
+    while (iters--)
+        bench_keep((uintptr_t) memcpy(dst, src, len));
+}
+
+static void
+bench_memset(void *arg, long iters)
+{
+    (void) arg;
+    while (iters--)
+        bench_keep((uintptr_t) memset(dst, (int) iters, len));
+}
+
+static void
+bench_strlen(void *arg, long iters)
+{
+    (void) arg;
+    while (iters--)
+        bench_keep(strlen(src));
+}
+
+static void
+bench_strcmp(void *arg, long iters)
+{
+    (void) arg;
+    while (iters--)
+        bench_keep((uintptr_t) strcmp(src, dst));
+}
+
+static const size_t lengths[] = { 8, 64, 512, MAX_LEN };
+
+int
+main(void)
+{
+    size_t i;
+
+    for (i = 0; i < MAX_LEN; i++)
+        src[i] = 'a' + (char) (i % 26);
+
+    for (i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) {
+        len = lengths[i];
+
+        bench_run("memcpy", (long) len, bench_memcpy, NULL);
+        bench_run("memset", (long) len, bench_memset, NULL);
+
+        /* string functions scan 'len' bytes before the terminator */
+        src[len] = '\0';
+        memcpy(dst, src, len + 1);
+        bench_run("strlen", (long) len, bench_strlen, NULL);
+        bench_run("strcmp", (long) len, bench_strcmp, NULL);
+        src[len] = 'a' + (char) (len % 26);
+    }
+    return 0;
+}
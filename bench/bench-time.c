@@ -0,0 +1,108 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdlib.h>
+#include <time.h>
+#include "bench.h"
+
+static char buf[128];
+
+/* Step through a few decades, one odd interval at a time */
+#define TIME_STEP	((time_t) 86400 * 37 + 12345)
+
+static void
+bench_gmtime(void *arg, long iters)
+{
+    struct tm tm;
+    time_t t = 0;
+
+    (void) arg;
+    while (iters--) {
+        bench_keep((uintptr_t) gmtime_r(&t, &tm));
+        t += TIME_STEP;
+    }
+}
+
+static void
+bench_localtime(void *arg, long iters)
+{
+    struct tm tm;
+    time_t t = 0;
+
+    (void) arg;
+    while (iters--) {
+        bench_keep((uintptr_t) localtime_r(&t, &tm));
+        t += TIME_STEP;
+    }
+}
+
+static void
+bench_mktime(void *arg, long iters)
+{
+    struct tm tm = { .tm_year = 100, .tm_mday = 1, .tm_isdst = -1 };
+
+    (void) arg;
+    while (iters--) {
+        tm.tm_mday = 1 + (int) (iters % 28);
+        tm.tm_isdst = -1;
+        bench_keep((uintptr_t) mktime(&tm));
+    }
+}
+
+static void
+bench_strftime(void *arg, long iters)
+{
+    struct tm tm;
+    time_t t = 1000000000;
+
+    (void) arg;
+    localtime_r(&t, &tm);
+    while (iters--)
+        bench_keep(strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S %Z %a %b %j", &tm));
+}
+
+int
+main(void)
+{
+    setenv("TZ", "PST8PDT,M3.2.0,M11.1.0", 1);
+    tzset();
+
+    bench_run("gmtime_r", 0, bench_gmtime, NULL);
+    bench_run("localtime_r", 0, bench_localtime, NULL);
+    bench_run("mktime", 0, bench_mktime, NULL);
+    bench_run("strftime", 0, bench_strftime, NULL);
+    return 0;
+}
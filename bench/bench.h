@@ -0,0 +1,148 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Minimal benchmark harness. Each benchmark is a function which runs
+ * its operation 'iters' times; bench_run keeps doubling the count
+ * until the run takes long enough to measure with clock(), then
+ * prints one JSON object per line:
+ *
+ *	{"bench":"memcpy","param":4096,"iters":65536,"total_ns":8060928,"ns":123}
+ *
+ * 'total_ns' is the time taken by all iterations and 'ns' the time
+ * per iteration; both are -1 when no clock is available.
+ * Lines starting with '{' are the results; anything else is
+ * commentary.
+ */
+
+#ifndef _BENCH_H_
+#define _BENCH_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef BENCH_MIN_CLOCKS
+#define BENCH_MIN_CLOCKS	(CLOCKS_PER_SEC / 5)
+#endif
+
+#ifndef BENCH_MAX_ITERS
+#define BENCH_MAX_ITERS		((long) 1 << 24)
+#endif
+
+/* Iterations used when clock() doesn't work */
+#ifndef BENCH_FIXED_ITERS
+#define BENCH_FIXED_ITERS	1000
+#endif
+
+typedef void (*bench_func_t)(void *arg, long iters);
+
+/* Results get stored here so the compiler can't discard the work */
+static volatile uintptr_t bench_sink;
+
+static inline void
+bench_keep(uintptr_t v)
+{
+    bench_sink += v;
+}
+
+/*
+ * Floating point results are kept by their bits; converting them to
+ * an integer is undefined when they are out of range or NaN
+ */
+static inline void
+bench_keep_double(double d)
+{
+    uint64_t v;
+
+    memcpy(&v, &d, sizeof(v));
+    bench_keep((uintptr_t) v);
+}
+
+static inline void
+bench_keep_float(float f)
+{
+    uint32_t v;
+
+    memcpy(&v, &f, sizeof(v));
+    bench_keep((uintptr_t) v);
+}
+
+static void
+bench_run(const char *name, long param, bench_func_t func, void *arg)
+{
+    long iters = 1;
+    clock_t elapsed;
+    long long total_ns, ns;
+
+    for (;;) {
+        clock_t start = clock();
+
+        if (start == (clock_t) -1) {
+            iters = BENCH_FIXED_ITERS;
+            func(arg, iters);
+            elapsed = (clock_t) -1;
+            break;
+        }
+        func(arg, iters);
+        elapsed = clock() - start;
+        if (elapsed >= BENCH_MIN_CLOCKS || iters >= BENCH_MAX_ITERS)
+            break;
+        iters <<= 1;
+    }
+
+    if (elapsed == (clock_t) -1) {
+        total_ns = ns = -1;
+    } else {
+        total_ns = (long long) elapsed * (1000000000 / CLOCKS_PER_SEC);
+        ns = total_ns / iters;
+    }
+
+    printf("{\"bench\":\"%s\",\"param\":%ld,\"iters\":%ld,\"total_ns\":%lld,\"ns\":%lld}\n",
+           name, param, iters, total_ns, ns);
+}
+
+/* Small deterministic generator so every run sees the same inputs */
+static uint32_t bench_seed = 1;
+
+static inline uint32_t
+bench_random(void)
+{
+    bench_seed = bench_seed * 1103515245 + 12345;
+    return bench_seed >> 8;
+}
+
+#endif /* _BENCH_H_ */
@@ -34,7 +34,13 @@ SUCH DAMAGE.
 #include <_ansi.h>
 #include <sys/lock.h>
 
-#define ENV_LOCK __LIBC_LOCK()
-#define ENV_UNLOCK __LIBC_UNLOCK()
+/* setenv and unsetenv hold the lock exclusively, lookups share it */
+#define ENV_LOCK __ENV_LOCK()
+#define ENV_UNLOCK __ENV_UNLOCK()
+#define ENV_LOCK_SHARED __ENV_LOCK_SHARED()
+#define ENV_UNLOCK_SHARED __ENV_UNLOCK_SHARED()
+
+/* _findenv for callers already holding the lock */
+char *_findenv_unlocked (const char *, int *);
 
 #endif /* _INCLUDE_ENVLOCK_H_ */
@@ -489,6 +489,8 @@ warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
 #ifdef __x86_64__
 #define __IEEE_LITTLE_ENDIAN
 # define _SUPPORTS_ERREXCEPT
+/* SSE2 is always available, where the new math code is faster */
+# define __OBSOLETE_MATH_DEFAULT 0
 #endif
 
 #ifdef __mep__
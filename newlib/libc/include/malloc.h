@@ -82,6 +82,9 @@ extern void *pvalloc (size_t);
 extern int malloc_trim (size_t);
 extern void __malloc_lock(void);
 extern void __malloc_unlock(void);
+/* Return blocks cached by the calling thread to the heap. Call this
+   before a thread exits when the malloc-tcache option is enabled.  */
+extern void __malloc_tcache_flush(void);
 
 /* A compatibility routine for an earlier version of the allocator.  */
 
@@ -706,6 +706,41 @@ extern int signgam;
 
 #endif /* __BSD_VISIBLE */
 
+/*
+ * Vector variants of some functions, using the vector function ABI
+ * of '#pragma omp declare simd'. Declaring them lets the compiler
+ * call them from vectorized loops. As in glibc, they are only
+ * declared with -ffast-math, as their results may differ from the
+ * scalar functions by an ulp. They are left off while building the
+ * library itself so the compiler doesn't emit its own clones next to
+ * the scalar definitions. The aarch64 variants are built but not yet
+ * declared.
+ */
+#if !defined(__PICOLIBC_NO_VECTOR_MATH) && !defined(_LIBC) && \
+    defined(__FAST_MATH__) && defined(__x86_64__)
+# if defined(_OPENMP) && _OPENMP >= 201307
+#  define __VECTOR_MATH_DECL _Pragma("omp declare simd notinbranch")
+# elif __GNUC_PREREQ(9, 0) && !defined(__clang__)
+#  define __VECTOR_MATH_DECL __attribute__((__simd__("notinbranch")))
+# endif
+#endif
+
+#ifdef __VECTOR_MATH_DECL
+#if !__OBSOLETE_MATH_FLOAT
+__VECTOR_MATH_DECL extern float sinf (float);
+__VECTOR_MATH_DECL extern float cosf (float);
+__VECTOR_MATH_DECL extern float expf (float);
+__VECTOR_MATH_DECL extern float exp2f (float);
+__VECTOR_MATH_DECL extern float logf (float);
+__VECTOR_MATH_DECL extern float log2f (float);
+__VECTOR_MATH_DECL extern float powf (float, float);
+#endif
+#if !__OBSOLETE_MATH_DOUBLE
+__VECTOR_MATH_DECL extern double exp (double);
+__VECTOR_MATH_DECL extern double log (double);
+#endif
+#endif
+
 #include <machine/math.h>
 
 _END_STD_C
@@ -61,13 +61,20 @@ typedef enum {
 typedef struct node {
 	char         *key;
 	struct node  *llink, *rlink;
+	int          height;		/* AVL subtree height */
 } node_t;
+
+/* Bound on the AVL tree height for any tree that fits in memory */
+#define __TSEARCH_MAX_HEIGHT	(sizeof(void *) * 8 * 3 / 2)
+
+int	__tsearch_balance(node_t **);
 #endif
 
 struct hsearch_data
 {
-  struct internal_head *htable;
+  struct internal_entry *htable;
   size_t htablesize;
+  size_t hfilled;
 };
 
 #ifndef __compar_fn_t_defined
@@ -24,6 +24,10 @@ typedef int _LOCK_RECURSIVE_T;
 #define __lock_try_acquire_recursive(lock) ((void) 0)
 #define __lock_release(lock) ((void) 0)
 #define __lock_release_recursive(lock) ((void) 0)
+#define __lock_acquire_shared(lock) ((void) 0)
+#define __lock_release_shared(lock) ((void) 0)
+#define __LOCK_INIT_OPTIONAL(lock)
+#define __lock_optional(op, libc_op, lock) ((void) 0)
 
 #else
 
@@ -59,6 +63,21 @@ extern void __retarget_lock_release(_LOCK_T lock);
 #define __lock_release(lock) __retarget_lock_release(lock)
 extern void __retarget_lock_release_recursive(_LOCK_T lock);
 #define __lock_release_recursive(lock) __retarget_lock_release_recursive(lock)
+extern void __retarget_lock_acquire_shared(_LOCK_T lock);
+#define __lock_acquire_shared(lock) __retarget_lock_acquire_shared(lock)
+extern void __retarget_lock_release_shared(_LOCK_T lock);
+#define __lock_release_shared(lock) __retarget_lock_release_shared(lock)
+
+/*
+ * Locks added after __libc_recursive_mutex are weak so that locking
+ * implementations written before they existed still link. When one
+ * isn't defined, __lock_optional applies libc_op to
+ * __libc_recursive_mutex in its place.
+ */
+#define __LOCK_INIT_OPTIONAL(lock) extern struct __lock __lock_ ## lock __attribute__((__weak__));
+#define __lock_optional(op, libc_op, lock)                              \
+  ((&__lock_ ## lock) ? op(&__lock_ ## lock) :                          \
+   libc_op(&__lock___libc_recursive_mutex))
 
 #ifdef __cplusplus
 }
@@ -70,4 +89,33 @@ extern void __retarget_lock_release_recursive(_LOCK_T lock);
 #define __LIBC_UNLOCK()	__lock_release_recursive(&__lock___libc_recursive_mutex)
 __LOCK_INIT_RECURSIVE(__libc_recursive_mutex)
 
+/*
+ * Subsystems with their own global state use separate locks so that
+ * unrelated calls don't contend. The environment and timezone locks
+ * may also be taken shared by code which only reads that state.
+ */
+#define __MALLOC_LOCK()		__lock_optional(__lock_acquire_recursive, __lock_acquire_recursive, __malloc_recursive_mutex)
+#define __MALLOC_UNLOCK()	__lock_optional(__lock_release_recursive, __lock_release_recursive, __malloc_recursive_mutex)
+__LOCK_INIT_OPTIONAL(__malloc_recursive_mutex)
+
+#define __ATEXIT_LOCK()		__lock_optional(__lock_acquire_recursive, __lock_acquire_recursive, __atexit_recursive_mutex)
+#define __ATEXIT_UNLOCK()	__lock_optional(__lock_release_recursive, __lock_release_recursive, __atexit_recursive_mutex)
+__LOCK_INIT_OPTIONAL(__atexit_recursive_mutex)
+
+#define __ARC4RANDOM_LOCK()	__lock_optional(__lock_acquire, __lock_acquire_recursive, __arc4random_mutex)
+#define __ARC4RANDOM_UNLOCK()	__lock_optional(__lock_release, __lock_release_recursive, __arc4random_mutex)
+__LOCK_INIT_OPTIONAL(__arc4random_mutex)
+
+#define __ENV_LOCK()		__lock_optional(__lock_acquire, __lock_acquire_recursive, __env_mutex)
+#define __ENV_UNLOCK()		__lock_optional(__lock_release, __lock_release_recursive, __env_mutex)
+#define __ENV_LOCK_SHARED()	__lock_optional(__lock_acquire_shared, __lock_acquire_recursive, __env_mutex)
+#define __ENV_UNLOCK_SHARED()	__lock_optional(__lock_release_shared, __lock_release_recursive, __env_mutex)
+__LOCK_INIT_OPTIONAL(__env_mutex)
+
+#define __TZ_LOCK()		__lock_optional(__lock_acquire, __lock_acquire_recursive, __tz_mutex)
+#define __TZ_UNLOCK()		__lock_optional(__lock_release, __lock_release_recursive, __tz_mutex)
+#define __TZ_LOCK_SHARED()	__lock_optional(__lock_acquire_shared, __lock_acquire_recursive, __tz_mutex)
+#define __TZ_UNLOCK_SHARED()	__lock_optional(__lock_release_shared, __lock_release_recursive, __tz_mutex)
+__LOCK_INIT_OPTIONAL(__tz_mutex)
+
 #endif /* __SYS_LOCK_H__ */
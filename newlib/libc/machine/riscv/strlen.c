@@ -12,6 +12,9 @@
 #include <string.h>
 #include <stdint.h>
 
+#ifndef __riscv_vector
+/* With the V extension, strlen is defined in strlen-rvv.S */
+
 size_t strlen(const char *str)
 {
   const char *start = str;
@@ -51,3 +54,4 @@ size_t strlen(const char *str)
   return ret + 7 - sl;
 #endif /* not PREFER_SIZE_OVER_SPEED */
 }
+#endif
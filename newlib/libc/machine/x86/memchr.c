@@ -1,3 +1,71 @@
-#ifdef __x86_64
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2022 Keith Packard
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "x86-simd.h"
+
+#ifdef X86_SIMD
+
+#include <string.h>
+
+void *
+memchr(const void *src, int c, size_t length)
+{
+    const unsigned char *s = src;
+    size_t off = (uintptr_t) s & (X86_VEC - 1);
+    x86_vec cv = x86_splat(c);
+    unsigned mask;
+    size_t pos;
+
+    if (!length)
+        return NULL;
+
+    /* The aligned vector containing 's' can't cross into another page */
+    mask = x86_match(x86_load_aligned(s), cv) >> off;
+    pos = 0;
+    for (;;) {
+        if (mask) {
+            pos += __builtin_ctz(mask);
+            return pos < length ? (void *) (s + pos) : NULL;
+        }
+        pos += pos ? X86_VEC : X86_VEC - off;
+        if (pos >= length)
+            return NULL;
+        mask = x86_match(*(const x86_vec *) (s + pos), cv);
+    }
+}
+
+#else
 #include "../../string/memchr.c"
 #endif
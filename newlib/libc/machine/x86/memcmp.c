@@ -1,3 +1,135 @@
-#ifdef __x86_64
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2022 Keith Packard
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "x86-simd.h"
+
+#ifdef X86_SIMD
+
+#include <string.h>
+
+/* Compare eight bytes, returning the difference of the first unequal pair */
+static inline int
+cmp8(const unsigned char *a, const unsigned char *b)
+{
+    uint64_t x = *(const x86_u64u *) a;
+    uint64_t y = *(const x86_u64u *) b;
+
+    if (x == y)
+        return 0;
+    a += __builtin_ctzll(x ^ y) >> 3;
+    b += __builtin_ctzll(x ^ y) >> 3;
+    return *a - *b;
+}
+
+static inline int
+cmp4(const unsigned char *a, const unsigned char *b)
+{
+    uint32_t x = *(const x86_u32u *) a;
+    uint32_t y = *(const x86_u32u *) b;
+
+    if (x == y)
+        return 0;
+    a += __builtin_ctz(x ^ y) >> 3;
+    b += __builtin_ctz(x ^ y) >> 3;
+    return *a - *b;
+}
+
+int
+memcmp(const void *m1, const void *m2, size_t n)
+{
+    const unsigned char *a = m1;
+    const unsigned char *b = m2;
+    unsigned mask;
+    int r;
+
+    if (n >= X86_VEC) {
+        size_t pos = 0;
+
+        for (;;) {
+            mask = x86_match(x86_load(a + pos), x86_load(b + pos)) ^ X86_VEC_ALL;
+            if (mask) {
+                pos += __builtin_ctz(mask);
+                return a[pos] - b[pos];
+            }
+            pos += X86_VEC;
+            if (pos >= n)
+                return 0;
+            /* Finish with a vector overlapping the previous one */
+            if (n - pos < X86_VEC)
+                pos = n - X86_VEC;
+        }
+    }
+
+#ifdef __AVX2__
+    if (n >= 16) {
+        x86_v16 x = *(const x86_v16u *) a;
+        x86_v16 y = *(const x86_v16u *) b;
+        size_t pos = 0;
+
+        mask = (unsigned) __builtin_ia32_pmovmskb128(x == y) ^ 0xffff;
+        if (!mask) {
+            pos = n - 16;
+            x = *(const x86_v16u *) (a + pos);
+            y = *(const x86_v16u *) (b + pos);
+            mask = (unsigned) __builtin_ia32_pmovmskb128(x == y) ^ 0xffff;
+            if (!mask)
+                return 0;
+        }
+        pos += __builtin_ctz(mask);
+        return a[pos] - b[pos];
+    }
+#endif
+    if (n >= 8) {
+        if ((r = cmp8(a, b)) != 0)
+            return r;
+        return cmp8(a + n - 8, b + n - 8);
+    }
+    if (n >= 4) {
+        if ((r = cmp4(a, b)) != 0)
+            return r;
+        return cmp4(a + n - 4, b + n - 4);
+    }
+    while (n--) {
+        if (*a != *b)
+            return *a - *b;
+        a++;
+        b++;
+    }
+    return 0;
+}
+
+#else
 #include "../../string/memcmp.c"
 #endif
@@ -0,0 +1,99 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "x86-simd.h"
+
+#ifdef X86_SIMD
+
+#include <string.h>
+
+void *
+__inhibit_loop_to_libcall
+memset(void *m, int c, size_t n)
+{
+    unsigned char *d = m;
+    x86_vec v = x86_splat(c);
+    unsigned char *p, *end;
+
+    if (n <= 2 * X86_VEC) {
+        /* Cover the range with two possibly overlapping stores */
+        if (n >= X86_VEC) {
+            x86_store(d, v);
+            x86_store(d + n - X86_VEC, v);
+#ifdef __AVX2__
+        } else if (n >= 16) {
+            x86_v16 v16 = { 0 };
+            v16 += (char) c;
+            *(x86_v16u *) d = v16;
+            *(x86_v16u *) (d + n - 16) = v16;
+#endif
+        } else if (n >= 8) {
+            uint64_t w = (uint64_t) (unsigned char) c * 0x0101010101010101ULL;
+            *(x86_u64u *) d = w;
+            *(x86_u64u *) (d + n - 8) = w;
+        } else if (n >= 4) {
+            uint32_t w = (uint32_t) (unsigned char) c * 0x01010101U;
+            *(x86_u32u *) d = w;
+            *(x86_u32u *) (d + n - 4) = w;
+        } else if (n) {
+            d[0] = c;
+            d[n >> 1] = c;
+            d[n - 1] = c;
+        }
+        return m;
+    }
+
+    /* Unaligned ends, aligned stores in between */
+    x86_store(d, v);
+    end = d + n - X86_VEC;
+    p = (unsigned char *) (((uintptr_t) d + X86_VEC) & ~(uintptr_t) (X86_VEC - 1));
+    while (end - p >= 4 * X86_VEC) {
+        *(x86_vec *) p = v;
+        *(x86_vec *) (p + X86_VEC) = v;
+        *(x86_vec *) (p + 2 * X86_VEC) = v;
+        *(x86_vec *) (p + 3 * X86_VEC) = v;
+        p += 4 * X86_VEC;
+    }
+    while (p < end) {
+        *(x86_vec *) p = v;
+        p += X86_VEC;
+    }
+    x86_store(end, v);
+    return m;
+}
+
+#else
+#include "../../string/memset.c"
+#endif
@@ -0,0 +1,77 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "x86-simd.h"
+
+#ifdef X86_SIMD
+
+#include <string.h>
+
+int
+strcmp(const char *s1, const char *s2)
+{
+    const unsigned char *a = (const unsigned char *) s1;
+    const unsigned char *b = (const unsigned char *) s2;
+    x86_vec zero = x86_splat(0);
+
+    for (;;) {
+        /*
+         * The strings may end anywhere, so step a byte at a time
+         * while a vector load could reach into the next page
+         */
+        if (x86_crosses_page(a) || x86_crosses_page(b)) {
+            if (*a != *b || !*a)
+                return *a - *b;
+            a++;
+            b++;
+            continue;
+        }
+
+        x86_vec va = x86_load(a);
+        x86_vec vb = x86_load(b);
+        unsigned mask = (x86_match(va, vb) ^ X86_VEC_ALL) | x86_match(va, zero);
+
+        if (mask) {
+            unsigned i = __builtin_ctz(mask);
+            return a[i] - b[i];
+        }
+        a += X86_VEC;
+        b += X86_VEC;
+    }
+}
+
+#else
+#include "../../string/strcmp.c"
+#endif
@@ -0,0 +1,76 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "x86-simd.h"
+
+#ifdef X86_SIMD
+
+#include <string.h>
+
+/* Index of the highest bit set in a non-zero mask */
+#define HIGHEST(m)	((int) (sizeof(unsigned) * 8 - 1) - __builtin_clz(m))
+
+char *
+strrchr(const char *s, int c)
+{
+    size_t off = (uintptr_t) s & (X86_VEC - 1);
+    const char *p = s - off;
+    const char *last = NULL;
+    x86_vec cv = x86_splat(c);
+    x86_vec zero = x86_splat(0);
+    unsigned keep = X86_VEC_ALL << off;
+
+    for (;;) {
+        x86_vec v = *(const x86_vec *) p;
+        unsigned zmask = x86_match(v, zero) & keep;
+        unsigned cmask = x86_match(v, cv) & keep;
+
+        if (zmask) {
+            /* Only matches up to and including the terminator count */
+            cmask &= zmask ^ (zmask - 1);
+            if (cmask)
+                return (char *) p + HIGHEST(cmask);
+            return (char *) last;
+        }
+        if (cmask)
+            last = p + HIGHEST(cmask);
+        keep = X86_VEC_ALL;
+        p += X86_VEC;
+    }
+}
+
+#else
+#include "../../string/strrchr.c"
+#endif
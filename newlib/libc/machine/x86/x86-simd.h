@@ -0,0 +1,235 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _X86_SIMD_H_
+#define _X86_SIMD_H_
+
+/*
+ * Vector helpers for the x86 string functions. The vector width is
+ * chosen when the library is compiled: 32 bytes when -march enables
+ * AVX2, 16 bytes when it enables SSE2 (always the case on x86_64),
+ * otherwise the generic C versions are used.
+ */
+
+#if defined(__SSE2__) && !defined(PREFER_SIZE_OVER_SPEED) && !defined(__OPTIMIZE_SIZE__)
+
+#define X86_SIMD
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/cdefs.h>
+
+typedef char x86_v16 __attribute__((vector_size(16), __may_alias__));
+typedef char x86_v16u __attribute__((vector_size(16), __may_alias__, aligned(1)));
+
+#ifdef __AVX2__
+#define X86_VEC 32
+typedef char x86_vec __attribute__((vector_size(32), __may_alias__));
+typedef char x86_vecu __attribute__((vector_size(32), __may_alias__, aligned(1)));
+#define x86_vec_mask(v)	((unsigned) __builtin_ia32_pmovmskb256(v))
+#else
+#define X86_VEC 16
+typedef x86_v16 x86_vec;
+typedef x86_v16u x86_vecu;
+#define x86_vec_mask(v)	((unsigned) __builtin_ia32_pmovmskb128(v))
+#endif
+
+/* Mask with one bit set for every byte in a vector */
+#define X86_VEC_ALL	((unsigned) (((uint64_t) 1 << X86_VEC) - 1))
+
+/*
+ * Loads that can't fault past the end of a string must not cross
+ * a page boundary; x86 pages are at least this large
+ */
+#define X86_PAGE_SIZE	4096
+
+typedef uint64_t x86_u64u __attribute__((__may_alias__, aligned(1)));
+typedef uint32_t x86_u32u __attribute__((__may_alias__, aligned(1)));
+typedef uint16_t x86_u16u __attribute__((__may_alias__, aligned(1)));
+
+/* Aligned load of the vector containing 'p' */
+static inline x86_vec
+x86_load_aligned(const void *p)
+{
+    return *(const x86_vec *) ((uintptr_t) p & ~(uintptr_t) (X86_VEC - 1));
+}
+
+static inline x86_vec
+x86_load(const void *p)
+{
+    return *(const x86_vecu *) p;
+}
+
+static inline void
+x86_store(void *p, x86_vec v)
+{
+    *(x86_vecu *) p = v;
+}
+
+/* Vector with every byte set to 'c' */
+static inline x86_vec
+x86_splat(int c)
+{
+    x86_vec v = { 0 };
+    return v + (char) c;
+}
+
+/* Bit mask of bytes in 'v' equal to 'c' */
+static inline unsigned
+x86_match(x86_vec v, x86_vec c)
+{
+    return x86_vec_mask(v == c);
+}
+
+/* Whether an unaligned vector load from 'p' could touch the next page */
+static inline int
+x86_crosses_page(const void *p)
+{
+    return ((uintptr_t) p & (X86_PAGE_SIZE - 1)) > X86_PAGE_SIZE - X86_VEC;
+}
+
+/*
+ * Copy 'n' bytes, for n <= 2 * X86_VEC. All of the source is read
+ * before any of the destination is written, so the buffers may
+ * overlap.
+ */
+static inline void
+x86_copy_small(unsigned char *d, const unsigned char *s, size_t n)
+{
+    if (n >= X86_VEC) {
+        x86_vec a = x86_load(s);
+        x86_vec b = x86_load(s + n - X86_VEC);
+        x86_store(d, a);
+        x86_store(d + n - X86_VEC, b);
+#ifdef __AVX2__
+    } else if (n >= 16) {
+        x86_v16 a = *(const x86_v16u *) s;
+        x86_v16 b = *(const x86_v16u *) (s + n - 16);
+        *(x86_v16u *) d = a;
+        *(x86_v16u *) (d + n - 16) = b;
+#endif
+    } else if (n >= 8) {
+        uint64_t a = *(const x86_u64u *) s;
+        uint64_t b = *(const x86_u64u *) (s + n - 8);
+        *(x86_u64u *) d = a;
+        *(x86_u64u *) (d + n - 8) = b;
+    } else if (n >= 4) {
+        uint32_t a = *(const x86_u32u *) s;
+        uint32_t b = *(const x86_u32u *) (s + n - 4);
+        *(x86_u32u *) d = a;
+        *(x86_u32u *) (d + n - 4) = b;
+    } else if (n) {
+        unsigned char a = s[0];
+        unsigned char b = s[n >> 1];
+        unsigned char c = s[n - 1];
+        d[0] = a;
+        d[n >> 1] = b;
+        d[n - 1] = c;
+    }
+}
+
+/*
+ * Copy 'n' bytes, n > 2 * X86_VEC, from low to high addresses, with
+ * aligned stores. Safe when 'd' is below 's' even if they overlap.
+ */
+static inline void
+x86_copy_forward(unsigned char *d, const unsigned char *s, size_t n)
+{
+    x86_vec head = x86_load(s);
+    x86_vec tail = x86_load(s + n - X86_VEC);
+    unsigned char *end = d + n - X86_VEC;
+    size_t skip = X86_VEC - ((uintptr_t) d & (X86_VEC - 1));
+    unsigned char *dst = d + skip;
+    const unsigned char *src = s + skip;
+
+    while (end - dst >= 4 * X86_VEC) {
+        x86_vec a = x86_load(src);
+        x86_vec b = x86_load(src + X86_VEC);
+        x86_vec c = x86_load(src + 2 * X86_VEC);
+        x86_vec e = x86_load(src + 3 * X86_VEC);
+        *(x86_vec *) dst = a;
+        *(x86_vec *) (dst + X86_VEC) = b;
+        *(x86_vec *) (dst + 2 * X86_VEC) = c;
+        *(x86_vec *) (dst + 3 * X86_VEC) = e;
+        dst += 4 * X86_VEC;
+        src += 4 * X86_VEC;
+    }
+    while (dst < end) {
+        *(x86_vec *) dst = x86_load(src);
+        dst += X86_VEC;
+        src += X86_VEC;
+    }
+    x86_store(d, head);
+    x86_store(end, tail);
+}
+
+/*
+ * Copy 'n' bytes, n > 2 * X86_VEC, from high to low addresses. Safe
+ * when 'd' is above 's' even if they overlap.
+ */
+static inline void
+x86_copy_backward(unsigned char *d, const unsigned char *s, size_t n)
+{
+    x86_vec head = x86_load(s);
+    x86_vec tail = x86_load(s + n - X86_VEC);
+    size_t skip = (uintptr_t) (d + n) & (X86_VEC - 1);
+    unsigned char *dst = d + n - skip;
+    const unsigned char *src = s + n - skip;
+    unsigned char *start = d + X86_VEC;
+
+    while (dst - start >= 4 * X86_VEC) {
+        x86_vec a = x86_load(src - X86_VEC);
+        x86_vec b = x86_load(src - 2 * X86_VEC);
+        x86_vec c = x86_load(src - 3 * X86_VEC);
+        x86_vec e = x86_load(src - 4 * X86_VEC);
+        *(x86_vec *) (dst - X86_VEC) = a;
+        *(x86_vec *) (dst - 2 * X86_VEC) = b;
+        *(x86_vec *) (dst - 3 * X86_VEC) = c;
+        *(x86_vec *) (dst - 4 * X86_VEC) = e;
+        dst -= 4 * X86_VEC;
+        src -= 4 * X86_VEC;
+    }
+    while (dst > start) {
+        dst -= X86_VEC;
+        src -= X86_VEC;
+        *(x86_vec *) dst = x86_load(src);
+    }
+    x86_store(d + n - X86_VEC, tail);
+    x86_store(d, head);
+}
+
+#endif /* __SSE2__ */
+
+#endif /* _X86_SIMD_H_ */
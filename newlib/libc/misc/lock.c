@@ -1,8 +1,10 @@
 /* Copyright (c) 2016 Thomas Preud'homme <thomas.preudhomme@arm.com> */
 /*
 FUNCTION
-<<__retarget_lock_init>>, <<__retarget_lock_init_recursive>>, <<__retarget_lock_close>>, <<__retarget_lock_close_recursive>>, <<__retarget_lock_acquire>>, <<__retarget_lock_acquire_recursive>>, <<__retarget_lock_try_acquire>>, <<__retarget_lock_try_acquire_recursive>>, <<__retarget_lock_release>>, <<__retarget_lock_release_recursive>>---locking routines
+<<__retarget_lock_init>>, <<__retarget_lock_init_recursive>>, <<__retarget_lock_close>>, <<__retarget_lock_close_recursive>>, <<__retarget_lock_acquire>>, <<__retarget_lock_acquire_recursive>>, <<__retarget_lock_try_acquire>>, <<__retarget_lock_try_acquire_recursive>>, <<__retarget_lock_release>>, <<__retarget_lock_release_recursive>>, <<__retarget_lock_acquire_shared>>, <<__retarget_lock_release_shared>>---locking routines
 
+INDEX
+	__lock___libc_recursive_mutex
 INDEX
 	__lock___sfp_recursive_mutex
 INDEX
@@ -12,7 +14,7 @@ INDEX
 INDEX
 	__lock___malloc_recursive_mutex
 INDEX
-	__lock___env_recursive_mutex
+	__lock___env_mutex
 INDEX
 	__lock___tz_mutex
 INDEX
@@ -38,14 +40,19 @@ INDEX
 	__retarget_lock_release
 INDEX
 	__retarget_lock_release_recursive
+INDEX
+	__retarget_lock_acquire_shared
+INDEX
+	__retarget_lock_release_shared
 
 SYNOPSIS
 	#include <lock.h>
+	struct __lock __lock___libc_recursive_mutex;
 	struct __lock __lock___sfp_recursive_mutex;
 	struct __lock __lock___atexit_recursive_mutex;
 	struct __lock __lock___at_quick_exit_mutex;
 	struct __lock __lock___malloc_recursive_mutex;
-	struct __lock __lock___env_recursive_mutex;
+	struct __lock __lock___env_mutex;
 	struct __lock __lock___tz_mutex;
 	struct __lock __lock___arc4random_mutex;
 
@@ -59,6 +66,8 @@ SYNOPSIS
 	int __retarget_lock_try_acquire_recursive (_LOCK_T <[lock]>);
 	void __retarget_lock_release (_LOCK_T <[lock]>);
 	void __retarget_lock_release_recursive (_LOCK_T <[lock]>);
+	void __retarget_lock_acquire_shared (_LOCK_T <[lock]>);
+	void __retarget_lock_release_shared (_LOCK_T <[lock]>);
 
 DESCRIPTION
 Newlib was configured to allow the target platform to provide the locking
@@ -68,9 +77,26 @@ single-threaded application to link successfully out of the box on bare-metal
 systems.
 
 For multi-threaded applications the target platform is required to provide
-an implementation for @strong{all} these routines and static locks.  If some
-routines or static locks are missing, the link will fail with doubly defined
-symbols.
+an implementation for @strong{all} these routines and
+<<__lock___libc_recursive_mutex>>.  If some are missing, the link will fail
+with doubly defined symbols.
+
+The malloc, atexit, arc4random, env and tz static locks are optional; libc
+references them weakly and uses <<__lock___libc_recursive_mutex>> with the
+recursive routines in place of any that the platform does not define.
+
+<<__lock___sfp_recursive_mutex>>, which guards the legacy stdio list of
+open files, and <<__lock___at_quick_exit_mutex>>, which guards the
+at_quick_exit handlers, are not separate locks in picolibc: both are
+covered by <<__lock___libc_recursive_mutex>>, so platforms need not
+define them.
+
+The exception is <<__retarget_lock_acquire_shared>> and
+<<__retarget_lock_release_shared>>, which take a non-recursive lock on
+behalf of a reader. Their default implementation simply uses
+<<__retarget_lock_acquire>> and <<__retarget_lock_release>>; platforms
+with reader/writer locks may provide them to let readers of the
+environment and timezone state run concurrently.
 
 PORTABILITY
 These locking routines and static lock are newlib-specific.  Supporting OS
@@ -88,6 +114,11 @@ struct __lock {
 };
 
 struct __lock __lock___libc_recursive_mutex;
+struct __lock __lock___atexit_recursive_mutex;
+struct __lock __lock___malloc_recursive_mutex;
+struct __lock __lock___env_mutex;
+struct __lock __lock___tz_mutex;
+struct __lock __lock___arc4random_mutex;
 
 void
 __retarget_lock_init (_LOCK_T *lock)
@@ -50,7 +50,6 @@ __RCSID("$NetBSD: hcreate.c,v 1.2 2001/02/19 21:26:04 ross Exp $");
 #endif
 
 #include <sys/types.h>
-#include <sys/queue.h>
 #include <errno.h>
 #include <search.h>
 #include <stdlib.h>
@@ -61,14 +60,22 @@ __RCSID("$NetBSD: hcreate.c,v 1.2 2001/02/19 21:26:04 ross Exp $");
 #include "extern.h"
 
 /*
+ * The table is open addressed with linear probing and Robin Hood
+ * insertion: an entry that is further from its home slot than the
+ * one occupying a slot takes that slot over, and the displaced
+ * entry continues along the probe sequence. That keeps probe
+ * lengths short and lets a search stop as soon as it meets an entry
+ * closer to home than the key would be. Entries are stored inline,
+ * along with their hash so that most mismatches are rejected
+ * without calling strcmp. A slot is empty when its key is NULL.
+ *
  * DO NOT MAKE THIS STRUCTURE LARGER THAN 32 BYTES (4 ptrs on 64-bit
  * ptr machine) without adjusting MAX_BUCKETS_LG2 below.
  */
 struct internal_entry {
-	SLIST_ENTRY(internal_entry) link;
 	ENTRY ent;
+	__uint32_t hash;
 };
-SLIST_HEAD(internal_head, internal_entry);
 
 #define	MIN_BUCKETS_LG2	4
 #define	MIN_BUCKETS	(1 << MIN_BUCKETS_LG2)
@@ -85,11 +92,85 @@ SLIST_HEAD(internal_head, internal_entry);
 #endif
 #define	MAX_BUCKETS	((size_t)1 << MAX_BUCKETS_LG2)
 
+/* The table is doubled once it would become more than 3/4 full */
+#define	MAX_FILLED(size)	((size) - (size) / 4)
+
+/* Distance of the entry in slot 'idx' from its home slot */
+#define	PROBE_DIST(ie, idx, mask)	(((idx) - ((ie)->hash & (mask))) & (mask))
+
+static struct internal_entry *
+alloc_table(size_t size)
+{
+	return calloc(size, sizeof (struct internal_entry));
+}
+
+/*
+ * Place 'item' at slot 'idx', which is 'dist' slots from its home,
+ * pushing any entries that are closer to their own home further
+ * along. Returns the slot holding 'item'.
+ */
+static ENTRY *
+insert_entry(struct internal_entry *table, size_t mask, size_t idx, size_t dist,
+	     ENTRY item, __uint32_t hash)
+{
+	struct internal_entry *ret = &table[idx];
+	struct internal_entry cur = { item, hash };
+
+	while (table[idx].ent.key != NULL) {
+		size_t edist = PROBE_DIST(&table[idx], idx, mask);
+
+		if (edist < dist) {
+			struct internal_entry tmp = table[idx];
+
+			table[idx] = cur;
+			cur = tmp;
+			dist = edist;
+		}
+		idx = (idx + 1) & mask;
+		dist++;
+	}
+	table[idx] = cur;
+	return &ret->ent;
+}
+
+/* Move every entry into a table twice the size */
+static int
+grow_table(struct hsearch_data *htab)
+{
+	struct internal_entry *old = htab->htable, *table;
+	size_t oldsize = htab->htablesize;
+	size_t size = oldsize * 2, mask = size - 1;
+	size_t i;
+
+	if (oldsize >= MAX_BUCKETS)
+		return 0;
+	table = alloc_table(size);
+	if (table == NULL)
+		return 0;
+
+	for (i = 0; i < oldsize; i++) {
+		size_t idx, dist = 0;
+
+		if (old[i].ent.key == NULL)
+			continue;
+		idx = old[i].hash & mask;
+		while (table[idx].ent.key != NULL &&
+		       PROBE_DIST(&table[idx], idx, mask) >= dist) {
+			idx = (idx + 1) & mask;
+			dist++;
+		}
+		insert_entry(table, mask, idx, dist, old[i].ent, old[i].hash);
+	}
+	free(old);
+	htab->htable = table;
+	htab->htablesize = size;
+	return 1;
+}
+
 int
 hcreate_r(size_t nel, struct hsearch_data *htab)
 {
-	size_t idx;
-	unsigned int p2;
+	size_t size;
 
 	/* Make sure this this isn't called when a table already exists. */
 	if (htab->htable != NULL) {
@@ -97,32 +178,22 @@ hcreate_r(size_t nel, struct hsearch_data *htab)
 		return 0;
 	}
 
-	/* If nel is too small, make it min sized. */
-	if (nel < MIN_BUCKETS)
-		nel = MIN_BUCKETS;
-
 	/* If it's too large, cap it. */
-	if (nel > MAX_BUCKETS)
-		nel = MAX_BUCKETS;
-
-	/* If it's is not a power of two in size, round up. */
-	if ((nel & (nel - 1)) != 0) {
-		for (p2 = 0; nel != 0; p2++)
-			nel >>= 1;
-		nel = 1 << p2;
-	}
-	
+	if (nel > MAX_FILLED(MAX_BUCKETS))
+		nel = MAX_FILLED(MAX_BUCKETS);
+
+	/* Round up to a power of two that holds nel entries. */
+	for (size = MIN_BUCKETS; MAX_FILLED(size) < nel; size <<= 1)
+		;
+
 	/* Allocate the table. */
-	htab->htablesize = nel;
-	htab->htable = malloc(htab->htablesize * sizeof htab->htable[0]);
+	htab->htable = alloc_table(size);
 	if (htab->htable == NULL) {
 		errno = ENOMEM;
 		return 0;
 	}
-
-	/* Initialize it. */
-	for (idx = 0; idx < htab->htablesize; idx++)
-		SLIST_INIT(&(htab->htable[idx]));
+	htab->htablesize = size;
+	htab->hfilled = 0;
 
 	return 1;
 }
@@ -130,23 +201,13 @@ hcreate_r(size_t nel, struct hsearch_data *htab)
 void
 hdestroy_r(struct hsearch_data *htab)
 {
-#if 0
-	struct internal_entry *ie;
-	size_t idx;
-#endif
 	if (htab->htable == NULL)
 		return;
 
-#if 0
-	for (idx = 0; idx < htab->htablesize; idx++) {
-		while (!SLIST_EMPTY(&(htab->htable[idx]))) {
-			ie = SLIST_FIRST(&(htab->htable[idx]));
-			SLIST_REMOVE_HEAD(&(htab->htable[idx]), link);
-                        free(ie->ent.key);
-			free(ie);
-		}
-	}
-#endif
+	/*
+	 * The keys belong to the application, which may still be
+	 * using them, so only the table itself is freed.
+	 */
 	free(htab->htable);
 	htab->htable = NULL;
 }
@@ -154,43 +215,44 @@ hdestroy_r(struct hsearch_data *htab)
 int
 hsearch_r(ENTRY item, ACTION action, ENTRY **retval, struct hsearch_data *htab)
 {
-	struct internal_head *head;
 	struct internal_entry *ie;
 	__uint32_t hashval;
-	size_t len;
+	size_t mask, idx, dist;
 
-	len = strlen(item.key);
-	hashval = __default_hash(item.key, len);
+	hashval = __default_hash(item.key, strlen(item.key));
 
-        head = &(htab->htable[hashval & (htab->htablesize - 1)]);
-	ie = SLIST_FIRST(head);
-	while (ie != NULL) {
-		if (strcmp(ie->ent.key, item.key) == 0)
+	for (;;) {
+		mask = htab->htablesize - 1;
+		idx = hashval & mask;
+		for (dist = 0; ; dist++, idx = (idx + 1) & mask) {
+			ie = &htab->htable[idx];
+			if (ie->ent.key == NULL || PROBE_DIST(ie, idx, mask) < dist)
+				break;
+			if (ie->hash == hashval && strcmp(ie->ent.key, item.key) == 0) {
+				*retval = &ie->ent;
+				return 1;
+			}
+		}
+
+		if (action == FIND) {
+			*retval = NULL;
+			return 0;
+		}
+
+		/* Grow when full, then search for the insertion point again */
+		if (htab->hfilled < MAX_FILLED(htab->htablesize))
 			break;
-		ie = SLIST_NEXT(ie, link);
+		if (!grow_table(htab)) {
+			/* Keep at least one slot empty so probes terminate */
+			if (htab->hfilled < htab->htablesize - 1)
+				break;
+			errno = ENOMEM;
+			*retval = NULL;
+			return 0;
+		}
 	}
 
-	if (ie != NULL)
-          {
-            *retval = &ie->ent;
-            return 1;
-          }
-	else if (action == FIND)
-          {
-            *retval = NULL;
-            return 0;
-          }
-
-	ie = malloc(sizeof *ie);
-	if (ie == NULL)
-          {
-            *retval = NULL;
-            return 0;
-          }
-	ie->ent.key = item.key;
-	ie->ent.data = item.data;
-
-	SLIST_INSERT_HEAD(head, ie, link);
-        *retval = &ie->ent;
+	htab->hfilled++;
+	*retval = insert_entry(htab->htable, mask, idx, dist, item, hashval);
 	return 1;
 }
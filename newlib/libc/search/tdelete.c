@@ -58,37 +58,50 @@ tdelete (const void *__restrict vkey,	/* key to be deleted */
 	void      **__restrict vrootp,	/* address of the root of tree */
 	int       (*compar)(const void *, const void *))
 {
-	node_t **rootp = (node_t **)vrootp;
+	node_t **path[__TSEARCH_MAX_HEIGHT + 1];
 	node_t *p, *q, *r;
-	int  cmp;
+	int  cmp, depth = 0, d;
 
-	if (rootp == NULL || (p = *rootp) == NULL)
+	if (vrootp == NULL || *vrootp == NULL)
 		return NULL;
 
-	while ((cmp = (*compar)(vkey, (*rootp)->key)) != 0) {
-		p = *rootp;
-		rootp = (cmp < 0) ?
-		    &(*rootp)->llink :		/* follow llink branch */
-		    &(*rootp)->rlink;		/* follow rlink branch */
-		if (*rootp == NULL)
+	path[depth++] = (node_t **)vrootp;
+	while ((cmp = (*compar)(vkey, (*path[depth-1])->key)) != 0) {
+		q = *path[depth-1];
+		path[depth++] = (cmp < 0) ?
+		    &q->llink :			/* follow llink branch */
+		    &q->rlink;			/* follow rlink branch */
+		if (*path[depth-1] == NULL)
 			return NULL;		/* key not found */
 	}
-	r = (*rootp)->rlink;			/* D1: */
-	if ((q = (*rootp)->llink) == NULL)	/* Left NULL? */
-		q = r;
-	else if (r != NULL) {			/* Right link is NULL? */
-		if (r->llink == NULL) {		/* D2: Find successor */
-			r->llink = q;
-			q = r;
-		} else {			/* D3: Find NULL link */
-			for (q = r->llink; q->llink != NULL; q = r->llink)
-				r = q;
-			r->llink = q->rlink;
-			q->llink = (*rootp)->llink;
-			q->rlink = (*rootp)->rlink;
-		}
+
+	/*
+	 * Return the parent, or some non-NULL value when deleting the
+	 * root. Rebalancing may move the parent, but never frees it.
+	 */
+	d = depth - 1;
+	p = d > 0 ? *path[d-1] : (node_t *) vrootp;
+	q = *path[d];
+
+	if (q->llink == NULL) {
+		*path[d] = q->rlink;		/* D1: splice out node */
+		depth = d;
+	} else {
+		/* D2: replace node with its in-order predecessor */
+		path[depth++] = &q->llink;
+		for (r = q->llink; r->rlink != NULL; r = r->rlink)
+			path[depth++] = &r->rlink;
+		*path[--depth] = r->llink;
+		r->llink = q->llink;
+		r->rlink = q->rlink;
+		r->height = q->height;
+		*path[d] = r;
+		path[d+1] = &r->llink;
 	}
-	free(*rootp);				/* D4: Free node */
-	*rootp = q;				/* link parent to new node */
+	free(q);				/* D4: Free node */
+
+	/* rebalance up to the first subtree whose height is unchanged */
+	while (depth > 0 && __tsearch_balance(path[--depth]))
+		;
 	return p;
 }
@@ -51,6 +51,72 @@ __RCSID("$NetBSD: tsearch.c,v 1.3 1999/09/16 11:45:37 lukem Exp $");
 #include <search.h>
 #include <stdlib.h>
 
+static inline int
+height(const node_t *n)
+{
+	return n ? n->height : 0;
+}
+
+static void
+fix_height(node_t *n)
+{
+	int hl = height(n->llink), hr = height(n->rlink);
+
+	n->height = (hl > hr ? hl : hr) + 1;
+}
+
+/* Rotate the subtree at *p, lifting its left child */
+static void
+rotate_right(node_t **p)
+{
+	node_t *x = *p, *y = x->llink;
+
+	x->llink = y->rlink;
+	y->rlink = x;
+	fix_height(x);
+	fix_height(y);
+	*p = y;
+}
+
+/* Rotate the subtree at *p, lifting its right child */
+static void
+rotate_left(node_t **p)
+{
+	node_t *x = *p, *y = x->rlink;
+
+	x->rlink = y->llink;
+	y->llink = x;
+	fix_height(x);
+	fix_height(y);
+	*p = y;
+}
+
+/*
+ * Restore the AVL invariant at *p after one of its subtrees has
+ * changed height by one. Returns non-zero when the height of the
+ * subtree at *p differs from the one recorded before the change, in
+ * which case the caller must continue towards the root.
+ */
+int
+__tsearch_balance(node_t **p)
+{
+	node_t *n = *p;
+	int old = n->height;
+	int hl = height(n->llink), hr = height(n->rlink);
+
+	if (hl - hr > 1) {
+		if (height(n->llink->rlink) > height(n->llink->llink))
+			rotate_left(&n->llink);
+		rotate_right(p);
+	} else if (hr - hl > 1) {
+		if (height(n->rlink->llink) > height(n->rlink->rlink))
+			rotate_right(&n->rlink);
+		rotate_left(p);
+	} else
+		fix_height(n);
+	return (*p)->height != old;
+}
+
 /* find or insert datum into search tree */
 void *
 tsearch (const void *vkey,		/* key to be located */
@@ -58,28 +124,35 @@ tsearch (const void *vkey,		/* key to be located */
 	int (*compar)(const void *, const void *))
 {
 	node_t *q;
-	node_t **rootp = (node_t **)vrootp;
+	node_t **path[__TSEARCH_MAX_HEIGHT + 1];
+	int depth = 0;
 
-	if (rootp == NULL)
+	if (vrootp == NULL)
 		return NULL;
 
-	while (*rootp != NULL) {	/* Knuth's T1: */
+	path[depth++] = (node_t **)vrootp;
+	while ((q = *path[depth-1]) != NULL) {	/* Knuth's T1: */
 		int r;
 
-		if ((r = (*compar)(vkey, (*rootp)->key)) == 0)	/* T2: */
-			return *rootp;		/* we found it! */
+		if ((r = (*compar)(vkey, q->key)) == 0)	/* T2: */
+			return q;		/* we found it! */
 
-		rootp = (r < 0) ?
-		    &(*rootp)->llink :		/* T3: follow left branch */
-		    &(*rootp)->rlink;		/* T4: follow right branch */
+		path[depth++] = (r < 0) ?
+		    &q->llink :			/* T3: follow left branch */
+		    &q->rlink;			/* T4: follow right branch */
 	}
 
 	q = malloc(sizeof(node_t));		/* T5: key not found */
 	if (q != 0) {				/* make new node */
-		*rootp = q;			/* link new node to old */
+		*path[--depth] = q;		/* link new node to old */
 		/* LINTED const castaway ok */
 		q->key = (void *)vkey;		/* initialize new node */
 		q->llink = q->rlink = NULL;
+		q->height = 1;
+
+		/* rebalance up to the first subtree whose height is unchanged */
+		while (depth > 0 && __tsearch_balance(path[--depth]))
+			;
 	}
 	return q;
 }
@@ -73,7 +73,7 @@ static char ***p_environ = &environ;
  */
 
 char *
-_findenv (
+_findenv_unlocked (
 	register const char *name,
 	int *offset)
 {
@@ -81,15 +81,10 @@ _findenv (
   register char **p;
   const char *c;
 
-  ENV_LOCK;
-
   /* In some embedded systems, this does not get set.  This protects
      newlib from dereferencing a bad pointer.  */
   if (!*p_environ)
-    {
-      ENV_UNLOCK;
-      return NULL;
-    }
+    return NULL;
 
   c = name;
   while (*c && *c != '=')  c++;
@@ -103,10 +98,21 @@ _findenv (
         if (*(c = *p + len) == '=')
 	{
 	  *offset = p - *p_environ;
-	  ENV_UNLOCK;
 	  return (char *) (++c);
 	}
     }
-  ENV_UNLOCK;
   return NULL;
 }
+
+char *
+_findenv (
+	register const char *name,
+	int *offset)
+{
+  char *value;
+
+  ENV_LOCK_SHARED;
+  value = _findenv_unlocked (name, offset);
+  ENV_UNLOCK_SHARED;
+  return value;
+}
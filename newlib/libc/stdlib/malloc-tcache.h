@@ -0,0 +1,142 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _MALLOC_TCACHE_H_
+#define _MALLOC_TCACHE_H_
+
+#include <sys/config.h>
+#include <stdint.h>
+
+/*
+ * Per-thread cache of small chunks, shared by nano-malloc and the
+ * legacy malloc. Chunks in the cache remain allocated as far as the
+ * heap is concerned; they are linked through their first payload
+ * word and sorted into bins of exactly one chunk size each, so they
+ * can be handed out again without taking the malloc lock.
+ *
+ * The cache lives in TLS, so it is only available when picolibc
+ * is built with thread local storage.
+ */
+
+/* Return this thread's cached chunks to the heap */
+void __malloc_tcache_flush(void);
+
+#if defined(_MALLOC_TCACHE) && defined(PICOLIBC_TLS)
+
+#define MALLOC_TCACHE
+
+/* Number of chunk sizes cached */
+#define MALLOC_TCACHE_BINS	16
+
+/* Chunks held in each bin before they are returned to the heap */
+#define MALLOC_TCACHE_COUNT	8
+
+struct __malloc_tcache {
+    void	*head[MALLOC_TCACHE_BINS];
+    uint8_t	count[MALLOC_TCACHE_BINS];
+};
+
+extern NEWLIB_THREAD_LOCAL struct __malloc_tcache __malloc_tcache;
+
+/* Take a chunk from 'bin', returning NULL if it is empty */
+static inline void *
+__malloc_tcache_get(unsigned bin)
+{
+    void *mem = __malloc_tcache.head[bin];
+
+    if (mem) {
+        __malloc_tcache.head[bin] = *(void **) mem;
+        __malloc_tcache.count[bin]--;
+    }
+    return mem;
+}
+
+/*
+ * Check whether 'mem' is already in 'bin', which catches double frees
+ * of cached chunks. Bins are short enough to just walk them.
+ */
+static inline int
+__malloc_tcache_has(void *mem, unsigned bin)
+{
+    void *c;
+
+    for (c = __malloc_tcache.head[bin]; c; c = *(void **) c)
+        if (c == mem)
+            return 1;
+    return 0;
+}
+
+/*
+ * Add a chunk to 'bin'. When the bin is already full, its previous
+ * contents are detached and returned so that the caller can release
+ * them to the heap in one batch.
+ */
+static inline void *
+__malloc_tcache_put(void *mem, unsigned bin)
+{
+    void *batch = NULL;
+
+    if (__malloc_tcache.count[bin] >= MALLOC_TCACHE_COUNT) {
+        batch = __malloc_tcache.head[bin];
+        __malloc_tcache.head[bin] = NULL;
+        __malloc_tcache.count[bin] = 0;
+    }
+    *(void **) mem = __malloc_tcache.head[bin];
+    __malloc_tcache.head[bin] = mem;
+    __malloc_tcache.count[bin]++;
+    return batch;
+}
+
+/* Detach every cached chunk as a single list */
+static inline void *
+__malloc_tcache_take(void)
+{
+    void *list = NULL;
+    unsigned bin;
+
+    for (bin = 0; bin < MALLOC_TCACHE_BINS; bin++) {
+        void *mem;
+
+        while ((mem = __malloc_tcache_get(bin)) != NULL) {
+            *(void **) mem = list;
+            list = mem;
+        }
+    }
+    return list;
+}
+
+#endif /* _MALLOC_TCACHE && PICOLIBC_TLS */
+
+#endif /* _MALLOC_TCACHE_H_ */
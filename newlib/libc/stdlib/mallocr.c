@@ -300,14 +300,15 @@ extern "C" {
 
 #include <sys/config.h>
 #include <sys/lock.h>
+#include "malloc-tcache.h"
 
 #define POINTER_UINT unsigned _POINTER_INT
 #define SEPARATE_OBJECTS
 #define HAVE_MMAP 0
 #define MORECORE(size) sbrk((size))
 #define MORECORE_CLEARS 0
-#define MALLOC_LOCK __LIBC_LOCK()
-#define MALLOC_UNLOCK __LIBC_UNLOCK()
+#define MALLOC_LOCK __MALLOC_LOCK()
+#define MALLOC_UNLOCK __MALLOC_UNLOCK()
 
 #ifdef __CYGWIN__
 # undef _WIN32
@@ -971,7 +972,12 @@ extern Void_t*     sbrk();
 #else
 
 #define cALLOc		calloc
+#ifdef MALLOC_TCACHE
+/* free goes through the thread cache */
+#define fREe		__malloc_free
+#else
 #define fREe		free
+#endif
 #define mALLOc		malloc
 #define mEMALIGn	memalign
 #define rEALLOc		realloc
@@ -1035,9 +1041,9 @@ struct mallinfo mALLINFo();
 /* Work around compiler optimizing away stores to 'size' field before
  * call to free.
  */
-#ifdef _HAVE_ALIAS_ATTRIBUTE
+#if defined(_HAVE_ALIAS_ATTRIBUTE) && !defined(MALLOC_TCACHE)
 extern __typeof(free) __malloc_free;
-#else
+#elif !defined(MALLOC_TCACHE)
 #define __malloc_free(x) fREe(x)
 #endif
 
@@ -1579,6 +1585,10 @@ STATIC mbinptr av_[NAV * 2 + 2] = {
  IAV(112), IAV(113), IAV(114), IAV(115), IAV(116), IAV(117), IAV(118), IAV(119),
  IAV(120), IAV(121), IAV(122), IAV(123), IAV(124), IAV(125), IAV(126), IAV(127)
 };
+
+#ifdef MALLOC_TCACHE
+NEWLIB_THREAD_LOCAL struct __malloc_tcache __malloc_tcache;
+#endif
 #else
 extern mbinptr av_[NAV * 2 + 2];
 #endif
@@ -1620,6 +1630,14 @@ extern mbinptr av_[NAV * 2 + 2];
 
 #define is_small_request(nb) (nb < MAX_SMALLBIN_SIZE - SMALLBIN_WIDTH)
 
+#ifdef MALLOC_TCACHE
+/* Largest chunk held in the thread cache */
+#define MALLOC_TCACHE_MAX (MINSIZE + (MALLOC_TCACHE_BINS - 1) * MALLOC_ALIGNMENT)
+
+/* thread cache bin holding chunks of size sz */
+#define tcache_bin(sz) ((unsigned) (((sz) - MINSIZE) / MALLOC_ALIGNMENT))
+#endif
+
 
 
 /*
@@ -2326,6 +2344,16 @@ Void_t* mALLOc(bytes) RDECL size_t bytes;
     return 0;
   }
 
+#ifdef MALLOC_TCACHE
+  /* Chunks in the thread cache have exactly the requested size */
+  if (nb <= MALLOC_TCACHE_MAX)
+  {
+    Void_t *mem = __malloc_tcache_get(tcache_bin(nb));
+    if (mem)
+      return mem;
+  }
+#endif
+
   MALLOC_LOCK;
 
   /* Check for exact match in a bin */
@@ -2695,7 +2723,58 @@ void fREe(mem) RDECL Void_t* mem;
 
 #endif /* MALLOC_PROVIDED */
 }
-#ifdef _HAVE_ALIAS_ATTRIBUTE
+
+#ifdef MALLOC_TCACHE
+/* Return a list of chunks taken from the thread cache to the heap */
+static void
+tcache_release(Void_t *list)
+{
+  if (!list)
+    return;
+
+  MALLOC_LOCK;
+  while (list)
+  {
+    Void_t *next = *(Void_t **) list;
+    fREe(list);
+    list = next;
+  }
+  MALLOC_UNLOCK;
+}
+
+/*
+  free keeps small chunks in the thread cache, releasing a full
+  cache bin to the heap in one batch.
+*/
+
+void free(Void_t* mem)
+{
+  INTERNAL_SIZE_T sz;
+
+  if (mem == 0)
+    return;
+
+  sz = chunksize(mem2chunk(mem));
+  if (sz > MALLOC_TCACHE_MAX)
+    fREe(mem);
+  else if (!__malloc_tcache_has(mem, tcache_bin(sz)))  /* double free */
+    tcache_release(__malloc_tcache_put(mem, tcache_bin(sz)));
+}
+#endif
+
+/*
+  Return chunks cached by the calling thread to the heap. Threads
+  using malloc should call this before exiting.
+*/
+
+void __malloc_tcache_flush(void)
+{
+#ifdef MALLOC_TCACHE
+  tcache_release(__malloc_tcache_take());
+#endif
+}
+
+#if defined(_HAVE_ALIAS_ATTRIBUTE) && !defined(MALLOC_TCACHE)
 #pragma GCC diagnostic push
 #ifndef __clang__
 #pragma GCC diagnostic ignored "-Wmissing-attributes"
@@ -3484,6 +3563,7 @@ void malloc_stats() RDECL
 #endif
   FILE *fp;
 
+  __malloc_tcache_flush();
   MALLOC_LOCK;
   malloc_update_mallinfo();
   local_max_total_mem = max_total_mem;
@@ -3532,6 +3612,8 @@ struct mallinfo mALLINFo() RDECL
 {
   struct mallinfo ret;
 
+  /* Count chunks in this thread's cache as free */
+  __malloc_tcache_flush();
   MALLOC_LOCK;
   malloc_update_mallinfo();
   ret = current_mallinfo;
@@ -42,14 +42,15 @@
 #include <sys/config.h>
 #include <sys/lock.h>
 #include <stdint.h>
+#include "malloc-tcache.h"
 
 #if MALLOC_DEBUG
 #include <assert.h>
-#define MALLOC_LOCK do { __LIBC_LOCK(); __malloc_validate(); } while(0)
-#define MALLOC_UNLOCK do { __malloc_validate(); __LIBC_UNLOCK(); } while(0)
+#define MALLOC_LOCK do { __MALLOC_LOCK(); __malloc_validate(); } while(0)
+#define MALLOC_UNLOCK do { __malloc_validate(); __MALLOC_UNLOCK(); } while(0)
 #else
-#define MALLOC_LOCK __LIBC_LOCK()
-#define MALLOC_UNLOCK __LIBC_UNLOCK()
+#define MALLOC_LOCK __MALLOC_LOCK()
+#define MALLOC_UNLOCK __MALLOC_UNLOCK()
 #undef assert
 #define assert(x) ((void)0)
 #endif
@@ -58,6 +59,13 @@
 #define MAX(a,b) ((a) >= (b) ? (a) : (b))
 #endif
 
+/* Whether malloc returns cleared memory */
+#if defined(_NANO_MALLOC_CLEAR_FREED) || defined(_NANO_MALLOC_CLEAR_NONE)
+#define MALLOC_CLEAR_ALL	false
+#else
+#define MALLOC_CLEAR_ALL	true
+#endif
+
 #if __SIZEOF_POINTER__ == __SIZEOF_LONG__
 #define ALIGN_TO(size, align) \
     (((size) + (align) -1L) & ~((align) -1L))
@@ -83,6 +91,63 @@ typedef struct {
     size_t s;
 } align_head_t;
 
+#ifdef _NANO_MALLOC_BINS
+
+typedef struct malloc_chunk
+{
+    /*          --------------------------------------
+     *   chunk->| size | PREV_FREE | FREE            |
+     * mem_ptr->| When allocated: data               |
+     *          | When freed: pointer to next free   |
+     *          | chunk in the same bin              |
+     *          | When freed: pointer to previous    |
+     *          | free chunk in the same bin         |
+     *          | ...                                |
+     *          | When freed: size                   |
+     *          --------------------------------------
+     *
+     * Sizes are multiples of MALLOC_CHUNK_ALIGN, which is at least
+     * 4, leaving the two low bits of the size field free for flags.
+     * CHUNK_FREE marks free chunks, CHUNK_PREV_FREE marks chunks
+     * whose neighbor at the next lower address is free. Free chunks
+     * store their size in the last word so that free can find the
+     * start of that lower neighbor and coalesce in constant time.
+     *
+     * Each piece of memory obtained from sbrk ends with a fence,
+     * a zero-sized in-use header, so every chunk has a neighbor
+     * at chunk+size that can be inspected.
+     */
+
+    /* size of the chunk, including flag bits */
+    size_t size;
+
+    /* pointer to next free chunk in the bin */
+    struct malloc_chunk * next;
+
+    /* pointer to previous free chunk in the bin */
+    struct malloc_chunk * prev;
+} chunk_t;
+
+#define CHUNK_FREE		((size_t) 1)
+#define CHUNK_PREV_FREE		((size_t) 2)
+#define CHUNK_FLAGS		(CHUNK_FREE | CHUNK_PREV_FREE)
+
+/* Alignment of allocated chunk. Compute the alignment required from a
+ * range of types, but leave room for the flag bits */
+#define MALLOC_CHUNK_ALIGN	MAX(offsetof(align_chunk_t, u), 4)
+
+/* Small chunks are sorted into exact-size bins, one for each multiple
+ * of MALLOC_CHUNK_ALIGN. Larger chunks go into bins spanning a
+ * power-of-two range of sizes; the last bin holds everything
+ * beyond that.
+ */
+#define MALLOC_NUM_SMALL_BINS	32
+#define MALLOC_NUM_BINS		64
+#define MALLOC_BINMAP_BITS	32
+#define MALLOC_BINMAP_WORDS	(MALLOC_NUM_BINS / MALLOC_BINMAP_BITS)
+
+#else
+
 typedef struct malloc_chunk
 {
     /*          --------------------------------------
@@ -111,6 +176,8 @@ typedef struct malloc_chunk
  * range of types */
 #define MALLOC_CHUNK_ALIGN	(offsetof(align_chunk_t, u))
 
+#endif /* _NANO_MALLOC_BINS */
+
 /* Alignment of the header. Never larger than MALLOC_CHUNK_ALIGN */
 #define MALLOC_HEAD_ALIGN	(offsetof(align_head_t, s))
 
@@ -121,13 +188,22 @@ typedef struct malloc_chunk
 #define MALLOC_PAGE_ALIGN 	(0x1000)
 
 /* Minimum allocation size */
+#ifdef _NANO_MALLOC_BINS
+#define MALLOC_MINSIZE		ALIGN_TO(sizeof(chunk_t) + sizeof(size_t), MALLOC_CHUNK_ALIGN)
+#else
 #define MALLOC_MINSIZE		ALIGN_TO(sizeof(chunk_t), MALLOC_HEAD_ALIGN)
+#endif
 
 /* Maximum allocation size */
 #define MALLOC_MAXSIZE 		(SIZE_MAX - (MALLOC_HEAD + 2*MALLOC_CHUNK_ALIGN))
 
 /* Forward data declarations */
+#ifdef _NANO_MALLOC_BINS
+extern chunk_t * __malloc_bins[MALLOC_NUM_BINS];
+extern uint32_t __malloc_binmap[MALLOC_BINMAP_WORDS];
+#else
 extern chunk_t * __malloc_free_list;
+#endif
 extern char * __malloc_sbrk_start;
 extern char * __malloc_sbrk_top;
 
@@ -145,17 +221,21 @@ void * valloc(size_t s);
 void * pvalloc(size_t s);
 void __malloc_validate(void);
 void __malloc_validate_block(chunk_t *r);
+void * __malloc_alloc(size_t s, bool clear);
 void * __malloc_sbrk_aligned(size_t s);
 bool __malloc_grow_chunk(chunk_t *c, size_t new_size);
 
 /* Work around compiler optimizing away stores to 'size' field before
  * call to free.
  */
-#ifdef _HAVE_ALIAS_ATTRIBUTE
+#if defined(_HAVE_ALIAS_ATTRIBUTE) || defined(MALLOC_TCACHE)
 extern __typeof(free) __malloc_free;
-extern __typeof(malloc) __malloc_malloc;
 #else
 #define __malloc_free(x) free(x)
+#endif
+#ifdef _HAVE_ALIAS_ATTRIBUTE
+extern __typeof(malloc) __malloc_malloc;
+#else
 #define __malloc_malloc(x) malloc(x)
 #endif
 
@@ -173,11 +253,39 @@ chunk_to_ptr(chunk_t *c)
     return (char *) c + MALLOC_HEAD;
 }
 
+#ifdef _NANO_MALLOC_BINS
+/* size of chunk, without the flag bits */
+static inline size_t
+chunk_get_size(chunk_t *c)
+{
+    return c->size & ~CHUNK_FLAGS;
+}
+
+/* set the size of a chunk which is not free, preserving CHUNK_PREV_FREE */
+static inline void
+chunk_set_size(chunk_t *c, size_t size)
+{
+    c->size = size | (c->size & CHUNK_PREV_FREE);
+}
+#else
+static inline size_t
+chunk_get_size(chunk_t *c)
+{
+    return c->size;
+}
+
+static inline void
+chunk_set_size(chunk_t *c, size_t size)
+{
+    c->size = size;
+}
+#endif
+
 /* end of chunk -- address of first byte past chunk storage */
 static inline void *
 chunk_end(chunk_t *c)
 {
-    return (char *) c + c->size;
+    return (char *) c + chunk_get_size(c);
 }
 
 /* chunk size needed to hold 'malloc_size' bytes */
@@ -193,6 +301,11 @@ chunk_size(size_t malloc_size)
     /* fill the gap between chunks */
     malloc_size += (MALLOC_CHUNK_ALIGN - MALLOC_HEAD_ALIGN);
 
+#ifdef _NANO_MALLOC_BINS
+    /* Keep the flag bits clear */
+    malloc_size = ALIGN_TO(malloc_size, MALLOC_CHUNK_ALIGN);
+#endif
+
     /* Make sure the requested size is big enough to hold a free chunk */
     malloc_size = MAX(MALLOC_MINSIZE, malloc_size);
     return malloc_size;
@@ -202,8 +315,42 @@ chunk_size(size_t malloc_size)
 static inline size_t
 chunk_usable(chunk_t *c)
 {
-    return c->size - MALLOC_HEAD;
+    return chunk_get_size(c) - MALLOC_HEAD;
+}
+
+/* Whether a new allocation needs to be cleared. 'fresh' is set when
+ * the memory came straight from sbrk, 'clear' when the caller needs
+ * zeroed memory */
+static inline bool
+malloc_need_clear(bool fresh, bool clear)
+{
+#ifdef _NANO_MALLOC_SBRK_ZERO
+    /* sbrk returns zeroed memory */
+    if (fresh)
+	return false;
+#endif
+    if (clear)
+	return true;
+#ifdef _NANO_MALLOC_CLEAR_FREED
+    /* Don't hand out data from previous allocations */
+    return !fresh;
+#else
+    (void) fresh;
+    return false;
+#endif
+}
+
+#ifdef MALLOC_TCACHE
+/* Largest chunk held in the thread cache */
+#define MALLOC_TCACHE_MAX	(MALLOC_MINSIZE + (MALLOC_TCACHE_BINS - 1) * MALLOC_CHUNK_ALIGN)
+
+/* thread cache bin holding chunks of 'size' bytes */
+static inline unsigned
+tcache_bin(size_t size)
+{
+    return (unsigned) ((size - MALLOC_MINSIZE) / MALLOC_CHUNK_ALIGN);
 }
+#endif
 
 /* assign 'size' to the specified chunk and return it to the free
  * pool */
@@ -214,9 +361,86 @@ make_free_chunk(chunk_t *c, size_t size)
     __malloc_free(chunk_to_ptr(c));
 }
 
+#ifdef _NANO_MALLOC_BINS
+/* chunk following 'c' in memory */
+static inline chunk_t *
+chunk_next(chunk_t *c)
+{
+    return (chunk_t *) chunk_end(c);
+}
+
+/* bin holding free chunks of 'size' bytes */
+static inline unsigned
+size_to_bin(size_t size)
+{
+    size_t n = size / MALLOC_CHUNK_ALIGN;
+    unsigned bin;
+
+    if (n < MALLOC_NUM_SMALL_BINS)
+        return (unsigned) n;
+
+    /* One bin per power of two above the small bins */
+    bin = MALLOC_NUM_SMALL_BINS +
+        (unsigned) ((sizeof(unsigned long) * 8 - 1) - __builtin_clzl((unsigned long) n)) -
+        (unsigned) ((sizeof(unsigned long) * 8 - 1) - __builtin_clzl(MALLOC_NUM_SMALL_BINS));
+    if (bin >= MALLOC_NUM_BINS)
+        bin = MALLOC_NUM_BINS - 1;
+    return bin;
+}
+
+/* mark 'c' as a free chunk of 'size' bytes and add it to its bin */
+static inline void
+bin_insert(chunk_t *c, size_t size)
+{
+    unsigned bin = size_to_bin(size);
+    chunk_t *head = __malloc_bins[bin];
+
+    /* The neighbor below is never free, it would have been merged */
+    c->size = size | CHUNK_FREE;
+    ((size_t *) ((char *) c + size))[-1] = size;
+    chunk_next(c)->size |= CHUNK_PREV_FREE;
+
+    c->next = head;
+    c->prev = NULL;
+    if (head)
+        head->prev = c;
+    else
+        __malloc_binmap[bin / MALLOC_BINMAP_BITS] |= (uint32_t) 1 << (bin % MALLOC_BINMAP_BITS);
+    __malloc_bins[bin] = c;
+}
+
+/* remove free chunk 'c' from its bin */
+static inline void
+bin_remove(chunk_t *c)
+{
+    if (c->prev)
+        c->prev->next = c->next;
+    else
+    {
+        unsigned bin = size_to_bin(chunk_get_size(c));
+
+        __malloc_bins[bin] = c->next;
+        if (!c->next)
+            __malloc_binmap[bin / MALLOC_BINMAP_BITS] &= ~((uint32_t) 1 << (bin % MALLOC_BINMAP_BITS));
+    }
+    if (c->next)
+        c->next->prev = c->prev;
+}
+#endif /* _NANO_MALLOC_BINS */
+
 #ifdef DEFINE_MALLOC
+#ifdef MALLOC_TCACHE
+NEWLIB_THREAD_LOCAL struct __malloc_tcache __malloc_tcache;
+#endif
+
+#ifdef _NANO_MALLOC_BINS
+/* Free chunk bins and bitmap of non-empty bins */
+chunk_t * __malloc_bins[MALLOC_NUM_BINS];
+uint32_t __malloc_binmap[MALLOC_BINMAP_WORDS];
+#else
 /* List list header of free blocks */
 chunk_t * __malloc_free_list;
+#endif
 
 /* Starting point of memory allocated from system */
 char * __malloc_sbrk_start;
@@ -252,6 +476,34 @@ void* __malloc_sbrk_aligned(size_t s)
     if (p == (void *)-1)
         return p;
 
+#ifdef _NANO_MALLOC_BINS
+    if (p == __malloc_sbrk_top)
+    {
+        /* Contiguous with the previous memory, replace the fence
+         * at the end of that with the new chunk, keeping its
+         * CHUNK_PREV_FREE flag
+         */
+        align_p = p - MALLOC_HEAD;
+        __malloc_sbrk_top = p + s;
+    }
+    else
+    {
+        /* Ask for space to align the chunk and hold a fence */
+        align_p = (char*)ALIGN_PTR(p + MALLOC_HEAD, MALLOC_CHUNK_ALIGN) - MALLOC_HEAD;
+
+        intptr_t adjust = (align_p - p) + MALLOC_HEAD;
+        char *extra = sbrk(adjust);
+        if (extra != p + s)
+            return (void *) -1;
+        __malloc_sbrk_top = extra + adjust;
+        ((chunk_t *) align_p)->size = 0;
+        if (__malloc_sbrk_start == NULL)
+            __malloc_sbrk_start = align_p;
+    }
+
+    /* Place the fence */
+    ((chunk_t *) (align_p + s))->size = 0;
+#else
     __malloc_sbrk_top = p + s;
 
     /* Adjust returned space so that the storage area
@@ -276,6 +528,7 @@ void* __malloc_sbrk_aligned(size_t s)
     }
     if (__malloc_sbrk_start == NULL)
 	__malloc_sbrk_start = align_p;
+#endif
 
     return align_p;
 }
@@ -285,9 +538,15 @@ __malloc_grow_chunk(chunk_t *c, size_t new_size)
 {
     char *chunk_e = chunk_end(c);
 
+#ifdef _NANO_MALLOC_BINS
+    /* The last chunk ends at the fence */
+    if (chunk_e != __malloc_sbrk_top - MALLOC_HEAD)
+	return false;
+#else
     if (chunk_e != __malloc_sbrk_top)
 	return false;
-    size_t add_size = MAX(MALLOC_MINSIZE, new_size - c->size);
+#endif
+    size_t add_size = MAX(MALLOC_MINSIZE, new_size - chunk_get_size(c));
 
     /* Ask for the extra memory needed */
     char *heap = __malloc_sbrk_aligned(add_size);
@@ -296,7 +555,7 @@ __malloc_grow_chunk(chunk_t *c, size_t new_size)
     if (heap == chunk_e)
     {
 	/* Set size and return */
-	c->size += add_size;
+	chunk_set_size(c, chunk_get_size(c) + add_size);
 	return true;
     }
 
@@ -308,16 +567,161 @@ __malloc_grow_chunk(chunk_t *c, size_t new_size)
     return false;
 }
 
+#ifdef _NANO_MALLOC_BINS
+
+/* Find a free chunk of at least 'size' bytes and remove it from its bin */
+static chunk_t *
+__malloc_bin_find(size_t size)
+{
+    unsigned bin = size_to_bin(size);
+    unsigned word = bin / MALLOC_BINMAP_BITS;
+    uint32_t map;
+    chunk_t *r;
+
+    /* Chunks in a large bin may be smaller than 'size', walk
+     * that bin looking for the first one which fits
+     */
+    if (bin >= MALLOC_NUM_SMALL_BINS)
+    {
+        for (r = __malloc_bins[bin]; r; r = r->next)
+            if (chunk_get_size(r) >= size)
+                goto found;
+        bin++;
+        word = bin / MALLOC_BINMAP_BITS;
+    }
+
+    /* Any chunk in the remaining bins fits, use the bitmap to
+     * locate the first non-empty one
+     */
+    if (word >= MALLOC_BINMAP_WORDS)
+        return NULL;
+    map = __malloc_binmap[word] & ((uint32_t) -1 << (bin % MALLOC_BINMAP_BITS));
+    while (!map)
+    {
+        if (++word >= MALLOC_BINMAP_WORDS)
+            return NULL;
+        map = __malloc_binmap[word];
+    }
+    r = __malloc_bins[word * MALLOC_BINMAP_BITS + __builtin_ctzl((unsigned long) map)];
+found:
+    bin_remove(r);
+    return r;
+}
+
+/** Function malloc
+  * Algorithm:
+  *   Use the bin bitmap to find the smallest non-empty bin holding
+  *   chunks large enough and split the first chunk from that. If
+  *   there isn't one, grow the free chunk at the top of the heap or
+  *   call sbrk to allocate a new chunk_t. Clear the memory if 'clear'
+  *   is set or the configuration requires it.
+  */
+void * __malloc_alloc(size_t s, bool clear)
+{
+    chunk_t *r;
+    char * ptr;
+    size_t alloc_size;
+    bool fresh = false;
+
+    if (s > MALLOC_MAXSIZE)
+    {
+        errno = ENOMEM;
+        return NULL;
+    }
+
+    alloc_size = chunk_size(s);
+
+#ifdef MALLOC_TCACHE
+    if (alloc_size <= MALLOC_TCACHE_MAX)
+    {
+        ptr = __malloc_tcache_get(tcache_bin(alloc_size));
+        if (ptr)
+        {
+            if (malloc_need_clear(false, clear))
+                memset(ptr, '\0', alloc_size - MALLOC_HEAD);
+            return ptr;
+        }
+    }
+#endif
+
+    MALLOC_LOCK;
+
+    r = __malloc_bin_find(alloc_size);
+
+    if (r == NULL && __malloc_sbrk_top)
+    {
+        chunk_t *fence = (chunk_t *) (__malloc_sbrk_top - MALLOC_HEAD);
+
+        if (fence->size & CHUNK_PREV_FREE)
+        {
+            /* Grow the free chunk at the end of memory */
+            chunk_t *top = (chunk_t *) ((char *) fence - ((size_t *) fence)[-1]);
+
+            bin_remove(top);
+            if (__malloc_grow_chunk(top, alloc_size))
+                r = top;
+            else
+                bin_insert(top, chunk_get_size(top));
+        }
+    }
+
+    if (r == NULL)
+    {
+        /* Failed to find a appropriate chunk_t. Ask for more memory */
+        r = __malloc_sbrk_aligned(alloc_size);
+
+        /* sbrk returns -1 if fail to allocate */
+        if (r == (void *)-1)
+        {
+            errno = ENOMEM;
+            MALLOC_UNLOCK;
+            return NULL;
+        }
+        chunk_set_size(r, alloc_size);
+        fresh = true;
+    }
+    else
+    {
+        size_t rem = chunk_get_size(r) - alloc_size;
+
+        if (rem >= MALLOC_MINSIZE)
+        {
+            /* Break it into two chunks and return the first one */
+            chunk_set_size(r, alloc_size);
+            bin_insert(chunk_next(r), rem);
+        }
+        else
+        {
+            /* Use the whole chunk */
+            r->size &= ~CHUNK_FREE;
+            chunk_next(r)->size &= ~CHUNK_PREV_FREE;
+        }
+    }
+
+    MALLOC_UNLOCK;
+
+    ptr = (char *)r + MALLOC_HEAD;
+
+    if (malloc_need_clear(fresh, clear))
+        memset(ptr, '\0', alloc_size - MALLOC_HEAD);
+
+    return ptr;
+}
+
+#else
+
 /** Function malloc
   * Algorithm:
   *   Walk through the free list to find the first match. If fails to find
-  *   one, call sbrk to allocate a new chunk_t.
+  *   one, call sbrk to allocate a new chunk_t. Clear the memory if
+  *   'clear' is set or the configuration requires it.
   */
-void * malloc(size_t s)
+void * __malloc_alloc(size_t s, bool clear)
 {
     chunk_t **p, *r;
     char * ptr;
     size_t alloc_size;
+    bool fresh = false;
 
     if (s > MALLOC_MAXSIZE)
     {
@@ -327,6 +731,19 @@ void * malloc(size_t s)
 
     alloc_size = chunk_size(s);
 
+#ifdef MALLOC_TCACHE
+    if (alloc_size <= MALLOC_TCACHE_MAX)
+    {
+        ptr = __malloc_tcache_get(tcache_bin(alloc_size));
+        if (ptr)
+        {
+            if (malloc_need_clear(false, clear))
+                memset(ptr, '\0', alloc_size - MALLOC_HEAD);
+            return ptr;
+        }
+    }
+#endif
+
     MALLOC_LOCK;
 
     for (p = &__malloc_free_list; (r = *p) != NULL; p = &r->next)
@@ -380,16 +797,24 @@ void * malloc(size_t s)
             return NULL;
         }
         r->size = alloc_size;
+        fresh = true;
     }
 
     MALLOC_UNLOCK;
 
     ptr = (char *)r + MALLOC_HEAD;
 
-    memset(ptr, '\0', alloc_size - MALLOC_HEAD);
+    if (malloc_need_clear(fresh, clear))
+        memset(ptr, '\0', alloc_size - MALLOC_HEAD);
 
     return ptr;
 }
+#endif /* _NANO_MALLOC_BINS */
+
+void * malloc(size_t s)
+{
+    return __malloc_alloc(s, MALLOC_CLEAR_ALL);
+}
 #ifdef _HAVE_ALIAS_ATTRIBUTE
 #pragma GCC diagnostic push
 #ifndef __clang__
@@ -402,6 +827,74 @@ __strong_reference(malloc, __malloc_malloc);
 
 #ifdef DEFINE_FREE
 
+#ifdef MALLOC_TCACHE
+/* free goes through the thread cache, __malloc_free returns chunks
+ * to the heap */
+#define free_heap __malloc_free
+#else
+#define free_heap free
+#endif
+
+#ifdef _NANO_MALLOC_BINS
+
+/** Function free
+  * Implementation of libc free.
+  * Algorithm:
+  *  Merge the chunk with the neighbors on either side if they are
+  *  free, found through the CHUNK_FREE flag of the following chunk
+  *  and the CHUNK_PREV_FREE flag of this one. Then insert the result
+  *  at the head of the bin for its size.
+  */
+void free_heap (void * free_p)
+{
+    chunk_t * p_to_free;
+    chunk_t * next;
+    size_t size;
+
+    if (free_p == NULL) return;
+
+    p_to_free = ptr_to_chunk(free_p);
+#if MALLOC_DEBUG
+    __malloc_validate_block(p_to_free);
+#endif
+
+    MALLOC_LOCK;
+
+    /* Check for double free */
+    if (p_to_free->size & CHUNK_FREE)
+    {
+        errno = ENOMEM;
+        MALLOC_UNLOCK;
+        return;
+    }
+
+    size = chunk_get_size(p_to_free);
+
+    /* Merge with the following chunk */
+    next = chunk_next(p_to_free);
+    if (next->size & CHUNK_FREE)
+    {
+        bin_remove(next);
+        size += chunk_get_size(next);
+    }
+
+    /* Merge with the preceding chunk */
+    if (p_to_free->size & CHUNK_PREV_FREE)
+    {
+        size_t prev_size = ((size_t *) p_to_free)[-1];
+
+        p_to_free = (chunk_t *) ((char *) p_to_free - prev_size);
+        bin_remove(p_to_free);
+        size += prev_size;
+    }
+
+    bin_insert(p_to_free, size);
+
+    MALLOC_UNLOCK;
+}
+
+#else
+
 /** Function free
   * Implementation of libc free.
   * Algorithm:
@@ -411,7 +904,7 @@ __strong_reference(malloc, __malloc_malloc);
   *  insert should make sure all chunks are sorted by address from low to
   *  high.  Then merge with neighbor chunks if adjacent.
   */
-void free (void * free_p)
+void free_heap (void * free_p)
 {
     chunk_t * p_to_free;
     chunk_t ** p, * r;
@@ -464,12 +957,79 @@ no_insert:
 
     MALLOC_UNLOCK;
 }
+#endif /* _NANO_MALLOC_BINS */
+
+#ifdef MALLOC_TCACHE
+/* Return a list of chunks taken from the thread cache to the heap */
+static void
+tcache_release(void *list)
+{
+    if (!list)
+        return;
+
+    MALLOC_LOCK;
+    while (list)
+    {
+        void *next = *(void **) list;
+        __malloc_free(list);
+        list = next;
+    }
+    MALLOC_UNLOCK;
+}
+
+/** Function free
+  * Keep small chunks in the thread cache, releasing a full cache
+  * bin to the heap in one batch.
+  */
+void free (void * free_p)
+{
+    chunk_t * p_to_free;
+    size_t size;
+    unsigned bin;
+
+    if (free_p == NULL) return;
+
+    p_to_free = ptr_to_chunk(free_p);
+    size = chunk_get_size(p_to_free);
+    if (size > MALLOC_TCACHE_MAX)
+    {
+        __malloc_free(free_p);
+        return;
+    }
+
+    /* Check for double free of a cached chunk or, where the chunk
+     * says so, of one already returned to the heap */
+    bin = tcache_bin(size);
+    if (__malloc_tcache_has(free_p, bin)
+#ifdef _NANO_MALLOC_BINS
+        || (p_to_free->size & CHUNK_FREE)
+#endif
+        )
+    {
+        errno = ENOMEM;
+        return;
+    }
+    tcache_release(__malloc_tcache_put(free_p, bin));
+}
+#endif
+
+/* Return chunks cached by the calling thread to the heap. Threads
+ * using malloc should call this before exiting */
+void __malloc_tcache_flush(void)
+{
+#ifdef MALLOC_TCACHE
+    tcache_release(__malloc_tcache_take());
+#endif
+}
+
 #ifdef _HAVE_ALIAS_ATTRIBUTE
 #pragma GCC diagnostic push
 #ifndef __clang__
 #pragma GCC diagnostic ignored "-Wmissing-attributes"
 #endif
+#ifndef MALLOC_TCACHE
 __strong_reference(free, __malloc_free);
+#endif
 __strong_reference(free, cfree);
 #pragma GCC diagnostic pop
 #endif
@@ -489,7 +1049,8 @@ void cfree(void * ptr)
 /* Function calloc
  *
  * Implement calloc by multiplying sizes (with overflow check) and
- * calling malloc (which sets to zero)
+ * asking for cleared memory, which skips the clear when it is known
+ * to be zero already
  */
 
 void * calloc(size_t n, size_t elem)
@@ -501,7 +1062,7 @@ void * calloc(size_t n, size_t elem)
         errno = ENOMEM;
         return NULL;
     }
-    return malloc(bytes);
+    return __malloc_alloc(bytes, true);
 }
 #endif /* DEFINE_CALLOC */
 
@@ -538,7 +1099,7 @@ void * realloc(void * ptr, size_t size)
     __malloc_validate_block(p_to_realloc);
 #endif
 
-    size_t old_size = p_to_realloc->size;
+    size_t old_size = chunk_get_size(p_to_realloc);
 
     /* See if we can avoid allocating new memory
      * when increasing the size
@@ -552,12 +1113,36 @@ void * realloc(void * ptr, size_t size)
 	if (__malloc_grow_chunk(p_to_realloc, new_size))
 	{
 	    /* clear new memory */
-	    memset(chunk_e, '\0', new_size - old_size);
+	    if (malloc_need_clear(true, MALLOC_CLEAR_ALL))
+		memset(chunk_e, '\0', new_size - old_size);
 	    /* adjust chunk_t size */
 	    old_size = new_size;
 	}
 	else
 	{
+#ifdef _NANO_MALLOC_BINS
+	    chunk_t *r = chunk_e;
+
+	    /* Check to see if there's a chunk_t of free space just past
+	     * the current block, merge it in in case that's useful
+	     */
+	    if (r->size & CHUNK_FREE)
+	    {
+		size_t r_size = chunk_get_size(r);
+
+		/* remove R from its bin */
+		bin_remove(r);
+		chunk_next(r)->size &= ~CHUNK_PREV_FREE;
+
+		/* clear the memory from r */
+		if (malloc_need_clear(false, MALLOC_CLEAR_ALL))
+		    memset(r, '\0', r_size);
+
+		/* add it's size to our block */
+		old_size += r_size;
+		chunk_set_size(p_to_realloc, old_size);
+	    }
+#else
 	    chunk_t **p, *r;
 
 	    /* Check to see if there's a chunk_t of free space just past
@@ -573,7 +1158,8 @@ void * realloc(void * ptr, size_t size)
 		    *p = r->next;
 
 		    /* clear the memory from r */
-		    memset(r, '\0', r_size);
+		    if (malloc_need_clear(false, MALLOC_CLEAR_ALL))
+			memset(r, '\0', r_size);
 
 		    /* add it's size to our block */
 		    old_size += r_size;
@@ -583,6 +1169,7 @@ void * realloc(void * ptr, size_t size)
 		if (p_to_realloc < r)
 		    break;
 	    }
+#endif
 	}
 
 	MALLOC_UNLOCK;
@@ -596,7 +1183,7 @@ void * realloc(void * ptr, size_t size)
 	 * and free it
 	 */
 	if (extra >= MALLOC_MINSIZE) {
-	    p_to_realloc->size = new_size;
+	    chunk_set_size(p_to_realloc, new_size);
 	    make_free_chunk(chunk_end(p_to_realloc), extra);
 	}
 	return ptr;
@@ -625,11 +1212,40 @@ __malloc_validate_block(chunk_t *r)
     __malloc_block = r;
     assert (ALIGN_PTR(chunk_to_ptr(r), MALLOC_CHUNK_ALIGN) == chunk_to_ptr(r));
     assert (ALIGN_PTR(r, MALLOC_HEAD_ALIGN) == r);
-    assert (r->size >= MALLOC_MINSIZE);
-    assert (r->size < 0x80000000UL);
-    assert (ALIGN_TO(r->size, MALLOC_HEAD_ALIGN) == r->size);
+    assert (chunk_get_size(r) >= MALLOC_MINSIZE);
+    assert (chunk_get_size(r) < 0x80000000UL);
+    assert (ALIGN_TO(chunk_get_size(r), MALLOC_HEAD_ALIGN) == chunk_get_size(r));
 }
 
+#ifdef _NANO_MALLOC_BINS
+void
+__malloc_validate(void)
+{
+    unsigned bin;
+    chunk_t *r, *prev;
+
+    for (bin = 0; bin < MALLOC_NUM_BINS; bin++) {
+	bool mapped = (__malloc_binmap[bin / MALLOC_BINMAP_BITS] >> (bin % MALLOC_BINMAP_BITS)) & 1;
+
+	assert (mapped == (__malloc_bins[bin] != NULL));
+	(void) mapped;
+	prev = NULL;
+	for (r = __malloc_bins[bin]; r; r = r->next) {
+	    __malloc_validate_block(r);
+	    assert (r->size & CHUNK_FREE);
+	    assert (r->prev == prev);
+	    assert (size_to_bin(chunk_get_size(r)) == bin);
+	    assert (((size_t *) chunk_end(r))[-1] == chunk_get_size(r));
+	    /* Adjacent free chunks are always merged */
+	    assert (!(r->size & CHUNK_PREV_FREE));
+	    assert (!(chunk_next(r)->size & CHUNK_FREE));
+	    assert (chunk_next(r)->size & CHUNK_PREV_FREE);
+	    prev = r;
+	}
+	(void) prev;
+    }
+}
+#else
 void
 __malloc_validate(void)
 {
@@ -640,6 +1256,7 @@ __malloc_validate(void)
 	assert (r->next == NULL || (char *) r + r->size < (char *) r->next);
     }
 }
+#endif
 
 struct mallinfo mallinfo(void)
 {
@@ -650,6 +1267,9 @@ struct mallinfo mallinfo(void)
     size_t ordblks = 0;
     struct mallinfo current_mallinfo;
 
+    /* Count chunks in this thread's cache as free */
+    __malloc_tcache_flush();
+
     MALLOC_LOCK;
 
     __malloc_validate();
@@ -662,12 +1282,27 @@ struct mallinfo mallinfo(void)
             total_size = (size_t)-1;
         else
             total_size = (size_t) (sbrk_now - __malloc_sbrk_start);
+#ifdef _NANO_MALLOC_BINS
+        /* Don't count the fence at the end */
+        total_size -= MALLOC_HEAD;
+#endif
     }
 
+#ifdef _NANO_MALLOC_BINS
+    unsigned bin;
+
+    for (bin = 0; bin < MALLOC_NUM_BINS; bin++) {
+	for (pf = __malloc_bins[bin]; pf; pf = pf->next) {
+	    ordblks++;
+	    free_size += chunk_get_size(pf);
+	}
+    }
+#else
     for (pf = __malloc_free_list; pf; pf = pf->next) {
 	ordblks++;
         free_size += pf->size;
     }
+#endif
 
     current_mallinfo.ordblks = ordblks;
     current_mallinfo.arena = total_size;
@@ -738,7 +1373,8 @@ void * memalign(size_t align, size_t s)
         return NULL;
     }
 
-    s = ALIGN_TO(MAX(s,1), MALLOC_CHUNK_ALIGN);
+    /* Make sure the aligned chunk can hold a free chunk */
+    s = ALIGN_TO(MAX(s, MALLOC_MINSIZE - MALLOC_HEAD), MALLOC_CHUNK_ALIGN);
 
     /* Make sure there's space to align the allocation and split
      * off chunk_t from the front
@@ -763,19 +1399,20 @@ void * memalign(size_t align, size_t s)
 	}
 
 	chunk_t *new_chunk_p = ptr_to_chunk(aligned_p);
-	new_chunk_p->size = chunk_p->size - offset;
+	new_chunk_p->size = chunk_get_size(chunk_p) - offset;
 
-	make_free_chunk(chunk_p, offset);
+	chunk_set_size(chunk_p, offset);
+	__malloc_free(allocated);
 
 	chunk_p = new_chunk_p;
     }
 
-    offset = chunk_p->size - chunk_size(s);
+    offset = chunk_get_size(chunk_p) - chunk_size(s);
 
     /* Split off the back piece if large enough */
     if (offset >= MALLOC_MINSIZE)
     {
-	chunk_p->size -= offset;
+	chunk_set_size(chunk_p, chunk_get_size(chunk_p) - offset);
 
 	make_free_chunk((chunk_t *) chunk_end(chunk_p), offset);
     }
@@ -51,7 +51,7 @@ _on_exit(int kind, union on_exit_func func, void *arg)
 {
 	int	ret = -1;
 	int	o;
-	__LIBC_LOCK();
+	__ATEXIT_LOCK();
 	for (o = 0; o < ATEXIT_MAX; o++) {
 		if (on_exits[o].kind == PICO_ONEXIT_EMPTY) {
 			on_exits[o].func = func;
@@ -61,7 +61,7 @@ _on_exit(int kind, union on_exit_func func, void *arg)
 			break;
 		}
 	}
-	__LIBC_UNLOCK();
+	__ATEXIT_UNLOCK();
 	return ret;
 }
 
@@ -82,7 +82,7 @@ __call_exitprocs(int code, void *param)
                 int                     kind = PICO_ONEXIT_EMPTY;
 		void	                *arg = 0;
 
-		__LIBC_LOCK();
+		__ATEXIT_LOCK();
 		for (i = ATEXIT_MAX - 1; i >= 0; i--) {
                         kind = on_exits[i].kind;
 			if (kind != PICO_ONEXIT_EMPTY) {
@@ -92,7 +92,7 @@ __call_exitprocs(int code, void *param)
 				break;
 			}
 		}
-		__LIBC_UNLOCK();
+		__ATEXIT_UNLOCK();
                 switch (kind) {
                 case PICO_ONEXIT_EMPTY:
                         return;
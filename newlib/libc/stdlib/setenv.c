@@ -56,7 +56,7 @@ setenv (const char *name,
   ENV_LOCK;
 
   l_value = strlen (value);
-  if ((C = _findenv (name, &offset)))
+  if ((C = _findenv_unlocked (name, &offset)))
     {				/* find if already exists */
       if (!rewrite)
         {
@@ -135,7 +135,7 @@ unsetenv (const char *name)
 
   ENV_LOCK;
 
-  while (_findenv (name, &offset))	/* if set multiple times */
+  while (_findenv_unlocked (name, &offset))	/* if set multiple times */
     { 
       for (P = &(*p_environ)[offset];; ++P)
         if (!(*P = *(P + 1)))
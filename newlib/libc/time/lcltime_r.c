@@ -40,14 +40,14 @@ localtime_r (const time_t *__restrict tim_p,
   int year;
   __tzinfo_type *const tz = __gettzinfo ();
   const uint8_t *ip;
+  int exclusive;
 
   res = gmtime_r (tim_p, res);
 
   year = res->tm_year + YEAR_BASE;
   ip = __month_lengths[isleap(year)];
 
-  TZ_LOCK;
-  _tzset_unlocked ();
+  exclusive = _tz_lock (year);
   if (_daylight)
     {
       if (year == tz->__tzyear || __tzcalc_limits (year))
@@ -136,7 +136,7 @@ localtime_r (const time_t *__restrict tim_p,
 	  res->tm_mday = ip[res->tm_mon];
 	}
     }
-  TZ_UNLOCK;
+  _tz_unlock (exclusive);
 
   return (res);
 }
@@ -34,9 +34,20 @@ int         __tzcalc_limits (int __year);
 
 extern const uint8_t __month_lengths[2][MONSPERYEAR];
 
-void _tzset_unlocked (void);
+void _tzset_unlocked (const char *tzenv);
 
 /* locks for multi-threading */
-#define TZ_LOCK		__LIBC_LOCK()
-#define TZ_UNLOCK	__LIBC_UNLOCK()
+#define TZ_LOCK		__TZ_LOCK()
+#define TZ_UNLOCK	__TZ_UNLOCK()
+#define TZ_LOCK_SHARED	__TZ_LOCK_SHARED()
+#define TZ_UNLOCK_SHARED	__TZ_UNLOCK_SHARED()
+
+/*
+ * Lock the timezone rules for reading, making sure they are current
+ * and that the daylight savings transitions for 'year' have been
+ * computed (pass 0 when they aren't needed). Returns non-zero when
+ * the lock had to be taken exclusively; hand that to _tz_unlock.
+ */
+int _tz_lock (int year);
+void _tz_unlock (int exclusive);
 
@@ -234,6 +234,7 @@ mktime (struct tm *tim_p)
   time_t tim;
   int year;
   int isdst=0;
+  int exclusive;
   __tzinfo_type *tz;
 
   tim = mktime_utc (tim_p, &days);
@@ -245,9 +246,7 @@ mktime (struct tm *tim_p)
 
   tz = __gettzinfo ();
 
-  TZ_LOCK;
-
-  _tzset_unlocked ();
+  exclusive = _tz_lock (year + YEAR_BASE);
 
   if (_daylight)
     {
@@ -324,7 +323,7 @@ mktime (struct tm *tim_p)
   else /* otherwise assume std time */
     tim += (time_t) tz->__tzrule[0].offset;
 
-  TZ_UNLOCK;
+  _tz_unlock (exclusive);
 
   /* reset isdst flag to what we have calculated */
   tim_p->tm_isdst = isdst;
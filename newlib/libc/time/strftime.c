@@ -687,7 +687,6 @@ __strftime (CHAR *s, size_t maxsize, const CHAR *format,
   CHAR alt;
   CHAR pad;
   unsigned long width;
-  int tzset_called = 0;
 
   const struct lc_time_T *_CurrentTimeLocale = __get_time_locale (locale);
   for (;;)
@@ -1125,12 +1124,7 @@ recurse:
 
 	    if (tim_p->tm_isdst >= 0)
 	      {
-		TZ_LOCK;
-		if (!tzset_called)
-		  {
-		    _tzset_unlocked ();
-		    tzset_called = 1;
-		  }
+		int exclusive = _tz_lock (0);
 
 #if defined (__CYGWIN__)
 		/* Cygwin must check if the application has been built with or
@@ -1149,7 +1143,7 @@ recurse:
 		   but have to use __tzrule for daylight savings.  */
 		offset = -tz->__tzrule[tim_p->tm_isdst > 0].offset;
 #endif
-		TZ_UNLOCK;
+		_tz_unlock (exclusive);
 	      }
 	    len = t_snprintf (&s[count], maxsize - count, CQ("%lld"),
 			    (((((long long)tim_p->tm_year - 69)/4
@@ -1336,13 +1330,7 @@ recurse:
           if (tim_p->tm_isdst >= 0)
             {
 	      long offset;
-
-	      TZ_LOCK;
-	      if (!tzset_called)
-		{
-		  _tzset_unlocked ();
-		  tzset_called = 1;
-		}
+	      int exclusive = _tz_lock (0);
 
 #if defined (__CYGWIN__)
 	      /* Cygwin must check if the application has been built with or
@@ -1361,7 +1349,7 @@ recurse:
 		 but have to use __tzrule for daylight savings.  */
 	      offset = -tz->__tzrule[tim_p->tm_isdst > 0].offset;
 #endif
-	      TZ_UNLOCK;
+	      _tz_unlock (exclusive);
 	      len = t_snprintf (&s[count], maxsize - count, CQ("%+03ld%.2ld"),
 			      offset / SECSPERHOUR,
 			      labs (offset / SECSPERMIN) % 60L);
@@ -1374,12 +1362,7 @@ recurse:
 	      size_t size;
 	      const char *tznam = NULL;
 
-	      TZ_LOCK;
-	      if (!tzset_called)
-		{
-		  _tzset_unlocked ();
-		  tzset_called = 1;
-		}
+	      int exclusive = _tz_lock (0);
 #if defined (__CYGWIN__)
 	      /* See above. */
 	      extern const char *__cygwin_gettzname (const struct tm *tmp);
@@ -1400,11 +1383,11 @@ recurse:
 		    s[count++] = tznam[i];
 		  else
 		    {
-		      TZ_UNLOCK;
+		      _tz_unlock (exclusive);
 		      return 0;
 		    }
 		}
-	      TZ_UNLOCK;
+	      _tz_unlock (exclusive);
 	    }
 	  break;
 	case CQ('%'):
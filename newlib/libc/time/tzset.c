@@ -105,19 +105,50 @@ Supporting OS subroutine required: None
 #include <string.h>
 #include <sys/types.h>
 #include <time.h>
+#include <envlock.h>
 #include "local.h"
 
 #define TZNAME_MIN	3	/* POSIX min TZ abbr size local def */
 #define TZNAME_MAX	10	/* POSIX max TZ abbr size local def */
+#define TZENV_MAX	80	/* longer than any valid POSIX TZ value */
 
 static char __tzname_std[TZNAME_MAX + 2];
 static char __tzname_dst[TZNAME_MAX + 2];
 static char *prev_tzenv = NULL;
+static int tz_gmt;
+
+/*
+ * Copy TZ out of the environment into 'buf', which holds TZENV_MAX + 1
+ * bytes, returning NULL when TZ isn't set. This is done before taking
+ * the TZ lock so that the environment lock is never taken while
+ * holding it. A value too long to be valid is replaced by an empty
+ * string, which selects UTC.
+ */
+static const char *
+_tz_getenv (char *buf)
+{
+  const char *tzenv;
+  size_t len;
+  int offset;
+
+  ENV_LOCK_SHARED;
+  tzenv = _findenv_unlocked ("TZ", &offset);
+  if (tzenv != NULL)
+    {
+      len = strlen (tzenv);
+      if (len > TZENV_MAX)
+	len = 0;
+      memcpy (buf, tzenv, len);
+      buf[len] = '\0';
+      tzenv = buf;
+    }
+  ENV_UNLOCK_SHARED;
+  return tzenv;
+}
 
 void
-_tzset_unlocked (void)
+_tzset_unlocked (const char *tzenv)
 {
-  char *tzenv;
   unsigned short hh, mm, ss, m, w, d;
   int sign, n;
   int i, ch;
@@ -125,7 +156,7 @@ _tzset_unlocked (void)
   __tzinfo_type *tz = __gettzinfo ();
   static const struct __tzrule_struct default_tzrule = {'J', 0, 0, 0, 0, (time_t)0, 0L };
 
-  if ((tzenv = getenv ("TZ")) == NULL)
+  if (tzenv == NULL)
       {
 	_timezone = 0;
 	_daylight = 0;
@@ -135,9 +166,12 @@ _tzset_unlocked (void)
 	tz->__tzrule[1] = default_tzrule;
 	free(prev_tzenv);
 	prev_tzenv = NULL;
+	tz_gmt = 1;
 	return;
       }
 
+  tz_gmt = 0;
+
   if (prev_tzenv != NULL && strcmp(tzenv, prev_tzenv) == 0)
     return;
 
@@ -352,7 +386,50 @@ _tzset_unlocked (void)
 void
 tzset (void)
 {
+  char buf[TZENV_MAX + 1];
+  const char *tzenv = _tz_getenv (buf);
+
   TZ_LOCK;
-  _tzset_unlocked ();
+  _tzset_unlocked (tzenv);
   TZ_UNLOCK;
 }
+
+/* Whether _tzset_unlocked would change anything */
+static int
+_tzset_stale (const char *tzenv)
+{
+  if (tzenv == NULL)
+    return !tz_gmt;
+  return prev_tzenv == NULL || strcmp (tzenv, prev_tzenv) != 0;
+}
+
+int
+_tz_lock (int year)
+{
+  __tzinfo_type *tz = __gettzinfo ();
+  char buf[TZENV_MAX + 1];
+  const char *tzenv = _tz_getenv (buf);
+
+  TZ_LOCK_SHARED;
+  if (!_tzset_stale (tzenv)
+      && !(_daylight && year >= EPOCH_YEAR && year != tz->__tzyear))
+    return 0;
+  TZ_UNLOCK_SHARED;
+
+  /*
+   * Updating the rules writes them, so switch to an exclusive lock
+   * and keep it until the caller is done
+   */
+  TZ_LOCK;
+  _tzset_unlocked (tzenv);
+  return 1;
+}
+
+void
+_tz_unlock (int exclusive)
+{
+  if (exclusive)
+    TZ_UNLOCK;
+  else
+    TZ_UNLOCK_SHARED;
+}
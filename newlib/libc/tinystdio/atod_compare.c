@@ -0,0 +1,234 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "stdio_private.h"
+#include "../../libm/common/math_config.h"
+
+/*
+ * Exact decimal to binary rounding for the cases where the leading 19
+ * digits can't decide it. The decimal value and the half-way point
+ * between the two candidate results are scaled to integers and
+ * compared as multi-precision numbers with 32-bit limbs.
+ *
+ * Only the first ATOD_COMPARE_DIGITS significant digits are kept;
+ * past those, digits can only matter by being non-zero. A half-way
+ * point between two doubles has at most 767 significant digits. The
+ * scaled half-way point of the smallest double with that many digits,
+ * (2**54 + 1) * 5**1103, needs 2617 bits; ATOD_COMPARE_LIMBS leaves
+ * room for that.
+ */
+
+#define ATOD_COMPARE_DIGITS     780
+#define ATOD_COMPARE_LIMBS      86
+
+struct big {
+    int         n;
+    uint32_t    v[ATOD_COMPARE_LIMBS];
+};
+
+static void
+big_set(struct big *b, uint64_t v)
+{
+    b->v[0] = (uint32_t) v;
+    b->v[1] = (uint32_t) (v >> 32);
+    b->n = b->v[1] ? 2 : (b->v[0] ? 1 : 0);
+}
+
+/* b = b * m + a */
+static void
+big_muladd(struct big *b, uint32_t m, uint32_t a)
+{
+    uint64_t carry = a;
+    int i;
+
+    for (i = 0; i < b->n; i++) {
+        carry += (uint64_t) b->v[i] * m;
+        b->v[i] = (uint32_t) carry;
+        carry >>= 32;
+    }
+    if (carry)
+        b->v[b->n++] = (uint32_t) carry;
+}
+
+static void
+big_mul_pow5(struct big *b, int k)
+{
+    uint32_t m = 1;
+
+    /* 5**13 is the largest power of five that fits in 32 bits */
+    for (; k >= 13; k -= 13)
+        big_muladd(b, 1220703125, 0);
+    while (k--)
+        m *= 5;
+    big_muladd(b, m, 0);
+}
+
+static void
+big_shl(struct big *b, int s)
+{
+    int words = s >> 5;
+    int bits = s & 31;
+    int i;
+
+    if (bits) {
+        uint32_t carry = 0;
+
+        for (i = 0; i < b->n; i++) {
+            uint32_t v = b->v[i];
+            b->v[i] = (v << bits) | carry;
+            carry = v >> (32 - bits);
+        }
+        if (carry)
+            b->v[b->n++] = carry;
+    }
+    if (words && b->n) {
+        for (i = b->n - 1; i >= 0; i--)
+            b->v[i + words] = b->v[i];
+        for (i = 0; i < words; i++)
+            b->v[i] = 0;
+        b->n += words;
+    }
+}
+
+static int
+big_cmp(const struct big *a, const struct big *b)
+{
+    int i;
+
+    if (a->n != b->n)
+        return a->n < b->n ? -1 : 1;
+    for (i = a->n - 1; i >= 0; i--)
+        if (a->v[i] != b->v[i])
+            return a->v[i] < b->v[i] ? -1 : 1;
+    return 0;
+}
+
+/*
+ * Compare the decimal value formed by the digits of w followed by
+ * those in tail[0..ntail), times 10**e10 / 10**(digits in tail),
+ * against m2 * 2**e2. A decimal point in the tail is skipped.
+ */
+static int
+__atod_compare(uint64_t w, int e10, const char *tail, int ntail, uint64_t m2, int e2)
+{
+    struct big l, r;
+    int digits = 20;
+    bool sticky = false;
+    uint32_t chunk = 0, scale = 1;
+    int cmp;
+
+    big_set(&l, w);
+    while (ntail--) {
+        unsigned int c = (unsigned char) *tail++ - '0';
+
+        if (c > 9)
+            continue;
+        if (digits >= ATOD_COMPARE_DIGITS) {
+            sticky |= (c != 0);
+            continue;
+        }
+        chunk = chunk * 10 + c;
+        scale *= 10;
+        digits++;
+        e10--;
+        if (scale == 1000000000) {
+            big_muladd(&l, scale, chunk);
+            chunk = 0;
+            scale = 1;
+        }
+    }
+    if (scale != 1)
+        big_muladd(&l, scale, chunk);
+
+    /* l * 2**e10 * 5**e10 against r * 2**e2, clearing the powers of five first */
+    big_set(&r, m2);
+    if (e10 >= 0)
+        big_mul_pow5(&l, e10);
+    else
+        big_mul_pow5(&r, -e10);
+    if (e10 > e2)
+        big_shl(&l, e10 - e2);
+    else
+        big_shl(&r, e2 - e10);
+
+    cmp = big_cmp(&l, &r);
+    if (cmp == 0 && sticky)
+        cmp = 1;
+    return cmp;
+}
+
+/*
+ * The correctly rounded value is either lo or the next larger double;
+ * pick one by comparing against the point half way between them
+ */
+double
+__atod_resolve(double lo, uint64_t w, int e10, const char *tail, int ntail)
+{
+    uint64_t bits = asuint64(lo);
+    uint64_t m = bits & (((uint64_t) 1 << 52) - 1);
+    int e = (int) (bits >> 52);
+    int cmp;
+
+    if (e) {
+        m |= (uint64_t) 1 << 52;
+        e -= 1075;
+    } else {
+        e = -1074;
+    }
+    cmp = __atod_compare(w, e10, tail, ntail, 2 * m + 1, e - 1);
+    if (cmp > 0 || (cmp == 0 && (bits & 1)))
+        bits++;
+    return asdouble(bits);
+}
+
+float
+__atof_resolve(float lo, uint64_t w, int e10, const char *tail, int ntail)
+{
+    uint32_t bits = asuint(lo);
+    uint32_t m = bits & (((uint32_t) 1 << 23) - 1);
+    int e = (int) (bits >> 23);
+    int cmp;
+
+    if (e) {
+        m |= (uint32_t) 1 << 23;
+        e -= 150;
+    } else {
+        e = -149;
+    }
+    cmp = __atod_compare(w, e10, tail, ntail, 2 * (uint64_t) m + 1, e - 1);
+    if (cmp > 0 || (cmp == 0 && (bits & 1)))
+        bits++;
+    return asfloat(bits);
+}
@@ -28,6 +28,9 @@
 
 #include "ryu/common.h"
 #include "ryu/d2s_intrinsics.h"
+#ifdef _IO_FLOAT_FAST_PARSE
+#include "eisel_lemire.h"
+#endif
 
 #define DOUBLE_MANTISSA_BITS 52
 #define DOUBLE_EXPONENT_BITS 11
@@ -69,6 +72,12 @@ __atod_engine(uint64_t m10, int e10)
     printf("m10 * 10^e10 = %" PRIu64 " * 10^%d\n", m10, e10);
 #endif
 
+#ifdef _IO_FLOAT_FAST_PARSE
+    uint64_t bits = __eisel_lemire_double(m10, e10);
+    if (bits != EISEL_LEMIRE_FAIL)
+        return int64Bits2Double(bits);
+#endif
+
     // Convert to binary float m2 * 2^e2, while retaining information about whether the conversion
     // was exact (trailingZeros).
     int32_t e2;
@@ -106,7 +115,10 @@ __atod_engine(uint64_t m10, int e10)
 	uint64_t pow5[2];
 	__double_computeInvPow5(-e10, pow5);
 	m2 = mulShift64(m10, pow5, j);
-	trailingZeros = multipleOfPowerOf5(m10, -e10);
+	// With more than 17 digits, m10 can be large enough that e2 > e10; the
+	// result is then only exact when 2^(e2-e10) divides m10 as well.
+	trailingZeros = (e2 < e10 || (e2 - e10 < 64 && multipleOfPowerOf2(m10, e2 - e10)))
+	    && multipleOfPowerOf5(m10, -e10);
 #ifdef RYU_DEBUG
 	printf("pow5 %016lx_%016lx j %d trailingZeros %d\n", pow5[0], pow5[1], j, trailingZeros);
 #endif
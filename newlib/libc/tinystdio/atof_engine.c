@@ -35,11 +35,12 @@
 #include "dtoa_engine.h"
 
 float
-__atof_engine(uint32_t u32, int exp)
+__atof_engine(uint64_t u64, int exp)
 {
     float flt;
     const float *f;
-    flt = u32;
+    /* Without exact conversion, conv_flt passes at most nine digits */
+    flt = (uint32_t) u64;
     int exp_cur;
 
     if (exp < 0) {
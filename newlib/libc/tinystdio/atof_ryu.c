@@ -25,8 +25,12 @@
 #include <stdio.h>
 #endif
 
+#include "stdio_private.h"
 #include "ryu/common.h"
 #include "ryu/f2s_intrinsics.h"
+#ifdef _IO_FLOAT_FAST_PARSE
+#include "eisel_lemire.h"
+#endif
 
 #define FLOAT_MANTISSA_BITS 23
 #define FLOAT_EXPONENT_BITS 8
@@ -59,8 +63,8 @@ static inline float int32Bits2Float(uint32_t bits) {
   return f;
 }
 
-float
-__atof_engine(uint32_t m10, int e10)
+static float
+atof_ryu(uint32_t m10, int e10)
 {
 #ifdef RYU_DEBUG
 	printf("m10digits = %d\n", m10);
@@ -165,3 +169,34 @@ __atof_engine(uint32_t m10, int e10)
 	uint32_t ieee = (((uint32_t)ieee_e2) << FLOAT_MANTISSA_BITS) | ieee_m2;
 	return int32Bits2Float(ieee);
 }
+
+float
+__atof_engine(uint64_t m10, int e10)
+{
+#ifdef _IO_FLOAT_FAST_PARSE
+	uint64_t bits = __eisel_lemire_float(m10, e10);
+	if (bits != EISEL_LEMIRE_FAIL)
+		return int32Bits2Float((uint32_t) bits);
+#endif
+
+	if (m10 <= UINT32_MAX)
+		return atof_ryu((uint32_t) m10, e10);
+
+	// Too many digits for the 32-bit code. Convert the leading nine; when
+	// rounding those and the next larger value agree, the rest can't
+	// change the result. Otherwise compare all of them against the
+	// point half way between the two.
+	uint64_t top = m10;
+	bool dropped = false;
+	int k = 0;
+	while (top >= 1000000000) {
+		dropped |= (top % 10) != 0;
+		top /= 10;
+		k++;
+	}
+	uint32_t m = (uint32_t) top;
+	float lo = atof_ryu(m, e10 + k);
+	if (!dropped || lo == atof_ryu(m + 1, e10 + k))
+		return lo;
+	return __atof_resolve(lo, m10, e10, NULL, 0);
+}
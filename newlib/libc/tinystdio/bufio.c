@@ -35,8 +35,8 @@
 
 #include <stdio-bufio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
-#include <stdbool.h>
 
 /* Buffered I/O routines for tiny stdio */
 
@@ -109,72 +109,184 @@ int
 __bufio_put(char c, FILE *f)
 {
 	struct __file_bufio *bf = (struct __file_bufio *) f;
-        int ret = (unsigned char) c;
 
-	__bufio_lock(f);
-        if (__bufio_setdir_locked(f, __SWR) < 0) {
-                ret = _FDEV_ERR;
-                goto bail;
-        }
+        if (__bufio_setdir_locked(f, __SWR) < 0)
+                return _FDEV_ERR;
 
 	bf->buf[bf->len++] = c;
 
 	/* flush if full, or if sending newline when linebuffered */
 	if (bf->len >= bf->size || (c == '\n' && (bf->bflags & __BLBF)))
 		if (__bufio_flush_locked(f) < 0)
-                        ret = _FDEV_ERR;
+                        return _FDEV_ERR;
 
-bail:
-	__bufio_unlock(f);
-	return ret;
+	return (unsigned char) c;
 }
 
-int
-__bufio_get(FILE *f)
+/*
+ * Switch to reading. Returns the amount of buffered data or _FDEV_ERR
+ */
+static int
+__bufio_setread_locked(FILE *f)
 {
 	struct __file_bufio *bf = (struct __file_bufio *) f;
-        int ret;
-        bool flushed = false;
-
-again:
-	__bufio_lock(f);
-        if (__bufio_setdir_locked(f, __SRD) < 0) {
-                ret = _FDEV_ERR;
-                goto bail;
-        }
 
-	if (bf->off >= bf->len) {
+        if (__bufio_setdir_locked(f, __SRD) < 0)
+                return _FDEV_ERR;
+        return bf->len - bf->off;
+}
 
-		/* Flush stdout if reading from stdin */
-		if (f == stdin && !flushed) {
-                        flushed = true;
-			__bufio_unlock(f);
-			fflush(stdout);
-                        goto again;
-		}
+/*
+ * Refill an empty read buffer. Returns the amount of data available
+ * or _FDEV_EOF
+ */
+static int
+__bufio_fill_locked(FILE *f)
+{
+	struct __file_bufio *bf = (struct __file_bufio *) f;
+        size_t size = bf->size;
 
-		/* Reset read pointer, read some data */
-		bf->off = 0;
-		bf->len = (bf->read)(bf->fd, bf->buf, bf->size);
+        /*
+         * Keep refills of seekable files aligned to the buffer size so
+         * that nearby seeks are likely to land in the buffer
+         */
+        if (bf->lseek)
+                size -= bf->pos % bf->size;
 
-		if (bf->len <= 0) {
-			bf->len = 0;
-                        ret = _FDEV_EOF;
-                        goto bail;
-		}
+	/* Reset read pointer, read some data */
+	bf->off = 0;
+	bf->len = (bf->read)(bf->fd, bf->buf, size);
 
-                /* Update FD pos */
-                bf->pos += bf->len;
+	if (bf->len <= 0) {
+		bf->len = 0;
+		return _FDEV_EOF;
 	}
 
+	/* Update FD pos */
+	bf->pos += bf->len;
+	return bf->len;
+}
+
+int
+__bufio_get(FILE *f)
+{
+	struct __file_bufio *bf = (struct __file_bufio *) f;
+        int avail = __bufio_setread_locked(f);
+
+        if (avail < 0)
+                return _FDEV_ERR;
+
+	if (avail == 0 && __bufio_fill_locked(f) < 0)
+		return _FDEV_EOF;
+
 	/*
 	 * Cast to unsigned avoids sign-extending chars with high-bit
 	 * set
 	 */
-	ret = (unsigned char) bf->buf[bf->off++];
-bail:
-	__bufio_unlock(f);
-	return ret;
+	return (unsigned char) bf->buf[bf->off++];
+}
+
+ssize_t
+__bufio_write(FILE *f, const void *buf, size_t count)
+{
+	struct __file_bufio *bf = (struct __file_bufio *) f;
+        const char *cp = buf;
+        size_t done = 0;
+
+        if (__bufio_setdir_locked(f, __SWR) < 0)
+                return _FDEV_ERR;
+
+        while (done < count) {
+                size_t this;
+
+                /*
+                 * With nothing buffered, send whole blocks straight
+                 * from the caller's buffer instead of copying them
+                 */
+                if (bf->len == 0 && count - done >= (size_t) bf->size) {
+                        ssize_t ret;
+
+                        this = count - done;
+                        this -= this % bf->size;
+                        ret = (bf->write)(bf->fd, cp + done, this);
+                        if (ret <= 0)
+                                break;
+                        bf->pos += ret;
+                        done += ret;
+                        continue;
+                }
+
+                this = bf->size - bf->len;
+                if (this > count - done)
+                        this = count - done;
+                memcpy(bf->buf + bf->len, cp + done, this);
+                bf->len += this;
+                done += this;
+                if (bf->len >= bf->size)
+                        if (__bufio_flush_locked(f) < 0)
+                                break;
+        }
+
+        /* flush if sending newline when linebuffered */
+        if (bf->len && (bf->bflags & __BLBF) && memchr(cp, '\n', done))
+                (void) __bufio_flush_locked(f);
+
+        return done ? (ssize_t) done : _FDEV_ERR;
+}
+
+ssize_t
+__bufio_read(FILE *f, void *buf, size_t count)
+{
+	struct __file_bufio *bf = (struct __file_bufio *) f;
+        int ret = __bufio_setread_locked(f);
+        size_t avail;
+
+        if (ret < 0)
+                return _FDEV_ERR;
+
+        if (ret == 0) {
+                /*
+                 * The buffer is empty; read whole blocks directly into
+                 * the caller's buffer rather than copying them through
+                 * ours
+                 */
+                if (count >= (size_t) bf->size) {
+                        ssize_t this;
+
+                        this = (bf->read)(bf->fd, buf, count - count % bf->size);
+                        if (this <= 0)
+                                return _FDEV_EOF;
+                        /* The old buffer contents no longer sit just before pos */
+                        bf->pos += this;
+                        bf->len = bf->off = 0;
+                        return this;
+                }
+                if (__bufio_fill_locked(f) < 0)
+                        return _FDEV_EOF;
+        }
+
+        /* Hand back whatever is buffered, the caller will ask for more */
+        avail = bf->len - bf->off;
+        if (avail > count)
+                avail = count;
+        memcpy(buf, bf->buf + bf->off, avail);
+        bf->off += avail;
+        return avail;
+}
+
+ssize_t
+__bufio_fill(FILE *f)
+{
+	struct __file_bufio *bf = (struct __file_bufio *) f;
+        int avail = __bufio_setread_locked(f);
+
+        if (avail < 0)
+                return _FDEV_ERR;
+
+	if (avail == 0 && __bufio_fill_locked(f) < 0)
+		return _FDEV_EOF;
+
+        return bf->len - bf->off;
 }
 
 off_t
@@ -184,8 +296,31 @@ __bufio_seek(FILE *f, off_t offset, int whence)
 	off_t ret;
 
 	__bufio_lock(f);
-        if (__bufio_setdir_locked(f, 0) < 0)
-                return _FDEV_ERR;
+        if (bf->dir == __SRD) {
+                /* File position of the start of the buffer */
+                off_t base = bf->pos - bf->len;
+
+                if (whence == SEEK_CUR) {
+                        whence = SEEK_SET;
+                        offset += base + bf->off;
+                }
+
+                /*
+                 * Seeks within the buffered data just move the read
+                 * offset. Otherwise, the buffer is left alone until
+                 * the lseek below succeeds
+                 */
+                if (bf->lseek && whence == SEEK_SET &&
+                    base <= offset && offset <= bf->pos)
+                {
+                        bf->off = offset - base;
+                        ret = offset;
+                        goto bail;
+                }
+        } else if (__bufio_setdir_locked(f, 0) < 0) {
+                ret = _FDEV_ERR;
+                goto bail;
+        }
         if (bf->lseek) {
                 if (whence == SEEK_CUR) {
                         whence = SEEK_SET;
@@ -194,8 +329,13 @@ __bufio_seek(FILE *f, off_t offset, int whence)
                 ret = (bf->lseek)(bf->fd, offset, whence);
         } else
                 ret = _FDEV_ERR;
-        if (ret >= 0)
+        if (ret >= 0) {
                 bf->pos = ret;
+                bf->len = 0;
+                bf->off = 0;
+                bf->dir = 0;
+        }
+bail:
         __bufio_unlock(f);
         return ret;
 }
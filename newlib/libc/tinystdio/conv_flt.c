@@ -192,12 +192,55 @@ typedef _u128 UINTFLOAT;
 #include "dtoa_engine.h"
 #endif
 
+#if defined(STRTOD) && defined(_IO_FLOAT_FAST_PARSE)
+#define CONV_FLT_EIGHT_DIGITS
+
+/*
+ * When the next eight characters are all digits, convert them at
+ * once using SWAR arithmetic on a 64-bit word
+ */
+static inline bool
+scanf_eight_digits(const char *s, uint32_t *val)
+{
+    uint64_t v;
+    int i;
+
+    for (i = 0; i < 8; i++)
+        if (!ISDIGIT(s[i]))
+            return false;
+    memcpy(&v, s, sizeof(v));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    v = __builtin_bswap64(v);
+#endif
+    v -= 0x3030303030303030ULL;
+    /* Pairs of digits */
+    v = (v * 10) + (v >> 8);
+    /* Combine four pairs */
+    v = (((v & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+         (((v >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+    *val = (uint32_t) v;
+    return true;
+}
+#endif
+
+#if (defined(STRTOD) || defined(STRTOF)) && defined(_IO_FLOAT_EXACT)
+/*
+ * strtod and strtof can go back over the digits which didn't fit in
+ * 'uint' when those decide the rounding
+ */
+#define CONV_FLT_RESCAN
+#endif
+
 static unsigned char
 conv_flt (FLT_STREAM *stream, int *lenp, width_t width, void *addr, uint16_t flags)
 {
     UINTFLOAT uint;
     unsigned int overflow = 0;
     int uintdigits = 0;
+#ifdef CONV_FLT_RESCAN
+    int tail = -1;              /* offset of the first dropped digit */
+    int ntail = 0;
+#endif
     FLOAT flt;
     int i;
     const char *p;
@@ -245,8 +288,14 @@ conv_flt (FLT_STREAM *stream, int *lenp, width_t width, void *addr, uint16_t fla
     default:
         exp = 0;
 	uint = U32_TO_UF(0);
+#ifdef _IO_FLOAT_EXACT
+/* 19 digits, which always fit in 64 bits */
+#define uintdigitsmax_10_float  18
+#define uintdigitsmax_10_double 18
+#else
 #define uintdigitsmax_10_float  8
 #define uintdigitsmax_10_double 16
+#endif
 #define uintdigitsmax_10_long_double    32
 #define uintdigitsmax_16_float  7
 #define uintdigitsmax_16_double 15
@@ -283,7 +332,12 @@ conv_flt (FLT_STREAM *stream, int *lenp, width_t width, void *addr, uint16_t fla
 	    if (c < base) {
 		flags |= FL_ANY;
 		if (flags & FL_OVFL) {
+                    /* Sticky; the value is more than uint * 10**exp */
                     overflow |= (c != 0);
+#ifdef CONV_FLT_RESCAN
+                    if (tail < 0)
+                        tail = *lenp - 1;
+#endif
 		    if (!(flags & FL_DOT))
 			exp += 1;
 		} else {
@@ -294,6 +348,19 @@ conv_flt (FLT_STREAM *stream, int *lenp, width_t width, void *addr, uint16_t fla
 			uintdigits++;
                         if (uintdigits > uintdigitsmax)
                             flags |= FL_OVFL;
+#ifdef CONV_FLT_EIGHT_DIGITS
+                        else if (base == 10 && uintdigits + 8 <= uintdigitsmax) {
+                            uint32_t eight;
+
+                            if (scanf_eight_digits(stream + *lenp, &eight)) {
+                                uint = uint * 100000000 + eight;
+                                uintdigits += 8;
+                                *lenp += 8;
+                                if (flags & FL_DOT)
+                                    exp -= 8;
+                            }
+                        }
+#endif
 		    }
 	        }
 
@@ -312,6 +379,11 @@ conv_flt (FLT_STREAM *stream, int *lenp, width_t width, void *addr, uint16_t fla
 	if (!(flags & FL_ANY))
 	    return 0;
 
+#ifdef CONV_FLT_RESCAN
+        if (tail >= 0)
+            ntail = *lenp - 1 - tail;
+#endif
+
 #ifdef _WANT_IO_C99_FORMATS
         int exp_match = (flags & FL_FHEX) ? 'p' : 'e';
 #else
@@ -486,6 +558,19 @@ conv_flt (FLT_STREAM *stream, int *lenp, width_t width, void *addr, uint16_t fla
                     flt = (FLOAT) INFINITY;
 		} else {
                     flt = (FLOAT) __atod_engine(UF_TO_U64(uint), exp);
+#ifdef CONV_FLT_RESCAN
+                    /*
+                     * With non-zero digits dropped, the value lies
+                     * between uint and uint + 1. If those round
+                     * differently, the dropped digits decide
+                     */
+                    if (overflow) {
+                        double hi = __atod_engine(UF_TO_U64(uint) + 1, exp);
+                        if ((double) flt != hi)
+                            flt = (FLOAT) __atod_resolve((double) flt, UF_TO_U64(uint), exp,
+                                                         stream + tail, ntail);
+                    }
+#endif
                 }
             }
             else if (CHECK_LONG_LONG())
@@ -501,7 +586,15 @@ conv_flt (FLT_STREAM *stream, int *lenp, width_t width, void *addr, uint16_t fla
                     // Number is larger than 1e+39, which should be rounded to +/-Infinity.
                     flt = (FLOAT) INFINITY;
 		} else {
-                    flt = (FLOAT) __atof_engine(UF_TO_U32(uint), exp);
+                    flt = (FLOAT) __atof_engine(UF_TO_U64(uint), exp);
+#ifdef CONV_FLT_RESCAN
+                    if (overflow) {
+                        float hi = __atof_engine(UF_TO_U64(uint) + 1, exp);
+                        if ((float) flt != hi)
+                            flt = (FLOAT) __atof_resolve((float) flt, UF_TO_U64(uint), exp,
+                                                         stream + tail, ntail);
+                    }
+#endif
                 }
             }
         }
@@ -58,7 +58,12 @@
 #define __dtoa_round __ftoa_round
 #define __atod_engine __atof_engine
 #define FLOAT float
+#ifdef _IO_FLOAT_EXACT
+/* conv_flt collects up to 19 digits for exact conversion */
+#define UINTFLOAT uint64_t
+#else
 #define UINTFLOAT uint32_t
+#endif
 
 #else
 
@@ -86,6 +91,25 @@ struct dtoa {
 int
 __dtoa_engine(FLOAT x, struct dtoa *dtoa, int max_digits, bool fmode, int max_decimals);
 
+#if defined(_IO_FLOAT_RYU_PRINTF) && !defined(PICOLIBC_FLOAT_PRINTF_SCANF)
+
+/*
+ * Fixed-precision engine which can produce every digit of a double;
+ * the longest exact decimal expansion (of a subnormal) is 767 digits.
+ */
+#define DTOA_FIXED_MAX_DIG	768
+
+struct dtoa_fixed {
+	int32_t	exp;
+	uint8_t	flags;
+	char	digits[DTOA_FIXED_MAX_DIG + 1];
+};
+
+int
+__dtoa_fixed_engine(double x, struct dtoa_fixed *dtoa, int max_digits, bool fmode, int max_decimals);
+
+#endif
+
 extern const FLOAT __dtoa_scale_up[];
 extern const FLOAT __dtoa_scale_down[];
 extern const FLOAT __dtoa_round[];
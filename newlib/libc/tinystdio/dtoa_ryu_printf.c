@@ -0,0 +1,246 @@
+// Copyright 2018 Ulf Adams
+//
+// The contents of this file may be used under the terms of the Apache License,
+// Version 2.0.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     http://www.apache.org/licenses/LICENSE-2.0)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+/*
+ * Fixed-precision binary to decimal conversion following "Ryu
+ * revisited: printf floating point conversion" (Ulf Adams, 2019).
+ *
+ * The value is produced in blocks of nine decimal digits. Each block
+ * comes from one multiplication of the significand by a table entry
+ * followed by a shift and a reduction modulo 10**9, so any number of
+ * exact digits can be generated in time proportional to the number
+ * of digits requested, without multiple-precision arithmetic.
+ */
+
+#include "ryu/common.h"
+#include "ryu/d2s_intrinsics.h"
+#include "ryu/d2fixed.h"
+#include "dtoa_engine.h"
+
+#ifdef _IO_FLOAT_RYU_PRINTF
+
+#define DOUBLE_MANTISSA_BITS 52
+#define DOUBLE_EXPONENT_BITS 11
+#define DOUBLE_BIAS 1023
+
+#define POW10_ADDITIONAL_BITS 120
+
+// Returns floor(m * mul / 2^j) mod 10^9 where mul is a 192-bit table
+// entry and 128 <= j <= 188. The table entries have been reduced modulo
+// 10^9 * 2^136, which doesn't change the result.
+static uint32_t mulShift_mod1e9(const uint64_t m, const uint64_t* const mul, const int32_t j) {
+  uint64_t high0;                                   // 64
+  const uint64_t low0 = umul128(m, mul[0], &high0); // 0
+  uint64_t high1;                                   // 128
+  const uint64_t low1 = umul128(m, mul[1], &high1); // 64
+  uint64_t high2;                                   // 192
+  const uint64_t low2 = umul128(m, mul[2], &high2); // 128
+  (void) low0;
+  const uint64_t s0high = low1 + high0;     // 64
+  const uint32_t c1 = s0high < low1;
+  const uint64_t s1low = low2 + high1 + c1; // 128
+  const uint32_t c2 = s1low < low2; // high1 + c1 can't overflow, so compare against low2
+  const uint64_t s1high = high2 + c2;       // 192
+  assert(j >= 128);
+  assert(j <= 188);
+  const uint32_t dist = (uint32_t) (j - 128); // dist: [0, 60]
+  uint64_t shiftedhigh = s1high;
+  uint64_t shiftedlow = s1low;
+  if (dist) {
+    shiftedhigh = s1high >> dist;
+    shiftedlow = shiftright128(s1low, s1high, dist);
+  }
+  // 2^64 mod 10^9 = 709551616
+  return (uint32_t) (((shiftedhigh % 1000000000) * 709551616 + shiftedlow % 1000000000) % 1000000000);
+}
+
+// Returns the nine-digit block of m2 * 2^e2 holding the digits
+// with weights 10^(9k) through 10^(9k+8).
+static uint32_t d2fixed_block(const uint64_t m2, const int32_t e2, const int32_t k) {
+  if (k >= 0) {
+    if (e2 < -DOUBLE_MANTISSA_BITS)
+      return 0;
+    const uint32_t idx = e2 <= 0 ? 0 : ((uint32_t) e2 + 15) / 16;
+    const uint32_t offset = __d2fixed_pow10_offset[idx];
+    if ((uint32_t) k >= __d2fixed_pow10_offset[idx + 1] - offset)
+      return 0;
+    const int32_t j = (int32_t) (16 * idx + POW10_ADDITIONAL_BITS) - e2;
+    return mulShift_mod1e9(m2 << 8, __d2fixed_pow10[offset + k], j + 8);
+  } else {
+    if (e2 >= 0)
+      return 0;
+    const uint32_t f = (uint32_t) (-k - 1);
+    const uint32_t idx = (uint32_t) -e2 / 16;
+    const uint32_t min_block = __d2fixed_min_block[idx];
+    if (f < min_block)
+      return 0;
+    const uint32_t offset = __d2fixed_pow10_offset_2[idx];
+    if (f - min_block >= __d2fixed_pow10_offset_2[idx + 1] - offset)
+      return 0;
+    const int32_t j = POW10_ADDITIONAL_BITS + (-e2 - (int32_t) (16 * idx));
+    return mulShift_mod1e9(m2 << 8, __d2fixed_pow10_2[offset + f - min_block], j + 8);
+  }
+}
+
+static const uint32_t d2fixed_pow10[9] = {
+	1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000
+};
+
+static int decimalLength9(const uint32_t v) {
+	int len = 1;
+	while (len < 9 && d2fixed_pow10[len] <= v)
+		len++;
+	return len;
+}
+
+// Returns true if every digit of m2 * 2^e2 below 10^p is zero.
+static bool d2fixed_exact(const uint64_t m2, const int32_t e2, const int32_t p) {
+	if (p > 0 && !multipleOfPowerOf5(m2, (uint32_t) p))
+		return false;
+	if (e2 >= p)
+		return true;
+	return p - e2 < 64 && multipleOfPowerOf2(m2, (uint32_t) (p - e2));
+}
+
+int
+__dtoa_fixed_engine(double x, struct dtoa_fixed *dtoa, int max_digits, bool fmode, int max_decimals)
+{
+	const uint64_t bits = double_to_bits(x);
+	const bool ieeeSign = ((bits >> (DOUBLE_MANTISSA_BITS + DOUBLE_EXPONENT_BITS)) & 1) != 0;
+	const uint64_t ieeeMantissa = bits & ((1ull << DOUBLE_MANTISSA_BITS) - 1);
+	const uint32_t ieeeExponent = (uint32_t) ((bits >> DOUBLE_MANTISSA_BITS) & ((1u << DOUBLE_EXPONENT_BITS) - 1));
+
+	uint8_t	flags = 0;
+
+	if (ieeeSign)
+		flags |= DTOA_MINUS;
+	if (ieeeExponent == 0 && ieeeMantissa == 0) {
+		flags |= DTOA_ZERO;
+		dtoa->digits[0] = '0';
+		dtoa->digits[1] = '\0';
+		dtoa->flags = flags;
+		dtoa->exp = 0;
+		return 1;
+	}
+	if (ieeeExponent == ((1u << DOUBLE_EXPONENT_BITS) - 1u)) {
+		if (ieeeMantissa) {
+			flags |= DTOA_NAN;
+		} else {
+			flags |= DTOA_INF;
+		}
+		dtoa->flags = flags;
+		return 0;
+	}
+	dtoa->flags = flags;
+
+	int32_t e2;
+	uint64_t m2;
+	if (ieeeExponent == 0) {
+		e2 = 1 - DOUBLE_BIAS - DOUBLE_MANTISSA_BITS;
+		m2 = ieeeMantissa;
+	} else {
+		e2 = (int32_t) ieeeExponent - DOUBLE_BIAS - DOUBLE_MANTISSA_BITS;
+		m2 = (1ull << DOUBLE_MANTISSA_BITS) | ieeeMantissa;
+	}
+
+	if (max_digits > DTOA_FIXED_MAX_DIG)
+		max_digits = DTOA_FIXED_MAX_DIG;
+
+	// Find the leading non-zero block, starting from the highest one
+	// the table covers for this exponent
+	int32_t k;
+	if (e2 >= -DOUBLE_MANTISSA_BITS) {
+		const uint32_t idx = e2 <= 0 ? 0 : ((uint32_t) e2 + 15) / 16;
+		k = __d2fixed_pow10_offset[idx + 1] - __d2fixed_pow10_offset[idx] - 1;
+	} else {
+		k = -1 - __d2fixed_min_block[(uint32_t) -e2 / 16];
+	}
+	uint32_t block;
+	while ((block = d2fixed_block(m2, e2, k)) == 0)
+		k--;
+	int len = decimalLength9(block);
+	int32_t exp = 9 * k + len - 1;
+
+	int ndigs = max_digits;
+	if (fmode && exp + max_decimals + 1 < ndigs)
+		ndigs = exp + max_decimals + 1;
+
+	// When no digits are left in fmode, the value rounds to zero or to
+	// one unit in the last place. The rounding digit is the leading
+	// digit if ndigs is zero, otherwise an implicit zero.
+	if (ndigs <= 0) {
+		bool round_up = false;
+		if (ndigs == 0) {
+			int round = (int) (block / d2fixed_pow10[len - 1]);
+			round_up = round > 5 || (round == 5 && !d2fixed_exact(m2, e2, exp));
+		}
+		dtoa->digits[0] = round_up ? '1' : '0';
+		dtoa->digits[1] = '\0';
+		dtoa->exp = -max_decimals;
+		return 1;
+	}
+
+	// Generate ndigs digits followed by the rounding digit
+	char	*digits = dtoa->digits;
+	int	d = 0;
+	int	round;
+	char	tmp[9];
+
+	for (;;) {
+		int i;
+		for (i = len - 1; i >= 0; i--) {
+			tmp[i] = (char) ('0' + block % 10);
+			block /= 10;
+		}
+		for (i = 0; i < len && d < ndigs; i++)
+			digits[d++] = tmp[i];
+		if (d == ndigs) {
+			if (i < len)
+				round = tmp[i] - '0';
+			else
+				round = (int) (d2fixed_block(m2, e2, k - 1) / 100000000);
+			break;
+		}
+		block = d2fixed_block(m2, e2, --k);
+		len = 9;
+	}
+
+	// Round half to even. The rounding digit sits at 10^(exp - ndigs)
+	bool round_up = round > 5 ||
+		(round == 5 && (!d2fixed_exact(m2, e2, exp - ndigs) ||
+				((digits[ndigs - 1] - '0') & 1)));
+
+	if (round_up) {
+		int i = ndigs - 1;
+		while (i >= 0 && digits[i] == '9')
+			digits[i--] = '0';
+		if (i < 0) {
+			digits[0] = '1';
+			exp++;
+		} else {
+			digits[i]++;
+		}
+	}
+
+	while (ndigs > 1 && digits[ndigs - 1] == '0')
+		ndigs--;
+	digits[ndigs] = '\0';
+	dtoa->exp = exp;
+	return ndigs;
+}
+
+#endif /* _IO_FLOAT_RYU_PRINTF */
@@ -0,0 +1,172 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _EISEL_LEMIRE_H_
+#define _EISEL_LEMIRE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <sys/config.h>
+
+/*
+ * Eisel-Lemire decimal to binary conversion. Multiplying the decimal
+ * significand by a 128-bit approximation of the power of ten almost
+ * always leaves enough bits to round correctly; the rare cases where
+ * it does not are detected and left to the exact ryu code.
+ *
+ * See Daniel Lemire, "Number Parsing at a Gigabyte per Second",
+ * Software: Practice and Experience 51 (8), 2021.
+ */
+
+#define EISEL_LEMIRE_MIN_Q      (-342)
+#define EISEL_LEMIRE_MAX_Q      308
+
+/* Returned when the fast path can't decide the rounding */
+#define EISEL_LEMIRE_FAIL       UINT64_MAX
+
+extern const uint64_t __eisel_lemire_pow5[EISEL_LEMIRE_MAX_Q - EISEL_LEMIRE_MIN_Q + 1][2];
+
+static inline uint64_t
+__eisel_lemire_mul(uint64_t a, uint64_t b, uint64_t *hi)
+{
+#ifdef __SIZEOF_INT128__
+    __uint128_t p = (__uint128_t) a * b;
+    *hi = (uint64_t) (p >> 64);
+    return (uint64_t) p;
+#else
+    uint64_t a_lo = (uint32_t) a, a_hi = a >> 32;
+    uint64_t b_lo = (uint32_t) b, b_hi = b >> 32;
+    uint64_t p00 = a_lo * b_lo;
+    uint64_t p01 = a_lo * b_hi;
+    uint64_t p10 = a_hi * b_lo;
+    uint64_t p11 = a_hi * b_hi;
+    uint64_t mid = (p00 >> 32) + (uint32_t) p01 + (uint32_t) p10;
+
+    *hi = p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+    return (mid << 32) | (uint32_t) p00;
+#endif
+}
+
+/*
+ * Compute the IEEE bits of w * 10**q for a format with 'mant_bits'
+ * explicit significand bits and an exponent bias of 'bias'. The
+ * smallest and largest interesting powers of ten and the range of q
+ * where ties can occur are format constants as well; everything is
+ * inlined so the callers get code specialized for float or double.
+ */
+static inline uint64_t
+__eisel_lemire(uint64_t w, int q, int mant_bits, int bias,
+               int min_q, int max_q, int min_even_q, int max_even_q)
+{
+    uint64_t lo, hi, lo2, hi2, mant;
+    uint64_t mask = UINT64_MAX >> (mant_bits + 3);
+    const uint64_t *pow5;
+    int lz, upper, shift;
+    int32_t e2;
+    int inf = 2 * bias + 1;
+
+    if (w == 0 || q < min_q)
+        return 0;
+    if (q > max_q)
+        return (uint64_t) inf << mant_bits;
+
+    /* Normalize w and form the top 128 bits of w * 5**q */
+    lz = __builtin_clzll(w);
+    w <<= lz;
+    pow5 = __eisel_lemire_pow5[q - EISEL_LEMIRE_MIN_Q];
+    lo = __eisel_lemire_mul(w, pow5[0], &hi);
+    if ((hi & mask) == mask) {
+        /* Truncated bits might carry into the result, add more */
+        lo2 = __eisel_lemire_mul(w, pow5[1], &hi2);
+        (void) lo2;
+        lo += hi2;
+        if (lo < hi2)
+            hi++;
+    }
+
+    /* Can't tell which way to round; only exact for small powers of ten */
+    if (lo == UINT64_MAX && (q < -27 || q > 55))
+        return EISEL_LEMIRE_FAIL;
+
+    upper = (int) (hi >> 63);
+    shift = upper + 64 - mant_bits - 3;
+    mant = hi >> shift;
+
+    /* floor(log2(10**q)) + 63 computed as q * log2(10) in 16.16 */
+    e2 = (int32_t) ((((152170 + 65536) * q) >> 16) + 63) + upper - lz + bias;
+
+    if (e2 <= 0) {
+        /* Subnormal */
+        if (-e2 + 1 >= 64)
+            return 0;
+        mant >>= -e2 + 1;
+        mant += mant & 1;
+        mant >>= 1;
+        /* Rounding may have produced the smallest normal */
+        e2 = mant >= ((uint64_t) 1 << mant_bits);
+        mant &= ((uint64_t) 1 << mant_bits) - 1;
+        return ((uint64_t) e2 << mant_bits) | mant;
+    }
+
+    /* Exactly half way between two values, round to even */
+    if (lo <= 1 && q >= min_even_q && q <= max_even_q &&
+        (mant & 3) == 1 && (mant << shift) == hi)
+        mant &= ~(uint64_t) 1;
+
+    mant += mant & 1;
+    mant >>= 1;
+    if (mant >= ((uint64_t) 2 << mant_bits)) {
+        mant = (uint64_t) 1 << mant_bits;
+        e2++;
+    }
+    mant &= ((uint64_t) 1 << mant_bits) - 1;
+    if (e2 >= inf)
+        return (uint64_t) inf << mant_bits;
+    return ((uint64_t) e2 << mant_bits) | mant;
+}
+
+static inline uint64_t
+__eisel_lemire_double(uint64_t w, int q)
+{
+    return __eisel_lemire(w, q, 52, 1023, -342, 308, -4, 23);
+}
+
+static inline uint64_t
+__eisel_lemire_float(uint64_t w, int q)
+{
+    return __eisel_lemire(w, q, 23, 127, -65, 38, -17, 10);
+}
+
+#endif /* _EISEL_LEMIRE_H_ */
@@ -37,22 +37,11 @@ int
 fgetc(FILE *stream)
 {
 	int rv;
-	__ungetc_t unget;
 
-	if ((stream->flags & __SRD) == 0)
-		return EOF;
-
-	if ((unget = __atomic_exchange_ungetc(&stream->unget, 0)) != 0)
-		return (unsigned char) unget;
-
-	rv = stream->get(stream);
-	if (rv < 0) {
-		/* if != _FDEV_ERR, assume it's _FDEV_EOF */
-		stream->flags |= (rv == _FDEV_ERR)? __SERR: __SEOF;
-		return EOF;
-	}
-
-	return (unsigned char)rv;
+	__flockfile_read(stream);
+	rv = __getc_unlocked(stream);
+	__funlockfile(stream);
+	return rv;
 }
 
 #ifdef _HAVE_ALIAS_ATTRIBUTE
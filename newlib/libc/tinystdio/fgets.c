@@ -41,13 +41,18 @@ fgets(char *str, int size, FILE *stream)
 	if ((stream->flags & __SRD) == 0 || size <= 0)
 		return NULL;
 
+	__flockfile_read(stream);
 	size--;
 	for (c = 0, cp = str; c != '\n' && size > 0; size--, cp++) {
-		if ((c = getc(stream)) == EOF)
-			return NULL;
+		if ((c = __getc_unlocked(stream)) == EOF) {
+			str = NULL;
+			break;
+		}
 		*cp = (char)c;
 	}
-	*cp = '\0';
+	if (str)
+		*cp = '\0';
+	__funlockfile(stream);
 
 	return str;
 }
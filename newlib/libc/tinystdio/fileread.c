@@ -0,0 +1,73 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "stdio_private.h"
+
+size_t
+__file_read(FILE *stream, void *buf, size_t count)
+{
+        struct __file_ext *xf = (struct __file_ext *) stream;
+        char *cp = buf;
+        size_t done = 0;
+        __ungetc_t unget;
+        int c;
+
+        if (!count)
+                return 0;
+
+        if ((stream->flags & __SEXT) && xf->read) {
+                /* Pick up any pending ungetc character first */
+                if ((unget = __atomic_exchange_ungetc(&stream->unget, 0)) != 0)
+                        cp[done++] = (char) unget;
+
+                while (done < count) {
+                        ssize_t this = (xf->read)(stream, cp + done, count - done);
+                        if (this <= 0) {
+                                /* if != _FDEV_ERR, assume it's _FDEV_EOF */
+                                stream->flags |= (this == _FDEV_ERR)? __SERR: __SEOF;
+                                break;
+                        }
+                        done += this;
+                }
+                return done;
+        }
+
+        while (done < count) {
+                if ((c = __getc_unlocked(stream)) == EOF)
+                        break;
+                cp[done++] = (char) c;
+        }
+        return done;
+}
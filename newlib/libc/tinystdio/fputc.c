@@ -36,13 +36,12 @@
 int
 fputc(int c, FILE *stream)
 {
-	if ((stream->flags & __SWR) == 0)
-		return EOF;
+	int rv;
 
-	if (stream->put(c, stream) < 0)
-		return EOF;
-
-	return (unsigned char) c;
+	__flockfile(stream);
+	rv = __putc_unlocked(c, stream);
+	__funlockfile(stream);
+	return rv;
 }
 
 #ifdef _HAVE_ALIAS_ATTRIBUTE
@@ -31,19 +31,22 @@
 
 #include <stdio.h>
 #include "stdio_private.h"
+#include <string.h>
 
 int
 fputs(const char *str, FILE *stream)
 {
-	char c;
+	size_t len;
 	int rv = 0;
 
 	if ((stream->flags & __SWR) == 0)
 		return EOF;
 
-	while ((c = *str++) != '\0')
-		if (stream->put(c, stream) < 0)
-			rv = EOF;
+	len = strlen(str);
+	__flockfile(stream);
+	if (__file_write(stream, str, len) != len)
+		rv = EOF;
+	__funlockfile(stream);
 
 	return rv;
 }
@@ -30,25 +30,26 @@
 /* $Id: fread.c 1944 2009-04-01 23:12:20Z arcanum $ */
 
 #include <stdio.h>
+#include <errno.h>
+#include <stdint.h>
 #include "stdio_private.h"
 
 size_t
 fread(void *ptr, size_t size, size_t nmemb, FILE *stream)
 {
-	size_t i, j;
-	uint8_t *cp;
-	int c;
+	size_t ret;
 
 	if ((stream->flags & __SRD) == 0 || size == 0)
 		return 0;
 
-	for (i = 0, cp = (uint8_t *)ptr; i < nmemb; i++)
-		for (j = 0; j < size; j++) {
-			c = getc(stream);
-			if (c == EOF)
-				return i;
-			*cp++ = (uint8_t)c;
-		}
+	/* size * nmemb would wrap around */
+	if (nmemb > SIZE_MAX / size) {
+		errno = EOVERFLOW;
+		return 0;
+	}
 
-	return i;
+	__flockfile_read(stream);
+	ret = __file_read(stream, ptr, size * nmemb) / size;
+	__funlockfile(stream);
+	return ret;
 }
@@ -30,21 +30,26 @@
 /* $Id: fwrite.c 1944 2009-04-01 23:12:20Z arcanum $ */
 
 #include <stdio.h>
+#include <errno.h>
+#include <stdint.h>
 #include "stdio_private.h"
 
 size_t
 fwrite(const void *ptr, size_t size, size_t nmemb, FILE *stream)
 {
-	size_t i, j;
-	const uint8_t *cp;
+	size_t ret;
 
 	if ((stream->flags & __SWR) == 0 || size == 0)
 		return 0;
 
-	for (i = 0, cp = (const uint8_t *)ptr; i < nmemb; i++)
-		for (j = 0; j < size; j++)
-			if (stream->put(*cp++, stream) < 0)
-				return i;
+	/* size * nmemb would wrap around */
+	if (nmemb > SIZE_MAX / size) {
+		errno = EOVERFLOW;
+		return 0;
+	}
 
-	return i;
+	__flockfile(stream);
+	ret = __file_write(stream, ptr, size * nmemb) / size;
+	__funlockfile(stream);
+	return ret;
 }
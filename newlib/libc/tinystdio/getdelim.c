@@ -0,0 +1,143 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "stdio_private.h"
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define GETDELIM_MIN    64
+
+/* Make room for 'need' bytes, growing the buffer geometrically */
+static bool
+getdelim_grow(char **lineptr, size_t *n, size_t need)
+{
+        size_t size;
+        char *line;
+
+        if (need <= *n)
+                return true;
+        size = *n * 2;
+        if (size < need)
+                size = need;
+        if (size < GETDELIM_MIN)
+                size = GETDELIM_MIN;
+        line = realloc(*lineptr, size);
+        if (!line)
+                return false;
+        *lineptr = line;
+        *n = size;
+        return true;
+}
+
+ssize_t
+getdelim(char **lineptr, size_t *n, int delim, FILE *stream)
+{
+        size_t len = 0;
+        bool done = false;
+        __ungetc_t unget;
+        int c;
+
+        if (!lineptr || !n) {
+                errno = EINVAL;
+                return -1;
+        }
+        if (!*lineptr)
+                *n = 0;
+
+        if ((stream->flags & __SRD) == 0)
+                return -1;
+
+        __flockfile_read(stream);
+
+        /* Pick up any pending ungetc character first */
+        if ((unget = __atomic_exchange_ungetc(&stream->unget, 0)) != 0) {
+                if (!getdelim_grow(lineptr, n, 2))
+                        goto nomem;
+                (*lineptr)[len++] = (char) unget;
+                done = (unsigned char) unget == (unsigned char) delim;
+        }
+
+        if (stream->flags & __SBUF) {
+                /*
+                 * Copy whole runs out of the bufio buffer, using
+                 * memchr to find the delimiter
+                 */
+                struct __file_bufio *bf = (struct __file_bufio *) stream;
+
+                while (!done) {
+                        ssize_t avail = __bufio_fill(stream);
+                        const char *start, *end;
+                        size_t take;
+
+                        if (avail <= 0) {
+                                /* if != _FDEV_ERR, assume it's _FDEV_EOF */
+                                stream->flags |= (avail == _FDEV_ERR)? __SERR: __SEOF;
+                                break;
+                        }
+                        start = bf->buf + bf->off;
+                        end = memchr(start, delim, avail);
+                        take = end ? (size_t) (end - start) + 1 : (size_t) avail;
+                        if (!getdelim_grow(lineptr, n, len + take + 1))
+                                goto nomem;
+                        memcpy(*lineptr + len, start, take);
+                        bf->off += take;
+                        len += take;
+                        done = end != NULL;
+                }
+        } else {
+                while (!done) {
+                        if ((c = __getc_unlocked(stream)) == EOF)
+                                break;
+                        if (!getdelim_grow(lineptr, n, len + 2))
+                                goto nomem;
+                        (*lineptr)[len++] = (char) c;
+                        done = c == (unsigned char) delim;
+                }
+        }
+
+        __funlockfile(stream);
+
+        if (len == 0)
+                return -1;
+        (*lineptr)[len] = '\0';
+        return (ssize_t) len;
+
+nomem:
+        stream->flags |= __SERR;
+        __funlockfile(stream);
+        errno = ENOMEM;
+        return -1;
+}
@@ -41,12 +41,17 @@ gets(char *str)
 	if ((stdin->flags & __SRD) == 0)
 		return NULL;
 
+	__flockfile_read(stdin);
 	for (c = 0, cp = str; c != '\n'; cp++) {
-		if ((c = getchar()) == EOF)
-			return NULL;
+		if ((c = __getc_unlocked(stdin)) == EOF) {
+			str = NULL;
+			break;
+		}
 		*cp = (char)c;
 	}
-	*--cp = '\0';
+	if (str)
+		*--cp = '\0';
+	__funlockfile(stdin);
 
 	return str;
 }
@@ -0,0 +1,224 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "stdio_private.h"
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wchar.h>
+
+/*
+ * Write-only streams collecting output in a malloc'd buffer which
+ * doubles in size as needed. Sizes and positions are counted in
+ * elements: bytes for open_memstream, wide characters for
+ * open_wmemstream. The buffer always holds a terminator after the
+ * last element written; *bufp and *sizep are updated on flush and
+ * close.
+ */
+
+#define MEMSTREAM_MIN   64
+
+struct __file_memstream {
+        struct __file_ext xfile;
+        void    **bufp;
+        size_t  *sizep;
+        char    *buf;
+        size_t  size;   /* allocated elements, not counting the terminator */
+        size_t  pos;    /* current position */
+        size_t  len;    /* elements written */
+        uint8_t esize;  /* size of one element */
+        mbstate_t mbs;  /* pending multi-byte sequence for wide streams */
+};
+
+/* Make room for 'need' elements and zero any gap left by seeking past the end */
+static bool
+__memstream_reserve(struct __file_memstream *mf, size_t need)
+{
+        if (need > mf->size) {
+                size_t size = mf->size * 2;
+                char *buf;
+
+                if (size < need)
+                        size = need;
+                buf = realloc(mf->buf, (size + 1) * mf->esize);
+                if (!buf)
+                        return false;
+                mf->buf = buf;
+                mf->size = size;
+        }
+        if (mf->pos > mf->len)
+                memset(mf->buf + mf->len * mf->esize, 0, (mf->pos - mf->len) * mf->esize);
+        return true;
+}
+
+static void
+__memstream_advance(struct __file_memstream *mf, size_t count)
+{
+        mf->pos += count;
+        if (mf->pos > mf->len) {
+                mf->len = mf->pos;
+                memset(mf->buf + mf->len * mf->esize, 0, mf->esize);
+        }
+}
+
+static int
+__memstream_put(char c, FILE *f)
+{
+        struct __file_memstream *mf = (struct __file_memstream *) f;
+
+        if (mf->esize == 1) {
+                if (!__memstream_reserve(mf, mf->pos + 1))
+                        return _FDEV_ERR;
+                mf->buf[mf->pos] = c;
+        } else {
+                wchar_t wc;
+                size_t r = mbrtowc(&wc, &c, 1, &mf->mbs);
+
+                if (r == (size_t) -2)
+                        return (unsigned char) c;
+                if (r == (size_t) -1) {
+                        memset(&mf->mbs, 0, sizeof(mf->mbs));
+                        return _FDEV_ERR;
+                }
+                if (!__memstream_reserve(mf, mf->pos + 1))
+                        return _FDEV_ERR;
+                ((wchar_t *) mf->buf)[mf->pos] = wc;
+        }
+        __memstream_advance(mf, 1);
+        return (unsigned char) c;
+}
+
+static ssize_t
+__memstream_write(FILE *f, const void *buf, size_t count)
+{
+        struct __file_memstream *mf = (struct __file_memstream *) f;
+
+        if (!__memstream_reserve(mf, mf->pos + count))
+                return _FDEV_ERR;
+        memcpy(mf->buf + mf->pos, buf, count);
+        __memstream_advance(mf, count);
+        return count;
+}
+
+static int
+__memstream_flush(FILE *f)
+{
+        struct __file_memstream *mf = (struct __file_memstream *) f;
+
+        *mf->bufp = mf->buf;
+        *mf->sizep = mf->pos < mf->len ? mf->pos : mf->len;
+        return 0;
+}
+
+static off_t
+__memstream_seek(FILE *f, off_t offset, int whence)
+{
+        struct __file_memstream *mf = (struct __file_memstream *) f;
+
+        switch (whence) {
+        case SEEK_SET:
+                break;
+        case SEEK_CUR:
+                offset += mf->pos;
+                break;
+        case SEEK_END:
+                offset += mf->len;
+                break;
+        default:
+                errno = EINVAL;
+                return EOF;
+        }
+        if (offset < 0) {
+                errno = EINVAL;
+                return EOF;
+        }
+        mf->pos = offset;
+        return offset;
+}
+
+static int
+__memstream_close(FILE *f)
+{
+        /* The buffer now belongs to the application */
+        __memstream_flush(f);
+        free(f);
+        return 0;
+}
+
+static FILE *
+__open_memstream(void **bufp, size_t *sizep, uint8_t esize)
+{
+        struct __file_memstream *mf;
+
+        if (!bufp || !sizep) {
+                errno = EINVAL;
+                return NULL;
+        }
+
+        mf = calloc(1, sizeof(struct __file_memstream));
+        if (!mf)
+                return NULL;
+
+        *mf = (struct __file_memstream) {
+                .xfile = FDEV_SETUP_EXT_BLOCK(__memstream_put, NULL, __memstream_flush,
+                                              __memstream_close, __memstream_seek, NULL,
+                                              esize == 1 ? __memstream_write : NULL, NULL,
+                                              __SWR),
+                .bufp = bufp,
+                .sizep = sizep,
+                .esize = esize,
+        };
+
+        mf->buf = calloc(MEMSTREAM_MIN + 1, esize);
+        if (!mf->buf) {
+                free(mf);
+                return NULL;
+        }
+        mf->size = MEMSTREAM_MIN;
+        __memstream_flush(&mf->xfile.cfile.file);
+        return &mf->xfile.cfile.file;
+}
+
+FILE *
+open_memstream(char **bufp, size_t *sizep)
+{
+        return __open_memstream((void **) bufp, sizep, 1);
+}
+
+FILE *
+open_wmemstream(wchar_t **bufp, size_t *sizep)
+{
+        return __open_memstream((void **) bufp, sizep, sizeof(wchar_t));
+}
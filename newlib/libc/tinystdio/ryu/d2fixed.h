@@ -0,0 +1,61 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RYU_D2FIXED_H_
+#define _RYU_D2FIXED_H_
+
+#include <stdint.h>
+#include <sys/config.h>
+
+/*
+ * Tables for the fixed-precision ryu engine in dtoa_ryu_printf.c,
+ * generated as described in "Ryu revisited: printf floating point
+ * conversion" by Ulf Adams.
+ */
+
+/* Index i holds integer blocks for binary exponents up to 16i */
+#define D2FIXED_POW10_INDEX	62
+
+/* Index i holds fraction blocks for binary exponents -16i to -16i - 15 */
+#define D2FIXED_POW10_INDEX_2	68
+
+extern const uint16_t __d2fixed_pow10_offset[D2FIXED_POW10_INDEX + 1];
+extern const uint64_t __d2fixed_pow10[][3];
+
+extern const uint8_t __d2fixed_min_block[D2FIXED_POW10_INDEX_2];
+extern const uint16_t __d2fixed_pow10_offset_2[D2FIXED_POW10_INDEX_2 + 1];
+extern const uint64_t __d2fixed_pow10_2[][3];
+
+#endif /* _RYU_D2FIXED_H_ */
@@ -0,0 +1,4495 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "ryu/d2fixed.h"
+
+#ifdef _IO_FLOAT_RYU_PRINTF
+
+/*
+ * Integer part. Entry k of index i is 2**(16i + 120) / 10**(9k),
+ * rounded up and reduced modulo 10**9 * 2**136, held as { low, middle,
+ * high } 64-bit words. Index i covers binary exponents up to 16i and
+ * lists only the blocks of nine digits a 53-bit significand can reach.
+ */
+
+const uint16_t __d2fixed_pow10_offset[D2FIXED_POW10_INDEX + 1] = {
+    0, 2, 5, 8, 12, 16, 21, 26,
+    32, 39, 46, 54, 62, 71, 80, 90,
+    100, 111, 122, 134, 146, 159, 173, 187,
+    202, 217, 233, 249, 266, 283, 301, 319,
+    338, 357, 377, 397, 418, 440, 462, 485,
+    508, 532, 556, 581, 606, 632, 658, 685,
+    712, 740, 768, 797, 827, 857, 888, 919,
+    951, 983, 1016, 1049, 1083, 1117, 1152,
+};
+
+const uint64_t __d2fixed_pow10[][3] = {
+    /* 0 */
+    { 0x0000000000000000ULL, 0x0100000000000000ULL, 0x0000000000000000ULL },
+    { 0x09b5a52cb98b4055ULL, 0x00000000044b82faULL, 0x0000000000000000ULL },
+    /* 1 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000100ULL },
+    { 0xa52cb98b405447c5ULL, 0x0000044b82fa09b5ULL, 0x0000000000000000ULL },
+    { 0x5dd1d243aba0e760ULL, 0x0000000000001272ULL, 0x0000000000000000ULL },
+    /* 2 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000001000000ULL },
+    { 0xb98b405447c4a982ULL, 0x044b82fa09b5a52cULL, 0x0000000000000000ULL },
+    { 0xd243aba0e75fe646ULL, 0x0000000012725dd1ULL, 0x0000000000000000ULL },
+    /* 3 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001194d80000ULL },
+    { 0x405447c4a98187efULL, 0x82fa09b5a52cb98bULL, 0x000000000000044bULL },
+    { 0xaba0e75fe645cc49ULL, 0x000012725dd1d243ULL, 0x0000000000000000ULL },
+    { 0x68dbc8f03f243bb0ULL, 0x0000000000004f3aULL, 0x0000000000000000ULL },
+    /* 4 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000003a376c0000ULL },
+    { 0x47c4a98187eebb23ULL, 0x09b5a52cb98b4054ULL, 0x00000000044b82faULL },
+    { 0xe75fe645cc4873faULL, 0x12725dd1d243aba0ULL, 0x0000000000000000ULL },
+    { 0xc8f03f243baf5133ULL, 0x000000004f3a68dbULL, 0x0000000000000000ULL },
+    /* 5 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002a4ae60000ULL },
+    { 0xa98187eebb22f009ULL, 0xa52cb98b405447c4ULL, 0x0000001aa0c609b5ULL },
+    { 0xe645cc4873f9e65bULL, 0x5dd1d243aba0e75fULL, 0x0000000000001272ULL },
+    { 0x3f243baf513267abULL, 0x00004f3a68dbc8f0ULL, 0x0000000000000000ULL },
+    { 0x4932d2e725a5bbcbULL, 0x0000000000015448ULL, 0x0000000000000000ULL },
+    /* 6 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000a69ce0000ULL },
+    { 0x87eebb22f008d5d7ULL, 0xb98b405447c4a981ULL, 0x00000030da53a52cULL },
+    { 0xcc4873f9e65afe69ULL, 0xd243aba0e75fe645ULL, 0x0000000012725dd1ULL },
+    { 0x3baf513267aa9a3fULL, 0x4f3a68dbc8f03f24ULL, 0x0000000000000000ULL },
+    { 0xd2e725a5bbca17a4ULL, 0x0000000154484932ULL, 0x0000000000000000ULL },
+    /* 7 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000206c060000ULL },
+    { 0xbb22f008d5d64f9dULL, 0x405447c4a98187eeULL, 0x0000000fc178b98bULL },
+    { 0x73f9e65afe688c93ULL, 0xaba0e75fe645cc48ULL, 0x0000000d997bd243ULL },
+    { 0x513267aa9a3ee525ULL, 0x68dbc8f03f243bafULL, 0x0000000000004f3aULL },
+    { 0x25a5bbca17a3aba2ULL, 0x000154484932d2e7ULL, 0x0000000000000000ULL },
+    { 0x6b4ddaae4689eb04ULL, 0x000000000005b580ULL, 0x0000000000000000ULL },
+    /* 8 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000139f800000ULL },
+    { 0xf008d5d64f9c394bULL, 0x47c4a98187eebb22ULL, 0x00000025769d4054ULL },
+    { 0xe65afe688c928e20ULL, 0xe75fe645cc4873f9ULL, 0x000000332c33aba0ULL },
+    { 0x67aa9a3ee524f8e1ULL, 0xc8f03f243baf5132ULL, 0x000000004f3a68dbULL },
+    { 0xbbca17a3aba173d4ULL, 0x54484932d2e725a5ULL, 0x0000000000000001ULL },
+    { 0xdaae4689eb03dcbfULL, 0x00000005b5806b4dULL, 0x0000000000000000ULL },
+    { 0x851a0b548ea3c996ULL, 0x0000000000000018ULL, 0x0000000000000000ULL },
+    /* 9 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002dc9fa0000ULL },
+    { 0xd5d64f9c394ae922ULL, 0xa98187eebb22f008ULL, 0x00000016540e47c4ULL },
+    { 0xfe688c928e1f2196ULL, 0xe645cc4873f9e65aULL, 0x00000037efd0e75fULL },
+    { 0x9a3ee524f8e02891ULL, 0x3f243baf513267aaULL, 0x00000010d493c8f0ULL },
+    { 0x17a3aba173d3d5fdULL, 0x4932d2e725a5bbcaULL, 0x0000000000015448ULL },
+    { 0x4689eb03dcbe2fe9ULL, 0x0005b5806b4ddaaeULL, 0x0000000000000000ULL },
+    { 0x0b548ea3c99552fdULL, 0x000000000018851aULL, 0x0000000000000000ULL },
+    /* 10 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001e28a60000ULL },
+    { 0x4f9c394ae9213016ULL, 0x87eebb22f008d5d6ULL, 0x000000104048a981ULL },
+    { 0x8c928e1f2195818bULL, 0xcc4873f9e65afe68ULL, 0x000000086fa9e645ULL },
+    { 0xe524f8e0289064e4ULL, 0x3baf513267aa9a3eULL, 0x0000000bd5563f24ULL },
+    { 0xaba173d3d5fc130dULL, 0xd2e725a5bbca17a3ULL, 0x0000000154484932ULL },
+    { 0xeb03dcbe2fe86913ULL, 0xb5806b4ddaae4689ULL, 0x0000000000000005ULL },
+    { 0x8ea3c99552fc2988ULL, 0x00000018851a0b54ULL, 0x0000000000000000ULL },
+    { 0x4ff258c744320748ULL, 0x0000000000000069ULL, 0x0000000000000000ULL },
+    /* 11 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000037957a0000ULL },
+    { 0x394ae92130153561ULL, 0xbb22f008d5d64f9cULL, 0x00000010de8987eeULL },
+    { 0x8e1f2195818ae780ULL, 0x73f9e65afe688c92ULL, 0x00000028d1b7cc48ULL },
+    { 0xf8e0289064e3cffbULL, 0x513267aa9a3ee524ULL, 0x00000035d1703bafULL },
+    { 0x73d3d5fc130c23b8ULL, 0x25a5bbca17a3aba1ULL, 0x0000001de660d2e7ULL },
+    { 0xdcbe2fe869126827ULL, 0x6b4ddaae4689eb03ULL, 0x000000000005b580ULL },
+    { 0xc99552fc298784d8ULL, 0x0018851a0b548ea3ULL, 0x0000000000000000ULL },
+    { 0x58c7443207477640ULL, 0x0000000000694ff2ULL, 0x0000000000000000ULL },
+    /* 12 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000822720000ULL },
+    { 0xe9213015356022f0ULL, 0xf008d5d64f9c394aULL, 0x0000003a2f30bb22ULL },
+    { 0x2195818ae77f3c37ULL, 0xe65afe688c928e1fULL, 0x0000000bbc5e73f9ULL },
+    { 0x289064e3cffa15acULL, 0x67aa9a3ee524f8e0ULL, 0x00000026967d5132ULL },
+    { 0xd5fc130c23b7aa2eULL, 0xbbca17a3aba173d3ULL, 0x00000012207925a5ULL },
+    { 0x2fe8691268269aa8ULL, 0xdaae4689eb03dcbeULL, 0x00000005b5806b4dULL },
+    { 0x52fc298784d710d3ULL, 0x851a0b548ea3c995ULL, 0x0000000000000018ULL },
+    { 0x44320747763f868dULL, 0x000000694ff258c7ULL, 0x0000000000000000ULL },
+    { 0x5016d841baa4644cULL, 0x00000000000001c4ULL, 0x0000000000000000ULL },
+    /* 13 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000020ea00000ULL },
+    { 0x3015356022ef3217ULL, 0xd5d64f9c394ae921ULL, 0x000000152fa6f008ULL },
+    { 0x818ae77f3c36a08dULL, 0xfe688c928e1f2195ULL, 0x00000027b8b3e65aULL },
+    { 0x64e3cffa15ab8bbaULL, 0x9a3ee524f8e02890ULL, 0x0000002f0da467aaULL },
+    { 0x130c23b7aa2da19cULL, 0x17a3aba173d3d5fcULL, 0x0000002893a1bbcaULL },
+    { 0x691268269aa7acc6ULL, 0x4689eb03dcbe2fe8ULL, 0x00000006105bdaaeULL },
+    { 0x298784d710d2d086ULL, 0x0b548ea3c99552fcULL, 0x000000000018851aULL },
+    { 0x0747763f868cd01eULL, 0x00694ff258c74432ULL, 0x0000000000000000ULL },
+    { 0xd841baa4644b8db5ULL, 0x0000000001c45016ULL, 0x0000000000000000ULL },
+    /* 14 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000031e5ee0000ULL },
+    { 0x356022ef3216417aULL, 0x4f9c394ae9213015ULL, 0x00000018579cd5d6ULL },
+    { 0xe77f3c36a08cce4fULL, 0x8c928e1f2195818aULL, 0x0000000ea4d6fe68ULL },
+    { 0xcffa15ab8bb9ccc3ULL, 0xe524f8e0289064e3ULL, 0x000000261b849a3eULL },
+    { 0x23b7aa2da19b9a3dULL, 0xaba173d3d5fc130cULL, 0x000000201c8e17a3ULL },
+    { 0x68269aa7acc51b40ULL, 0xeb03dcbe2fe86912ULL, 0x00000013b0004689ULL },
+    { 0x84d710d2d085b92bULL, 0x8ea3c99552fc2987ULL, 0x00000018851a0b54ULL },
+    { 0x763f868cd01d569bULL, 0x4ff258c744320747ULL, 0x0000000000000069ULL },
+    { 0xbaa4644b8db4c788ULL, 0x000001c45016d841ULL, 0x0000000000000000ULL },
+    { 0xab3c855a0e1517d8ULL, 0x0000000000000796ULL, 0x0000000000000000ULL },
+    /* 15 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000245faa0000ULL },
+    { 0x22ef32164179b6c0ULL, 0x394ae92130153560ULL, 0x000000221f5e4f9cULL },
+    { 0x3c36a08cce4e0a37ULL, 0x8e1f2195818ae77fULL, 0x000000089bb68c92ULL },
+    { 0x15ab8bb9ccc2933cULL, 0xf8e0289064e3cffaULL, 0x000000259750e524ULL },
+    { 0xaa2da19b9a3cab82ULL, 0x73d3d5fc130c23b7ULL, 0x00000000e635aba1ULL },
+    { 0x9aa7acc51b3fd35cULL, 0xdcbe2fe869126826ULL, 0x00000026227deb03ULL },
+    { 0x10d2d085b92a647fULL, 0xc99552fc298784d7ULL, 0x000000386cfe8ea3ULL },
+    { 0x868cd01d569a53f5ULL, 0x58c744320747763fULL, 0x0000000000694ff2ULL },
+    { 0x644b8db4c7871bc4ULL, 0x01c45016d841baa4ULL, 0x0000000000000000ULL },
+    { 0x855a0e1517d71395ULL, 0x000000000796ab3cULL, 0x0000000000000000ULL },
+    /* 16 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001171060000ULL },
+    { 0x32164179b6bf082dULL, 0xe9213015356022efULL, 0x000000073f90394aULL },
+    { 0xa08cce4e0a366281ULL, 0x2195818ae77f3c36ULL, 0x0000003430e28e1fULL },
+    { 0x8bb9ccc2933b76b5ULL, 0x289064e3cffa15abULL, 0x000000315266f8e0ULL },
+    { 0xa19b9a3cab811d57ULL, 0xd5fc130c23b7aa2dULL, 0x0000002c480973d3ULL },
+    { 0xacc51b3fd35b883fULL, 0x2fe8691268269aa7ULL, 0x00000022c469dcbeULL },
+    { 0xd085b92a647eb512ULL, 0x52fc298784d710d2ULL, 0x0000002e6533c995ULL },
+    { 0xd01d569a53f4e888ULL, 0x44320747763f868cULL, 0x0000002db52858c7ULL },
+    { 0x8db4c7871bc3602dULL, 0x5016d841baa4644bULL, 0x00000000000001c4ULL },
+    { 0x0e1517d71394ca12ULL, 0x00000796ab3c855aULL, 0x0000000000000000ULL },
+    { 0xb309321cde0be3b6ULL, 0x0000000000002097ULL, 0x0000000000000000ULL },
+    /* 17 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000007ba260000ULL },
+    { 0x4179b6bf082ce3feULL, 0x3015356022ef3216ULL, 0x00000022cf40e921ULL },
+    { 0xce4e0a36628033a5ULL, 0x818ae77f3c36a08cULL, 0x000000219e8f2195ULL },
+    { 0xccc2933b76b4fa42ULL, 0x64e3cffa15ab8bb9ULL, 0x0000003ab0ce2890ULL },
+    { 0x9a3cab811d56fa9dULL, 0x130c23b7aa2da19bULL, 0x000000361cbdd5fcULL },
+    { 0x1b3fd35b883ed9c6ULL, 0x691268269aa7acc5ULL, 0x0000003ab60a2fe8ULL },
+    { 0xb92a647eb5110568ULL, 0x298784d710d2d085ULL, 0x0000000ba5ed52fcULL },
+    { 0x569a53f4e887a6abULL, 0x0747763f868cd01dULL, 0x0000000551a74432ULL },
+    { 0xc7871bc3602cbb46ULL, 0xd841baa4644b8db4ULL, 0x0000000001c45016ULL },
+    { 0x17d71394ca11fdcfULL, 0x0796ab3c855a0e15ULL, 0x0000000000000000ULL },
+    { 0x321cde0be3b5001aULL, 0x000000002097b309ULL, 0x0000000000000000ULL },
+    /* 18 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000004f0200000ULL },
+    { 0xb6bf082ce3fd84c0ULL, 0x356022ef32164179ULL, 0x0000002057573015ULL },
+    { 0x0a36628033a40be8ULL, 0xe77f3c36a08cce4eULL, 0x000000350aad818aULL },
+    { 0x933b76b4fa414024ULL, 0xcffa15ab8bb9ccc2ULL, 0x00000002d39264e3ULL },
+    { 0xab811d56fa9c85a6ULL, 0x23b7aa2da19b9a3cULL, 0x000000044922130cULL },
+    { 0xd35b883ed9c580d8ULL, 0x68269aa7acc51b3fULL, 0x0000001f8d8e6912ULL },
+    { 0x647eb51105677ca6ULL, 0x84d710d2d085b92aULL, 0x00000010a3762987ULL },
+    { 0x53f4e887a6aafea9ULL, 0x763f868cd01d569aULL, 0x0000000f4dc20747ULL },
+    { 0x1bc3602cbb453d3aULL, 0xbaa4644b8db4c787ULL, 0x000000231490d841ULL },
+    { 0x1394ca11fdce19b5ULL, 0xab3c855a0e1517d7ULL, 0x0000000000000796ULL },
+    { 0xde0be3b50019a304ULL, 0x00002097b309321cULL, 0x0000000000000000ULL },
+    { 0xea76c619ef3657ecULL, 0x0000000000008bfbULL, 0x0000000000000000ULL },
+    /* 19 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000016622e0000ULL },
+    { 0x082ce3fd84bf5bbaULL, 0x22ef32164179b6bfULL, 0x0000001d9fcf3560ULL },
+    { 0x628033a40be73648ULL, 0x3c36a08cce4e0a36ULL, 0x0000003a3a34e77fULL },
+    { 0x76b4fa41402348ecULL, 0x15ab8bb9ccc2933bULL, 0x0000002ac345cffaULL },
+    { 0x1d56fa9c85a535e0ULL, 0xaa2da19b9a3cab81ULL, 0x00000008fcfc23b7ULL },
+    { 0x883ed9c580d75888ULL, 0x9aa7acc51b3fd35bULL, 0x0000003212ea6826ULL },
+    { 0xb51105677ca5ca8fULL, 0x10d2d085b92a647eULL, 0x0000000eca6b84d7ULL },
+    { 0xe887a6aafea8cb98ULL, 0x868cd01d569a53f4ULL, 0x000000264683763fULL },
+    { 0x602cbb453d393824ULL, 0x644b8db4c7871bc3ULL, 0x0000000e1753baa4ULL },
+    { 0xca11fdce19b4aed7ULL, 0x855a0e1517d71394ULL, 0x000000000796ab3cULL },
+    { 0xe3b50019a3030a33ULL, 0x2097b309321cde0bULL, 0x0000000000000000ULL },
+    { 0xc619ef3657eb4edcULL, 0x000000008bfbea76ULL, 0x0000000000000000ULL },
+    /* 20 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000037b12c0000ULL },
+    { 0xe3fd84bf5bb9d3e6ULL, 0x32164179b6bf082cULL, 0x0000000cb80822efULL },
+    { 0x33a40be73647459eULL, 0xa08cce4e0a366280ULL, 0x00000027f0ed3c36ULL },
+    { 0xfa41402348ebc591ULL, 0x8bb9ccc2933b76b4ULL, 0x0000000a9fd615abULL },
+    { 0xfa9c85a535df608fULL, 0xa19b9a3cab811d56ULL, 0x000000270a33aa2dULL },
+    { 0xd9c580d75887ffe6ULL, 0xacc51b3fd35b883eULL, 0x0000003115869aa7ULL },
+    { 0x05677ca5ca8e7681ULL, 0xd085b92a647eb511ULL, 0x00000020c91b10d2ULL },
+    { 0xa6aafea8cb971a7dULL, 0xd01d569a53f4e887ULL, 0x000000119757868cULL },
+    { 0xbb453d39382309ecULL, 0x8db4c7871bc3602cULL, 0x00000014f7b2644bULL },
+    { 0xfdce19b4aed6bf45ULL, 0x0e1517d71394ca11ULL, 0x0000002351fc855aULL },
+    { 0x0019a3030a3231c0ULL, 0xb309321cde0be3b5ULL, 0x0000000000002097ULL },
+    { 0xef3657eb4edb3c56ULL, 0x00008bfbea76c619ULL, 0x0000000000000000ULL },
+    { 0x163246e89954e9a9ULL, 0x000000000002593aULL, 0x0000000000000000ULL },
+    /* 21 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000052e8c0000ULL },
+    { 0x84bf5bb9d3e589a1ULL, 0x4179b6bf082ce3fdULL, 0x00000020c8af3216ULL },
+    { 0x0be73647459d41efULL, 0xce4e0a36628033a4ULL, 0x0000002b4288a08cULL },
+    { 0x402348ebc590999cULL, 0xccc2933b76b4fa41ULL, 0x000000243aa18bb9ULL },
+    { 0x85a535df608eed90ULL, 0x9a3cab811d56fa9cULL, 0x0000002de475a19bULL },
+    { 0x80d75887ffe5cab7ULL, 0x1b3fd35b883ed9c5ULL, 0x0000001f2287acc5ULL },
+    { 0x7ca5ca8e7680a354ULL, 0xb92a647eb5110567ULL, 0x00000006d4b2d085ULL },
+    { 0xfea8cb971a7c381eULL, 0x569a53f4e887a6aaULL, 0x0000002a174ad01dULL },
+    { 0x3d39382309eb172fULL, 0xc7871bc3602cbb45ULL, 0x00000004e93f8db4ULL },
+    { 0x19b4aed6bf442c49ULL, 0x17d71394ca11fdceULL, 0x00000002241c0e15ULL },
+    { 0xa3030a3231bf90b0ULL, 0x321cde0be3b50019ULL, 0x000000002097b309ULL },
+    { 0x57eb4edb3c55b65bULL, 0x8bfbea76c619ef36ULL, 0x0000000000000000ULL },
+    { 0x46e89954e9a81fe4ULL, 0x00000002593a1632ULL, 0x0000000000000000ULL },
+    { 0x163ff802a3426a8dULL, 0x000000000000000aULL, 0x0000000000000000ULL },
+    /* 22 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001c56b60000ULL },
+    { 0x5bb9d3e589a0ece4ULL, 0xb6bf082ce3fd84bfULL, 0x000000122b8a4179ULL },
+    { 0x3647459d41eefc20ULL, 0x0a36628033a40be7ULL, 0x0000002d4d94ce4eULL },
+    { 0x48ebc590999b3443ULL, 0x933b76b4fa414023ULL, 0x0000000e2035ccc2ULL },
+    { 0x35df608eed8f8e22ULL, 0xab811d56fa9c85a5ULL, 0x0000000edc4d9a3cULL },
+    { 0x5887ffe5cab6b936ULL, 0xd35b883ed9c580d7ULL, 0x00000009decb1b3fULL },
+    { 0xca8e7680a3538142ULL, 0x647eb51105677ca5ULL, 0x00000023eea9b92aULL },
+    { 0xcb971a7c381d07a6ULL, 0x53f4e887a6aafea8ULL, 0x0000001f7517569aULL },
+    { 0x382309eb172e3e61ULL, 0x1bc3602cbb453d39ULL, 0x00000032138ec787ULL },
+    { 0xaed6bf442c480fbeULL, 0x1394ca11fdce19b4ULL, 0x00000006b8a117d7ULL },
+    { 0x0a3231bf90aff414ULL, 0xde0be3b50019a303ULL, 0x0000003aa75b321cULL },
+    { 0x4edb3c55b65a883eULL, 0xea76c619ef3657ebULL, 0x0000000000008bfbULL },
+    { 0x9954e9a81fe35444ULL, 0x0002593a163246e8ULL, 0x0000000000000000ULL },
+    { 0xf802a3426a8ca07dULL, 0x00000000000a163fULL, 0x0000000000000000ULL },
+    /* 23 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002c7a640000ULL },
+    { 0xd3e589a0ece3dd4fULL, 0x082ce3fd84bf5bb9ULL, 0x0000000ca995b6bfULL },
+    { 0x459d41eefc1fa7aeULL, 0x628033a40be73647ULL, 0x0000000dd8500a36ULL },
+    { 0xc590999b34429ee6ULL, 0x76b4fa41402348ebULL, 0x0000001e0fd4933bULL },
+    { 0x608eed8f8e21f320ULL, 0x1d56fa9c85a535dfULL, 0x000000154fbeab81ULL },
+    { 0xffe5cab6b9358329ULL, 0x883ed9c580d75887ULL, 0x0000001d8057d35bULL },
+    { 0x7680a3538141b711ULL, 0xb51105677ca5ca8eULL, 0x0000003905ac647eULL },
+    { 0x1a7c381d07a5741fULL, 0xe887a6aafea8cb97ULL, 0x0000002d7d4c53f4ULL },
+    { 0x09eb172e3e605ad2ULL, 0x602cbb453d393823ULL, 0x00000022a4891bc3ULL },
+    { 0xbf442c480fbddfa1ULL, 0xca11fdce19b4aed6ULL, 0x00000002c4ab1394ULL },
+    { 0x31bf90aff4138edcULL, 0xe3b50019a3030a32ULL, 0x0000001ba778de0bULL },
+    { 0x3c55b65a883d7eabULL, 0xc619ef3657eb4edbULL, 0x000000008bfbea76ULL },
+    { 0xe9a81fe35443e1c0ULL, 0x593a163246e89954ULL, 0x0000000000000002ULL },
+    { 0xa3426a8ca07c2dccULL, 0x0000000a163ff802ULL, 0x0000000000000000ULL },
+    { 0x52adc44bace4a762ULL, 0x000000000000002bULL, 0x0000000000000000ULL },
+    /* 24 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000a73b00000ULL },
+    { 0x89a0ece3dd4e6909ULL, 0xe3fd84bf5bb9d3e5ULL, 0x0000001dd96b082cULL },
+    { 0x41eefc1fa7ade5d7ULL, 0x33a40be73647459dULL, 0x0000002a231a6280ULL },
+    { 0x999b34429ee53c15ULL, 0xfa41402348ebc590ULL, 0x00000014405976b4ULL },
+    { 0xed8f8e21f31f1482ULL, 0xfa9c85a535df608eULL, 0x0000000ea2311d56ULL },
+    { 0xcab6b9358328ea6bULL, 0xd9c580d75887ffe5ULL, 0x00000003f689883eULL },
+    { 0xa3538141b7104103ULL, 0x05677ca5ca8e7680ULL, 0x0000001f956eb511ULL },
+    { 0x381d07a5741ecc62ULL, 0xa6aafea8cb971a7cULL, 0x0000000a6a34e887ULL },
+    { 0x172e3e605ad1dc29ULL, 0xbb453d39382309ebULL, 0x00000004305f602cULL },
+    { 0x2c480fbddfa0185dULL, 0xfdce19b4aed6bf44ULL, 0x0000002a2476ca11ULL },
+    { 0x90aff4138edbf1b6ULL, 0x0019a3030a3231bfULL, 0x0000000609cfe3b5ULL },
+    { 0xb65a883d7eaa3b8dULL, 0xef3657eb4edb3c55ULL, 0x0000000d863cc619ULL },
+    { 0x1fe35443e1bfa421ULL, 0x163246e89954e9a8ULL, 0x000000000002593aULL },
+    { 0x6a8ca07c2dcb0cf3ULL, 0x000a163ff802a342ULL, 0x0000000000000000ULL },
+    { 0xc44bace4a761b05cULL, 0x00000000002b52adULL, 0x0000000000000000ULL },
+    /* 25 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000003b06e20000ULL },
+    { 0xece3dd4e69087102ULL, 0x84bf5bb9d3e589a0ULL, 0x0000002631eee3fdULL },
+    { 0xfc1fa7ade5d649f3ULL, 0x0be73647459d41eeULL, 0x0000000f313c33a4ULL },
+    { 0x34429ee53c141ad0ULL, 0x402348ebc590999bULL, 0x000000247170fa41ULL },
+    { 0x8e21f31f148122dbULL, 0x85a535df608eed8fULL, 0x0000002dfc1cfa9cULL },
+    { 0xb9358328ea6af230ULL, 0x80d75887ffe5cab6ULL, 0x00000018184cd9c5ULL },
+    { 0x8141b710410283b1ULL, 0x7ca5ca8e7680a353ULL, 0x00000027d0150567ULL },
+    { 0x07a5741ecc617a2bULL, 0xfea8cb971a7c381dULL, 0x000000101ef9a6aaULL },
+    { 0x3e605ad1dc28e0ceULL, 0x3d39382309eb172eULL, 0x0000002ffc8abb45ULL },
+    { 0x0fbddfa0185cbe13ULL, 0x19b4aed6bf442c48ULL, 0x00000005f811fdceULL },
+    { 0xf4138edbf1b5e3b9ULL, 0xa3030a3231bf90afULL, 0x0000000ca71f0019ULL },
+    { 0x883d7eaa3b8ca1baULL, 0x57eb4edb3c55b65aULL, 0x0000000bb4bdef36ULL },
+    { 0x5443e1bfa420bc98ULL, 0x46e89954e9a81fe3ULL, 0x00000002593a1632ULL },
+    { 0xa07c2dcb0cf26f7bULL, 0x163ff802a3426a8cULL, 0x000000000000000aULL },
+    { 0xace4a761b05b2635ULL, 0x0000002b52adc44bULL, 0x0000000000000000ULL },
+    { 0x121a4650e4ddeb93ULL, 0x00000000000000baULL, 0x0000000000000000ULL },
+    /* 26 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002c8dd80000ULL },
+    { 0xdd4e690871018ebbULL, 0x5bb9d3e589a0ece3ULL, 0x00000035d54f84bfULL },
+    { 0xa7ade5d649f2497aULL, 0x3647459d41eefc1fULL, 0x0000000837240be7ULL },
+    { 0x9ee53c141acfdbbbULL, 0x48ebc590999b3442ULL, 0x00000026774f4023ULL },
+    { 0xf31f148122da8f9eULL, 0x35df608eed8f8e21ULL, 0x00000032239c85a5ULL },
+    { 0x8328ea6af22fbd8dULL, 0x5887ffe5cab6b935ULL, 0x0000002699ed80d7ULL },
+    { 0xb710410283b0a5eeULL, 0xca8e7680a3538141ULL, 0x000000274cfb7ca5ULL },
+    { 0x741ecc617a2aba2fULL, 0xcb971a7c381d07a5ULL, 0x0000000d5288fea8ULL },
+    { 0x5ad1dc28e0cd47a3ULL, 0x382309eb172e3e60ULL, 0x0000002a118b3d39ULL },
+    { 0xdfa0185cbe12d3faULL, 0xaed6bf442c480fbdULL, 0x00000000b53019b4ULL },
+    { 0x8edbf1b5e3b8c588ULL, 0x0a3231bf90aff413ULL, 0x00000036c973a303ULL },
+    { 0x7eaa3b8ca1b93b53ULL, 0x4edb3c55b65a883dULL, 0x0000003627fa57ebULL },
+    { 0xe1bfa420bc97a718ULL, 0x9954e9a81fe35443ULL, 0x0000000ee4d646e8ULL },
+    { 0x2dcb0cf26f7ab7b8ULL, 0xf802a3426a8ca07cULL, 0x00000000000a163fULL },
+    { 0xa761b05b2634b255ULL, 0x002b52adc44bace4ULL, 0x0000000000000000ULL },
+    { 0x4650e4ddeb92f34eULL, 0x0000000000ba121aULL, 0x0000000000000000ULL },
+    /* 27 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002b44320000ULL },
+    { 0x690871018eba3159ULL, 0xd3e589a0ece3dd4eULL, 0x0000001098235bb9ULL },
+    { 0xe5d649f24979c251ULL, 0x459d41eefc1fa7adULL, 0x00000036e5173647ULL },
+    { 0x3c141acfdbbafc05ULL, 0xc590999b34429ee5ULL, 0x00000034025148ebULL },
+    { 0x148122da8f9d4d83ULL, 0x608eed8f8e21f31fULL, 0x0000001faa3535dfULL },
+    { 0xea6af22fbd8cc194ULL, 0xffe5cab6b9358328ULL, 0x000000212b735887ULL },
+    { 0x410283b0a5ed881cULL, 0x7680a3538141b710ULL, 0x000000232e77ca8eULL },
+    { 0xcc617a2aba2edb85ULL, 0x1a7c381d07a5741eULL, 0x000000082878cb97ULL },
+    { 0xdc28e0cd47a24e22ULL, 0x09eb172e3e605ad1ULL, 0x00000031ffed3823ULL },
+    { 0x185cbe12d3f98416ULL, 0xbf442c480fbddfa0ULL, 0x0000000bafd0aed6ULL },
+    { 0xf1b5e3b8c5870899ULL, 0x31bf90aff4138edbULL, 0x000000330b770a32ULL },
+    { 0x3b8ca1b93b52a16fULL, 0x3c55b65a883d7eaaULL, 0x00000013c5314edbULL },
+    { 0xa420bc97a717a7b1ULL, 0xe9a81fe35443e1bfULL, 0x000000009d389954ULL },
+    { 0x0cf26f7ab7b7ea44ULL, 0xa3426a8ca07c2dcbULL, 0x0000000a163ff802ULL },
+    { 0xb05b2634b254f189ULL, 0x52adc44bace4a761ULL, 0x000000000000002bULL },
+    { 0xe4ddeb92f34d6262ULL, 0x000000ba121a4650ULL, 0x0000000000000000ULL },
+    { 0x2ae9b9f14e0b23faULL, 0x000000000000031fULL, 0x0000000000000000ULL },
+    /* 28 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000003571820000ULL },
+    { 0x71018eba31588166ULL, 0x89a0ece3dd4e6908ULL, 0x000000249d47d3e5ULL },
+    { 0x49f24979c250a8b3ULL, 0x41eefc1fa7ade5d6ULL, 0x00000021aad5459dULL },
+    { 0x1acfdbbafc04f170ULL, 0x999b34429ee53c14ULL, 0x00000021472bc590ULL },
+    { 0x22da8f9d4d82a4cbULL, 0xed8f8e21f31f1481ULL, 0x0000003580a9608eULL },
+    { 0xf22fbd8cc193ba96ULL, 0xcab6b9358328ea6aULL, 0x0000001df36bffe5ULL },
+    { 0x83b0a5ed881bebd9ULL, 0xa3538141b7104102ULL, 0x0000001cec0a7680ULL },
+    { 0x7a2aba2edb84dc61ULL, 0x381d07a5741ecc61ULL, 0x00000036bc7d1a7cULL },
+    { 0xe0cd47a24e213ac5ULL, 0x172e3e605ad1dc28ULL, 0x0000000fdf6d09ebULL },
+    { 0xbe12d3f984156ebaULL, 0x2c480fbddfa0185cULL, 0x0000002c9a2cbf44ULL },
+    { 0xe3b8c587089854dbULL, 0x90aff4138edbf1b5ULL, 0x00000013f4da31bfULL },
+    { 0xa1b93b52a16e782aULL, 0xb65a883d7eaa3b8cULL, 0x0000002725013c55ULL },
+    { 0xbc97a717a7b08e4dULL, 0x1fe35443e1bfa420ULL, 0x0000000f76b6e9a8ULL },
+    { 0x6f7ab7b7ea43b86eULL, 0x6a8ca07c2dcb0cf2ULL, 0x00000028754ea342ULL },
+    { 0x2634b254f1883939ULL, 0xc44bace4a761b05bULL, 0x00000000002b52adULL },
+    { 0xeb92f34d62616ce5ULL, 0x00ba121a4650e4ddULL, 0x0000000000000000ULL },
+    { 0xb9f14e0b23f99295ULL, 0x00000000031f2ae9ULL, 0x0000000000000000ULL },
+    /* 29 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002577e60000ULL },
+    { 0x8eba315881653427ULL, 0xece3dd4e69087101ULL, 0x00000037a49b89a0ULL },
+    { 0x4979c250a8b22febULL, 0xfc1fa7ade5d649f2ULL, 0x0000002422e341eeULL },
+    { 0xdbbafc04f16f2b1bULL, 0x34429ee53c141acfULL, 0x000000216c8e999bULL },
+    { 0x8f9d4d82a4cae9f8ULL, 0x8e21f31f148122daULL, 0x0000002a8b2aed8fULL },
+    { 0xbd8cc193ba95aa4fULL, 0xb9358328ea6af22fULL, 0x000000137147cab6ULL },
+    { 0xa5ed881bebd84b5aULL, 0x8141b710410283b0ULL, 0x00000006c250a353ULL },
+    { 0xba2edb84dc600205ULL, 0x07a5741ecc617a2aULL, 0x0000000ac456381dULL },
+    { 0x47a24e213ac47d9aULL, 0x3e605ad1dc28e0cdULL, 0x00000010c733172eULL },
+    { 0xd3f984156eb9a53fULL, 0x0fbddfa0185cbe12ULL, 0x00000028f7a42c48ULL },
+    { 0xc587089854da2251ULL, 0xf4138edbf1b5e3b8ULL, 0x00000015142390afULL },
+    { 0x3b52a16e78299289ULL, 0x883d7eaa3b8ca1b9ULL, 0x00000034eddfb65aULL },
+    { 0xa717a7b08e4cdce6ULL, 0x5443e1bfa420bc97ULL, 0x00000020be041fe3ULL },
+    { 0xb7b7ea43b86daa11ULL, 0xa07c2dcb0cf26f7aULL, 0x000000119e9a6a8cULL },
+    { 0xb254f18839386d37ULL, 0xace4a761b05b2634ULL, 0x0000002b52adc44bULL },
+    { 0xf34d62616ce41322ULL, 0x121a4650e4ddeb92ULL, 0x00000000000000baULL },
+    { 0x4e0b23f99294bba6ULL, 0x0000031f2ae9b9f1ULL, 0x0000000000000000ULL },
+    { 0x6619ba27255a2c81ULL, 0x0000000000000d68ULL, 0x0000000000000000ULL },
+    /* 30 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000350dc80000ULL },
+    { 0x3158816534261126ULL, 0xdd4e690871018ebaULL, 0x000000075ec8ece3ULL },
+    { 0xc250a8b22feaa6beULL, 0xa7ade5d649f24979ULL, 0x0000000f82e6fc1fULL },
+    { 0xfc04f16f2b1a15acULL, 0x9ee53c141acfdbbaULL, 0x00000007e78f3442ULL },
+    { 0x4d82a4cae9f7b11bULL, 0xf31f148122da8f9dULL, 0x0000000c75958e21ULL },
+    { 0xc193ba95aa4e8740ULL, 0x8328ea6af22fbd8cULL, 0x0000000f4cecb935ULL },
+    { 0x881bebd84b59f310ULL, 0xb710410283b0a5edULL, 0x0000002685cd8141ULL },
+    { 0xdb84dc60020421b6ULL, 0x741ecc617a2aba2eULL, 0x000000166f3107a5ULL },
+    { 0x4e213ac47d9900ffULL, 0x5ad1dc28e0cd47a2ULL, 0x0000002c35583e60ULL },
+    { 0x84156eb9a53e3833ULL, 0xdfa0185cbe12d3f9ULL, 0x000000048dc00fbdULL },
+    { 0x089854da2250ffa9ULL, 0x8edbf1b5e3b8c587ULL, 0x0000000e515ff413ULL },
+    { 0xa16e782992882873ULL, 0x7eaa3b8ca1b93b52ULL, 0x0000000fce12883dULL },
+    { 0xa7b08e4cdce5b08cULL, 0xe1bfa420bc97a717ULL, 0x0000001ce9a35443ULL },
+    { 0xea43b86daa102472ULL, 0x2dcb0cf26f7ab7b7ULL, 0x000000353cd4a07cULL },
+    { 0xf18839386d363b24ULL, 0xa761b05b2634b254ULL, 0x000000061e17ace4ULL },
+    { 0x62616ce41321a019ULL, 0x4650e4ddeb92f34dULL, 0x0000000000ba121aULL },
+    { 0x23f99294bba5ae40ULL, 0x031f2ae9b9f14e0bULL, 0x0000000000000000ULL },
+    { 0xba27255a2c80a538ULL, 0x000000000d686619ULL, 0x0000000000000000ULL },
+    /* 31 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000012419e0000ULL },
+    { 0x8165342611258611ULL, 0x690871018eba3158ULL, 0x000000287d1ddd4eULL },
+    { 0xa8b22feaa6bdcdacULL, 0xe5d649f24979c250ULL, 0x000000355f73a7adULL },
+    { 0xf16f2b1a15abafe4ULL, 0x3c141acfdbbafc04ULL, 0x000000073c849ee5ULL },
+    { 0xa4cae9f7b11ad589ULL, 0x148122da8f9d4d82ULL, 0x0000000986c3f31fULL },
+    { 0xba95aa4e873f4ed2ULL, 0xea6af22fbd8cc193ULL, 0x00000003c8cf8328ULL },
+    { 0xebd84b59f30f134fULL, 0x410283b0a5ed881bULL, 0x000000072bb9b710ULL },
+    { 0xdc60020421b52eb2ULL, 0xcc617a2aba2edb84ULL, 0x00000030dca1741eULL },
+    { 0x3ac47d9900fe9c7fULL, 0xdc28e0cd47a24e21ULL, 0x00000025466a5ad1ULL },
+    { 0x6eb9a53e383249c8ULL, 0x185cbe12d3f98415ULL, 0x0000003335b1dfa0ULL },
+    { 0x54da2250ffa8f276ULL, 0xf1b5e3b8c5870898ULL, 0x00000027a2a78edbULL },
+    { 0x7829928828726654ULL, 0x3b8ca1b93b52a16eULL, 0x0000002c9eb37eaaULL },
+    { 0x8e4cdce5b08b69b5ULL, 0xa420bc97a717a7b0ULL, 0x0000002f46c1e1bfULL },
+    { 0xb86daa102471b0cfULL, 0x0cf26f7ab7b7ea43ULL, 0x00000016beb62dcbULL },
+    { 0x39386d363b23fee4ULL, 0xb05b2634b254f188ULL, 0x00000012d5a8a761ULL },
+    { 0x6ce41321a0183e11ULL, 0xe4ddeb92f34d6261ULL, 0x0000000741bc4650ULL },
+    { 0x9294bba5ae3f0330ULL, 0x2ae9b9f14e0b23f9ULL, 0x000000000000031fULL },
+    { 0x255a2c80a537b0f0ULL, 0x00000d686619ba27ULL, 0x0000000000000000ULL },
+    { 0x0a6cc11ac2be832eULL, 0x0000000000003996ULL, 0x0000000000000000ULL },
+    /* 32 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000001f7260000ULL },
+    { 0x3426112586103eacULL, 0x71018eba31588165ULL, 0x00000031e49c6908ULL },
+    { 0x2feaa6bdcdabb8a9ULL, 0x49f24979c250a8b2ULL, 0x00000004ae55e5d6ULL },
+    { 0x2b1a15abafe33ddbULL, 0x1acfdbbafc04f16fULL, 0x0000001e111d3c14ULL },
+    { 0xe9f7b11ad5887e24ULL, 0x22da8f9d4d82a4caULL, 0x00000018e67b1481ULL },
+    { 0xaa4e873f4ed1ac9bULL, 0xf22fbd8cc193ba95ULL, 0x0000000095deea6aULL },
+    { 0x4b59f30f134e2fa5ULL, 0x83b0a5ed881bebd8ULL, 0x00000016b2184102ULL },
+    { 0x020421b52eb172d9ULL, 0x7a2aba2edb84dc60ULL, 0x000000098486cc61ULL },
+    { 0x7d9900fe9c7e3562ULL, 0xe0cd47a24e213ac4ULL, 0x0000001597e1dc28ULL },
+    { 0xa53e383249c75632ULL, 0xbe12d3f984156eb9ULL, 0x0000002a5976185cULL },
+    { 0x2250ffa8f27564efULL, 0xe3b8c587089854daULL, 0x00000020be4df1b5ULL },
+    { 0x9288287266533380ULL, 0xa1b93b52a16e7829ULL, 0x000000079f423b8cULL },
+    { 0xdce5b08b69b4592aULL, 0xbc97a717a7b08e4cULL, 0x000000387247a420ULL },
+    { 0xaa102471b0ce9f66ULL, 0x6f7ab7b7ea43b86dULL, 0x0000001538eb0cf2ULL },
+    { 0x6d363b23fee36616ULL, 0x2634b254f1883938ULL, 0x00000033ab79b05bULL },
+    { 0x1321a0183e10583dULL, 0xeb92f34d62616ce4ULL, 0x000000366b2ce4ddULL },
+    { 0xbba5ae3f032fad21ULL, 0xb9f14e0b23f99294ULL, 0x00000000031f2ae9ULL },
+    { 0x2c80a537b0efefecULL, 0x0d686619ba27255aULL, 0x0000000000000000ULL },
+    { 0xc11ac2be832d2969ULL, 0x0000000039960a6cULL, 0x0000000000000000ULL },
+    /* 33 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000005cd60000ULL },
+    { 0x112586103eab5040ULL, 0x8eba315881653426ULL, 0x00000038696e7101ULL },
+    { 0xa6bdcdabb8a8f616ULL, 0x4979c250a8b22feaULL, 0x00000030655249f2ULL },
+    { 0x15abafe33dda325dULL, 0xdbbafc04f16f2b1aULL, 0x00000032e3401acfULL },
+    { 0xb11ad5887e232c41ULL, 0x8f9d4d82a4cae9f7ULL, 0x0000000b1d8d22daULL },
+    { 0x873f4ed1ac9a47b9ULL, 0xbd8cc193ba95aa4eULL, 0x00000029210cf22fULL },
+    { 0xf30f134e2fa4ae41ULL, 0xa5ed881bebd84b59ULL, 0x00000009f2be83b0ULL },
+    { 0x21b52eb172d8d161ULL, 0xba2edb84dc600204ULL, 0x0000002fcba17a2aULL },
+    { 0x00fe9c7e35618eb1ULL, 0x47a24e213ac47d99ULL, 0x00000004623ce0cdULL },
+    { 0x383249c75631c599ULL, 0xd3f984156eb9a53eULL, 0x0000002b053ebe12ULL },
+    { 0xffa8f27564ee62a5ULL, 0xc587089854da2250ULL, 0x0000002b20abe3b8ULL },
+    { 0x28726653337f3560ULL, 0x3b52a16e78299288ULL, 0x000000234f34a1b9ULL },
+    { 0xb08b69b4592909eaULL, 0xa717a7b08e4cdce5ULL, 0x0000001c928abc97ULL },
+    { 0x2471b0ce9f65e8aeULL, 0xb7b7ea43b86daa10ULL, 0x0000000c44f66f7aULL },
+    { 0x3b23fee366150b47ULL, 0xb254f18839386d36ULL, 0x0000002236ed2634ULL },
+    { 0xa0183e10583cd332ULL, 0xf34d62616ce41321ULL, 0x000000382ee3eb92ULL },
+    { 0xae3f032fad207090ULL, 0x4e0b23f99294bba5ULL, 0x000000184ea7b9f1ULL },
+    { 0xa537b0efefebdd3bULL, 0x6619ba27255a2c80ULL, 0x0000000000000d68ULL },
+    { 0xc2be832d2968c44bULL, 0x000039960a6cc11aULL, 0x0000000000000000ULL },
+    { 0x9530e188c128d12cULL, 0x000000000000f754ULL, 0x0000000000000000ULL },
+    /* 34 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002b59f40000ULL },
+    { 0x86103eab503f216dULL, 0x3158816534261125ULL, 0x0000001c59678ebaULL },
+    { 0xcdabb8a8f615373fULL, 0xc250a8b22feaa6bdULL, 0x0000002b89244979ULL },
+    { 0xafe33dda325c3a53ULL, 0xfc04f16f2b1a15abULL, 0x000000249ff9dbbaULL },
+    { 0xd5887e232c4082baULL, 0x4d82a4cae9f7b11aULL, 0x00000020c5b88f9dULL },
+    { 0x4ed1ac9a47b8e308ULL, 0xc193ba95aa4e873fULL, 0x000000374dfdbd8cULL },
+    { 0x134e2fa4ae40ae6aULL, 0x881bebd84b59f30fULL, 0x0000000ae8eca5edULL },
+    { 0x2eb172d8d1601cb5ULL, 0xdb84dc60020421b5ULL, 0x00000025ca24ba2eULL },
+    { 0x9c7e35618eb04ef4ULL, 0x4e213ac47d9900feULL, 0x0000003a184f47a2ULL },
+    { 0x49c75631c5982b14ULL, 0x84156eb9a53e3832ULL, 0x0000001f70a0d3f9ULL },
+    { 0xf27564ee62a46e67ULL, 0x089854da2250ffa8ULL, 0x000000133d2ac587ULL },
+    { 0x6653337f355f140fULL, 0xa16e782992882872ULL, 0x0000000581f33b52ULL },
+    { 0x69b4592909e9ae01ULL, 0xa7b08e4cdce5b08bULL, 0x0000002ad231a717ULL },
+    { 0xb0ce9f65e8ad6934ULL, 0xea43b86daa102471ULL, 0x00000013c706b7b7ULL },
+    { 0xfee366150b46715cULL, 0xf18839386d363b23ULL, 0x000000120476b254ULL },
+    { 0x3e10583cd33148dbULL, 0x62616ce41321a018ULL, 0x000000029806f34dULL },
+    { 0x032fad20708f579dULL, 0x23f99294bba5ae3fULL, 0x00000005fd754e0bULL },
+    { 0xb0efefebdd3a7f74ULL, 0xba27255a2c80a537ULL, 0x000000000d686619ULL },
+    { 0x832d2968c44a9445ULL, 0x39960a6cc11ac2beULL, 0x0000000000000000ULL },
+    { 0xe188c128d12bee5aULL, 0x00000000f7549530ULL, 0x0000000000000000ULL },
+    /* 35 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000149b560000ULL },
+    { 0x3eab503f216cd0feULL, 0x8165342611258610ULL, 0x00000012c7a63158ULL },
+    { 0xb8a8f615373e3962ULL, 0xa8b22feaa6bdcdabULL, 0x0000000126a1c250ULL },
+    { 0x3dda325c3a52e281ULL, 0xf16f2b1a15abafe3ULL, 0x0000001e6af8fc04ULL },
+    { 0x7e232c4082b91525ULL, 0xa4cae9f7b11ad588ULL, 0x0000002265534d82ULL },
+    { 0xac9a47b8e3076f40ULL, 0xba95aa4e873f4ed1ULL, 0x00000006803cc193ULL },
+    { 0x2fa4ae40ae69892cULL, 0xebd84b59f30f134eULL, 0x0000001eef1f881bULL },
+    { 0x72d8d1601cb4642cULL, 0xdc60020421b52eb1ULL, 0x00000007bca2db84ULL },
+    { 0x35618eb04ef3dee9ULL, 0x3ac47d9900fe9c7eULL, 0x00000004fd7a4e21ULL },
+    { 0x5631c5982b13d7eaULL, 0x6eb9a53e383249c7ULL, 0x0000002377a98415ULL },
+    { 0x64ee62a46e66747fULL, 0x54da2250ffa8f275ULL, 0x00000019b87d0898ULL },
+    { 0x337f355f140e4f03ULL, 0x7829928828726653ULL, 0x000000291b8ca16eULL },
+    { 0x592909e9ae00a388ULL, 0x8e4cdce5b08b69b4ULL, 0x0000000fc473a7b0ULL },
+    { 0x9f65e8ad6933b9a6ULL, 0xb86daa102471b0ceULL, 0x0000001fb78dea43ULL },
+    { 0x66150b46715bb234ULL, 0x39386d363b23fee3ULL, 0x00000016af00f188ULL },
+    { 0x583cd33148da6149ULL, 0x6ce41321a0183e10ULL, 0x0000003a1baf6261ULL },
+    { 0xad20708f579c45aaULL, 0x9294bba5ae3f032fULL, 0x000000091d4723f9ULL },
+    { 0xefebdd3a7f737777ULL, 0x255a2c80a537b0efULL, 0x00000022ef1fba27ULL },
+    { 0x2968c44a9444a8eeULL, 0x0a6cc11ac2be832dULL, 0x0000000000003996ULL },
+    { 0xc128d12bee59e68fULL, 0x0000f7549530e188ULL, 0x0000000000000000ULL },
+    { 0xa6fe9631f9d94f67ULL, 0x0000000000042646ULL, 0x0000000000000000ULL },
+    /* 36 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001790360000ULL },
+    { 0x503f216cd0fd77d5ULL, 0x3426112586103eabULL, 0x000000297cc88165ULL },
+    { 0xf615373e3961af3aULL, 0x2feaa6bdcdabb8a8ULL, 0x00000019e226a8b2ULL },
+    { 0x325c3a52e28042a9ULL, 0x2b1a15abafe33ddaULL, 0x0000002f3e9cf16fULL },
+    { 0x2c4082b91524bcecULL, 0xe9f7b11ad5887e23ULL, 0x00000022d8bea4caULL },
+    { 0x47b8e3076f3fdf88ULL, 0xaa4e873f4ed1ac9aULL, 0x000000325c25ba95ULL },
+    { 0xae40ae69892bcddaULL, 0x4b59f30f134e2fa4ULL, 0x000000165a83ebd8ULL },
+    { 0xd1601cb4642bbf28ULL, 0x020421b52eb172d8ULL, 0x0000002dbfc0dc60ULL },
+    { 0x8eb04ef3dee8863eULL, 0x7d9900fe9c7e3561ULL, 0x0000002b39553ac4ULL },
+    { 0xc5982b13d7e94ad4ULL, 0xa53e383249c75631ULL, 0x00000032c9cd6eb9ULL },
+    { 0x62a46e66747ee530ULL, 0x2250ffa8f27564eeULL, 0x00000009ade854daULL },
+    { 0x355f140e4f02a6e2ULL, 0x928828726653337fULL, 0x00000011e5627829ULL },
+    { 0x09e9ae00a38761faULL, 0xdce5b08b69b45929ULL, 0x0000001988808e4cULL },
+    { 0xe8ad6933b9a5b136ULL, 0xaa102471b0ce9f65ULL, 0x0000000d2349b86dULL },
+    { 0x0b46715bb2337397ULL, 0x6d363b23fee36615ULL, 0x000000351a503938ULL },
+    { 0xd33148da61480e1cULL, 0x1321a0183e10583cULL, 0x00000022a12d6ce4ULL },
+    { 0x708f579c45a9861aULL, 0xbba5ae3f032fad20ULL, 0x00000014fec79294ULL },
+    { 0xdd3a7f737776be8bULL, 0x2c80a537b0efefebULL, 0x000000195243255aULL },
+    { 0xc44a9444a8ed586dULL, 0xc11ac2be832d2968ULL, 0x0000000039960a6cULL },
+    { 0xd12bee59e68ef47dULL, 0xf7549530e188c128ULL, 0x0000000000000000ULL },
+    { 0x9631f9d94f66cfa1ULL, 0x000000042646a6feULL, 0x0000000000000000ULL },
+    { 0xd270cc51055ea7cbULL, 0x0000000000000011ULL, 0x0000000000000000ULL },
+    /* 37 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000008dcf80000ULL },
+    { 0x216cd0fd77d43bc6ULL, 0x112586103eab503fULL, 0x00000036a24f3426ULL },
+    { 0x373e3961af39d458ULL, 0xa6bdcdabb8a8f615ULL, 0x0000000612c42feaULL },
+    { 0x3a52e28042a8de27ULL, 0x15abafe33dda325cULL, 0x00000039ab952b1aULL },
+    { 0x82b91524bceb6312ULL, 0xb11ad5887e232c40ULL, 0x0000001248a6e9f7ULL },
+    { 0xe3076f3fdf87720fULL, 0x873f4ed1ac9a47b8ULL, 0x00000014f167aa4eULL },
+    { 0xae69892bcdd91f49ULL, 0xf30f134e2fa4ae40ULL, 0x00000000f6444b59ULL },
+    { 0x1cb4642bbf272a6fULL, 0x21b52eb172d8d160ULL, 0x000000239fbe0204ULL },
+    { 0x4ef3dee8863d720cULL, 0x00fe9c7e35618eb0ULL, 0x0000000e7c927d99ULL },
+    { 0x2b13d7e94ad3a2f1ULL, 0x383249c75631c598ULL, 0x00000012dbe5a53eULL },
+    { 0x6e66747ee52f1050ULL, 0xffa8f27564ee62a4ULL, 0x0000001fb3a62250ULL },
+    { 0x140e4f02a6e182daULL, 0x28726653337f355fULL, 0x000000357a919288ULL },
+    { 0xae00a38761f9afbbULL, 0xb08b69b4592909e9ULL, 0x00000003c228dce5ULL },
+    { 0x6933b9a5b135596bULL, 0x2471b0ce9f65e8adULL, 0x0000000ca06baa10ULL },
+    { 0x715bb23373961aabULL, 0x3b23fee366150b46ULL, 0x00000007d43a6d36ULL },
+    { 0x48da61480e1b914cULL, 0xa0183e10583cd331ULL, 0x0000002693561321ULL },
+    { 0x579c45a98619cbb7ULL, 0xae3f032fad20708fULL, 0x0000001df3dcbba5ULL },
+    { 0x7f737776be8aa47fULL, 0xa537b0efefebdd3aULL, 0x000000063b102c80ULL },
+    { 0x9444a8ed586c72c9ULL, 0xc2be832d2968c44aULL, 0x00000013b186c11aULL },
+    { 0xee59e68ef47ce570ULL, 0x9530e188c128d12bULL, 0x000000000000f754ULL },
+    { 0xf9d94f66cfa00210ULL, 0x00042646a6fe9631ULL, 0x0000000000000000ULL },
+    { 0xcc51055ea7ca8fd7ULL, 0x000000000011d270ULL, 0x0000000000000000ULL },
+    /* 38 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000008bc960000ULL },
+    { 0xd0fd77d43bc5c2b2ULL, 0x86103eab503f216cULL, 0x0000002c312a1125ULL },
+    { 0x3961af39d4573798ULL, 0xcdabb8a8f615373eULL, 0x00000027f958a6bdULL },
+    { 0xe28042a8de262f94ULL, 0xafe33dda325c3a52ULL, 0x000000063f7015abULL },
+    { 0x1524bceb63110e05ULL, 0xd5887e232c4082b9ULL, 0x0000000ebd71b11aULL },
+    { 0x6f3fdf87720e1bedULL, 0x4ed1ac9a47b8e307ULL, 0x000000038290873fULL },
+    { 0x892bcdd91f48989eULL, 0x134e2fa4ae40ae69ULL, 0x0000002a2f4ff30fULL },
+    { 0x642bbf272a6e1a9eULL, 0x2eb172d8d1601cb4ULL, 0x0000003b480421b5ULL },
+    { 0xdee8863d720b8781ULL, 0x9c7e35618eb04ef3ULL, 0x0000000bb56900feULL },
+    { 0xd7e94ad3a2f0dc52ULL, 0x49c75631c5982b13ULL, 0x0000002756083832ULL },
+    { 0x747ee52f104f9831ULL, 0xf27564ee62a46e66ULL, 0x0000001aa2c0ffa8ULL },
+    { 0x4f02a6e182d9fad2ULL, 0x6653337f355f140eULL, 0x0000002075a82872ULL },
+    { 0xa38761f9afba3d8eULL, 0x69b4592909e9ae00ULL, 0x0000001a787db08bULL },
+    { 0xb9a5b135596a4bd6ULL, 0xb0ce9f65e8ad6933ULL, 0x0000000861822471ULL },
+    { 0xb23373961aaa21f2ULL, 0xfee366150b46715bULL, 0x00000005a4f63b23ULL },
+    { 0x61480e1b914b0c21ULL, 0x3e10583cd33148daULL, 0x0000000eabd5a018ULL },
+    { 0x45a98619cbb6e76dULL, 0x032fad20708f579cULL, 0x0000000cf773ae3fULL },
+    { 0x7776be8aa47e9438ULL, 0xb0efefebdd3a7f73ULL, 0x0000002c5b6ca537ULL },
+    { 0xa8ed586c72c820e6ULL, 0x832d2968c44a9444ULL, 0x0000000b6188c2beULL },
+    { 0xe68ef47ce56fd516ULL, 0xe188c128d12bee59ULL, 0x00000000f7549530ULL },
+    { 0x4f66cfa0020f039cULL, 0x2646a6fe9631f9d9ULL, 0x0000000000000004ULL },
+    { 0x055ea7ca8fd68f6fULL, 0x00000011d270cc51ULL, 0x0000000000000000ULL },
+    { 0x8b888296c5f9e2bbULL, 0x000000000000004cULL, 0x0000000000000000ULL },
+    /* 39 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000003c8440000ULL },
+    { 0x77d43bc5c2b12ed1ULL, 0x3eab503f216cd0fdULL, 0x00000027fb638610ULL },
+    { 0xaf39d4573797bd4bULL, 0xb8a8f615373e3961ULL, 0x00000034e8a7cdabULL },
+    { 0x42a8de262f93dca5ULL, 0x3dda325c3a52e280ULL, 0x0000001fc799afe3ULL },
+    { 0xbceb63110e043f11ULL, 0x7e232c4082b91524ULL, 0x00000030d18ed588ULL },
+    { 0xdf87720e1bec494dULL, 0xac9a47b8e3076f3fULL, 0x0000001234414ed1ULL },
+    { 0xcdd91f48989dbdcaULL, 0x2fa4ae40ae69892bULL, 0x0000002950c3134eULL },
+    { 0xbf272a6e1a9d3725ULL, 0x72d8d1601cb4642bULL, 0x0000001d629d2eb1ULL },
+    { 0x863d720b87803e55ULL, 0x35618eb04ef3dee8ULL, 0x0000002e69649c7eULL },
+    { 0x4ad3a2f0dc51d033ULL, 0x5631c5982b13d7e9ULL, 0x0000001b553e49c7ULL },
+    { 0xe52f104f9830f070ULL, 0x64ee62a46e66747eULL, 0x000000135f2cf275ULL },
+    { 0xa6e182d9fad10fc9ULL, 0x337f355f140e4f02ULL, 0x00000029fd986653ULL },
+    { 0x61f9afba3d8d245aULL, 0x592909e9ae00a387ULL, 0x000000301bab69b4ULL },
+    { 0xb135596a4bd572eeULL, 0x9f65e8ad6933b9a5ULL, 0x00000034f205b0ceULL },
+    { 0x73961aaa21f19d71ULL, 0x66150b46715bb233ULL, 0x00000003ce37fee3ULL },
+    { 0x0e1b914b0c20efddULL, 0x583cd33148da6148ULL, 0x0000000b19ba3e10ULL },
+    { 0x8619cbb6e76c9969ULL, 0xad20708f579c45a9ULL, 0x00000037dd5f032fULL },
+    { 0xbe8aa47e943758d0ULL, 0xefebdd3a7f737776ULL, 0x0000000a83d9b0efULL },
+    { 0x586c72c820e5b373ULL, 0x2968c44a9444a8edULL, 0x0000001fd734832dULL },
+    { 0xf47ce56fd515c9edULL, 0xc128d12bee59e68eULL, 0x000000107334e188ULL },
+    { 0xcfa0020f039bad4dULL, 0xa6fe9631f9d94f66ULL, 0x0000000000042646ULL },
+    { 0xa7ca8fd68f6e505eULL, 0x0011d270cc51055eULL, 0x0000000000000000ULL },
+    { 0x8296c5f9e2ba8defULL, 0x00000000004c8b88ULL, 0x0000000000000000ULL },
+    /* 40 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000027e3140000ULL },
+    { 0x3bc5c2b12ed066d0ULL, 0x503f216cd0fd77d4ULL, 0x0000002756e03eabULL },
+    { 0xd4573797bd4a732dULL, 0xf615373e3961af39ULL, 0x00000032cd89b8a8ULL },
+    { 0xde262f93dca414c7ULL, 0x325c3a52e28042a8ULL, 0x0000000830773ddaULL },
+    { 0x63110e043f10e8c2ULL, 0x2c4082b91524bcebULL, 0x00000023ebd07e23ULL },
+    { 0x720e1bec494c01fcULL, 0x47b8e3076f3fdf87ULL, 0x0000002657bbac9aULL },
+    { 0x1f48989dbdc9a450ULL, 0xae40ae69892bcdd9ULL, 0x000000327b5a2fa4ULL },
+    { 0x2a6e1a9d3724538bULL, 0xd1601cb4642bbf27ULL, 0x00000016b6df72d8ULL },
+    { 0x720b87803e544002ULL, 0x8eb04ef3dee8863dULL, 0x0000000b96a23561ULL },
+    { 0xa2f0dc51d032e441ULL, 0xc5982b13d7e94ad3ULL, 0x0000003780df5631ULL },
+    { 0x104f9830f06f1d55ULL, 0x62a46e66747ee52fULL, 0x0000001d9e3764eeULL },
+    { 0x82d9fad10fc83114ULL, 0x355f140e4f02a6e1ULL, 0x000000098e19337fULL },
+    { 0xafba3d8d2459fff8ULL, 0x09e9ae00a38761f9ULL, 0x00000017ba3e5929ULL },
+    { 0x596a4bd572ed41b4ULL, 0xe8ad6933b9a5b135ULL, 0x00000004e6529f65ULL },
+    { 0x1aaa21f19d708a6fULL, 0x0b46715bb2337396ULL, 0x0000000e29736615ULL },
+    { 0x914b0c20efdca4a7ULL, 0xd33148da61480e1bULL, 0x000000078d8e583cULL },
+    { 0xcbb6e76c996871e6ULL, 0x708f579c45a98619ULL, 0x00000036ea99ad20ULL },
+    { 0xa47e943758cf6eecULL, 0xdd3a7f737776be8aULL, 0x000000186495efebULL },
+    { 0x72c820e5b3727874ULL, 0xc44a9444a8ed586cULL, 0x0000000980e32968ULL },
+    { 0xe56fd515c9ec542eULL, 0xd12bee59e68ef47cULL, 0x0000003b468cc128ULL },
+    { 0x020f039bad4cfbcbULL, 0x9631f9d94f66cfa0ULL, 0x000000042646a6feULL },
+    { 0x8fd68f6e505dd389ULL, 0xd270cc51055ea7caULL, 0x0000000000000011ULL },
+    { 0xc5f9e2ba8dee8a97ULL, 0x0000004c8b888296ULL, 0x0000000000000000ULL },
+    { 0xc22ca71a1bd6f0a6ULL, 0x0000000000000148ULL, 0x0000000000000000ULL },
+    /* 41 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000eb2e00000ULL },
+    { 0xc2b12ed066cf05d1ULL, 0x216cd0fd77d43bc5ULL, 0x00000004f08f503fULL },
+    { 0x3797bd4a732c0ee5ULL, 0x373e3961af39d457ULL, 0x000000157934f615ULL },
+    { 0x2f93dca414c699b8ULL, 0x3a52e28042a8de26ULL, 0x0000000f0522325cULL },
+    { 0x0e043f10e8c11944ULL, 0x82b91524bceb6311ULL, 0x0000002b0c1d2c40ULL },
+    { 0x1bec494c01fbff9aULL, 0xe3076f3fdf87720eULL, 0x0000000f0f4e47b8ULL },
+    { 0x989dbdc9a44f8e44ULL, 0xae69892bcdd91f48ULL, 0x0000001660baae40ULL },
+    { 0x1a9d3724538a14daULL, 0x1cb4642bbf272a6eULL, 0x000000290cccd160ULL },
+    { 0x87803e5440010475ULL, 0x4ef3dee8863d720bULL, 0x000000236def8eb0ULL },
+    { 0xdc51d032e440212fULL, 0x2b13d7e94ad3a2f0ULL, 0x0000002648ddc598ULL },
+    { 0x9830f06f1d54944aULL, 0x6e66747ee52f104fULL, 0x00000016231c62a4ULL },
+    { 0xfad10fc8311352d1ULL, 0x140e4f02a6e182d9ULL, 0x000000366865355fULL },
+    { 0x3d8d2459fff79b95ULL, 0xae00a38761f9afbaULL, 0x00000028601909e9ULL },
+    { 0x4bd572ed41b3ab13ULL, 0x6933b9a5b135596aULL, 0x0000001066b7e8adULL },
+    { 0x21f19d708a6e17bcULL, 0x715bb23373961aaaULL, 0x0000000b79970b46ULL },
+    { 0x0c20efdca4a6e67bULL, 0x48da61480e1b914bULL, 0x000000215fdcd331ULL },
+    { 0xe76c996871e5fe69ULL, 0x579c45a98619cbb6ULL, 0x0000000d9ebe708fULL },
+    { 0x943758cf6eeb28e3ULL, 0x7f737776be8aa47eULL, 0x000000115d43dd3aULL },
+    { 0x20e5b372787342f4ULL, 0x9444a8ed586c72c8ULL, 0x0000000a3a7ec44aULL },
+    { 0xd515c9ec542dec0aULL, 0xee59e68ef47ce56fULL, 0x0000000ba2ccd12bULL },
+    { 0x039bad4cfbca189dULL, 0xf9d94f66cfa0020fULL, 0x0000001a434a9631ULL },
+    { 0x8f6e505dd3883605ULL, 0xcc51055ea7ca8fd6ULL, 0x000000000011d270ULL },
+    { 0xe2ba8dee8a96a68fULL, 0x004c8b888296c5f9ULL, 0x0000000000000000ULL },
+    { 0xa71a1bd6f0a5b37eULL, 0x000000000148c22cULL, 0x0000000000000000ULL },
+    /* 42 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001955f60000ULL },
+    { 0x2ed066cf05d0e92bULL, 0xd0fd77d43bc5c2b1ULL, 0x0000000e7cd9216cULL },
+    { 0xbd4a732c0ee4919dULL, 0x3961af39d4573797ULL, 0x000000134c51373eULL },
+    { 0xdca414c699b76a7fULL, 0xe28042a8de262f93ULL, 0x0000002b17c83a52ULL },
+    { 0x3f10e8c1194353ebULL, 0x1524bceb63110e04ULL, 0x00000001bb2282b9ULL },
+    { 0x494c01fbff9933afULL, 0x6f3fdf87720e1becULL, 0x00000018926ce307ULL },
+    { 0xbdc9a44f8e43e9c3ULL, 0x892bcdd91f48989dULL, 0x0000002a0028ae69ULL },
+    { 0x3724538a14d99369ULL, 0x642bbf272a6e1a9dULL, 0x00000038c7d41cb4ULL },
+    { 0x3e5440010474794fULL, 0xdee8863d720b8780ULL, 0x000000049ec24ef3ULL },
+    { 0xd032e440212e5f24ULL, 0xd7e94ad3a2f0dc51ULL, 0x00000017dacc2b13ULL },
+    { 0xf06f1d5494498adcULL, 0x747ee52f104f9830ULL, 0x0000000354dc6e66ULL },
+    { 0x0fc8311352d07bf6ULL, 0x4f02a6e182d9fad1ULL, 0x000000002613140eULL },
+    { 0x2459fff79b947dc6ULL, 0xa38761f9afba3d8dULL, 0x0000000c0b0fae00ULL },
+    { 0x72ed41b3ab12bda4ULL, 0xb9a5b135596a4bd5ULL, 0x0000001559836933ULL },
+    { 0x9d708a6e17bb0ef8ULL, 0xb23373961aaa21f1ULL, 0x00000032d876715bULL },
+    { 0xefdca4a6e67a5af7ULL, 0x61480e1b914b0c20ULL, 0x00000024628b48daULL },
+    { 0x996871e5fe68a8ffULL, 0x45a98619cbb6e76cULL, 0x0000001ae259579cULL },
+    { 0x58cf6eeb28e2e695ULL, 0x7776be8aa47e9437ULL, 0x0000000ffc727f73ULL },
+    { 0xb372787342f3e342ULL, 0xa8ed586c72c820e5ULL, 0x00000014ee7e9444ULL },
+    { 0xc9ec542dec09bc14ULL, 0xe68ef47ce56fd515ULL, 0x0000003298b1ee59ULL },
+    { 0xad4cfbca189c739cULL, 0x4f66cfa0020f039bULL, 0x00000012dd39f9d9ULL },
+    { 0x505dd388360461c3ULL, 0x055ea7ca8fd68f6eULL, 0x00000011d270cc51ULL },
+    { 0x8dee8a96a68e2551ULL, 0x8b888296c5f9e2baULL, 0x000000000000004cULL },
+    { 0x1bd6f0a5b37d0be1ULL, 0x00000148c22ca71aULL, 0x0000000000000000ULL },
+    { 0x01c96621a4ef65edULL, 0x0000000000000584ULL, 0x0000000000000000ULL },
+    /* 43 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000003b03e00000ULL },
+    { 0x66cf05d0e92aeb2aULL, 0x77d43bc5c2b12ed0ULL, 0x00000016be72d0fdULL },
+    { 0x732c0ee4919c857aULL, 0xaf39d4573797bd4aULL, 0x0000001ddcea3961ULL },
+    { 0x14c699b76a7efdb1ULL, 0x42a8de262f93dca4ULL, 0x000000088dc0e280ULL },
+    { 0xe8c1194353ea47e3ULL, 0xbceb63110e043f10ULL, 0x0000000edf231524ULL },
+    { 0x01fbff9933ae18f8ULL, 0xdf87720e1bec494cULL, 0x0000000a32ed6f3fULL },
+    { 0xa44f8e43e9c257d1ULL, 0xcdd91f48989dbdc9ULL, 0x0000000a2f81892bULL },
+    { 0x538a14d99368ff15ULL, 0xbf272a6e1a9d3724ULL, 0x000000362388642bULL },
+    { 0x40010474794efa04ULL, 0x863d720b87803e54ULL, 0x00000036514ddee8ULL },
+    { 0xe440212e5f238f29ULL, 0x4ad3a2f0dc51d032ULL, 0x0000001d8b8bd7e9ULL },
+    { 0x1d5494498adb6ad5ULL, 0xe52f104f9830f06fULL, 0x000000009e10747eULL },
+    { 0x311352d07bf52b5cULL, 0xa6e182d9fad10fc8ULL, 0x0000001f85704f02ULL },
+    { 0xfff79b947dc5675eULL, 0x61f9afba3d8d2459ULL, 0x000000269406a387ULL },
+    { 0x41b3ab12bda3c0ceULL, 0xb135596a4bd572edULL, 0x0000000bfabfb9a5ULL },
+    { 0x8a6e17bb0ef7993eULL, 0x73961aaa21f19d70ULL, 0x00000010c6d1b233ULL },
+    { 0xa4a6e67a5af691eaULL, 0x0e1b914b0c20efdcULL, 0x0000002778686148ULL },
+    { 0x71e5fe68a8fe824bULL, 0x8619cbb6e76c9968ULL, 0x0000001ba5b645a9ULL },
+    { 0x6eeb28e2e6949834ULL, 0xbe8aa47e943758cfULL, 0x0000003742e37776ULL },
+    { 0x787342f3e3412013ULL, 0x586c72c820e5b372ULL, 0x0000002148c8a8edULL },
+    { 0x542dec09bc13453dULL, 0xf47ce56fd515c9ecULL, 0x00000017f003e68eULL },
+    { 0xfbca189c739be1d0ULL, 0xcfa0020f039bad4cULL, 0x0000001609e74f66ULL },
+    { 0xd388360461c2842aULL, 0xa7ca8fd68f6e505dULL, 0x0000001fc8a3055eULL },
+    { 0x8a96a68e2550b653ULL, 0x8296c5f9e2ba8deeULL, 0x00000000004c8b88ULL },
+    { 0xf0a5b37d0be0e9cdULL, 0x0148c22ca71a1bd6ULL, 0x0000000000000000ULL },
+    { 0x6621a4ef65ec6bcbULL, 0x00000000058401c9ULL, 0x0000000000000000ULL },
+    /* 44 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000316a1a0000ULL },
+    { 0x05d0e92aeb29f3dfULL, 0x3bc5c2b12ed066cfULL, 0x0000000d76e777d4ULL },
+    { 0x0ee4919c8579f95eULL, 0xd4573797bd4a732cULL, 0x00000027514daf39ULL },
+    { 0x99b76a7efdb0d4deULL, 0xde262f93dca414c6ULL, 0x00000036ce2842a8ULL },
+    { 0x194353ea47e2f859ULL, 0x63110e043f10e8c1ULL, 0x0000001f892ebcebULL },
+    { 0xff9933ae18f70b4dULL, 0x720e1bec494c01fbULL, 0x000000328d7ddf87ULL },
+    { 0x8e43e9c257d063edULL, 0x1f48989dbdc9a44fULL, 0x000000091e75cdd9ULL },
+    { 0x14d99368ff140a8cULL, 0x2a6e1a9d3724538aULL, 0x0000000e4e6fbf27ULL },
+    { 0x0474794efa03ba1bULL, 0x720b87803e544001ULL, 0x000000314684863dULL },
+    { 0x212e5f238f285722ULL, 0xa2f0dc51d032e440ULL, 0x0000000af5374ad3ULL },
+    { 0x94498adb6ad47de7ULL, 0x104f9830f06f1d54ULL, 0x000000348182e52fULL },
+    { 0x52d07bf52b5b263fULL, 0x82d9fad10fc83113ULL, 0x0000003a2278a6e1ULL },
+    { 0x9b947dc5675d75e9ULL, 0xafba3d8d2459fff7ULL, 0x0000000c6bdd61f9ULL },
+    { 0xab12bda3c0cd3935ULL, 0x596a4bd572ed41b3ULL, 0x00000022f2e7b135ULL },
+    { 0x17bb0ef7993d8dddULL, 0x1aaa21f19d708a6eULL, 0x000000066b277396ULL },
+    { 0xe67a5af691e91ca7ULL, 0x914b0c20efdca4a6ULL, 0x00000006018c0e1bULL },
+    { 0xfe68a8fe824a6e21ULL, 0xcbb6e76c996871e5ULL, 0x0000002047bd8619ULL },
+    { 0x28e2e69498336c52ULL, 0xa47e943758cf6eebULL, 0x000000194006be8aULL },
+    { 0x42f3e34120124f3bULL, 0x72c820e5b3727873ULL, 0x0000001d1465586cULL },
+    { 0xec09bc13453ce19eULL, 0xe56fd515c9ec542dULL, 0x000000254138f47cULL },
+    { 0x189c739be1cfcfc5ULL, 0x020f039bad4cfbcaULL, 0x0000002f29a0cfa0ULL },
+    { 0x360461c284290fbbULL, 0x8fd68f6e505dd388ULL, 0x000000231acaa7caULL },
+    { 0xa68e2550b652834cULL, 0xc5f9e2ba8dee8a96ULL, 0x00000010f0be8296ULL },
+    { 0xb37d0be0e9cc11aeULL, 0xc22ca71a1bd6f0a5ULL, 0x0000000000000148ULL },
+    { 0xa4ef65ec6bca6cb6ULL, 0x0000058401c96621ULL, 0x0000000000000000ULL },
+    { 0x8617a104ee462a19ULL, 0x00000000000017b0ULL, 0x0000000000000000ULL },
+    /* 45 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002e0b720000ULL },
+    { 0xe92aeb29f3de227aULL, 0xc2b12ed066cf05d0ULL, 0x000000144e8c3bc5ULL },
+    { 0x919c8579f95dff5cULL, 0x3797bd4a732c0ee4ULL, 0x00000008e40dd457ULL },
+    { 0x6a7efdb0d4dd06bdULL, 0x2f93dca414c699b7ULL, 0x00000003f88ade26ULL },
+    { 0x53ea47e2f858f3efULL, 0x0e043f10e8c11943ULL, 0x0000000348f76311ULL },
+    { 0x33ae18f70b4c27bfULL, 0x1bec494c01fbff99ULL, 0x00000010e711720eULL },
+    { 0xe9c257d063ecb50bULL, 0x989dbdc9a44f8e43ULL, 0x00000019a2b51f48ULL },
+    { 0x9368ff140a8ba6fbULL, 0x1a9d3724538a14d9ULL, 0x00000002af332a6eULL },
+    { 0x794efa03ba1a7aceULL, 0x87803e5440010474ULL, 0x000000381469720bULL },
+    { 0x5f238f2857218b37ULL, 0xdc51d032e440212eULL, 0x000000128833a2f0ULL },
+    { 0x8adb6ad47de6a0e0ULL, 0x9830f06f1d549449ULL, 0x00000032c09b104fULL },
+    { 0x7bf52b5b263edc95ULL, 0xfad10fc8311352d0ULL, 0x0000002b5ccb82d9ULL },
+    { 0x7dc5675d75e81d07ULL, 0x3d8d2459fff79b94ULL, 0x00000018bfbfafbaULL },
+    { 0xbda3c0cd39345161ULL, 0x4bd572ed41b3ab12ULL, 0x000000279cb1596aULL },
+    { 0x0ef7993d8ddc9cddULL, 0x21f19d708a6e17bbULL, 0x00000011792c1aaaULL },
+    { 0x5af691e91ca6b7b9ULL, 0x0c20efdca4a6e67aULL, 0x0000002a95ed914bULL },
+    { 0xa8fe824a6e20ef83ULL, 0xe76c996871e5fe68ULL, 0x0000001d78b1cbb6ULL },
+    { 0xe69498336c517461ULL, 0x943758cf6eeb28e2ULL, 0x0000002e9896a47eULL },
+    { 0xe34120124f3a8445ULL, 0x20e5b372787342f3ULL, 0x0000001a09ba72c8ULL },
+    { 0xbc13453ce19dc829ULL, 0xd515c9ec542dec09ULL, 0x000000037ee8e56fULL },
+    { 0x739be1cfcfc49802ULL, 0x039bad4cfbca189cULL, 0x00000031f4ca020fULL },
+    { 0x61c284290fbaa9b4ULL, 0x8f6e505dd3883604ULL, 0x0000003a2e588fd6ULL },
+    { 0x2550b652834b9c88ULL, 0xe2ba8dee8a96a68eULL, 0x0000000a6582c5f9ULL },
+    { 0x0be0e9cc11adcb2dULL, 0xa71a1bd6f0a5b37dULL, 0x000000000148c22cULL },
+    { 0x65ec6bca6cb5567eULL, 0x058401c96621a4efULL, 0x0000000000000000ULL },
+    { 0xa104ee462a18dff0ULL, 0x0000000017b08617ULL, 0x0000000000000000ULL },
+    /* 46 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002940ec0000ULL },
+    { 0xeb29f3de22796b6bULL, 0x2ed066cf05d0e92aULL, 0x00000023545fc2b1ULL },
+    { 0x8579f95dff5bd979ULL, 0xbd4a732c0ee4919cULL, 0x000000226d413797ULL },
+    { 0xfdb0d4dd06bcd248ULL, 0xdca414c699b76a7eULL, 0x00000000fd1a2f93ULL },
+    { 0x47e2f858f3ee38c3ULL, 0x3f10e8c1194353eaULL, 0x0000003703c30e04ULL },
+    { 0x18f70b4c27bec88aULL, 0x494c01fbff9933aeULL, 0x00000024ba1e1becULL },
+    { 0x57d063ecb50a3dfbULL, 0xbdc9a44f8e43e9c2ULL, 0x000000249ac4989dULL },
+    { 0xff140a8ba6fa9115ULL, 0x3724538a14d99368ULL, 0x0000001ddbe81a9dULL },
+    { 0xfa03ba1a7acd1f79ULL, 0x3e5440010474794eULL, 0x000000130c738780ULL },
+    { 0x8f2857218b364c56ULL, 0xd032e440212e5f23ULL, 0x0000000b6500dc51ULL },
+    { 0x6ad47de6a0dfd2a6ULL, 0xf06f1d5494498adbULL, 0x00000030ad0b9830ULL },
+    { 0x2b5b263edc946203ULL, 0x0fc8311352d07bf5ULL, 0x00000020dcb7fad1ULL },
+    { 0x675d75e81d06aaa9ULL, 0x2459fff79b947dc5ULL, 0x00000031b28c3d8dULL },
+    { 0xc0cd393451606f71ULL, 0x72ed41b3ab12bda3ULL, 0x0000003841604bd5ULL },
+    { 0x993d8ddc9cdc5a94ULL, 0x9d708a6e17bb0ef7ULL, 0x00000007ab3221f1ULL },
+    { 0x91e91ca6b7b856ccULL, 0xefdca4a6e67a5af6ULL, 0x0000001949050c20ULL },
+    { 0x824a6e20ef825c2eULL, 0x996871e5fe68a8feULL, 0x0000000ce2eee76cULL },
+    { 0x98336c5174601c24ULL, 0x58cf6eeb28e2e694ULL, 0x000000357b3e9437ULL },
+    { 0x20124f3a84440d16ULL, 0xb372787342f3e341ULL, 0x0000000512b620e5ULL },
+    { 0x453ce19dc828cadbULL, 0xc9ec542dec09bc13ULL, 0x000000243f11d515ULL },
+    { 0xe1cfcfc498015ecfULL, 0xad4cfbca189c739bULL, 0x00000019af39039bULL },
+    { 0x84290fbaa9b3caa9ULL, 0x505dd388360461c2ULL, 0x0000002b6f828f6eULL },
+    { 0xb652834b9c87897aULL, 0x8dee8a96a68e2550ULL, 0x000000061433e2baULL },
+    { 0xe9cc11adcb2c1361ULL, 0x1bd6f0a5b37d0be0ULL, 0x0000001ebc3aa71aULL },
+    { 0x6bca6cb5567d9ff1ULL, 0x01c96621a4ef65ecULL, 0x0000000000000584ULL },
+    { 0xee462a18dfef0551ULL, 0x000017b08617a104ULL, 0x0000000000000000ULL },
+    { 0xee6ed136d13454cbULL, 0x00000000000065beULL, 0x0000000000000000ULL },
+    /* 47 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000003085b40000ULL },
+    { 0xf3de22796b6aa0f8ULL, 0x66cf05d0e92aeb29ULL, 0x00000011558f2ed0ULL },
+    { 0xf95dff5bd978c889ULL, 0x732c0ee4919c8579ULL, 0x0000002633ffbd4aULL },
+    { 0xd4dd06bcd247a209ULL, 0x14c699b76a7efdb0ULL, 0x00000003efdddca4ULL },
+    { 0xf858f3ee38c2dc1dULL, 0xe8c1194353ea47e2ULL, 0x00000011b26a3f10ULL },
+    { 0x0b4c27bec889e08dULL, 0x01fbff9933ae18f7ULL, 0x0000002ef2ca494cULL },
+    { 0x63ecb50a3dfabeebULL, 0xa44f8e43e9c257d0ULL, 0x000000087537bdc9ULL },
+    { 0x0a8ba6fa91147a8dULL, 0x538a14d99368ff14ULL, 0x000000139db13724ULL },
+    { 0xba1a7acd1f78e7c3ULL, 0x40010474794efa03ULL, 0x0000000bd9603e54ULL },
+    { 0x57218b364c558b52ULL, 0xe440212e5f238f28ULL, 0x00000019def1d032ULL },
+    { 0x7de6a0dfd2a5d15aULL, 0x1d5494498adb6ad4ULL, 0x0000002e9c5af06fULL },
+    { 0x263edc9462028ae3ULL, 0x311352d07bf52b5bULL, 0x00000014f4690fc8ULL },
+    { 0x75e81d06aaa8f435ULL, 0xfff79b947dc5675dULL, 0x000000373d992459ULL },
+    { 0x393451606f70bbc7ULL, 0x41b3ab12bda3c0cdULL, 0x0000001a33f372edULL },
+    { 0x8ddc9cdc5a9357f5ULL, 0x8a6e17bb0ef7993dULL, 0x000000335f5b9d70ULL },
+    { 0x1ca6b7b856cbb135ULL, 0xa4a6e67a5af691e9ULL, 0x000000185166efdcULL },
+    { 0x6e20ef825c2d264dULL, 0x71e5fe68a8fe824aULL, 0x000000304bfc9968ULL },
+    { 0x6c5174601c23750dULL, 0x6eeb28e2e6949833ULL, 0x0000001aa6f958cfULL },
+    { 0x4f3a84440d153559ULL, 0x787342f3e3412012ULL, 0x00000037064bb372ULL },
+    { 0xe19dc828cada40b2ULL, 0x542dec09bc13453cULL, 0x00000011ec93c9ecULL },
+    { 0xcfc498015eced44eULL, 0xfbca189c739be1cfULL, 0x00000015d87bad4cULL },
+    { 0x0fbaa9b3caa86b86ULL, 0xd388360461c28429ULL, 0x000000378a2c505dULL },
+    { 0x834b9c8789798f9fULL, 0x8a96a68e2550b652ULL, 0x000000320b6c8deeULL },
+    { 0x11adcb2c136039f2ULL, 0xf0a5b37d0be0e9ccULL, 0x0000002ee4501bd6ULL },
+    { 0x6cb5567d9ff09d2fULL, 0x6621a4ef65ec6bcaULL, 0x00000000058401c9ULL },
+    { 0x2a18dfef0550706bULL, 0x17b08617a104ee46ULL, 0x0000000000000000ULL },
+    { 0xd136d13454ca17afULL, 0x0000000065beee6eULL, 0x0000000000000000ULL },
+    /* 48 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000003033840000ULL },
+    { 0x22796b6aa0f775b2ULL, 0x05d0e92aeb29f3deULL, 0x0000000a421266cfULL },
+    { 0xff5bd978c88897edULL, 0x0ee4919c8579f95dULL, 0x0000002e3d82732cULL },
+    { 0x06bcd247a2080c0eULL, 0x99b76a7efdb0d4ddULL, 0x0000002cf59414c6ULL },
+    { 0xf3ee38c2dc1cde4bULL, 0x194353ea47e2f858ULL, 0x0000003aac46e8c1ULL },
+    { 0x27bec889e08c5bbfULL, 0xff9933ae18f70b4cULL, 0x0000001285e401fbULL },
+    { 0xb50a3dfabeeaa810ULL, 0x8e43e9c257d063ecULL, 0x00000020264ba44fULL },
+    { 0xa6fa91147a8c6ba6ULL, 0x14d99368ff140a8bULL, 0x000000003ca4538aULL },
+    { 0x7acd1f78e7c228d4ULL, 0x0474794efa03ba1aULL, 0x0000000eee6c4001ULL },
+    { 0x8b364c558b51a26cULL, 0x212e5f238f285721ULL, 0x00000013b150e440ULL },
+    { 0xa0dfd2a5d1590b33ULL, 0x94498adb6ad47de6ULL, 0x000000047fc51d54ULL },
+    { 0xdc9462028ae2ca54ULL, 0x52d07bf52b5b263eULL, 0x00000039a6923113ULL },
+    { 0x1d06aaa8f434c5bbULL, 0x9b947dc5675d75e8ULL, 0x00000029d50ffff7ULL },
+    { 0x51606f70bbc686cdULL, 0xab12bda3c0cd3934ULL, 0x00000019a20941b3ULL },
+    { 0x9cdc5a9357f41f2dULL, 0x17bb0ef7993d8ddcULL, 0x00000026dc088a6eULL },
+    { 0xb7b856cbb1343144ULL, 0xe67a5af691e91ca6ULL, 0x000000358cb2a4a6ULL },
+    { 0xef825c2d264caf7dULL, 0xfe68a8fe824a6e20ULL, 0x00000036c09c71e5ULL },
+    { 0x74601c23750ce1ebULL, 0x28e2e69498336c51ULL, 0x0000001ad61f6eebULL },
+    { 0x84440d15355804c4ULL, 0x42f3e34120124f3aULL, 0x0000000ab12a7873ULL },
+    { 0xc828cada40b18bd9ULL, 0xec09bc13453ce19dULL, 0x0000002f0dde542dULL },
+    { 0x98015eced44d9217ULL, 0x189c739be1cfcfc4ULL, 0x0000001fb6cefbcaULL },
+    { 0xa9b3caa86b859ebfULL, 0x360461c284290fbaULL, 0x000000231379d388ULL },
+    { 0x9c8789798f9e45f5ULL, 0xa68e2550b652834bULL, 0x00000026948e8a96ULL },
+    { 0xcb2c136039f1e6fbULL, 0xb37d0be0e9cc11adULL, 0x00000007d55af0a5ULL },
+    { 0x567d9ff09d2e4358ULL, 0xa4ef65ec6bca6cb5ULL, 0x0000002919a36621ULL },
+    { 0xdfef0550706a6d68ULL, 0x8617a104ee462a18ULL, 0x00000000000017b0ULL },
+    { 0xd13454ca17aee7bfULL, 0x000065beee6ed136ULL, 0x0000000000000000ULL },
+    { 0xb7eb212cd0915e74ULL, 0x000000000001b4feULL, 0x0000000000000000ULL },
+    /* 49 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000030a40e0000ULL },
+    { 0x6b6aa0f775b1a1bdULL, 0xe92aeb29f3de2279ULL, 0x0000003537c305d0ULL },
+    { 0xd978c88897ec498aULL, 0x919c8579f95dff5bULL, 0x0000002ab4720ee4ULL },
+    { 0xd247a2080c0dcf0aULL, 0x6a7efdb0d4dd06bcULL, 0x0000000fad0c99b7ULL },
+    { 0x38c2dc1cde4a5666ULL, 0x53ea47e2f858f3eeULL, 0x00000023ab8b1943ULL },
+    { 0xc889e08c5bbe8f90ULL, 0x33ae18f70b4c27beULL, 0x0000000fcfefff99ULL },
+    { 0x3dfabeeaa80fb408ULL, 0xe9c257d063ecb50aULL, 0x00000032a8878e43ULL },
+    { 0x91147a8c6ba5b331ULL, 0x9368ff140a8ba6faULL, 0x0000001b1e6214d9ULL },
+    { 0x1f78e7c228d3603cULL, 0x794efa03ba1a7acdULL, 0x0000000acbf70474ULL },
+    { 0x4c558b51a26b8a71ULL, 0x5f238f2857218b36ULL, 0x000000111f78212eULL },
+    { 0xd2a5d1590b321b85ULL, 0x8adb6ad47de6a0dfULL, 0x000000308aa09449ULL },
+    { 0x62028ae2ca531d16ULL, 0x7bf52b5b263edc94ULL, 0x0000002292c552d0ULL },
+    { 0xaaa8f434c5ba62b0ULL, 0x7dc5675d75e81d06ULL, 0x000000045d099b94ULL },
+    { 0x6f70bbc686ccdb94ULL, 0xbda3c0cd39345160ULL, 0x0000002b8d8dab12ULL },
+    { 0x5a9357f41f2ceafbULL, 0x0ef7993d8ddc9cdcULL, 0x0000001c7cf217bbULL },
+    { 0x56cbb13431435d8aULL, 0x5af691e91ca6b7b8ULL, 0x000000185e3ae67aULL },
+    { 0x5c2d264caf7c2b90ULL, 0xa8fe824a6e20ef82ULL, 0x00000034d455fe68ULL },
+    { 0x1c23750ce1eaa8aeULL, 0xe69498336c517460ULL, 0x00000038c8d728e2ULL },
+    { 0x0d15355804c3daffULL, 0xe34120124f3a8444ULL, 0x00000002443b42f3ULL },
+    { 0xcada40b18bd8e3e6ULL, 0xbc13453ce19dc828ULL, 0x000000246d3dec09ULL },
+    { 0x5eced44d921667e4ULL, 0x739be1cfcfc49801ULL, 0x00000001052e189cULL },
+    { 0xcaa86b859ebe7b7aULL, 0x61c284290fbaa9b3ULL, 0x00000021188c3604ULL },
+    { 0x89798f9e45f4ee8fULL, 0x2550b652834b9c87ULL, 0x0000001d1d58a68eULL },
+    { 0x136039f1e6fa8507ULL, 0x0be0e9cc11adcb2cULL, 0x00000037bd3db37dULL },
+    { 0x9ff09d2e4357b221ULL, 0x65ec6bca6cb5567dULL, 0x000000058065a4efULL },
+    { 0x0550706a6d675e0aULL, 0xa104ee462a18dfefULL, 0x0000000017b08617ULL },
+    { 0x54ca17aee7befe85ULL, 0x65beee6ed136d134ULL, 0x0000000000000000ULL },
+    { 0x212cd0915e7348ebULL, 0x00000001b4feb7ebULL, 0x0000000000000000ULL },
+    /* 50 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000009fe260000ULL },
+    { 0xa0f775b1a1bced76ULL, 0xeb29f3de22796b6aULL, 0x000000247166e92aULL },
+    { 0xc88897ec4989e071ULL, 0x8579f95dff5bd978ULL, 0x0000001d9140919cULL },
+    { 0xa2080c0dcf095686ULL, 0xfdb0d4dd06bcd247ULL, 0x000000368c396a7eULL },
+    { 0xdc1cde4a56659b29ULL, 0x47e2f858f3ee38c2ULL, 0x00000028890553eaULL },
+    { 0xe08c5bbe8f8fce1eULL, 0x18f70b4c27bec889ULL, 0x0000002d3fbf33aeULL },
+    { 0xbeeaa80fb4073e32ULL, 0x57d063ecb50a3dfaULL, 0x000000187245e9c2ULL },
+    { 0x7a8c6ba5b3303b42ULL, 0xff140a8ba6fa9114ULL, 0x00000012635f9368ULL },
+    { 0xe7c228d3603b9fe0ULL, 0xfa03ba1a7acd1f78ULL, 0x00000008477e794eULL },
+    { 0x8b51a26b8a70e8daULL, 0x8f2857218b364c55ULL, 0x00000033164a5f23ULL },
+    { 0xd1590b321b848672ULL, 0x6ad47de6a0dfd2a5ULL, 0x00000039153b8adbULL },
+    { 0x8ae2ca531d158c15ULL, 0x2b5b263edc946202ULL, 0x0000002df62e7bf5ULL },
+    { 0xf434c5ba62af1a90ULL, 0x675d75e81d06aaa8ULL, 0x0000002620727dc5ULL },
+    { 0xbbc686ccdb93b045ULL, 0xc0cd393451606f70ULL, 0x00000039a606bda3ULL },
+    { 0x57f41f2ceafa7c8dULL, 0x993d8ddc9cdc5a93ULL, 0x0000003968b70ef7ULL },
+    { 0xb13431435d898941ULL, 0x91e91ca6b7b856cbULL, 0x0000003b41ea5af6ULL },
+    { 0x264caf7c2b8f3b92ULL, 0x824a6e20ef825c2dULL, 0x0000002298eca8feULL },
+    { 0x750ce1eaa8adcb3cULL, 0x98336c5174601c23ULL, 0x0000000f29c4e694ULL },
+    { 0x355804c3dafe461aULL, 0x20124f3a84440d15ULL, 0x000000047c9be341ULL },
+    { 0x40b18bd8e3e50962ULL, 0x453ce19dc828cadaULL, 0x000000244b4bbc13ULL },
+    { 0xd44d921667e33d81ULL, 0xe1cfcfc498015eceULL, 0x0000002d4a12739bULL },
+    { 0x6b859ebe7b797369ULL, 0x84290fbaa9b3caa8ULL, 0x00000012cad261c2ULL },
+    { 0x8f9e45f4ee8e8586ULL, 0xb652834b9c878979ULL, 0x000000345de02550ULL },
+    { 0x39f1e6fa8506d41aULL, 0xe9cc11adcb2c1360ULL, 0x000000370bcb0be0ULL },
+    { 0x9d2e4357b220c209ULL, 0x6bca6cb5567d9ff0ULL, 0x0000000125e565ecULL },
+    { 0x706a6d675e093f43ULL, 0xee462a18dfef0550ULL, 0x0000002c7465a104ULL },
+    { 0x17aee7befe84d32eULL, 0xee6ed136d13454caULL, 0x00000000000065beULL },
+    { 0xd0915e7348eaa0d6ULL, 0x0001b4feb7eb212cULL, 0x0000000000000000ULL },
+    { 0x13b91f745e5a32f1ULL, 0x00000000000754e1ULL, 0x0000000000000000ULL },
+    /* 51 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000009c4920000ULL },
+    { 0x75b1a1bced757da0ULL, 0xf3de22796b6aa0f7ULL, 0x0000001c6638eb29ULL },
+    { 0x97ec4989e0700e09ULL, 0xf95dff5bd978c888ULL, 0x000000292bfa8579ULL },
+    { 0x0c0dcf095685f1a5ULL, 0xd4dd06bcd247a208ULL, 0x00000034d878fdb0ULL },
+    { 0xde4a56659b28583fULL, 0xf858f3ee38c2dc1cULL, 0x0000003984fa47e2ULL },
+    { 0x5bbe8f8fce1dd3cfULL, 0x0b4c27bec889e08cULL, 0x00000030850818f7ULL },
+    { 0xa80fb4073e319aacULL, 0x63ecb50a3dfabeeaULL, 0x00000004aa8c57d0ULL },
+    { 0x6ba5b3303b411637ULL, 0x0a8ba6fa91147a8cULL, 0x00000000de24ff14ULL },
+    { 0x28d3603b9fdf5e07ULL, 0xba1a7acd1f78e7c2ULL, 0x000000096478fa03ULL },
+    { 0xa26b8a70e8d9dae2ULL, 0x57218b364c558b51ULL, 0x00000031797f8f28ULL },
+    { 0x0b321b848671397aULL, 0x7de6a0dfd2a5d159ULL, 0x0000001538ed6ad4ULL },
+    { 0xca531d158c14fd37ULL, 0x263edc9462028ae2ULL, 0x00000015c2af2b5bULL },
+    { 0xc5ba62af1a8f0d56ULL, 0x75e81d06aaa8f434ULL, 0x0000002fc845675dULL },
+    { 0x86ccdb93b0449d99ULL, 0x393451606f70bbc6ULL, 0x0000000e54e9c0cdULL },
+    { 0x1f2ceafa7c8c15d5ULL, 0x8ddc9cdc5a9357f4ULL, 0x00000036468d993dULL },
+    { 0x31435d89894056acULL, 0x1ca6b7b856cbb134ULL, 0x00000011546291e9ULL },
+    { 0xaf7c2b8f3b916869ULL, 0x6e20ef825c2d264cULL, 0x0000000bf90e824aULL },
+    { 0xe1eaa8adcb3bc89aULL, 0x6c5174601c23750cULL, 0x0000000443549833ULL },
+    { 0x04c3dafe46196432ULL, 0x4f3a84440d153558ULL, 0x0000000e2ccf2012ULL },
+    { 0x8bd8e3e509619311ULL, 0xe19dc828cada40b1ULL, 0x000000306289453cULL },
+    { 0x921667e33d806012ULL, 0xcfc498015eced44dULL, 0x000000098f73e1cfULL },
+    { 0x9ebe7b797368c6b3ULL, 0x0fbaa9b3caa86b85ULL, 0x0000001336268429ULL },
+    { 0x45f4ee8e85853851ULL, 0x834b9c8789798f9eULL, 0x0000002f8376b652ULL },
+    { 0xe6fa8506d419d324ULL, 0x11adcb2c136039f1ULL, 0x0000002f2172e9ccULL },
+    { 0x4357b220c2087472ULL, 0x6cb5567d9ff09d2eULL, 0x0000001056206bcaULL },
+    { 0x6d675e093f429439ULL, 0x2a18dfef0550706aULL, 0x00000019cd38ee46ULL },
+    { 0xe7befe84d32da8f2ULL, 0xd136d13454ca17aeULL, 0x0000000065beee6eULL },
+    { 0x5e7348eaa0d5133eULL, 0xb4feb7eb212cd091ULL, 0x0000000000000001ULL },
+    { 0x1f745e5a32f0ad4cULL, 0x0000000754e113b9ULL, 0x0000000000000000ULL },
+    { 0x7d228322baf5244aULL, 0x000000000000001fULL, 0x0000000000000000ULL },
+    /* 52 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000033b8420000ULL },
+    { 0xa1bced757d9f56e2ULL, 0x22796b6aa0f775b1ULL, 0x00000015e2aff3deULL },
+    { 0x4989e0700e08f749ULL, 0xff5bd978c88897ecULL, 0x000000337631f95dULL },
+    { 0xcf095685f1a41e8cULL, 0x06bcd247a2080c0dULL, 0x00000014b600d4ddULL },
+    { 0x56659b28583e904eULL, 0xf3ee38c2dc1cde4aULL, 0x00000011bb34f858ULL },
+    { 0x8f8fce1dd3cec609ULL, 0x27bec889e08c5bbeULL, 0x000000371cd90b4cULL },
+    { 0xb4073e319aabe8d1ULL, 0xb50a3dfabeeaa80fULL, 0x0000002083ec63ecULL },
+    { 0xb3303b41163656b1ULL, 0xa6fa91147a8c6ba5ULL, 0x000000062a500a8bULL },
+    { 0x603b9fdf5e06289cULL, 0x7acd1f78e7c228d3ULL, 0x00000007cf5dba1aULL },
+    { 0x8a70e8d9dae1da3dULL, 0x8b364c558b51a26bULL, 0x00000035b2865721ULL },
+    { 0x1b84867139797707ULL, 0xa0dfd2a5d1590b32ULL, 0x0000000ea2d87de6ULL },
+    { 0x1d158c14fd36d76fULL, 0xdc9462028ae2ca53ULL, 0x000000360b09263eULL },
+    { 0x62af1a8f0d554245ULL, 0x1d06aaa8f434c5baULL, 0x0000000c2e6375e8ULL },
+    { 0xdb93b0449d988cbfULL, 0x51606f70bbc686ccULL, 0x000000335d8b3934ULL },
+    { 0xeafa7c8c15d4b24dULL, 0x9cdc5a9357f41f2cULL, 0x00000026d1258ddcULL },
+    { 0x5d89894056abbe3eULL, 0xb7b856cbb1343143ULL, 0x00000007ab1d1ca6ULL },
+    { 0x2b8f3b9168681b16ULL, 0xef825c2d264caf7cULL, 0x00000012f7126e20ULL },
+    { 0xa8adcb3bc8998a7eULL, 0x74601c23750ce1eaULL, 0x0000000d9fdd6c51ULL },
+    { 0xdafe46196431d576ULL, 0x84440d15355804c3ULL, 0x00000024bc884f3aULL },
+    { 0xe3e5096193108b4dULL, 0xc828cada40b18bd8ULL, 0x0000002dc5e6e19dULL },
+    { 0x67e33d80601123e0ULL, 0x98015eced44d9216ULL, 0x0000002b75f9cfc4ULL },
+    { 0x7b797368c6b20fa3ULL, 0xa9b3caa86b859ebeULL, 0x000000119acb0fbaULL },
+    { 0xee8e8585385014d5ULL, 0x9c8789798f9e45f4ULL, 0x0000002876e8834bULL },
+    { 0x8506d419d3234870ULL, 0xcb2c136039f1e6faULL, 0x0000002a389411adULL },
+    { 0xb220c20874714a11ULL, 0x567d9ff09d2e4357ULL, 0x00000005caa66cb5ULL },
+    { 0x5e093f429438a930ULL, 0xdfef0550706a6d67ULL, 0x0000000cc35c2a18ULL },
+    { 0xfe84d32da8f13373ULL, 0xd13454ca17aee7beULL, 0x0000003b4e66d136ULL },
+    { 0x48eaa0d5133d4606ULL, 0xb7eb212cd0915e73ULL, 0x000000000001b4feULL },
+    { 0x5e5a32f0ad4bce0fULL, 0x000754e113b91f74ULL, 0x0000000000000000ULL },
+    { 0x8322baf524497e40ULL, 0x00000000001f7d22ULL, 0x0000000000000000ULL },
+    /* 53 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001c452c0000ULL },
+    { 0xed757d9f56e1a7ebULL, 0x6b6aa0f775b1a1bcULL, 0x0000001562a82279ULL },
+    { 0xe0700e08f74849d5ULL, 0xd978c88897ec4989ULL, 0x0000002bf6a1ff5bULL },
+    { 0x5685f1a41e8ba048ULL, 0xd247a2080c0dcf09ULL, 0x00000037771f06bcULL },
+    { 0x9b28583e904d1bbeULL, 0x38c2dc1cde4a5665ULL, 0x0000002c6b92f3eeULL },
+    { 0xce1dd3cec608ecf8ULL, 0xc889e08c5bbe8f8fULL, 0x00000002627a27beULL },
+    { 0x3e319aabe8d0d25eULL, 0x3dfabeeaa80fb407ULL, 0x0000003a56f0b50aULL },
+    { 0x3b41163656b012e0ULL, 0x91147a8c6ba5b330ULL, 0x0000002fc247a6faULL },
+    { 0x9fdf5e06289b559aULL, 0x1f78e7c228d3603bULL, 0x0000000ca46c7acdULL },
+    { 0xe8d9dae1da3c3261ULL, 0x4c558b51a26b8a70ULL, 0x000000341ce18b36ULL },
+    { 0x8671397977061f98ULL, 0xd2a5d1590b321b84ULL, 0x000000228c4ea0dfULL },
+    { 0x8c14fd36d76e05a6ULL, 0x62028ae2ca531d15ULL, 0x000000018d5cdc94ULL },
+    { 0x1a8f0d554244c5a8ULL, 0xaaa8f434c5ba62afULL, 0x0000001673fe1d06ULL },
+    { 0xb0449d988cbef908ULL, 0x6f70bbc686ccdb93ULL, 0x000000334e1c5160ULL },
+    { 0x7c8c15d4b24c0db4ULL, 0x5a9357f41f2ceafaULL, 0x0000002aeb769cdcULL },
+    { 0x894056abbe3d4d6cULL, 0x56cbb13431435d89ULL, 0x0000001e5a10b7b8ULL },
+    { 0x3b9168681b15434cULL, 0x5c2d264caf7c2b8fULL, 0x000000166098ef82ULL },
+    { 0xcb3bc8998a7d960cULL, 0x1c23750ce1eaa8adULL, 0x0000000fd8297460ULL },
+    { 0x46196431d57561deULL, 0x0d15355804c3dafeULL, 0x000000097f6a8444ULL },
+    { 0x096193108b4c1c2fULL, 0xcada40b18bd8e3e5ULL, 0x0000000051adc828ULL },
+    { 0x3d80601123df543cULL, 0x5eced44d921667e3ULL, 0x00000029dc6a9801ULL },
+    { 0x7368c6b20fa2933aULL, 0xcaa86b859ebe7b79ULL, 0x0000001f8ea2a9b3ULL },
+    { 0x8585385014d4d9e2ULL, 0x89798f9e45f4ee8eULL, 0x0000000a431d9c87ULL },
+    { 0xd419d323486ff678ULL, 0x136039f1e6fa8506ULL, 0x0000001d3fd1cb2cULL },
+    { 0xc20874714a10d2c5ULL, 0x9ff09d2e4357b220ULL, 0x00000037a6bf567dULL },
+    { 0x3f429438a92f9937ULL, 0x0550706a6d675e09ULL, 0x0000000c2f2edfefULL },
+    { 0xd32da8f1337226dfULL, 0x54ca17aee7befe84ULL, 0x00000036bed0d134ULL },
+    { 0xa0d5133d46052999ULL, 0x212cd0915e7348eaULL, 0x00000001b4feb7ebULL },
+    { 0x32f0ad4bce0e56e1ULL, 0x54e113b91f745e5aULL, 0x0000000000000007ULL },
+    { 0xbaf524497e3ff3e1ULL, 0x0000001f7d228322ULL, 0x0000000000000000ULL },
+    { 0x3e4f75e2224e685bULL, 0x0000000000000087ULL, 0x0000000000000000ULL },
+    /* 54 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000018d3920000ULL },
+    { 0x7d9f56e1a7ea032eULL, 0xa0f775b1a1bced75ULL, 0x0000001c1f3f6b6aULL },
+    { 0x0e08f74849d41e7aULL, 0xc88897ec4989e070ULL, 0x00000010ada7d978ULL },
+    { 0xf1a41e8ba0470d54ULL, 0xa2080c0dcf095685ULL, 0x0000002d5e8cd247ULL },
+    { 0x583e904d1bbd2234ULL, 0xdc1cde4a56659b28ULL, 0x000000201a1e38c2ULL },
+    { 0xd3cec608ecf73267ULL, 0xe08c5bbe8f8fce1dULL, 0x0000003a619cc889ULL },
+    { 0x9aabe8d0d25d15e8ULL, 0xbeeaa80fb4073e31ULL, 0x00000004c4a03dfaULL },
+    { 0x163656b012dffc72ULL, 0x7a8c6ba5b3303b41ULL, 0x0000001c26849114ULL },
+    { 0x5e06289b559911a4ULL, 0xe7c228d3603b9fdfULL, 0x00000013ead51f78ULL },
+    { 0xdae1da3c3260fddeULL, 0x8b51a26b8a70e8d9ULL, 0x000000269b824c55ULL },
+    { 0x397977061f97ee42ULL, 0xd1590b321b848671ULL, 0x00000000978bd2a5ULL },
+    { 0xfd36d76e05a5fa73ULL, 0x8ae2ca531d158c14ULL, 0x0000002756706202ULL },
+    { 0x0d554244c5a7ce33ULL, 0xf434c5ba62af1a8fULL, 0x0000001a3f70aaa8ULL },
+    { 0x9d988cbef907a59dULL, 0xbbc686ccdb93b044ULL, 0x000000224e5c6f70ULL },
+    { 0x15d4b24c0db33059ULL, 0x57f41f2ceafa7c8cULL, 0x0000002f6d005a93ULL },
+    { 0x56abbe3d4d6b6667ULL, 0xb13431435d898940ULL, 0x0000000a832056cbULL },
+    { 0x68681b15434bdb26ULL, 0x264caf7c2b8f3b91ULL, 0x00000008416a5c2dULL },
+    { 0xc8998a7d960bec89ULL, 0x750ce1eaa8adcb3bULL, 0x00000004f01e1c23ULL },
+    { 0x6431d57561dd7df4ULL, 0x355804c3dafe4619ULL, 0x00000032d0e00d15ULL },
+    { 0x93108b4c1c2ef72fULL, 0x40b18bd8e3e50961ULL, 0x0000003027fccadaULL },
+    { 0x601123df543b3d9aULL, 0xd44d921667e33d80ULL, 0x00000027369d5eceULL },
+    { 0xc6b20fa29339ad96ULL, 0x6b859ebe7b797368ULL, 0x0000001c4d99caa8ULL },
+    { 0x385014d4d9e1cb6dULL, 0x8f9e45f4ee8e8585ULL, 0x0000001667898979ULL },
+    { 0xd323486ff677328dULL, 0x39f1e6fa8506d419ULL, 0x0000003805b61360ULL },
+    { 0x74714a10d2c43481ULL, 0x9d2e4357b220c208ULL, 0x00000012ba8b9ff0ULL },
+    { 0x9438a92f993683cfULL, 0x706a6d675e093f42ULL, 0x0000002f0da70550ULL },
+    { 0xa8f1337226de2f1fULL, 0x17aee7befe84d32dULL, 0x0000000a6f2a54caULL },
+    { 0x133d46052998526aULL, 0xd0915e7348eaa0d5ULL, 0x0000003467a3212cULL },
+    { 0xad4bce0e56e05068ULL, 0x13b91f745e5a32f0ULL, 0x00000000000754e1ULL },
+    { 0x24497e3ff3e00c58ULL, 0x001f7d228322baf5ULL, 0x0000000000000000ULL },
+    { 0x75e2224e685a7745ULL, 0x0000000000873e4fULL, 0x0000000000000000ULL },
+    /* 55 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000399dc00000ULL },
+    { 0x56e1a7ea032d4ad6ULL, 0x75b1a1bced757d9fULL, 0x0000001fcd9aa0f7ULL },
+    { 0xf74849d41e794511ULL, 0x97ec4989e0700e08ULL, 0x00000001dfa4c888ULL },
+    { 0x1e8ba0470d53578eULL, 0x0c0dcf095685f1a4ULL, 0x00000006b8afa208ULL },
+    { 0x904d1bbd2233430fULL, 0xde4a56659b28583eULL, 0x00000020ae02dc1cULL },
+    { 0xc608ecf73266fbbdULL, 0x5bbe8f8fce1dd3ceULL, 0x00000036a29de08cULL },
+    { 0xe8d0d25d15e74387ULL, 0xa80fb4073e319aabULL, 0x00000020b1b6beeaULL },
+    { 0x56b012dffc71c668ULL, 0x6ba5b3303b411636ULL, 0x0000002d34ce7a8cULL },
+    { 0x289b559911a38070ULL, 0x28d3603b9fdf5e06ULL, 0x0000001301cae7c2ULL },
+    { 0xda3c3260fddda8f6ULL, 0xa26b8a70e8d9dae1ULL, 0x00000014bb6b8b51ULL },
+    { 0x77061f97ee4109cbULL, 0x0b321b8486713979ULL, 0x00000034cdc1d159ULL },
+    { 0xd76e05a5fa72f687ULL, 0xca531d158c14fd36ULL, 0x0000000c497a8ae2ULL },
+    { 0x4244c5a7ce323746ULL, 0xc5ba62af1a8f0d55ULL, 0x0000002e391af434ULL },
+    { 0x8cbef907a59cb0aeULL, 0x86ccdb93b0449d98ULL, 0x00000038d6cabbc6ULL },
+    { 0xb24c0db33058f04aULL, 0x1f2ceafa7c8c15d4ULL, 0x0000000c26e957f4ULL },
+    { 0xbe3d4d6b6666dd5fULL, 0x31435d89894056abULL, 0x00000011dacfb134ULL },
+    { 0x1b15434bdb2563d4ULL, 0xaf7c2b8f3b916868ULL, 0x00000002ffdb264cULL },
+    { 0x8a7d960bec88f427ULL, 0xe1eaa8adcb3bc899ULL, 0x000000147e51750cULL },
+    { 0xd57561dd7df33154ULL, 0x04c3dafe46196431ULL, 0x0000002956953558ULL },
+    { 0x8b4c1c2ef72e1eb9ULL, 0x8bd8e3e509619310ULL, 0x000000120f9240b1ULL },
+    { 0x23df543b3d9935dcULL, 0x921667e33d806011ULL, 0x0000001f1c60d44dULL },
+    { 0x0fa29339ad953ed8ULL, 0x9ebe7b797368c6b2ULL, 0x00000024d9d26b85ULL },
+    { 0x14d4d9e1cb6ca21cULL, 0x45f4ee8e85853850ULL, 0x00000038527f8f9eULL },
+    { 0x486ff677328c887dULL, 0xe6fa8506d419d323ULL, 0x0000000ac57e39f1ULL },
+    { 0x4a10d2c4348044e4ULL, 0x4357b220c2087471ULL, 0x00000018c7909d2eULL },
+    { 0xa92f993683ce2e92ULL, 0x6d675e093f429438ULL, 0x00000028b92a706aULL },
+    { 0x337226de2f1e19b8ULL, 0xe7befe84d32da8f1ULL, 0x00000021d8aa17aeULL },
+    { 0x460529985269ccc6ULL, 0x5e7348eaa0d5133dULL, 0x0000002b1a2ed091ULL },
+    { 0xce0e56e050674140ULL, 0x1f745e5a32f0ad4bULL, 0x0000000754e113b9ULL },
+    { 0x7e3ff3e00c57550fULL, 0x7d228322baf52449ULL, 0x000000000000001fULL },
+    { 0x224e685a7744a6e9ULL, 0x000000873e4f75e2ULL, 0x0000000000000000ULL },
+    { 0xddb0db666656f88dULL, 0x0000000000000244ULL, 0x0000000000000000ULL },
+    /* 56 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000295bae0000ULL },
+    { 0xa7ea032d4ad5ab07ULL, 0xa1bced757d9f56e1ULL, 0x0000003703d175b1ULL },
+    { 0x49d41e7945106308ULL, 0x4989e0700e08f748ULL, 0x00000003371097ecULL },
+    { 0xa0470d53578dd4e8ULL, 0xcf095685f1a41e8bULL, 0x000000114edc0c0dULL },
+    { 0x1bbd2233430e2aecULL, 0x56659b28583e904dULL, 0x0000002c5e4ede4aULL },
+    { 0xecf73266fbbc7a4aULL, 0x8f8fce1dd3cec608ULL, 0x00000003a7fc5bbeULL },
+    { 0xd25d15e74386ea22ULL, 0xb4073e319aabe8d0ULL, 0x00000026947ca80fULL },
+    { 0x12dffc71c667f233ULL, 0xb3303b41163656b0ULL, 0x0000003136fc6ba5ULL },
+    { 0x559911a3806f8f26ULL, 0x603b9fdf5e06289bULL, 0x0000001909ee28d3ULL },
+    { 0x3260fddda8f54475ULL, 0x8a70e8d9dae1da3cULL, 0x0000000baaa3a26bULL },
+    { 0x1f97ee4109cafbcdULL, 0x1b84867139797706ULL, 0x0000001359f50b32ULL },
+    { 0x05a5fa72f686272fULL, 0x1d158c14fd36d76eULL, 0x0000002b6570ca53ULL },
+    { 0xc5a7ce323745e0c2ULL, 0x62af1a8f0d554244ULL, 0x0000002fb278c5baULL },
+    { 0xf907a59cb0ad0ff8ULL, 0xdb93b0449d988cbeULL, 0x0000000a755086ccULL },
+    { 0x0db33058f0496bccULL, 0xeafa7c8c15d4b24cULL, 0x0000000faf4a1f2cULL },
+    { 0x4d6b6666dd5ed301ULL, 0x5d89894056abbe3dULL, 0x0000001ce91e3143ULL },
+    { 0x434bdb2563d3ef40ULL, 0x2b8f3b9168681b15ULL, 0x00000036a2c2af7cULL },
+    { 0x960bec88f426b2d6ULL, 0xa8adcb3bc8998a7dULL, 0x0000002d99e4e1eaULL },
+    { 0x61dd7df33153fc0eULL, 0xdafe46196431d575ULL, 0x000000327faa04c3ULL },
+    { 0x1c2ef72e1eb8ec53ULL, 0xe3e5096193108b4cULL, 0x00000005377d8bd8ULL },
+    { 0x543b3d9935dbdf18ULL, 0x67e33d80601123dfULL, 0x0000002c59a19216ULL },
+    { 0x9339ad953ed7880fULL, 0x7b797368c6b20fa2ULL, 0x0000003907139ebeULL },
+    { 0xd9e1cb6ca21bf25dULL, 0xee8e8585385014d4ULL, 0x0000003a542245f4ULL },
+    { 0xf677328c887cf566ULL, 0x8506d419d323486fULL, 0x000000146b13e6faULL },
+    { 0xd2c4348044e3fbdaULL, 0xb220c20874714a10ULL, 0x00000018112c4357ULL },
+    { 0x993683ce2e915c7aULL, 0x5e093f429438a92fULL, 0x0000002c78246d67ULL },
+    { 0x26de2f1e19b782b1ULL, 0xfe84d32da8f13372ULL, 0x0000001ad782e7beULL },
+    { 0x29985269ccc580ffULL, 0x48eaa0d5133d4605ULL, 0x0000001b181b5e73ULL },
+    { 0x56e05067413f5609ULL, 0x5e5a32f0ad4bce0eULL, 0x0000000809171f74ULL },
+    { 0xf3e00c57550e0c52ULL, 0x8322baf524497e3fULL, 0x00000000001f7d22ULL },
+    { 0x685a7744a6e804a3ULL, 0x00873e4f75e2224eULL, 0x0000000000000000ULL },
+    { 0xdb666656f88c4021ULL, 0x000000000244ddb0ULL, 0x0000000000000000ULL },
+    /* 57 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002bfcf60000ULL },
+    { 0x032d4ad5ab06983aULL, 0xed757d9f56e1a7eaULL, 0x000000201a17a1bcULL },
+    { 0x1e7945106307c35cULL, 0xe0700e08f74849d4ULL, 0x000000022c964989ULL },
+    { 0x0d53578dd4e72fb8ULL, 0x5685f1a41e8ba047ULL, 0x00000017a831cf09ULL },
+    { 0x2233430e2aebcb3fULL, 0x9b28583e904d1bbdULL, 0x000000217b745665ULL },
+    { 0x3266fbbc7a49aa4dULL, 0xce1dd3cec608ecf7ULL, 0x00000001afb68f8fULL },
+    { 0x15e74386ea215683ULL, 0x3e319aabe8d0d25dULL, 0x0000000b3ad1b407ULL },
+    { 0xfc71c667f2321b3dULL, 0x3b41163656b012dfULL, 0x0000000de1e5b330ULL },
+    { 0x11a3806f8f25791dULL, 0x9fdf5e06289b5599ULL, 0x0000001a49ef603bULL },
+    { 0xfddda8f544743ee2ULL, 0xe8d9dae1da3c3260ULL, 0x0000001edb1d8a70ULL },
+    { 0xee4109cafbcc06afULL, 0x8671397977061f97ULL, 0x0000000504501b84ULL },
+    { 0xfa72f686272e0dc5ULL, 0x8c14fd36d76e05a5ULL, 0x00000028c4ff1d15ULL },
+    { 0xce323745e0c19af4ULL, 0x1a8f0d554244c5a7ULL, 0x0000002262ec62afULL },
+    { 0xa59cb0ad0ff78e1fULL, 0xb0449d988cbef907ULL, 0x0000003a5228db93ULL },
+    { 0x3058f0496bcb8b9aULL, 0x7c8c15d4b24c0db3ULL, 0x0000002005caeafaULL },
+    { 0x6666dd5ed300cd47ULL, 0x894056abbe3d4d6bULL, 0x0000002159555d89ULL },
+    { 0xdb2563d3ef3fd56dULL, 0x3b9168681b15434bULL, 0x0000002876ec2b8fULL },
+    { 0xec88f426b2d5cc61ULL, 0xcb3bc8998a7d960bULL, 0x0000003b33e6a8adULL },
+    { 0x7df33153fc0d46a4ULL, 0x46196431d57561ddULL, 0x0000003553a5dafeULL },
+    { 0xf72e1eb8ec52ee7fULL, 0x096193108b4c1c2eULL, 0x00000034e892e3e5ULL },
+    { 0x3d9935dbdf1788d1ULL, 0x3d80601123df543bULL, 0x0000001c470867e3ULL },
+    { 0xad953ed7880e4da9ULL, 0x7368c6b20fa29339ULL, 0x000000212ef27b79ULL },
+    { 0xcb6ca21bf25cd7e0ULL, 0x8585385014d4d9e1ULL, 0x000000019702ee8eULL },
+    { 0x328c887cf565951fULL, 0xd419d323486ff677ULL, 0x00000007a0868506ULL },
+    { 0x348044e3fbd98a69ULL, 0xc20874714a10d2c4ULL, 0x00000002272bb220ULL },
+    { 0x83ce2e915c793cb6ULL, 0x3f429438a92f9936ULL, 0x0000001eecfb5e09ULL },
+    { 0x2f1e19b782b0dd81ULL, 0xd32da8f1337226deULL, 0x00000036a0eefe84ULL },
+    { 0x5269ccc580fe85bcULL, 0xa0d5133d46052998ULL, 0x00000015004748eaULL },
+    { 0x5067413f5608f96fULL, 0x32f0ad4bce0e56e0ULL, 0x0000000816165e5aULL },
+    { 0x0c57550e0c51663cULL, 0xbaf524497e3ff3e0ULL, 0x0000001f7d228322ULL },
+    { 0x7744a6e804a291cdULL, 0x3e4f75e2224e685aULL, 0x0000000000000087ULL },
+    { 0x6656f88c402026e8ULL, 0x00000244ddb0db66ULL, 0x0000000000000000ULL },
+    { 0xcce62836ac5774efULL, 0x00000000000009beULL, 0x0000000000000000ULL },
+    /* 58 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001b5afe0000ULL },
+    { 0x4ad5ab069839610fULL, 0x7d9f56e1a7ea032dULL, 0x0000001a16fced75ULL },
+    { 0x45106307c35b386cULL, 0x0e08f74849d41e79ULL, 0x0000001f2fade070ULL },
+    { 0x578dd4e72fb75fc1ULL, 0xf1a41e8ba0470d53ULL, 0x0000000964bb5685ULL },
+    { 0x430e2aebcb3ef5d3ULL, 0x583e904d1bbd2233ULL, 0x00000006f1d99b28ULL },
+    { 0xfbbc7a49aa4c5975ULL, 0xd3cec608ecf73266ULL, 0x0000000b8ca3ce1dULL },
+    { 0x4386ea215682bc3aULL, 0x9aabe8d0d25d15e7ULL, 0x0000000f27793e31ULL },
+    { 0xc667f2321b3cb6bdULL, 0x163656b012dffc71ULL, 0x0000003401ba3b41ULL },
+    { 0x806f8f25791c4c68ULL, 0x5e06289b559911a3ULL, 0x00000032b92b9fdfULL },
+    { 0xa8f544743ee1a847ULL, 0xdae1da3c3260fdddULL, 0x0000001a5cb4e8d9ULL },
+    { 0x09cafbcc06aeadffULL, 0x397977061f97ee41ULL, 0x00000004e30c8671ULL },
+    { 0xf686272e0dc4d294ULL, 0xfd36d76e05a5fa72ULL, 0x000000214e918c14ULL },
+    { 0x3745e0c19af3bbd8ULL, 0x0d554244c5a7ce32ULL, 0x0000000ff9cf1a8fULL },
+    { 0xb0ad0ff78e1e947bULL, 0x9d988cbef907a59cULL, 0x000000209dbbb044ULL },
+    { 0xf0496bcb8b99eb44ULL, 0x15d4b24c0db33058ULL, 0x0000000efae07c8cULL },
+    { 0xdd5ed300cd46bbbfULL, 0x56abbe3d4d6b6666ULL, 0x00000021dafb8940ULL },
+    { 0x63d3ef3fd56cc3fdULL, 0x68681b15434bdb25ULL, 0x0000000deb613b91ULL },
+    { 0xf426b2d5cc60b566ULL, 0xc8998a7d960bec88ULL, 0x00000005e971cb3bULL },
+    { 0x3153fc0d46a3b494ULL, 0x6431d57561dd7df3ULL, 0x00000016b7e44619ULL },
+    { 0x1eb8ec52ee7e2b40ULL, 0x93108b4c1c2ef72eULL, 0x0000001de3c30961ULL },
+    { 0x35dbdf1788d07d9cULL, 0x601123df543b3d99ULL, 0x0000001865253d80ULL },
+    { 0x3ed7880e4da8a673ULL, 0xc6b20fa29339ad95ULL, 0x0000001f04877368ULL },
+    { 0xa21bf25cd7df13a3ULL, 0x385014d4d9e1cb6cULL, 0x0000000603468585ULL },
+    { 0x887cf565951ebfc9ULL, 0xd323486ff677328cULL, 0x00000001f7f2d419ULL },
+    { 0x44e3fbd98a685448ULL, 0x74714a10d2c43480ULL, 0x0000000f806ac208ULL },
+    { 0x2e915c793cb55ec6ULL, 0x9438a92f993683ceULL, 0x0000000aa18b3f42ULL },
+    { 0x19b782b0dd803f1fULL, 0xa8f1337226de2f1eULL, 0x000000319c44d32dULL },
+    { 0xccc580fe85bb90a5ULL, 0x133d460529985269ULL, 0x000000380976a0d5ULL },
+    { 0x413f5608f96e19cdULL, 0xad4bce0e56e05067ULL, 0x00000039139632f0ULL },
+    { 0x550e0c51663b0c5bULL, 0x24497e3ff3e00c57ULL, 0x000000128036baf5ULL },
+    { 0xa6e804a291cc35eeULL, 0x75e2224e685a7744ULL, 0x0000000000873e4fULL },
+    { 0xf88c402026e7087fULL, 0x0244ddb0db666656ULL, 0x0000000000000000ULL },
+    { 0x2836ac5774ee3680ULL, 0x0000000009becce6ULL, 0x0000000000000000ULL },
+    /* 59 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000025195e0000ULL },
+    { 0xab069839610e7c8aULL, 0x56e1a7ea032d4ad5ULL, 0x0000000216697d9fULL },
+    { 0x6307c35b386b12a4ULL, 0xf74849d41e794510ULL, 0x0000002636460e08ULL },
+    { 0xd4e72fb75fc0f1d3ULL, 0x1e8ba0470d53578dULL, 0x0000000e9115f1a4ULL },
+    { 0x2aebcb3ef5d2ff36ULL, 0x904d1bbd2233430eULL, 0x0000003024aa583eULL },
+    { 0x7a49aa4c597403c9ULL, 0xc608ecf73266fbbcULL, 0x000000280699d3ceULL },
+    { 0xea215682bc399cb9ULL, 0xe8d0d25d15e74386ULL, 0x0000000ca6d59aabULL },
+    { 0xf2321b3cb6bcc241ULL, 0x56b012dffc71c667ULL, 0x000000016f151636ULL },
+    { 0x8f25791c4c6755dcULL, 0x289b559911a3806fULL, 0x0000003495db5e06ULL },
+    { 0x44743ee1a8463d17ULL, 0xda3c3260fddda8f5ULL, 0x0000001c47dfdae1ULL },
+    { 0xfbcc06aeadfee2c0ULL, 0x77061f97ee4109caULL, 0x0000000cc4cf3979ULL },
+    { 0x272e0dc4d293b91aULL, 0xd76e05a5fa72f686ULL, 0x00000013d9d2fd36ULL },
+    { 0xe0c19af3bbd7cacbULL, 0x4244c5a7ce323745ULL, 0x0000002384ad0d55ULL },
+    { 0x0ff78e1e947a2cb0ULL, 0x8cbef907a59cb0adULL, 0x0000003185b29d98ULL },
+    { 0x6bcb8b99eb439718ULL, 0xb24c0db33058f049ULL, 0x00000027fcb015d4ULL },
+    { 0xd300cd46bbbe0500ULL, 0xbe3d4d6b6666dd5eULL, 0x000000183d3056abULL },
+    { 0xef3fd56cc3fc0476ULL, 0x1b15434bdb2563d3ULL, 0x00000023bfc16868ULL },
+    { 0xb2d5cc60b5658bbeULL, 0x8a7d960bec88f426ULL, 0x0000000b9a53c899ULL },
+    { 0xfc0d46a3b49382d8ULL, 0xd57561dd7df33153ULL, 0x00000003da1b6431ULL },
+    { 0xec52ee7e2b3fcc84ULL, 0x8b4c1c2ef72e1eb8ULL, 0x00000003fda19310ULL },
+    { 0xdf1788d07d9b96edULL, 0x23df543b3d9935dbULL, 0x0000002975446011ULL },
+    { 0x880e4da8a6724000ULL, 0x0fa29339ad953ed7ULL, 0x00000012a538c6b2ULL },
+    { 0xf25cd7df13a29519ULL, 0x14d4d9e1cb6ca21bULL, 0x0000000837073850ULL },
+    { 0xf565951ebfc881d8ULL, 0x486ff677328c887cULL, 0x0000001a6091d323ULL },
+    { 0xfbd98a685447daa8ULL, 0x4a10d2c4348044e3ULL, 0x0000000d31407471ULL },
+    { 0x5c793cb55ec511b3ULL, 0xa92f993683ce2e91ULL, 0x0000003828b29438ULL },
+    { 0x82b0dd803f1eaf7dULL, 0x337226de2f1e19b7ULL, 0x0000000e442fa8f1ULL },
+    { 0x80fe85bb90a43f33ULL, 0x460529985269ccc5ULL, 0x00000011a653133dULL },
+    { 0x5608f96e19cc7b17ULL, 0xce0e56e05067413fULL, 0x000000111c88ad4bULL },
+    { 0x0c51663b0c5ae5f8ULL, 0x7e3ff3e00c57550eULL, 0x00000034a6a32449ULL },
+    { 0x04a291cc35eddfd0ULL, 0x224e685a7744a6e8ULL, 0x0000001008bb75e2ULL },
+    { 0x402026e7087e866fULL, 0xddb0db666656f88cULL, 0x0000000000000244ULL },
+    { 0xac5774ee367f9431ULL, 0x000009becce62836ULL, 0x0000000000000000ULL },
+    { 0x1608ce3b49886bcbULL, 0x00000000000029dbULL, 0x0000000000000000ULL },
+    /* 60 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000348a240000ULL },
+    { 0x9839610e7c895746ULL, 0xa7ea032d4ad5ab06ULL, 0x00000010d4b956e1ULL },
+    { 0xc35b386b12a37dd4ULL, 0x49d41e7945106307ULL, 0x00000020825cf748ULL },
+    { 0x2fb75fc0f1d2752aULL, 0xa0470d53578dd4e7ULL, 0x00000011f4041e8bULL },
+    { 0xcb3ef5d2ff35a10cULL, 0x1bbd2233430e2aebULL, 0x000000021402904dULL },
+    { 0xaa4c597403c835cfULL, 0xecf73266fbbc7a49ULL, 0x000000309ebec608ULL },
+    { 0x5682bc399cb8e416ULL, 0xd25d15e74386ea21ULL, 0x00000028fecfe8d0ULL },
+    { 0x1b3cb6bcc240d017ULL, 0x12dffc71c667f232ULL, 0x000000242aa656b0ULL },
+    { 0x791c4c6755db3d34ULL, 0x559911a3806f8f25ULL, 0x0000000e0402289bULL },
+    { 0x3ee1a8463d16404bULL, 0x3260fddda8f54474ULL, 0x000000016cfbda3cULL },
+    { 0x06aeadfee2bf7e87ULL, 0x1f97ee4109cafbccULL, 0x000000199dd37706ULL },
+    { 0x0dc4d293b919082dULL, 0x05a5fa72f686272eULL, 0x000000100322d76eULL },
+    { 0x9af3bbd7caca0481ULL, 0xc5a7ce323745e0c1ULL, 0x0000002c76dd4244ULL },
+    { 0x8e1e947a2caf8230ULL, 0xf907a59cb0ad0ff7ULL, 0x00000011b5248cbeULL },
+    { 0x8b99eb4397173df2ULL, 0x0db33058f0496bcbULL, 0x0000000e45e8b24cULL },
+    { 0xcd46bbbe04ffe34eULL, 0x4d6b6666dd5ed300ULL, 0x00000004f35dbe3dULL },
+    { 0xd56cc3fc0475fcbbULL, 0x434bdb2563d3ef3fULL, 0x0000001d3d841b15ULL },
+    { 0xcc60b5658bbd1598ULL, 0x960bec88f426b2d5ULL, 0x0000001b54878a7dULL },
+    { 0x46a3b49382d73b5cULL, 0x61dd7df33153fc0dULL, 0x00000011b883d575ULL },
+    { 0xee7e2b3fcc83a0a1ULL, 0x1c2ef72e1eb8ec52ULL, 0x00000033ff728b4cULL },
+    { 0x88d07d9b96ecf15aULL, 0x543b3d9935dbdf17ULL, 0x00000025da3b23dfULL },
+    { 0x4da8a6723fff505fULL, 0x9339ad953ed7880eULL, 0x000000318eea0fa2ULL },
+    { 0xd7df13a295189c30ULL, 0xd9e1cb6ca21bf25cULL, 0x0000001a118014d4ULL },
+    { 0x951ebfc881d7e2fbULL, 0xf677328c887cf565ULL, 0x00000003eabf486fULL },
+    { 0x8a685447daa72178ULL, 0xd2c4348044e3fbd9ULL, 0x0000000b15174a10ULL },
+    { 0x3cb55ec511b2b120ULL, 0x993683ce2e915c79ULL, 0x0000001a93faa92fULL },
+    { 0xdd803f1eaf7c0fedULL, 0x26de2f1e19b782b0ULL, 0x0000000133b53372ULL },
+    { 0x85bb90a43f3274baULL, 0x29985269ccc580feULL, 0x0000000356b14605ULL },
+    { 0xf96e19cc7b1670e5ULL, 0x56e05067413f5608ULL, 0x0000000ee3dfce0eULL },
+    { 0x663b0c5ae5f77b82ULL, 0xf3e00c57550e0c51ULL, 0x0000001241757e3fULL },
+    { 0x91cc35eddfcf0997ULL, 0x685a7744a6e804a2ULL, 0x000000292d80224eULL },
+    { 0x26e7087e866eaa71ULL, 0xdb666656f88c4020ULL, 0x000000000244ddb0ULL },
+    { 0x74ee367f9430aec4ULL, 0x09becce62836ac57ULL, 0x0000000000000000ULL },
+    { 0xce3b49886bcabcafULL, 0x0000000029db1608ULL, 0x0000000000000000ULL },
+    /* 61 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000367c3a0000ULL },
+    { 0x610e7c895745fbd2ULL, 0x032d4ad5ab069839ULL, 0x000000316347a7eaULL },
+    { 0x386b12a37dd3b17cULL, 0x1e7945106307c35bULL, 0x000000108b0849d4ULL },
+    { 0x5fc0f1d27529582bULL, 0x0d53578dd4e72fb7ULL, 0x0000002c093da047ULL },
+    { 0xf5d2ff35a10beccbULL, 0x2233430e2aebcb3eULL, 0x000000398e151bbdULL },
+    { 0x597403c835cec08eULL, 0x3266fbbc7a49aa4cULL, 0x00000015ac54ecf7ULL },
+    { 0xbc399cb8e41556abULL, 0x15e74386ea215682ULL, 0x00000034269cd25dULL },
+    { 0xb6bcc240d016f615ULL, 0xfc71c667f2321b3cULL, 0x00000023a39e12dfULL },
+    { 0x4c6755db3d33d7f8ULL, 0x11a3806f8f25791cULL, 0x0000001695275599ULL },
+    { 0xa8463d16404a362cULL, 0xfddda8f544743ee1ULL, 0x000000235fc63260ULL },
+    { 0xadfee2bf7e869d62ULL, 0xee4109cafbcc06aeULL, 0x00000026a5141f97ULL },
+    { 0xd293b919082c552dULL, 0xfa72f686272e0dc4ULL, 0x0000002711fc05a5ULL },
+    { 0xbbd7caca04807a9cULL, 0xce323745e0c19af3ULL, 0x00000001c7cac5a7ULL },
+    { 0x947a2caf822faf35ULL, 0xa59cb0ad0ff78e1eULL, 0x00000029b87cf907ULL },
+    { 0xeb4397173df121a5ULL, 0x3058f0496bcb8b99ULL, 0x00000019018a0db3ULL },
+    { 0xbbbe04ffe34dd889ULL, 0x6666dd5ed300cd46ULL, 0x00000011a95f4d6bULL },
+    { 0xc3fc0475fcba1873ULL, 0xdb2563d3ef3fd56cULL, 0x00000002c6b9434bULL },
+    { 0xb5658bbd15972099ULL, 0xec88f426b2d5cc60ULL, 0x0000003391f3960bULL },
+    { 0xb49382d73b5b2759ULL, 0x7df33153fc0d46a3ULL, 0x0000000aef5d61ddULL },
+    { 0x2b3fcc83a0a0a28eULL, 0xf72e1eb8ec52ee7eULL, 0x0000000dcb041c2eULL },
+    { 0x7d9b96ecf15998a2ULL, 0x3d9935dbdf1788d0ULL, 0x0000000d6de1543bULL },
+    { 0xa6723fff505e84feULL, 0xad953ed7880e4da8ULL, 0x0000003492689339ULL },
+    { 0x13a295189c2f3155ULL, 0xcb6ca21bf25cd7dfULL, 0x0000001bc0b8d9e1ULL },
+    { 0xbfc881d7e2fa5436ULL, 0x328c887cf565951eULL, 0x0000002daebbf677ULL },
+    { 0x5447daa7217750f8ULL, 0x348044e3fbd98a68ULL, 0x0000000cb156d2c4ULL },
+    { 0x5ec511b2b11fb126ULL, 0x83ce2e915c793cb5ULL, 0x00000033bb339936ULL },
+    { 0x3f1eaf7c0fece459ULL, 0x2f1e19b782b0dd80ULL, 0x00000023771826deULL },
+    { 0x90a43f3274b915e2ULL, 0x5269ccc580fe85bbULL, 0x000000343a292998ULL },
+    { 0x19cc7b1670e45a0aULL, 0x5067413f5608f96eULL, 0x000000342a5056e0ULL },
+    { 0x0c5ae5f77b81c16cULL, 0x0c57550e0c51663bULL, 0x00000015102ff3e0ULL },
+    { 0x35eddfcf0996d779ULL, 0x7744a6e804a291ccULL, 0x00000017d780685aULL },
+    { 0x087e866eaa70e7b5ULL, 0x6656f88c402026e7ULL, 0x0000002c6c96db66ULL },
+    { 0x367f9430aec32bf0ULL, 0xcce62836ac5774eeULL, 0x00000000000009beULL },
+    { 0x49886bcabcae02beULL, 0x000029db1608ce3bULL, 0x0000000000000000ULL },
+    { 0xf1ba87bc86968f49ULL, 0x000000000000b3c4ULL, 0x0000000000000000ULL },
+};
+
+/*
+ * Fractional part. Entry f of index i is 10**(9(f + 1)) * 2**(120 - 16i),
+ * rounded up and reduced the same way. Index i covers binary exponents
+ * from -16i down to -16i - 15; blocks before __d2fixed_min_block[i] are
+ * always zero and blocks past the end of each run are never needed.
+ */
+
+const uint8_t __d2fixed_min_block[D2FIXED_POW10_INDEX_2] = {
+    0, 0, 0, 0, 0, 0, 1, 1, 2, 3, 3, 4,
+    4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 10, 10,
+    11, 11, 12, 12, 13, 13, 14, 14, 15, 15, 16, 16,
+    17, 18, 18, 19, 19, 20, 20, 21, 21, 22, 22, 23,
+    23, 24, 24, 25, 26, 26, 27, 27, 28, 28, 29, 29,
+    30, 30, 31, 31, 32, 33, 33, 34,
+};
+
+const uint16_t __d2fixed_pow10_offset_2[D2FIXED_POW10_INDEX_2 + 1] = {
+    0, 2, 6, 12, 19, 28, 39, 51,
+    65, 79, 94, 111, 129, 148, 168, 190,
+    213, 238, 263, 290, 318, 348, 378, 409,
+    442, 476, 512, 548, 586, 625, 666, 707,
+    750, 794, 840, 887, 935, 984, 1034, 1086,
+    1138, 1192, 1247, 1304, 1362, 1421, 1481, 1543,
+    1606, 1670, 1735, 1802, 1870, 1939, 2009, 2080,
+    2153, 2227, 2302, 2378, 2456, 2535, 2616, 2697,
+    2780, 2864, 2949, 3035, 3121,
+};
+
+const uint64_t __d2fixed_pow10_2[][3] = {
+    /* 0 */
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000000003b9acaULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002f08236400ULL },
+    /* 1 */
+    { 0x0000000000000000ULL, 0x9aca000000000000ULL, 0x000000000000003bULL },
+    { 0x0000000000000000ULL, 0x6400000000000000ULL, 0x0000000de0b6b3a7ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000026f9423ce8ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000003604471000ULL },
+    /* 2 */
+    { 0x0000000000000000ULL, 0x003b9aca00000000ULL, 0x0000000000000000ULL },
+    { 0x0000000000000000ULL, 0xb3a7640000000000ULL, 0x00000000000de0b6ULL },
+    { 0x0000000000000000ULL, 0x3ce8000000000000ULL, 0x0000002a89dfd080ULL },
+    { 0x0000000000000000ULL, 0x1000000000000000ULL, 0x0000001ddb934b9fULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002508dd22a0ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002540be4000ULL },
+    /* 3 */
+    { 0x0000000000000000ULL, 0x0000003b9aca0000ULL, 0x0000000000000000ULL },
+    { 0x0000000000000000ULL, 0xe0b6b3a764000000ULL, 0x000000000000000dULL },
+    { 0x0000000000000000ULL, 0xd0803ce800000000ULL, 0x000000033b2e3c9fULL },
+    { 0x0000000000000000ULL, 0x4b9f100000000000ULL, 0x0000002535af15b3ULL },
+    { 0x0000000000000000ULL, 0x22a0000000000000ULL, 0x00000029bed6a00bULL },
+    { 0x0000000000000000ULL, 0x4000000000000000ULL, 0x0000000297b67d92ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000220d2de680ULL },
+    /* 4 */
+    { 0x0000000000000000ULL, 0x00000000003b9acaULL, 0x0000000000000000ULL },
+    { 0x0000000000000000ULL, 0x000de0b6b3a76400ULL, 0x0000000000000000ULL },
+    { 0x0000000000000000ULL, 0x3c9fd0803ce80000ULL, 0x0000000000033b2eULL },
+    { 0x0000000000000000ULL, 0x15b34b9f10000000ULL, 0x0000000ac3edc907ULL },
+    { 0x0000000000000000ULL, 0xa00b22a000000000ULL, 0x00000001a648f768ULL },
+    { 0x0000000000000000ULL, 0x7d92400000000000ULL, 0x000000185c2565f6ULL },
+    { 0x0000000000000000ULL, 0xe680000000000000ULL, 0x0000003963fabdcfULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000003067d434e1ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000034630b8a00ULL },
+    /* 5 */
+    { 0x9aca000000000000ULL, 0x000000000000003bULL, 0x0000000000000000ULL },
+    { 0x6400000000000000ULL, 0x0000000de0b6b3a7ULL, 0x0000000000000000ULL },
+    { 0x0000000000000000ULL, 0x3b2e3c9fd0803ce8ULL, 0x0000000000000003ULL },
+    { 0x0000000000000000ULL, 0xc90715b34b9f1000ULL, 0x00000000c097ce7bULL },
+    { 0x0000000000000000ULL, 0xf768a00b22a00000ULL, 0x0000001cd22d3ce2ULL },
+    { 0x0000000000000000ULL, 0x65f67d9240000000ULL, 0x00000034d841090bULL },
+    { 0x0000000000000000ULL, 0xbdcfe68000000000ULL, 0x00000002a76423acULL },
+    { 0x0000000000000000ULL, 0x34e1000000000000ULL, 0x00000028383166f6ULL },
+    { 0x0000000000000000ULL, 0x8a00000000000000ULL, 0x00000039530df013ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000048c9e6ee4ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000003515dbe800ULL },
+    /* 6 */
+    { 0xb3a7640000000000ULL, 0x00000000000de0b6ULL, 0x0000000000000000ULL },
+    { 0x3ce8000000000000ULL, 0x00033b2e3c9fd080ULL, 0x0000000000000000ULL },
+    { 0x1000000000000000ULL, 0xce7bc90715b34b9fULL, 0x000000000000c097ULL },
+    { 0x0000000000000000ULL, 0x3ce2f768a00b22a0ULL, 0x00000023586086b9ULL },
+    { 0x0000000000000000ULL, 0x090b65f67d924000ULL, 0x0000002b21091999ULL },
+    { 0x0000000000000000ULL, 0x23acbdcfe6800000ULL, 0x00000023a19dd27eULL },
+    { 0x0000000000000000ULL, 0x66f634e100000000ULL, 0x0000001d5e7dcdcfULL },
+    { 0x0000000000000000ULL, 0xf0138a0000000000ULL, 0x000000304a225589ULL },
+    { 0x0000000000000000ULL, 0x6ee4000000000000ULL, 0x000000201dbbc3feULL },
+    { 0x0000000000000000ULL, 0xe800000000000000ULL, 0x0000003b3d6604a7ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002717fe0d10ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000003b9aca000ULL },
+    /* 7 */
+    { 0xe0b6b3a764000000ULL, 0x000000000000000dULL, 0x0000000000000000ULL },
+    { 0xd0803ce800000000ULL, 0x000000033b2e3c9fULL, 0x0000000000000000ULL },
+    { 0x4b9f100000000000ULL, 0xc097ce7bc90715b3ULL, 0x0000000000000000ULL },
+    { 0x22a0000000000000ULL, 0x86b93ce2f768a00bULL, 0x000000002cd76fe0ULL },
+    { 0x4000000000000000ULL, 0x1999090b65f67d92ULL, 0x0000003446cee6c5ULL },
+    { 0x0000000000000000ULL, 0xd27e23acbdcfe680ULL, 0x0000002de4133157ULL },
+    { 0x0000000000000000ULL, 0xcdcf66f634e10000ULL, 0x00000014729cfe31ULL },
+    { 0x0000000000000000ULL, 0x5589f0138a000000ULL, 0x0000000b988be7e4ULL },
+    { 0x0000000000000000ULL, 0xc3fe6ee400000000ULL, 0x0000003529c66acdULL },
+    { 0x0000000000000000ULL, 0x04a7e80000000000ULL, 0x0000002fe895e744ULL },
+    { 0x0000000000000000ULL, 0x0d10000000000000ULL, 0x0000000fd6332b26ULL },
+    { 0x0000000000000000ULL, 0xa000000000000000ULL, 0x00000008dc0491eeULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000378f288a40ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000ee6b28000ULL },
+    /* 8 */
+    { 0x3c9fd0803ce80000ULL, 0x0000000000033b2eULL, 0x0000000000000000ULL },
+    { 0x15b34b9f10000000ULL, 0x0000c097ce7bc907ULL, 0x0000000000000000ULL },
+    { 0xa00b22a000000000ULL, 0x6fe086b93ce2f768ULL, 0x0000000000002cd7ULL },
+    { 0x7d92400000000000ULL, 0xe6c51999090b65f6ULL, 0x00000032290c0a64ULL },
+    { 0xe680000000000000ULL, 0x3157d27e23acbdcfULL, 0x000000177e31dd8fULL },
+    { 0x0000000000000000ULL, 0xfe31cdcf66f634e1ULL, 0x0000002156f3e946ULL },
+    { 0x0000000000000000ULL, 0xe7e45589f0138a00ULL, 0x00000010878268f7ULL },
+    { 0x0000000000000000ULL, 0x6acdc3fe6ee40000ULL, 0x00000039b856bc0cULL },
+    { 0x0000000000000000ULL, 0xe74404a7e8000000ULL, 0x00000002e41f7839ULL },
+    { 0x0000000000000000ULL, 0x2b260d1000000000ULL, 0x0000000d7b4f7c79ULL },
+    { 0x0000000000000000ULL, 0x91eea00000000000ULL, 0x0000001c363555f2ULL },
+    { 0x0000000000000000ULL, 0x8a40000000000000ULL, 0x000000387a4d2f92ULL },
+    { 0x0000000000000000ULL, 0x8000000000000000ULL, 0x000000221e778b96ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000230a7fc100ULL },
+    /* 9 */
+    { 0xc90715b34b9f1000ULL, 0x00000000c097ce7bULL, 0x0000000000000000ULL },
+    { 0xf768a00b22a00000ULL, 0x2cd76fe086b93ce2ULL, 0x0000000000000000ULL },
+    { 0x65f67d9240000000ULL, 0x0a64e6c51999090bULL, 0x000000000a70c3c4ULL },
+    { 0xbdcfe68000000000ULL, 0xdd8f3157d27e23acULL, 0x0000002da4ee3215ULL },
+    { 0x34e1000000000000ULL, 0xe946fe31cdcf66f6ULL, 0x0000000517488955ULL },
+    { 0x8a00000000000000ULL, 0x68f7e7e45589f013ULL, 0x0000001400b57b5cULL },
+    { 0x0000000000000000ULL, 0xbc0c6acdc3fe6ee4ULL, 0x0000001584113266ULL },
+    { 0x0000000000000000ULL, 0x7839e74404a7e800ULL, 0x00000017eb750c77ULL },
+    { 0x0000000000000000ULL, 0x7c792b260d100000ULL, 0x0000001bd0f1efffULL },
+    { 0x0000000000000000ULL, 0x55f291eea0000000ULL, 0x0000003b7c2a660dULL },
+    { 0x0000000000000000ULL, 0x2f928a4000000000ULL, 0x000000031adf215fULL },
+    { 0x0000000000000000ULL, 0x8b96800000000000ULL, 0x0000001629847f8dULL },
+    { 0x0000000000000000ULL, 0xc100000000000000ULL, 0x00000020f4c1582dULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000aa725344aULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000113abe6400ULL },
+    /* 10 */
+    { 0xce7bc90715b34ba0ULL, 0x000000000000c097ULL, 0x0000000000000000ULL },
+    { 0x3ce2f768a00b22a0ULL, 0x00002cd76fe086b9ULL, 0x0000000000000000ULL },
+    { 0x090b65f67d924000ULL, 0xc3c40a64e6c51999ULL, 0x0000000000000a70ULL },
+    { 0x23acbdcfe6800000ULL, 0x3215dd8f3157d27eULL, 0x0000001a414cecccULL },
+    { 0x66f634e100000000ULL, 0x8955e946fe31cdcfULL, 0x0000002f8b024abcULL },
+    { 0xf0138a0000000000ULL, 0x7b5c68f7e7e45589ULL, 0x0000002be5a62ecfULL },
+    { 0x6ee4000000000000ULL, 0x3266bc0c6acdc3feULL, 0x000000304ee2391fULL },
+    { 0xe800000000000000ULL, 0x0c777839e74404a7ULL, 0x00000007437a9ce9ULL },
+    { 0x0000000000000000ULL, 0xefff7c792b260d10ULL, 0x0000003642c8ec69ULL },
+    { 0x0000000000000000ULL, 0x660d55f291eea000ULL, 0x00000018aa5dd8c0ULL },
+    { 0x0000000000000000ULL, 0x215f2f928a400000ULL, 0x0000002ccbda475bULL },
+    { 0x0000000000000000ULL, 0x7f8d8b9680000000ULL, 0x0000001537caeb8eULL },
+    { 0x0000000000000000ULL, 0x582dc10000000000ULL, 0x000000212d8ecaf7ULL },
+    { 0x0000000000000000ULL, 0x344a000000000000ULL, 0x0000003996e0c295ULL },
+    { 0x0000000000000000ULL, 0x6400000000000000ULL, 0x00000022bd443dc6ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002e3100b2e8ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000003604471000ULL },
+    /* 11 */
+    { 0x86b93ce2f768a00cULL, 0x000000002cd76fe0ULL, 0x0000000000000000ULL },
+    { 0x1999090b65f67d93ULL, 0x0a70c3c40a64e6c5ULL, 0x0000000000000000ULL },
+    { 0xd27e23acbdcfe680ULL, 0xeccc3215dd8f3157ULL, 0x00000000026e4d30ULL },
+    { 0xcdcf66f634e10000ULL, 0x4abc8955e946fe31ULL, 0x0000000b64281d3aULL },
+    { 0x5589f0138a000000ULL, 0x2ecf7b5c68f7e7e4ULL, 0x0000000d9278680aULL },
+    { 0xc3fe6ee400000000ULL, 0x391f3266bc0c6acdULL, 0x000000025ef2032eULL },
+    { 0x04a7e80000000000ULL, 0x9ce90c777839e744ULL, 0x0000000ac31d0674ULL },
+    { 0x0d10000000000000ULL, 0xec69efff7c792b26ULL, 0x0000001b26ac1de0ULL },
+    { 0xa000000000000000ULL, 0xd8c0660d55f291eeULL, 0x000000345e7c1c95ULL },
+    { 0x0000000000000000ULL, 0x475b215f2f928a40ULL, 0x00000022e38ef84aULL },
+    { 0x0000000000000000ULL, 0xeb8e7f8d8b968000ULL, 0x000000114b5b89d0ULL },
+    { 0x0000000000000000ULL, 0xcaf7582dc1000000ULL, 0x00000030a49c64fcULL },
+    { 0x0000000000000000ULL, 0xc295344a00000000ULL, 0x0000003adba09244ULL },
+    { 0x0000000000000000ULL, 0x3dc6640000000000ULL, 0x00000010026bb258ULL },
+    { 0x0000000000000000ULL, 0xb2e8000000000000ULL, 0x000000148b978322ULL },
+    { 0x0000000000000000ULL, 0x1000000000000000ULL, 0x00000008143678bbULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002b8dcb3aa0ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002540be4000ULL },
+    /* 12 */
+    { 0x6fe086b93ce2f769ULL, 0x0000000000002cd7ULL, 0x0000000000000000ULL },
+    { 0xe6c51999090b65f7ULL, 0x00000a70c3c40a64ULL, 0x0000000000000000ULL },
+    { 0x3157d27e23acbdd0ULL, 0x4d30eccc3215dd8fULL, 0x000000000000026eULL },
+    { 0xfe31cdcf66f634e1ULL, 0x1d3a4abc8955e946ULL, 0x00000019ae7bbeeaULL },
+    { 0xe7e45589f0138a00ULL, 0x680a2ecf7b5c68f7ULL, 0x00000036824abf5aULL },
+    { 0x6acdc3fe6ee40000ULL, 0x032e391f3266bc0cULL, 0x000000150ca44502ULL },
+    { 0xe74404a7e8000000ULL, 0x06749ce90c777839ULL, 0x0000000077f3277bULL },
+    { 0x2b260d1000000000ULL, 0x1de0ec69efff7c79ULL, 0x0000001ca4dfd568ULL },
+    { 0x91eea00000000000ULL, 0x1c95d8c0660d55f2ULL, 0x000000183dd6f75eULL },
+    { 0x8a40000000000000ULL, 0xf84a475b215f2f92ULL, 0x00000015e97dfda6ULL },
+    { 0x8000000000000000ULL, 0x89d0eb8e7f8d8b96ULL, 0x00000026e02e3b0bULL },
+    { 0x0000000000000000ULL, 0x64fccaf7582dc100ULL, 0x00000002afbd28b6ULL },
+    { 0x0000000000000000ULL, 0x9244c295344a0000ULL, 0x0000002a778eee88ULL },
+    { 0x0000000000000000ULL, 0xb2583dc664000000ULL, 0x0000001fcc49999fULL },
+    { 0x0000000000000000ULL, 0x8322b2e800000000ULL, 0x000000252ea9a20bULL },
+    { 0x0000000000000000ULL, 0x78bb100000000000ULL, 0x00000002ae2ef794ULL },
+    { 0x0000000000000000ULL, 0x3aa0000000000000ULL, 0x000000229198e47bULL },
+    { 0x0000000000000000ULL, 0x4000000000000000ULL, 0x0000001cb1056082ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001e53814680ULL },
+    /* 13 */
+    { 0x0a64e6c51999090cULL, 0x000000000a70c3c4ULL, 0x0000000000000000ULL },
+    { 0xdd8f3157d27e23adULL, 0x026e4d30eccc3215ULL, 0x0000000000000000ULL },
+    { 0xe946fe31cdcf66f7ULL, 0xbeea1d3a4abc8955ULL, 0x000000000090e40fULL },
+    { 0x68f7e7e45589f014ULL, 0xbf5a680a2ecf7b5cULL, 0x00000003aa853a36ULL },
+    { 0xbc0c6acdc3fe6ee4ULL, 0x4502032e391f3266ULL, 0x0000000cbf34255aULL },
+    { 0x7839e74404a7e800ULL, 0x277b06749ce90c77ULL, 0x00000015047c3465ULL },
+    { 0x7c792b260d100000ULL, 0xd5681de0ec69efffULL, 0x000000178d42eba5ULL },
+    { 0x55f291eea0000000ULL, 0xf75e1c95d8c0660dULL, 0x000000269c7439e8ULL },
+    { 0x2f928a4000000000ULL, 0xfda6f84a475b215fULL, 0x000000363ddf5263ULL },
+    { 0x8b96800000000000ULL, 0x3b0b89d0eb8e7f8dULL, 0x0000001747eaf7d0ULL },
+    { 0xc100000000000000ULL, 0x28b664fccaf7582dULL, 0x000000307b837c4bULL },
+    { 0x0000000000000000ULL, 0xee889244c295344aULL, 0x000000117fd3d51eULL },
+    { 0x0000000000000000ULL, 0x999fb2583dc66400ULL, 0x0000000733ad6015ULL },
+    { 0x0000000000000000ULL, 0xa20b8322b2e80000ULL, 0x0000000507774363ULL },
+    { 0x0000000000000000ULL, 0xf79478bb10000000ULL, 0x000000173296c002ULL },
+    { 0x0000000000000000ULL, 0xe47b3aa000000000ULL, 0x00000000b0da7e7eULL },
+    { 0x0000000000000000ULL, 0x6082400000000000ULL, 0x0000001d8b61f8edULL },
+    { 0x0000000000000000ULL, 0x4680000000000000ULL, 0x0000003744c56141ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000f32b76aa1ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000257c590a00ULL },
+    /* 14 */
+    { 0xc3c40a64e6c5199aULL, 0x0000000000000a70ULL, 0x0000000000000000ULL },
+    { 0x3215dd8f3157d27fULL, 0x0000026e4d30ecccULL, 0x0000000000000000ULL },
+    { 0x8955e946fe31cdd0ULL, 0xe40fbeea1d3a4abcULL, 0x0000000000000090ULL },
+    { 0x7b5c68f7e7e4558aULL, 0x3a36bf5a680a2ecfULL, 0x00000021bc2b266dULL },
+    { 0x3266bc0c6acdc3ffULL, 0x255a4502032e391fULL, 0x000000196e75d2f8ULL },
+    { 0x0c777839e74404a8ULL, 0x3465277b06749ce9ULL, 0x00000039c6a613aeULL },
+    { 0xefff7c792b260d10ULL, 0xeba5d5681de0ec69ULL, 0x000000288f684a4aULL },
+    { 0x660d55f291eea000ULL, 0x39e8f75e1c95d8c0ULL, 0x00000011719c17e2ULL },
+    { 0x215f2f928a400000ULL, 0x5263fda6f84a475bULL, 0x00000034ac2208d9ULL },
+    { 0x7f8d8b9680000000ULL, 0xf7d03b0b89d0eb8eULL, 0x000000329964169eULL },
+    { 0x582dc10000000000ULL, 0x7c4b28b664fccaf7ULL, 0x00000025033b8069ULL },
+    { 0x344a000000000000ULL, 0xd51eee889244c295ULL, 0x000000188f6d53abULL },
+    { 0x6400000000000000ULL, 0x6015999fb2583dc6ULL, 0x000000280203ebbfULL },
+    { 0x0000000000000000ULL, 0x4363a20b8322b2e8ULL, 0x0000002c8edbc937ULL },
+    { 0x0000000000000000ULL, 0xc002f79478bb1000ULL, 0x0000000cddf21b74ULL },
+    { 0x0000000000000000ULL, 0x7e7ee47b3aa00000ULL, 0x0000001b2ed8505aULL },
+    { 0x0000000000000000ULL, 0xf8ed608240000000ULL, 0x0000001511debecdULL },
+    { 0x0000000000000000ULL, 0x6141468000000000ULL, 0x0000002ff4e8fa75ULL },
+    { 0x0000000000000000ULL, 0x6aa1000000000000ULL, 0x0000001b54632b41ULL },
+    { 0x0000000000000000ULL, 0x0a00000000000000ULL, 0x0000000f3b20ddfdULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000003aea4dade4ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000003515dbe800ULL },
+    /* 15 */
+    { 0xeccc3215dd8f3158ULL, 0x00000000026e4d30ULL, 0x0000000000000000ULL },
+    { 0x4abc8955e946fe32ULL, 0x0090e40fbeea1d3aULL, 0x0000000000000000ULL },
+    { 0x2ecf7b5c68f7e7e5ULL, 0x266d3a36bf5a680aULL, 0x000000000021bc2bULL },
+    { 0x391f3266bc0c6aceULL, 0xd2f8255a4502032eULL, 0x0000000a0bf25671ULL },
+    { 0x9ce90c777839e745ULL, 0x13ae3465277b0674ULL, 0x0000001a8071ea5aULL },
+    { 0xec69efff7c792b27ULL, 0x4a4aeba5d5681de0ULL, 0x00000014f9001066ULL },
+    { 0xd8c0660d55f291efULL, 0x17e239e8f75e1c95ULL, 0x00000017d0f8ac00ULL },
+    { 0x475b215f2f928a40ULL, 0x08d95263fda6f84aULL, 0x00000000058f9448ULL },
+    { 0xeb8e7f8d8b968000ULL, 0x169ef7d03b0b89d0ULL, 0x00000010c5983fb4ULL },
+    { 0xcaf7582dc1000000ULL, 0x80697c4b28b664fcULL, 0x00000029ee1a5897ULL },
+    { 0xc295344a00000000ULL, 0x53abd51eee889244ULL, 0x0000002346331a6dULL },
+    { 0x3dc6640000000000ULL, 0xebbf6015999fb258ULL, 0x0000001974633381ULL },
+    { 0xb2e8000000000000ULL, 0xc9374363a20b8322ULL, 0x0000001e3fe37049ULL },
+    { 0x1000000000000000ULL, 0x1b74c002f79478bbULL, 0x000000112dfd008cULL },
+    { 0x0000000000000000ULL, 0x505a7e7ee47b3aa0ULL, 0x000000209f0afa26ULL },
+    { 0x0000000000000000ULL, 0xbecdf8ed60824000ULL, 0x00000008ebaf6cfeULL },
+    { 0x0000000000000000ULL, 0xfa75614146800000ULL, 0x0000003b500142d4ULL },
+    { 0x0000000000000000ULL, 0x2b416aa100000000ULL, 0x00000031967fc5a7ULL },
+    { 0x0000000000000000ULL, 0xddfd0a0000000000ULL, 0x00000026ec0c010eULL },
+    { 0x0000000000000000ULL, 0xade4000000000000ULL, 0x00000003762696afULL },
+    { 0x0000000000000000ULL, 0xe800000000000000ULL, 0x00000028e74cc65dULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000015dd3fa910ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000003b9aca000ULL },
+    /* 16 */
+    { 0x4d30eccc3215dd90ULL, 0x000000000000026eULL, 0x0000000000000000ULL },
+    { 0x1d3a4abc8955e947ULL, 0x00000090e40fbeeaULL, 0x0000000000000000ULL },
+    { 0x680a2ecf7b5c68f8ULL, 0xbc2b266d3a36bf5aULL, 0x0000000000000021ULL },
+    { 0x032e391f3266bc0dULL, 0x5671d2f8255a4502ULL, 0x00000007dac3c24aULL },
+    { 0x06749ce90c77783aULL, 0xea5a13ae3465277bULL, 0x000000114edee44dULL },
+    { 0x1de0ec69efff7c7aULL, 0x10664a4aeba5d568ULL, 0x00000012241f37a4ULL },
+    { 0x1c95d8c0660d55f3ULL, 0xac0017e239e8f75eULL, 0x0000002632fae598ULL },
+    { 0xf84a475b215f2f93ULL, 0x944808d95263fda6ULL, 0x000000238bf3f547ULL },
+    { 0x89d0eb8e7f8d8b97ULL, 0x3fb4169ef7d03b0bULL, 0x00000010aa744860ULL },
+    { 0x64fccaf7582dc100ULL, 0x589780697c4b28b6ULL, 0x0000001668e0c5d0ULL },
+    { 0x9244c295344a0000ULL, 0x1a6d53abd51eee88ULL, 0x0000003082649ba3ULL },
+    { 0xb2583dc664000000ULL, 0x3381ebbf6015999fULL, 0x00000025f9b5cae7ULL },
+    { 0x8322b2e800000000ULL, 0x7049c9374363a20bULL, 0x00000035d4aa5c21ULL },
+    { 0x78bb100000000000ULL, 0x008c1b74c002f794ULL, 0x00000007c918f05dULL },
+    { 0x3aa0000000000000ULL, 0xfa26505a7e7ee47bULL, 0x00000015a75c010aULL },
+    { 0x4000000000000000ULL, 0x6cfebecdf8ed6082ULL, 0x000000028e49f8f3ULL },
+    { 0x0000000000000000ULL, 0x42d4fa7561414680ULL, 0x00000038ad4e5b39ULL },
+    { 0x0000000000000000ULL, 0xc5a72b416aa10000ULL, 0x0000000d55067893ULL },
+    { 0x0000000000000000ULL, 0x010eddfd0a000000ULL, 0x0000002267e7077eULL },
+    { 0x0000000000000000ULL, 0x96afade400000000ULL, 0x0000001d566e7cf0ULL },
+    { 0x0000000000000000ULL, 0xc65de80000000000ULL, 0x000000380432f9a8ULL },
+    { 0x0000000000000000ULL, 0xa910000000000000ULL, 0x000000274bc4257bULL },
+    { 0x0000000000000000ULL, 0xa000000000000000ULL, 0x0000001ccabbf706ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000018ae17a40ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000ee6b28000ULL },
+    /* 17 */
+    { 0xbeea1d3a4abc8956ULL, 0x000000000090e40fULL, 0x0000000000000000ULL },
+    { 0xbf5a680a2ecf7b5dULL, 0x0021bc2b266d3a36ULL, 0x0000000000000000ULL },
+    { 0x4502032e391f3267ULL, 0xc24a5671d2f8255aULL, 0x000000000007dac3ULL },
+    { 0x277b06749ce90c78ULL, 0xe44dea5a13ae3465ULL, 0x0000002d942479f2ULL },
+    { 0xd5681de0ec69f000ULL, 0x37a410664a4aeba5ULL, 0x000000388d7af407ULL },
+    { 0xf75e1c95d8c0660eULL, 0xe598ac0017e239e8ULL, 0x00000001ae2ffa60ULL },
+    { 0xfda6f84a475b2160ULL, 0xf547944808d95263ULL, 0x000000168f80c2a5ULL },
+    { 0x3b0b89d0eb8e7f8eULL, 0x48603fb4169ef7d0ULL, 0x00000026a3dfffc6ULL },
+    { 0x28b664fccaf7582eULL, 0xc5d0589780697c4bULL, 0x0000002e2a922db0ULL },
+    { 0xee889244c295344aULL, 0x9ba31a6d53abd51eULL, 0x0000002928797fd6ULL },
+    { 0x999fb2583dc66400ULL, 0xcae73381ebbf6015ULL, 0x00000031f7a18e03ULL },
+    { 0xa20b8322b2e80000ULL, 0x5c217049c9374363ULL, 0x00000000e20e560eULL },
+    { 0xf79478bb10000000ULL, 0xf05d008c1b74c002ULL, 0x0000000357ea75b0ULL },
+    { 0xe47b3aa000000000ULL, 0x010afa26505a7e7eULL, 0x000000293261a4bcULL },
+    { 0x6082400000000000ULL, 0xf8f36cfebecdf8edULL, 0x0000002bc5ea8113ULL },
+    { 0x4680000000000000ULL, 0x5b3942d4fa756141ULL, 0x00000004a6739efeULL },
+    { 0x0000000000000000ULL, 0x7893c5a72b416aa1ULL, 0x0000003b38d1c6d4ULL },
+    { 0x0000000000000000ULL, 0x077e010eddfd0a00ULL, 0x0000003178423e97ULL },
+    { 0x0000000000000000ULL, 0x7cf096afade40000ULL, 0x000000232a0bb7f4ULL },
+    { 0x0000000000000000ULL, 0xf9a8c65de8000000ULL, 0x00000038ec9f860aULL },
+    { 0x0000000000000000ULL, 0x257ba91000000000ULL, 0x000000028e2cbe3eULL },
+    { 0x0000000000000000ULL, 0xf706a00000000000ULL, 0x0000000e783715edULL },
+    { 0x0000000000000000ULL, 0x7a40000000000000ULL, 0x0000003767d0e5c7ULL },
+    { 0x0000000000000000ULL, 0x8000000000000000ULL, 0x0000002e71c9b0f6ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000039648b8100ULL },
+    /* 18 */
+    { 0xe40fbeea1d3a4abdULL, 0x0000000000000090ULL, 0x0000000000000000ULL },
+    { 0x3a36bf5a680a2ed0ULL, 0x00000021bc2b266dULL, 0x0000000000000000ULL },
+    { 0x255a4502032e3920ULL, 0xdac3c24a5671d2f8ULL, 0x0000000000000007ULL },
+    { 0x3465277b06749ceaULL, 0x79f2e44dea5a13aeULL, 0x00000001d42aea28ULL },
+    { 0xeba5d5681de0ec6aULL, 0xf40737a410664a4aULL, 0x000000096c9446f4ULL },
+    { 0x39e8f75e1c95d8c1ULL, 0xfa60e598ac0017e2ULL, 0x000000390859beb7ULL },
+    { 0x5263fda6f84a475cULL, 0xc2a5f547944808d9ULL, 0x0000002ad5f21ec4ULL },
+    { 0xf7d03b0b89d0eb8fULL, 0xffc648603fb4169eULL, 0x0000002dcfd498f3ULL },
+    { 0x7c4b28b664fccaf8ULL, 0x2db0c5d058978069ULL, 0x00000038cf7b17c8ULL },
+    { 0xd51eee889244c296ULL, 0x7fd69ba31a6d53abULL, 0x0000002e9b912dfbULL },
+    { 0x6015999fb2583dc7ULL, 0x8e03cae73381ebbfULL, 0x0000003a8e87cfd7ULL },
+    { 0x4363a20b8322b2e8ULL, 0x560e5c217049c937ULL, 0x000000323010641aULL },
+    { 0xc002f79478bb1000ULL, 0x75b0f05d008c1b74ULL, 0x0000000621c1dbc6ULL },
+    { 0x7e7ee47b3aa00000ULL, 0xa4bc010afa26505aULL, 0x0000002e351f2cb3ULL },
+    { 0xf8ed608240000000ULL, 0x8113f8f36cfebecdULL, 0x00000029d3962d52ULL },
+    { 0x6141468000000000ULL, 0x9efe5b3942d4fa75ULL, 0x0000001335a25a3dULL },
+    { 0x6aa1000000000000ULL, 0xc6d47893c5a72b41ULL, 0x0000000e58e6e37dULL },
+    { 0x0a00000000000000ULL, 0x3e97077e010eddfdULL, 0x0000001d48dfd27eULL },
+    { 0x0000000000000000ULL, 0xb7f47cf096afade4ULL, 0x0000001d64c212f7ULL },
+    { 0x0000000000000000ULL, 0x860af9a8c65de800ULL, 0x00000039ad2d7905ULL },
+    { 0x0000000000000000ULL, 0xbe3e257ba9100000ULL, 0x00000001493b85e8ULL },
+    { 0x0000000000000000ULL, 0x15edf706a0000000ULL, 0x0000003630926a23ULL },
+    { 0x0000000000000000ULL, 0xe5c77a4000000000ULL, 0x000000082b44b862ULL },
+    { 0x0000000000000000ULL, 0xb0f6800000000000ULL, 0x0000001706c13c7bULL },
+    { 0x0000000000000000ULL, 0x8100000000000000ULL, 0x0000001ccc92dd6bULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001907bb6dcaULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002f08236400ULL },
+    /* 19 */
+    { 0x266d3a36bf5a680bULL, 0x000000000021bc2bULL, 0x0000000000000000ULL },
+    { 0xd2f8255a4502032fULL, 0x0007dac3c24a5671ULL, 0x0000000000000000ULL },
+    { 0x13ae3465277b0675ULL, 0xea2879f2e44dea5aULL, 0x000000000001d42aULL },
+    { 0x4a4aeba5d5681de1ULL, 0x46f4f40737a41066ULL, 0x00000009fdea0d38ULL },
+    { 0x17e239e8f75e1c96ULL, 0xbeb7fa60e598ac00ULL, 0x0000000d1a618b95ULL },
+    { 0x08d95263fda6f84bULL, 0x1ec4c2a5f5479448ULL, 0x00000022dd7f49deULL },
+    { 0x169ef7d03b0b89d1ULL, 0x98f3ffc648603fb4ULL, 0x00000033b7651f80ULL },
+    { 0x80697c4b28b664fdULL, 0x17c82db0c5d05897ULL, 0x0000001df101b76bULL },
+    { 0x53abd51eee889245ULL, 0x2dfb7fd69ba31a6dULL, 0x00000018ef3bf1b7ULL },
+    { 0xebbf6015999fb259ULL, 0xcfd78e03cae73381ULL, 0x0000002aa65b2a09ULL },
+    { 0xc9374363a20b8323ULL, 0x641a560e5c217049ULL, 0x0000000248d57366ULL },
+    { 0x1b74c002f79478bcULL, 0xdbc675b0f05d008cULL, 0x00000017d6fb14a9ULL },
+    { 0x505a7e7ee47b3aa0ULL, 0x2cb3a4bc010afa26ULL, 0x000000278c5af9edULL },
+    { 0xbecdf8ed60824000ULL, 0x2d528113f8f36cfeULL, 0x0000003738b5704eULL },
+    { 0xfa75614146800000ULL, 0x5a3d9efe5b3942d4ULL, 0x0000001233b6f724ULL },
+    { 0x2b416aa100000000ULL, 0xe37dc6d47893c5a7ULL, 0x0000000876c72beaULL },
+    { 0xddfd0a0000000000ULL, 0xd27e3e97077e010eULL, 0x00000036b0742dfdULL },
+    { 0xade4000000000000ULL, 0x12f7b7f47cf096afULL, 0x0000003b18fc0076ULL },
+    { 0xe800000000000000ULL, 0x7905860af9a8c65dULL, 0x0000001b7dc3ab61ULL },
+    { 0x0000000000000000ULL, 0x85e8be3e257ba910ULL, 0x00000016b1d3fcb5ULL },
+    { 0x0000000000000000ULL, 0x6a2315edf706a000ULL, 0x0000002a439e6d84ULL },
+    { 0x0000000000000000ULL, 0xb862e5c77a400000ULL, 0x0000001ed4866ae8ULL },
+    { 0x0000000000000000ULL, 0x3c7bb0f680000000ULL, 0x000000362f3557f1ULL },
+    { 0x0000000000000000ULL, 0xdd6b810000000000ULL, 0x000000382acd3deaULL },
+    { 0x0000000000000000ULL, 0x6dca000000000000ULL, 0x00000036af0a4c1dULL },
+    { 0x0000000000000000ULL, 0x6400000000000000ULL, 0x00000006da18d225ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000008b4a7a8e8ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000003604471000ULL },
+    /* 20 */
+    { 0xbc2b266d3a36bf5bULL, 0x0000000000000021ULL, 0x0000000000000000ULL },
+    { 0x5671d2f8255a4503ULL, 0x00000007dac3c24aULL, 0x0000000000000000ULL },
+    { 0xea5a13ae3465277cULL, 0xd42aea2879f2e44dULL, 0x0000000000000001ULL },
+    { 0x10664a4aeba5d569ULL, 0x0d3846f4f40737a4ULL, 0x000000006d00f732ULL },
+    { 0xac0017e239e8f75fULL, 0x8b95beb7fa60e598ULL, 0x0000000ba74f6aa3ULL },
+    { 0x944808d95263fda7ULL, 0x49de1ec4c2a5f547ULL, 0x00000026140e872dULL },
+    { 0x3fb4169ef7d03b0cULL, 0x1f8098f3ffc64860ULL, 0x0000000a8b685cffULL },
+    { 0x589780697c4b28b7ULL, 0xb76b17c82db0c5d0ULL, 0x0000003b6684e577ULL },
+    { 0x1a6d53abd51eee89ULL, 0xf1b72dfb7fd69ba3ULL, 0x0000001bdfa87ba1ULL },
+    { 0x3381ebbf601599a0ULL, 0x2a09cfd78e03cae7ULL, 0x00000025b4a06885ULL },
+    { 0x7049c9374363a20cULL, 0x7366641a560e5c21ULL, 0x0000001f01349ff9ULL },
+    { 0x008c1b74c002f795ULL, 0x14a9dbc675b0f05dULL, 0x0000003a146cd9b9ULL },
+    { 0xfa26505a7e7ee47cULL, 0xf9ed2cb3a4bc010aULL, 0x0000002b17ab9e22ULL },
+    { 0x6cfebecdf8ed6083ULL, 0x704e2d528113f8f3ULL, 0x0000000824bf9b2fULL },
+    { 0x42d4fa7561414680ULL, 0xf7245a3d9efe5b39ULL, 0x0000000b0b910216ULL },
+    { 0xc5a72b416aa10000ULL, 0x2beae37dc6d47893ULL, 0x0000000558d82badULL },
+    { 0x010eddfd0a000000ULL, 0x2dfdd27e3e97077eULL, 0x0000002851d43262ULL },
+    { 0x96afade400000000ULL, 0x007612f7b7f47cf0ULL, 0x00000016dbf6a27eULL },
+    { 0xc65de80000000000ULL, 0xab617905860af9a8ULL, 0x0000001d564ae9c3ULL },
+    { 0xa910000000000000ULL, 0xfcb585e8be3e257bULL, 0x0000002d8ecef4c1ULL },
+    { 0xa000000000000000ULL, 0x6d846a2315edf706ULL, 0x0000002d2a88ec76ULL },
+    { 0x0000000000000000ULL, 0x6ae8b862e5c77a40ULL, 0x0000001b92d8d888ULL },
+    { 0x0000000000000000ULL, 0x57f13c7bb0f68000ULL, 0x0000001fc31f96d9ULL },
+    { 0x0000000000000000ULL, 0x3deadd6b81000000ULL, 0x000000329aaeff73ULL },
+    { 0x0000000000000000ULL, 0x4c1d6dca00000000ULL, 0x0000001ad4f34f2cULL },
+    { 0x0000000000000000ULL, 0xd225640000000000ULL, 0x0000000a50538610ULL },
+    { 0x0000000000000000ULL, 0xa8e8000000000000ULL, 0x00000003ea9a4e5bULL },
+    { 0x0000000000000000ULL, 0x1000000000000000ULL, 0x00000015575966d7ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000003212b952a0ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002540be4000ULL },
+    /* 21 */
+    { 0xc24a5671d2f8255bULL, 0x000000000007dac3ULL, 0x0000000000000000ULL },
+    { 0xe44dea5a13ae3466ULL, 0x0001d42aea2879f2ULL, 0x0000000000000000ULL },
+    { 0x37a410664a4aeba6ULL, 0xf7320d3846f4f407ULL, 0x0000000000006d00ULL },
+    { 0xe598ac0017e239e9ULL, 0x6aa38b95beb7fa60ULL, 0x00000000398e0035ULL },
+    { 0xf547944808d95264ULL, 0x872d49de1ec4c2a5ULL, 0x0000000c6fdffdb2ULL },
+    { 0x48603fb4169ef7d1ULL, 0x5cff1f8098f3ffc6ULL, 0x0000002991199feeULL },
+    { 0xc5d0589780697c4cULL, 0xe577b76b17c82db0ULL, 0x000000377f8ed31cULL },
+    { 0x9ba31a6d53abd51fULL, 0x7ba1f1b72dfb7fd6ULL, 0x00000006ba5b6e5aULL },
+    { 0xcae73381ebbf6016ULL, 0x68852a09cfd78e03ULL, 0x00000015113417aeULL },
+    { 0x5c217049c9374364ULL, 0x9ff97366641a560eULL, 0x000000289b8b2f44ULL },
+    { 0xf05d008c1b74c003ULL, 0xd9b914a9dbc675b0ULL, 0x0000000ffa5cdfe2ULL },
+    { 0x010afa26505a7e7fULL, 0x9e22f9ed2cb3a4bcULL, 0x00000034d157a0e5ULL },
+    { 0xf8f36cfebecdf8eeULL, 0x9b2f704e2d528113ULL, 0x0000003576485f6bULL },
+    { 0x5b3942d4fa756142ULL, 0x0216f7245a3d9efeULL, 0x000000190dd431dfULL },
+    { 0x7893c5a72b416aa1ULL, 0x2bad2beae37dc6d4ULL, 0x00000033ec52846cULL },
+    { 0x077e010eddfd0a00ULL, 0x32622dfdd27e3e97ULL, 0x000000192f7889c2ULL },
+    { 0x7cf096afade40000ULL, 0xa27e007612f7b7f4ULL, 0x0000002d37082b6aULL },
+    { 0xf9a8c65de8000000ULL, 0xe9c3ab617905860aULL, 0x00000018d3ecee1eULL },
+    { 0x257ba91000000000ULL, 0xf4c1fcb585e8be3eULL, 0x0000000732911ca8ULL },
+    { 0xf706a00000000000ULL, 0xec766d846a2315edULL, 0x0000002756914310ULL },
+    { 0x7a40000000000000ULL, 0xd8886ae8b862e5c7ULL, 0x00000003f0bae510ULL },
+    { 0x8000000000000000ULL, 0x96d957f13c7bb0f6ULL, 0x00000003ec16fd8fULL },
+    { 0x0000000000000000ULL, 0xff733deadd6b8100ULL, 0x000000216e96230aULL },
+    { 0x0000000000000000ULL, 0x4f2c4c1d6dca0000ULL, 0x000000028f85e829ULL },
+    { 0x0000000000000000ULL, 0x8610d22564000000ULL, 0x000000099e396ea9ULL },
+    { 0x0000000000000000ULL, 0x4e5ba8e800000000ULL, 0x0000002778664a56ULL },
+    { 0x0000000000000000ULL, 0x66d7100000000000ULL, 0x00000014183e5ce5ULL },
+    { 0x0000000000000000ULL, 0x52a0000000000000ULL, 0x0000003569687135ULL },
+    { 0x0000000000000000ULL, 0x4000000000000000ULL, 0x0000000c6a48a772ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001a99d4a680ULL },
+    /* 22 */
+    { 0x79f2e44dea5a13afULL, 0x00000001d42aea28ULL, 0x0000000000000000ULL },
+    { 0xf40737a410664a4bULL, 0x6d00f7320d3846f4ULL, 0x0000000000000000ULL },
+    { 0xfa60e598ac0017e3ULL, 0x00356aa38b95beb7ULL, 0x0000000019612190ULL },
+    { 0xc2a5f547944808daULL, 0xfdb2872d49de1ec4ULL, 0x00000021871e0fdfULL },
+    { 0xffc648603fb4169fULL, 0x9fee5cff1f8098f3ULL, 0x0000003426e780bbULL },
+    { 0x2db0c5d05897806aULL, 0xd31ce577b76b17c8ULL, 0x0000002baf4e3104ULL },
+    { 0x7fd69ba31a6d53acULL, 0x6e5a7ba1f1b72dfbULL, 0x000000011f9276d9ULL },
+    { 0x8e03cae73381ebc0ULL, 0x17ae68852a09cfd7ULL, 0x000000329fe6ce00ULL },
+    { 0x560e5c217049c938ULL, 0x2f449ff97366641aULL, 0x00000000058383b1ULL },
+    { 0x75b0f05d008c1b75ULL, 0xdfe2d9b914a9dbc6ULL, 0x0000002941070f72ULL },
+    { 0xa4bc010afa26505bULL, 0xa0e59e22f9ed2cb3ULL, 0x0000001abf0e9b4dULL },
+    { 0x8113f8f36cfebeceULL, 0x5f6b9b2f704e2d52ULL, 0x000000121304f688ULL },
+    { 0x9efe5b3942d4fa76ULL, 0x31df0216f7245a3dULL, 0x0000001fc072cecaULL },
+    { 0xc6d47893c5a72b42ULL, 0x846c2bad2beae37dULL, 0x0000002f13bff0fcULL },
+    { 0x3e97077e010eddfeULL, 0x89c232622dfdd27eULL, 0x0000003acb33d7a0ULL },
+    { 0xb7f47cf096afade4ULL, 0x2b6aa27e007612f7ULL, 0x0000002560d14d22ULL },
+    { 0x860af9a8c65de800ULL, 0xee1ee9c3ab617905ULL, 0x00000007f4aaa7daULL },
+    { 0xbe3e257ba9100000ULL, 0x1ca8f4c1fcb585e8ULL, 0x00000032f9411e5dULL },
+    { 0x15edf706a0000000ULL, 0x4310ec766d846a23ULL, 0x00000015ade7a6a9ULL },
+    { 0xe5c77a4000000000ULL, 0xe510d8886ae8b862ULL, 0x0000002768cccd98ULL },
+    { 0xb0f6800000000000ULL, 0xfd8f96d957f13c7bULL, 0x00000023993d52c8ULL },
+    { 0x8100000000000000ULL, 0x230aff733deadd6bULL, 0x0000002ecbf73838ULL },
+    { 0x0000000000000000ULL, 0xe8294f2c4c1d6dcaULL, 0x0000000d1204e923ULL },
+    { 0x0000000000000000ULL, 0x6ea98610d2256400ULL, 0x000000085c378349ULL },
+    { 0x0000000000000000ULL, 0x4a564e5ba8e80000ULL, 0x0000001118e79532ULL },
+    { 0x0000000000000000ULL, 0x5ce566d710000000ULL, 0x0000000bb58a4aa2ULL },
+    { 0x0000000000000000ULL, 0x713552a000000000ULL, 0x00000025cd94de00ULL },
+    { 0x0000000000000000ULL, 0xa772400000000000ULL, 0x000000001a5bbd72ULL },
+    { 0x0000000000000000ULL, 0xa680000000000000ULL, 0x0000001ab1ea879aULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002401e1b061ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001695a68a00ULL },
+    /* 23 */
+    { 0xea2879f2e44dea5bULL, 0x000000000001d42aULL, 0x0000000000000000ULL },
+    { 0x46f4f40737a41067ULL, 0x00006d00f7320d38ULL, 0x0000000000000000ULL },
+    { 0xbeb7fa60e598ac01ULL, 0x219000356aa38b95ULL, 0x0000000000001961ULL },
+    { 0x1ec4c2a5f5479449ULL, 0x0fdffdb2872d49deULL, 0x000000169d770528ULL },
+    { 0x98f3ffc648603fb5ULL, 0x80bb9fee5cff1f80ULL, 0x0000000953e1c8bdULL },
+    { 0x17c82db0c5d05898ULL, 0x3104d31ce577b76bULL, 0x0000002c1f40364eULL },
+    { 0x2dfb7fd69ba31a6eULL, 0x76d96e5a7ba1f1b7ULL, 0x0000001234934c3cULL },
+    { 0xcfd78e03cae73382ULL, 0xce0017ae68852a09ULL, 0x0000000e13f35102ULL },
+    { 0x641a560e5c21704aULL, 0x83b12f449ff97366ULL, 0x00000000a72c280fULL },
+    { 0xdbc675b0f05d008dULL, 0x0f72dfe2d9b914a9ULL, 0x000000039cbb4c65ULL },
+    { 0x2cb3a4bc010afa27ULL, 0x9b4da0e59e22f9edULL, 0x0000001787aa82e4ULL },
+    { 0x2d528113f8f36cffULL, 0xf6885f6b9b2f704eULL, 0x000000353a04b352ULL },
+    { 0x5a3d9efe5b3942d5ULL, 0xceca31df0216f724ULL, 0x0000001350fb328eULL },
+    { 0xe37dc6d47893c5a8ULL, 0xf0fc846c2bad2beaULL, 0x000000214001ae4bULL },
+    { 0xd27e3e97077e010fULL, 0xd7a089c232622dfdULL, 0x00000011ae751693ULL },
+    { 0x12f7b7f47cf096b0ULL, 0x4d222b6aa27e0076ULL, 0x000000226c165e77ULL },
+    { 0x7905860af9a8c65eULL, 0xa7daee1ee9c3ab61ULL, 0x0000001bc6e9696cULL },
+    { 0x85e8be3e257ba910ULL, 0x1e5d1ca8f4c1fcb5ULL, 0x000000194c622b07ULL },
+    { 0x6a2315edf706a000ULL, 0xa6a94310ec766d84ULL, 0x00000001a84d5793ULL },
+    { 0xb862e5c77a400000ULL, 0xcd98e510d8886ae8ULL, 0x0000002260afc5c8ULL },
+    { 0x3c7bb0f680000000ULL, 0x52c8fd8f96d957f1ULL, 0x0000002ec0cc5cffULL },
+    { 0xdd6b810000000000ULL, 0x3838230aff733deaULL, 0x0000003b727596abULL },
+    { 0x6dca000000000000ULL, 0xe923e8294f2c4c1dULL, 0x00000027dd7bdc34ULL },
+    { 0x6400000000000000ULL, 0x83496ea98610d225ULL, 0x0000000c51b94611ULL },
+    { 0x0000000000000000ULL, 0x95324a564e5ba8e8ULL, 0x0000000413d8b845ULL },
+    { 0x0000000000000000ULL, 0x4aa25ce566d71000ULL, 0x0000001033753f1cULL },
+    { 0x0000000000000000ULL, 0xde00713552a00000ULL, 0x00000006964ea3f8ULL },
+    { 0x0000000000000000ULL, 0xbd72a77240000000ULL, 0x00000039f1a40587ULL },
+    { 0x0000000000000000ULL, 0x879aa68000000000ULL, 0x0000001f9abc7f0cULL },
+    { 0x0000000000000000ULL, 0xb061000000000000ULL, 0x00000002ead41a67ULL },
+    { 0x0000000000000000ULL, 0x8a00000000000000ULL, 0x0000001824584686ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001f53272ce4ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000003515dbe800ULL },
+    /* 24 */
+    { 0x0d3846f4f40737a5ULL, 0x000000006d00f732ULL, 0x0000000000000000ULL },
+    { 0x8b95beb7fa60e599ULL, 0x1961219000356aa3ULL, 0x0000000000000000ULL },
+    { 0x49de1ec4c2a5f548ULL, 0x05280fdffdb2872dULL, 0x0000000005e8bb31ULL },
+    { 0x1f8098f3ffc64861ULL, 0xc8bd80bb9fee5cffULL, 0x0000000b69d403d3ULL },
+    { 0xb76b17c82db0c5d1ULL, 0x364e3104d31ce577ULL, 0x000000314f518b10ULL },
+    { 0xf1b72dfb7fd69ba4ULL, 0x4c3c76d96e5a7ba1ULL, 0x00000003c6517b2fULL },
+    { 0x2a09cfd78e03cae8ULL, 0x5102ce0017ae6885ULL, 0x0000000b032b1debULL },
+    { 0x7366641a560e5c22ULL, 0x280f83b12f449ff9ULL, 0x00000036c9f40f16ULL },
+    { 0x14a9dbc675b0f05eULL, 0x4c650f72dfe2d9b9ULL, 0x0000000528a1284bULL },
+    { 0xf9ed2cb3a4bc010bULL, 0x82e49b4da0e59e22ULL, 0x000000118822a9a2ULL },
+    { 0x704e2d528113f8f4ULL, 0xb352f6885f6b9b2fULL, 0x00000025d66da898ULL },
+    { 0xf7245a3d9efe5b3aULL, 0x328ececa31df0216ULL, 0x000000238da87c39ULL },
+    { 0x2beae37dc6d47894ULL, 0xae4bf0fc846c2badULL, 0x0000000d513c7575ULL },
+    { 0x2dfdd27e3e97077fULL, 0x1693d7a089c23262ULL, 0x0000001b665335c1ULL },
+    { 0x007612f7b7f47cf1ULL, 0x5e774d222b6aa27eULL, 0x0000002cf4f40372ULL },
+    { 0xab617905860af9a9ULL, 0x696ca7daee1ee9c3ULL, 0x0000001aa0ec9115ULL },
+    { 0xfcb585e8be3e257cULL, 0x2b071e5d1ca8f4c1ULL, 0x00000004fc3e5b3cULL },
+    { 0x6d846a2315edf707ULL, 0x5793a6a94310ec76ULL, 0x0000000e024c003bULL },
+    { 0x6ae8b862e5c77a40ULL, 0xc5c8cd98e510d888ULL, 0x0000000dd1108955ULL },
+    { 0x57f13c7bb0f68000ULL, 0x5cff52c8fd8f96d9ULL, 0x00000013f871f03eULL },
+    { 0x3deadd6b81000000ULL, 0x96ab3838230aff73ULL, 0x0000000e8523ff0dULL },
+    { 0x4c1d6dca00000000ULL, 0xdc34e923e8294f2cULL, 0x0000000329f0d1d7ULL },
+    { 0xd225640000000000ULL, 0x461183496ea98610ULL, 0x000000324244fd51ULL },
+    { 0xa8e8000000000000ULL, 0xb84595324a564e5bULL, 0x00000012ec4a5114ULL },
+    { 0x1000000000000000ULL, 0x3f1c4aa25ce566d7ULL, 0x00000004d2ff3ca5ULL },
+    { 0x0000000000000000ULL, 0xa3f8de00713552a0ULL, 0x000000267975e004ULL },
+    { 0x0000000000000000ULL, 0x0587bd72a7724000ULL, 0x000000011498a842ULL },
+    { 0x0000000000000000ULL, 0x7f0c879aa6800000ULL, 0x0000000f5f31b4aeULL },
+    { 0x0000000000000000ULL, 0x1a67b06100000000ULL, 0x00000028a0ca010aULL },
+    { 0x0000000000000000ULL, 0x46868a0000000000ULL, 0x000000025a31c0dcULL },
+    { 0x0000000000000000ULL, 0x2ce4000000000000ULL, 0x0000003349713e63ULL },
+    { 0x0000000000000000ULL, 0xe800000000000000ULL, 0x00000017174fce93ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000226fe64510ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000003b9aca000ULL },
+    /* 25 */
+    { 0xf7320d3846f4f408ULL, 0x0000000000006d00ULL, 0x0000000000000000ULL },
+    { 0x6aa38b95beb7fa61ULL, 0x0000196121900035ULL, 0x0000000000000000ULL },
+    { 0x872d49de1ec4c2a6ULL, 0xbb3105280fdffdb2ULL, 0x00000000000005e8ULL },
+    { 0x5cff1f8098f3ffc7ULL, 0x03d3c8bd80bb9feeULL, 0x000000362fdc8b62ULL },
+    { 0xe577b76b17c82db1ULL, 0x8b10364e3104d31cULL, 0x00000016d22573afULL },
+    { 0x7ba1f1b72dfb7fd7ULL, 0x7b2f4c3c76d96e5aULL, 0x00000028df30e7ffULL },
+    { 0x68852a09cfd78e04ULL, 0x1deb5102ce0017aeULL, 0x0000003b7bdd9839ULL },
+    { 0x9ff97366641a560fULL, 0x0f16280f83b12f44ULL, 0x0000000d4c6e4cd6ULL },
+    { 0xd9b914a9dbc675b1ULL, 0x284b4c650f72dfe2ULL, 0x00000031d6e81677ULL },
+    { 0x9e22f9ed2cb3a4bdULL, 0xa9a282e49b4da0e5ULL, 0x0000001bbe559db2ULL },
+    { 0x9b2f704e2d528114ULL, 0xa898b352f6885f6bULL, 0x00000029991f79c7ULL },
+    { 0x0216f7245a3d9effULL, 0x7c39328ececa31dfULL, 0x0000002e7c942838ULL },
+    { 0x2bad2beae37dc6d5ULL, 0x7575ae4bf0fc846cULL, 0x0000000d26c87b14ULL },
+    { 0x32622dfdd27e3e98ULL, 0x35c11693d7a089c2ULL, 0x00000004c370eca5ULL },
+    { 0xa27e007612f7b7f5ULL, 0x03725e774d222b6aULL, 0x00000026774832c6ULL },
+    { 0xe9c3ab617905860bULL, 0x9115696ca7daee1eULL, 0x0000002e1a85ad4aULL },
+    { 0xf4c1fcb585e8be3fULL, 0x5b3c2b071e5d1ca8ULL, 0x000000115c860ca8ULL },
+    { 0xec766d846a2315eeULL, 0x003b5793a6a94310ULL, 0x0000002732d2981aULL },
+    { 0xd8886ae8b862e5c8ULL, 0x8955c5c8cd98e510ULL, 0x000000060dc65510ULL },
+    { 0x96d957f13c7bb0f7ULL, 0xf03e5cff52c8fd8fULL, 0x00000003d9a66e8bULL },
+    { 0xff733deadd6b8100ULL, 0xff0d96ab3838230aULL, 0x0000002094fb5083ULL },
+    { 0x4f2c4c1d6dca0000ULL, 0xd1d7dc34e923e829ULL, 0x0000001ebb97b726ULL },
+    { 0x8610d22564000000ULL, 0xfd51461183496ea9ULL, 0x0000000909d59d2eULL },
+    { 0x4e5ba8e800000000ULL, 0x5114b84595324a56ULL, 0x0000000af0cb31ecULL },
+    { 0x66d7100000000000ULL, 0x3ca53f1c4aa25ce5ULL, 0x00000037059304e9ULL },
+    { 0x52a0000000000000ULL, 0xe004a3f8de007135ULL, 0x000000364e009acdULL },
+    { 0x4000000000000000ULL, 0xa8420587bd72a772ULL, 0x0000002fef1c4758ULL },
+    { 0x0000000000000000ULL, 0xb4ae7f0c879aa680ULL, 0x00000014a46263c1ULL },
+    { 0x0000000000000000ULL, 0x010a1a67b0610000ULL, 0x0000002d19c3c0d2ULL },
+    { 0x0000000000000000ULL, 0xc0dc46868a000000ULL, 0x00000030e537a8fbULL },
+    { 0x0000000000000000ULL, 0x3e632ce400000000ULL, 0x0000003a9dab6ef1ULL },
+    { 0x0000000000000000ULL, 0xce93e80000000000ULL, 0x000000382b3ebe3bULL },
+    { 0x0000000000000000ULL, 0x4510000000000000ULL, 0x0000000decc58c72ULL },
+    { 0x0000000000000000ULL, 0xa000000000000000ULL, 0x0000001a9b02661eULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000721646a40ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000ee6b28000ULL },
+    /* 26 */
+    { 0x00356aa38b95beb8ULL, 0x0000000019612190ULL, 0x0000000000000000ULL },
+    { 0xfdb2872d49de1ec5ULL, 0x05e8bb3105280fdfULL, 0x0000000000000000ULL },
+    { 0x9fee5cff1f8098f4ULL, 0x8b6203d3c8bd80bbULL, 0x00000000016035ceULL },
+    { 0xd31ce577b76b17c9ULL, 0x73af8b10364e3104ULL, 0x00000030170269d3ULL },
+    { 0x6e5a7ba1f1b72dfcULL, 0xe7ff7b2f4c3c76d9ULL, 0x000000313b83e5eeULL },
+    { 0x17ae68852a09cfd8ULL, 0x98391deb5102ce00ULL, 0x000000379febf423ULL },
+    { 0x2f449ff97366641bULL, 0x4cd60f16280f83b1ULL, 0x00000008499ad25eULL },
+    { 0xdfe2d9b914a9dbc7ULL, 0x1677284b4c650f72ULL, 0x00000015f4b9f6e0ULL },
+    { 0xa0e59e22f9ed2cb4ULL, 0x9db2a9a282e49b4dULL, 0x000000342cabcbb1ULL },
+    { 0x5f6b9b2f704e2d53ULL, 0x79c7a898b352f688ULL, 0x000000295abd3101ULL },
+    { 0x31df0216f7245a3eULL, 0x28387c39328ececaULL, 0x0000000057f5700eULL },
+    { 0x846c2bad2beae37eULL, 0x7b147575ae4bf0fcULL, 0x000000034bd46258ULL },
+    { 0x89c232622dfdd27fULL, 0xeca535c11693d7a0ULL, 0x0000001499dd927eULL },
+    { 0x2b6aa27e007612f8ULL, 0x32c603725e774d22ULL, 0x0000001d8d489580ULL },
+    { 0xee1ee9c3ab617906ULL, 0xad4a9115696ca7daULL, 0x0000001dd93755f9ULL },
+    { 0x1ca8f4c1fcb585e9ULL, 0x0ca85b3c2b071e5dULL, 0x0000003a21e77108ULL },
+    { 0x4310ec766d846a24ULL, 0x981a003b5793a6a9ULL, 0x00000001dfc8c44aULL },
+    { 0xe510d8886ae8b863ULL, 0x55108955c5c8cd98ULL, 0x000000115e2859b6ULL },
+    { 0xfd8f96d957f13c7cULL, 0x6e8bf03e5cff52c8ULL, 0x0000002a73d9dab8ULL },
+    { 0x230aff733deadd6cULL, 0x5083ff0d96ab3838ULL, 0x0000002af0fe47c7ULL },
+    { 0xe8294f2c4c1d6dcaULL, 0xb726d1d7dc34e923ULL, 0x0000002e681220b7ULL },
+    { 0x6ea98610d2256400ULL, 0x9d2efd5146118349ULL, 0x0000002ac64b163bULL },
+    { 0x4a564e5ba8e80000ULL, 0x31ec5114b8459532ULL, 0x0000000de1456cadULL },
+    { 0x5ce566d710000000ULL, 0x04e93ca53f1c4aa2ULL, 0x00000028533a283dULL },
+    { 0x713552a000000000ULL, 0x9acde004a3f8de00ULL, 0x0000000e3506db28ULL },
+    { 0xa772400000000000ULL, 0x4758a8420587bd72ULL, 0x00000009743a9ca0ULL },
+    { 0xa680000000000000ULL, 0x63c1b4ae7f0c879aULL, 0x00000025515ad268ULL },
+    { 0x0000000000000000ULL, 0xc0d2010a1a67b061ULL, 0x000000184e1c05e1ULL },
+    { 0x0000000000000000ULL, 0xa8fbc0dc46868a00ULL, 0x000000348ff086b7ULL },
+    { 0x0000000000000000ULL, 0x6ef13e632ce40000ULL, 0x0000002ac2fe983bULL },
+    { 0x0000000000000000ULL, 0xbe3bce93e8000000ULL, 0x0000000dd6813c0aULL },
+    { 0x0000000000000000ULL, 0x8c72451000000000ULL, 0x000000028056b2b1ULL },
+    { 0x0000000000000000ULL, 0x661ea00000000000ULL, 0x0000002956b8eb7aULL },
+    { 0x0000000000000000ULL, 0x6a40000000000000ULL, 0x0000001c7f8b11e0ULL },
+    { 0x0000000000000000ULL, 0x8000000000000000ULL, 0x00000034402dbe56ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001423cd4100ULL },
+    /* 27 */
+    { 0x219000356aa38b96ULL, 0x0000000000001961ULL, 0x0000000000000000ULL },
+    { 0x0fdffdb2872d49dfULL, 0x000005e8bb310528ULL, 0x0000000000000000ULL },
+    { 0x80bb9fee5cff1f81ULL, 0x35ce8b6203d3c8bdULL, 0x0000000000000160ULL },
+    { 0x3104d31ce577b76cULL, 0x69d373af8b10364eULL, 0x000000166692e2d4ULL },
+    { 0x76d96e5a7ba1f1b8ULL, 0xe5eee7ff7b2f4c3cULL, 0x0000003174d3005dULL },
+    { 0xce0017ae68852a0aULL, 0xf42398391deb5102ULL, 0x00000015dcc4789dULL },
+    { 0x83b12f449ff97367ULL, 0xd25e4cd60f16280fULL, 0x00000024c6c5b422ULL },
+    { 0x0f72dfe2d9b914aaULL, 0xf6e01677284b4c65ULL, 0x000000081b89c26dULL },
+    { 0x9b4da0e59e22f9eeULL, 0xcbb19db2a9a282e4ULL, 0x000000199a62ecc7ULL },
+    { 0xf6885f6b9b2f704fULL, 0x310179c7a898b352ULL, 0x0000002e84c01eebULL },
+    { 0xceca31df0216f725ULL, 0x700e28387c39328eULL, 0x00000036c280669fULL },
+    { 0xf0fc846c2bad2bebULL, 0x62587b147575ae4bULL, 0x000000251f3a7a34ULL },
+    { 0xd7a089c232622dfeULL, 0x927eeca535c11693ULL, 0x0000000c3256e331ULL },
+    { 0x4d222b6aa27e0077ULL, 0x958032c603725e77ULL, 0x0000000b8abc7e7cULL },
+    { 0xa7daee1ee9c3ab62ULL, 0x55f9ad4a9115696cULL, 0x0000001d01c8c8c9ULL },
+    { 0x1e5d1ca8f4c1fcb6ULL, 0x71080ca85b3c2b07ULL, 0x0000002ee08d20f9ULL },
+    { 0xa6a94310ec766d85ULL, 0xc44a981a003b5793ULL, 0x0000003a13dfacf2ULL },
+    { 0xcd98e510d8886ae9ULL, 0x59b655108955c5c8ULL, 0x000000388606d4d0ULL },
+    { 0x52c8fd8f96d957f2ULL, 0xdab86e8bf03e5cffULL, 0x0000003082a76413ULL },
+    { 0x3838230aff733debULL, 0x47c75083ff0d96abULL, 0x000000049f69bf02ULL },
+    { 0xe923e8294f2c4c1eULL, 0x20b7b726d1d7dc34ULL, 0x0000000087ebea18ULL },
+    { 0x83496ea98610d226ULL, 0x163b9d2efd514611ULL, 0x000000059e210f8bULL },
+    { 0x95324a564e5ba8e8ULL, 0x6cad31ec5114b845ULL, 0x000000206238dca1ULL },
+    { 0x4aa25ce566d71000ULL, 0x283d04e93ca53f1cULL, 0x0000002595a6aa72ULL },
+    { 0xde00713552a00000ULL, 0xdb289acde004a3f8ULL, 0x0000001a944c5896ULL },
+    { 0xbd72a77240000000ULL, 0x9ca04758a8420587ULL, 0x000000231fb93b08ULL },
+    { 0x879aa68000000000ULL, 0xd26863c1b4ae7f0cULL, 0x00000002014df472ULL },
+    { 0xb061000000000000ULL, 0x05e1c0d2010a1a67ULL, 0x0000001abbeb3bd0ULL },
+    { 0x8a00000000000000ULL, 0x86b7a8fbc0dc4686ULL, 0x000000306f22b5e2ULL },
+    { 0x0000000000000000ULL, 0x983b6ef13e632ce4ULL, 0x00000034be041cbaULL },
+    { 0x0000000000000000ULL, 0x3c0abe3bce93e800ULL, 0x0000002b71e88271ULL },
+    { 0x0000000000000000ULL, 0xb2b18c7245100000ULL, 0x0000001a5d4df1aeULL },
+    { 0x0000000000000000ULL, 0xeb7a661ea0000000ULL, 0x00000028acd0432cULL },
+    { 0x0000000000000000ULL, 0x11e06a4000000000ULL, 0x0000000a756e4ef9ULL },
+    { 0x0000000000000000ULL, 0xbe56800000000000ULL, 0x00000039fdb80197ULL },
+    { 0x0000000000000000ULL, 0x4100000000000000ULL, 0x00000023549e2bb9ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002b21fe474aULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000113abe6400ULL },
+    /* 28 */
+    { 0x05280fdffdb2872eULL, 0x0000000005e8bb31ULL, 0x0000000000000000ULL },
+    { 0xc8bd80bb9fee5d00ULL, 0x016035ce8b6203d3ULL, 0x0000000000000000ULL },
+    { 0x364e3104d31ce578ULL, 0xe2d469d373af8b10ULL, 0x000000000052015cULL },
+    { 0x4c3c76d96e5a7ba2ULL, 0x005de5eee7ff7b2fULL, 0x00000015a070b327ULL },
+    { 0x5102ce0017ae6886ULL, 0x789df42398391debULL, 0x0000000914aaa2c4ULL },
+    { 0x280f83b12f449ffaULL, 0xb422d25e4cd60f16ULL, 0x0000002dbe97fd75ULL },
+    { 0x4c650f72dfe2d9baULL, 0xc26df6e01677284bULL, 0x0000001b67af4391ULL },
+    { 0x82e49b4da0e59e23ULL, 0xecc7cbb19db2a9a2ULL, 0x00000021eff15176ULL },
+    { 0xb352f6885f6b9b30ULL, 0x1eeb310179c7a898ULL, 0x0000001bb07a52f8ULL },
+    { 0x328ececa31df0217ULL, 0x669f700e28387c39ULL, 0x00000039c526962cULL },
+    { 0xae4bf0fc846c2baeULL, 0x7a3462587b147575ULL, 0x0000000a567f83b6ULL },
+    { 0x1693d7a089c23263ULL, 0xe331927eeca535c1ULL, 0x0000002a7c7f929aULL },
+    { 0x5e774d222b6aa27fULL, 0x7e7c958032c60372ULL, 0x0000002410034fdaULL },
+    { 0x696ca7daee1ee9c4ULL, 0xc8c955f9ad4a9115ULL, 0x00000032df433534ULL },
+    { 0x2b071e5d1ca8f4c2ULL, 0x20f971080ca85b3cULL, 0x0000000c4a30d65dULL },
+    { 0x5793a6a94310ec77ULL, 0xacf2c44a981a003bULL, 0x00000015aee8cf1fULL },
+    { 0xc5c8cd98e510d889ULL, 0xd4d059b655108955ULL, 0x000000076002fbbeULL },
+    { 0x5cff52c8fd8f96daULL, 0x6413dab86e8bf03eULL, 0x0000002c6e6e9defULL },
+    { 0x96ab3838230aff74ULL, 0xbf0247c75083ff0dULL, 0x00000037bccfac51ULL },
+    { 0xdc34e923e8294f2dULL, 0xea1820b7b726d1d7ULL, 0x000000130872eea1ULL },
+    { 0x461183496ea98611ULL, 0x0f8b163b9d2efd51ULL, 0x00000025b2da24c5ULL },
+    { 0xb84595324a564e5cULL, 0xdca16cad31ec5114ULL, 0x0000002de1bbe60eULL },
+    { 0x3f1c4aa25ce566d8ULL, 0xaa72283d04e93ca5ULL, 0x0000000375d5a73eULL },
+    { 0xa3f8de00713552a0ULL, 0x5896db289acde004ULL, 0x0000000e972c4a70ULL },
+    { 0x0587bd72a7724000ULL, 0x3b089ca04758a842ULL, 0x0000001a2858b529ULL },
+    { 0x7f0c879aa6800000ULL, 0xf472d26863c1b4aeULL, 0x00000009998907dbULL },
+    { 0x1a67b06100000000ULL, 0x3bd005e1c0d2010aULL, 0x0000003336551273ULL },
+    { 0x46868a0000000000ULL, 0xb5e286b7a8fbc0dcULL, 0x0000001ad475d9b0ULL },
+    { 0x2ce4000000000000ULL, 0x1cba983b6ef13e63ULL, 0x0000002924c40ed6ULL },
+    { 0xe800000000000000ULL, 0x82713c0abe3bce93ULL, 0x00000031da153c00ULL },
+    { 0x0000000000000000ULL, 0xf1aeb2b18c724510ULL, 0x000000001e5ef7e1ULL },
+    { 0x0000000000000000ULL, 0x432ceb7a661ea000ULL, 0x000000349b50eefaULL },
+    { 0x0000000000000000ULL, 0x4ef911e06a400000ULL, 0x0000003a44cd3c4cULL },
+    { 0x0000000000000000ULL, 0x0197be5680000000ULL, 0x00000011c4571f44ULL },
+    { 0x0000000000000000ULL, 0x2bb9410000000000ULL, 0x0000000fd57c9768ULL },
+    { 0x0000000000000000ULL, 0x474a000000000000ULL, 0x00000018411031ecULL },
+    { 0x0000000000000000ULL, 0x6400000000000000ULL, 0x00000037034b60c4ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002db9cb1ee8ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000003604471000ULL },
+    /* 29 */
+    { 0xbb3105280fdffdb3ULL, 0x00000000000005e8ULL, 0x0000000000000000ULL },
+    { 0x03d3c8bd80bb9fefULL, 0x0000016035ce8b62ULL, 0x0000000000000000ULL },
+    { 0x8b10364e3104d31dULL, 0x015ce2d469d373afULL, 0x0000000000000052ULL },
+    { 0x7b2f4c3c76d96e5bULL, 0xb327005de5eee7ffULL, 0x0000001317e5ef3aULL },
+    { 0x1deb5102ce0017afULL, 0xa2c4789df4239839ULL, 0x0000000daac813e8ULL },
+    { 0x0f16280f83b12f45ULL, 0xfd75b422d25e4cd6ULL, 0x000000362a2cc26bULL },
+    { 0x284b4c650f72dfe3ULL, 0x4391c26df6e01677ULL, 0x0000001924b5cf51ULL },
+    { 0xa9a282e49b4da0e6ULL, 0x5176ecc7cbb19db2ULL, 0x00000012ebb55ccfULL },
+    { 0xa898b352f6885f6cULL, 0x52f81eeb310179c7ULL, 0x0000003045210064ULL },
+    { 0x7c39328ececa31e0ULL, 0x962c669f700e2838ULL, 0x000000175bc841daULL },
+    { 0x7575ae4bf0fc846dULL, 0x83b67a3462587b14ULL, 0x00000032e4c70cdbULL },
+    { 0x35c11693d7a089c3ULL, 0x929ae331927eeca5ULL, 0x000000331c157fddULL },
+    { 0x03725e774d222b6bULL, 0x4fda7e7c958032c6ULL, 0x0000003396c2b937ULL },
+    { 0x9115696ca7daee1fULL, 0x3534c8c955f9ad4aULL, 0x0000000ce0d90999ULL },
+    { 0x5b3c2b071e5d1ca9ULL, 0xd65d20f971080ca8ULL, 0x00000023abe61002ULL },
+    { 0x003b5793a6a94311ULL, 0xcf1facf2c44a981aULL, 0x00000000a91ea7c4ULL },
+    { 0x8955c5c8cd98e511ULL, 0xfbbed4d059b65510ULL, 0x0000002dd2bc3158ULL },
+    { 0xf03e5cff52c8fd90ULL, 0x9def6413dab86e8bULL, 0x00000014b7d2a27cULL },
+    { 0xff0d96ab3838230bULL, 0xac51bf0247c75083ULL, 0x0000001d03bf82b1ULL },
+    { 0xd1d7dc34e923e82aULL, 0xeea1ea1820b7b726ULL, 0x000000295e24b22aULL },
+    { 0xfd51461183496eaaULL, 0x24c50f8b163b9d2eULL, 0x00000009fef4bea6ULL },
+    { 0x5114b84595324a57ULL, 0xe60edca16cad31ecULL, 0x00000026aeeea223ULL },
+    { 0x3ca53f1c4aa25ce6ULL, 0xa73eaa72283d04e9ULL, 0x000000085bba2551ULL },
+    { 0xe004a3f8de007136ULL, 0x4a705896db289acdULL, 0x0000001302ea7af2ULL },
+    { 0xa8420587bd72a773ULL, 0xb5293b089ca04758ULL, 0x0000003869a7dabcULL },
+    { 0xb4ae7f0c879aa680ULL, 0x07dbf472d26863c1ULL, 0x0000002befda625bULL },
+    { 0x010a1a67b0610000ULL, 0x12733bd005e1c0d2ULL, 0x0000001531da3fdbULL },
+    { 0xc0dc46868a000000ULL, 0xd9b0b5e286b7a8fbULL, 0x0000003301b684a9ULL },
+    { 0x3e632ce400000000ULL, 0x0ed61cba983b6ef1ULL, 0x000000278bdeb3feULL },
+    { 0xce93e80000000000ULL, 0x3c0082713c0abe3bULL, 0x0000003b2708bd21ULL },
+    { 0x4510000000000000ULL, 0xf7e1f1aeb2b18c72ULL, 0x00000007bcec6fb6ULL },
+    { 0xa000000000000000ULL, 0xeefa432ceb7a661eULL, 0x0000002a99c29036ULL },
+    { 0x0000000000000000ULL, 0x3c4c4ef911e06a40ULL, 0x0000000cca4ac899ULL },
+    { 0x0000000000000000ULL, 0x1f440197be568000ULL, 0x00000023ad8cc5afULL },
+    { 0x0000000000000000ULL, 0x97682bb941000000ULL, 0x00000028c617a9f2ULL },
+    { 0x0000000000000000ULL, 0x31ec474a00000000ULL, 0x000000387b938236ULL },
+    { 0x0000000000000000ULL, 0x60c4640000000000ULL, 0x0000000c9e463ff5ULL },
+    { 0x0000000000000000ULL, 0x1ee8000000000000ULL, 0x0000003921ab178bULL },
+    { 0x0000000000000000ULL, 0x1000000000000000ULL, 0x00000020643dd5f3ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000003897a76aa0ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002540be4000ULL },
+    /* 30 */
+    { 0x8b6203d3c8bd80bcULL, 0x00000000016035ceULL, 0x0000000000000000ULL },
+    { 0x73af8b10364e3105ULL, 0x0052015ce2d469d3ULL, 0x0000000000000000ULL },
+    { 0xe7ff7b2f4c3c76daULL, 0xef3ab327005de5eeULL, 0x00000000001317e5ULL },
+    { 0x98391deb5102ce01ULL, 0x13e8a2c4789df423ULL, 0x000000358929df5eULL },
+    { 0x4cd60f16280f83b2ULL, 0xc26bfd75b422d25eULL, 0x00000015e778d32aULL },
+    { 0x1677284b4c650f73ULL, 0xcf514391c26df6e0ULL, 0x00000009f4a995c9ULL },
+    { 0x9db2a9a282e49b4eULL, 0x5ccf5176ecc7cbb1ULL, 0x0000002efccdaf0bULL },
+    { 0x79c7a898b352f689ULL, 0x006452f81eeb3101ULL, 0x00000002a54293b9ULL },
+    { 0x28387c39328ececbULL, 0x41da962c669f700eULL, 0x0000002b12f355c8ULL },
+    { 0x7b147575ae4bf0fdULL, 0x0cdb83b67a346258ULL, 0x0000002ea0430211ULL },
+    { 0xeca535c11693d7a1ULL, 0x7fdd929ae331927eULL, 0x00000003f845c78dULL },
+    { 0x32c603725e774d23ULL, 0xb9374fda7e7c9580ULL, 0x00000020f206a2f8ULL },
+    { 0xad4a9115696ca7dbULL, 0x09993534c8c955f9ULL, 0x00000039e9136cd3ULL },
+    { 0x0ca85b3c2b071e5eULL, 0x1002d65d20f97108ULL, 0x0000003122d09b00ULL },
+    { 0x981a003b5793a6aaULL, 0xa7c4cf1facf2c44aULL, 0x0000000003ba55beULL },
+    { 0x55108955c5c8cd99ULL, 0x3158fbbed4d059b6ULL, 0x0000002c63f1b882ULL },
+    { 0x6e8bf03e5cff52c9ULL, 0xa27c9def6413dab8ULL, 0x0000001e5017ec7cULL },
+    { 0x5083ff0d96ab3839ULL, 0x82b1ac51bf0247c7ULL, 0x0000001d04cecf93ULL },
+    { 0xb726d1d7dc34e924ULL, 0xb22aeea1ea1820b7ULL, 0x00000022584ff6b8ULL },
+    { 0x9d2efd514611834aULL, 0xbea624c50f8b163bULL, 0x0000002b00bccf68ULL },
+    { 0x31ec5114b8459533ULL, 0xa223e60edca16cadULL, 0x000000186345a0daULL },
+    { 0x04e93ca53f1c4aa3ULL, 0x2551a73eaa72283dULL, 0x00000032e790538eULL },
+    { 0x9acde004a3f8de01ULL, 0x7af24a705896db28ULL, 0x00000021188c6e1cULL },
+    { 0x4758a8420587bd73ULL, 0xdabcb5293b089ca0ULL, 0x00000006a18e45ebULL },
+    { 0x63c1b4ae7f0c879bULL, 0x625b07dbf472d268ULL, 0x00000036ea052ddeULL },
+    { 0xc0d2010a1a67b061ULL, 0x3fdb12733bd005e1ULL, 0x00000033c7219f2eULL },
+    { 0xa8fbc0dc46868a00ULL, 0x84a9d9b0b5e286b7ULL, 0x0000000ac4ae656cULL },
+    { 0x6ef13e632ce40000ULL, 0xb3fe0ed61cba983bULL, 0x0000001944309406ULL },
+    { 0xbe3bce93e8000000ULL, 0xbd213c0082713c0aULL, 0x000000018f891e46ULL },
+    { 0x8c72451000000000ULL, 0x6fb6f7e1f1aeb2b1ULL, 0x00000010785c400eULL },
+    { 0x661ea00000000000ULL, 0x9036eefa432ceb7aULL, 0x000000035c79c358ULL },
+    { 0x6a40000000000000ULL, 0xc8993c4c4ef911e0ULL, 0x000000149ec94beaULL },
+    { 0x8000000000000000ULL, 0xc5af1f440197be56ULL, 0x00000036aa313f5cULL },
+    { 0x0000000000000000ULL, 0xa9f297682bb94100ULL, 0x0000001599a77b89ULL },
+    { 0x0000000000000000ULL, 0x823631ec474a0000ULL, 0x000000200d67c4edULL },
+    { 0x0000000000000000ULL, 0x3ff560c464000000ULL, 0x000000374c9e3adaULL },
+    { 0x0000000000000000ULL, 0x178b1ee800000000ULL, 0x00000032d0b43d61ULL },
+    { 0x0000000000000000ULL, 0xd5f3100000000000ULL, 0x000000169b21d663ULL },
+    { 0x0000000000000000ULL, 0x6aa0000000000000ULL, 0x000000173eac7fb9ULL },
+    { 0x0000000000000000ULL, 0x4000000000000000ULL, 0x0000002b2baf5262ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000016e0280680ULL },
+    /* 31 */
+    { 0x35ce8b6203d3c8beULL, 0x0000000000000160ULL, 0x0000000000000000ULL },
+    { 0x69d373af8b10364fULL, 0x00000052015ce2d4ULL, 0x0000000000000000ULL },
+    { 0xe5eee7ff7b2f4c3dULL, 0x17e5ef3ab327005dULL, 0x0000000000000013ULL },
+    { 0xf42398391deb5103ULL, 0xdf5e13e8a2c4789dULL, 0x00000004720d6f4fULL },
+    { 0xd25e4cd60f162810ULL, 0xd32ac26bfd75b422ULL, 0x0000001298c6136eULL },
+    { 0xf6e01677284b4c66ULL, 0x95c9cf514391c26dULL, 0x00000019cdad5527ULL },
+    { 0xcbb19db2a9a282e5ULL, 0xaf0b5ccf5176ecc7ULL, 0x000000093774da5fULL },
+    { 0x310179c7a898b353ULL, 0x93b9006452f81eebULL, 0x0000001647326b58ULL },
+    { 0x700e28387c39328fULL, 0x55c841da962c669fULL, 0x000000149f9a64f1ULL },
+    { 0x62587b147575ae4cULL, 0x02110cdb83b67a34ULL, 0x0000003830b12f55ULL },
+    { 0x927eeca535c11694ULL, 0xc78d7fdd929ae331ULL, 0x00000013cae03fd9ULL },
+    { 0x958032c603725e78ULL, 0xa2f8b9374fda7e7cULL, 0x00000032b4ab7f0cULL },
+    { 0x55f9ad4a9115696dULL, 0x6cd309993534c8c9ULL, 0x00000002f13354e7ULL },
+    { 0x71080ca85b3c2b08ULL, 0x9b001002d65d20f9ULL, 0x00000035e202b608ULL },
+    { 0xc44a981a003b5794ULL, 0x55bea7c4cf1facf2ULL, 0x0000000200ed0c08ULL },
+    { 0x59b655108955c5c9ULL, 0xb8823158fbbed4d0ULL, 0x00000001f0cd1903ULL },
+    { 0xdab86e8bf03e5d00ULL, 0xec7ca27c9def6413ULL, 0x00000000ddc5ef47ULL },
+    { 0x47c75083ff0d96acULL, 0xcf9382b1ac51bf02ULL, 0x00000010befdbd06ULL },
+    { 0x20b7b726d1d7dc35ULL, 0xf6b8b22aeea1ea18ULL, 0x0000000195f53da5ULL },
+    { 0x163b9d2efd514612ULL, 0xcf68bea624c50f8bULL, 0x00000026a435f0d8ULL },
+    { 0x6cad31ec5114b846ULL, 0xa0daa223e60edca1ULL, 0x000000327ae4fc9bULL },
+    { 0x283d04e93ca53f1dULL, 0x538e2551a73eaa72ULL, 0x000000243c2bf3d0ULL },
+    { 0xdb289acde004a3f9ULL, 0x6e1c7af24a705896ULL, 0x000000308138680aULL },
+    { 0x9ca04758a8420588ULL, 0x45ebdabcb5293b08ULL, 0x000000026daf085aULL },
+    { 0xd26863c1b4ae7f0dULL, 0x2dde625b07dbf472ULL, 0x0000001504b2a677ULL },
+    { 0x05e1c0d2010a1a68ULL, 0x9f2e3fdb12733bd0ULL, 0x0000001bbfa1e2a3ULL },
+    { 0x86b7a8fbc0dc4687ULL, 0x656c84a9d9b0b5e2ULL, 0x00000026189e8624ULL },
+    { 0x983b6ef13e632ce4ULL, 0x9406b3fe0ed61cbaULL, 0x000000087961bde2ULL },
+    { 0x3c0abe3bce93e800ULL, 0x1e46bd213c008271ULL, 0x00000034c11d6051ULL },
+    { 0xb2b18c7245100000ULL, 0x400e6fb6f7e1f1aeULL, 0x00000012e3068608ULL },
+    { 0xeb7a661ea0000000ULL, 0xc3589036eefa432cULL, 0x00000001ebc05ef9ULL },
+    { 0x11e06a4000000000ULL, 0x4beac8993c4c4ef9ULL, 0x0000003a270a00a7ULL },
+    { 0xbe56800000000000ULL, 0x3f5cc5af1f440197ULL, 0x00000026f3a6c95fULL },
+    { 0x4100000000000000ULL, 0x7b89a9f297682bb9ULL, 0x000000162d31a75dULL },
+    { 0x0000000000000000ULL, 0xc4ed823631ec474aULL, 0x00000015c3fece75ULL },
+    { 0x0000000000000000ULL, 0x3ada3ff560c46400ULL, 0x0000001b6b982146ULL },
+    { 0x0000000000000000ULL, 0x3d61178b1ee80000ULL, 0x000000105a071e78ULL },
+    { 0x0000000000000000ULL, 0xd663d5f310000000ULL, 0x0000001bfed92d43ULL },
+    { 0x0000000000000000ULL, 0x7fb96aa000000000ULL, 0x0000000fcb6d8188ULL },
+    { 0x0000000000000000ULL, 0x5262400000000000ULL, 0x0000001fc7f845e5ULL },
+    { 0x0000000000000000ULL, 0x0680000000000000ULL, 0x0000003564a526dcULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000333a890621ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000007aef40a00ULL },
+    /* 32 */
+    { 0xe2d469d373af8b11ULL, 0x000000000052015cULL, 0x0000000000000000ULL },
+    { 0x005de5eee7ff7b30ULL, 0x001317e5ef3ab327ULL, 0x0000000000000000ULL },
+    { 0x789df42398391decULL, 0x6f4fdf5e13e8a2c4ULL, 0x000000000004720dULL },
+    { 0xb422d25e4cd60f17ULL, 0x136ed32ac26bfd75ULL, 0x0000000320c6f85cULL },
+    { 0xc26df6e01677284cULL, 0x552795c9cf514391ULL, 0x000000157026e2abULL },
+    { 0xecc7cbb19db2a9a3ULL, 0xda5faf0b5ccf5176ULL, 0x00000027e4388a86ULL },
+    { 0x1eeb310179c7a899ULL, 0x6b5893b9006452f8ULL, 0x0000001f65ddd336ULL },
+    { 0x669f700e28387c3aULL, 0x64f155c841da962cULL, 0x0000000caba4ee08ULL },
+    { 0x7a3462587b147576ULL, 0x2f5502110cdb83b6ULL, 0x00000001f456f799ULL },
+    { 0xe331927eeca535c2ULL, 0x3fd9c78d7fdd929aULL, 0x00000023aa87eff6ULL },
+    { 0x7e7c958032c60373ULL, 0x7f0ca2f8b9374fdaULL, 0x00000039559be861ULL },
+    { 0xc8c955f9ad4a9116ULL, 0x54e76cd309993534ULL, 0x00000016b33b4569ULL },
+    { 0x20f971080ca85b3dULL, 0xb6089b001002d65dULL, 0x000000188641864aULL },
+    { 0xacf2c44a981a003cULL, 0x0c0855bea7c4cf1fULL, 0x0000001165207089ULL },
+    { 0xd4d059b655108956ULL, 0x1903b8823158fbbeULL, 0x0000001fe8a34c45ULL },
+    { 0x6413dab86e8bf03fULL, 0xef47ec7ca27c9defULL, 0x00000010168b6d7fULL },
+    { 0xbf0247c75083ff0eULL, 0xbd06cf9382b1ac51ULL, 0x0000001dc9807793ULL },
+    { 0xea1820b7b726d1d8ULL, 0x3da5f6b8b22aeea1ULL, 0x0000002265e4db17ULL },
+    { 0x0f8b163b9d2efd52ULL, 0xf0d8cf68bea624c5ULL, 0x000000056942ac57ULL },
+    { 0xdca16cad31ec5115ULL, 0xfc9ba0daa223e60eULL, 0x0000001479ae3e44ULL },
+    { 0xaa72283d04e93ca6ULL, 0xf3d0538e2551a73eULL, 0x000000100fee4303ULL },
+    { 0x5896db289acde005ULL, 0x680a6e1c7af24a70ULL, 0x00000000eb94ccf6ULL },
+    { 0x3b089ca04758a843ULL, 0x085a45ebdabcb529ULL, 0x000000395ef76bbfULL },
+    { 0xf472d26863c1b4afULL, 0xa6772dde625b07dbULL, 0x0000002c7a6e9102ULL },
+    { 0x3bd005e1c0d2010bULL, 0xe2a39f2e3fdb1273ULL, 0x000000009df7b29dULL },
+    { 0xb5e286b7a8fbc0ddULL, 0x8624656c84a9d9b0ULL, 0x00000024c2b2a0f2ULL },
+    { 0x1cba983b6ef13e64ULL, 0xbde29406b3fe0ed6ULL, 0x00000038778e731dULL },
+    { 0x82713c0abe3bce94ULL, 0x60511e46bd213c00ULL, 0x00000006ecbeea3fULL },
+    { 0xf1aeb2b18c724510ULL, 0x8608400e6fb6f7e1ULL, 0x0000000ec184a4c6ULL },
+    { 0x432ceb7a661ea000ULL, 0x5ef9c3589036eefaULL, 0x0000002e38ed2d7cULL },
+    { 0x4ef911e06a400000ULL, 0x00a74beac8993c4cULL, 0x0000001cf516d536ULL },
+    { 0x0197be5680000000ULL, 0xc95f3f5cc5af1f44ULL, 0x0000000c92cd8fa6ULL },
+    { 0x2bb9410000000000ULL, 0xa75d7b89a9f29768ULL, 0x00000026d541b1cbULL },
+    { 0x474a000000000000ULL, 0xce75c4ed823631ecULL, 0x0000002f6ab5ebc4ULL },
+    { 0x6400000000000000ULL, 0x21463ada3ff560c4ULL, 0x0000002dd294a224ULL },
+    { 0x0000000000000000ULL, 0x1e783d61178b1ee8ULL, 0x000000086983b611ULL },
+    { 0x0000000000000000ULL, 0x2d43d663d5f31000ULL, 0x00000003fc5f8c85ULL },
+    { 0x0000000000000000ULL, 0x81887fb96aa00000ULL, 0x0000001f01f4f2efULL },
+    { 0x0000000000000000ULL, 0x45e5526240000000ULL, 0x00000037c3ab5dc2ULL },
+    { 0x0000000000000000ULL, 0x26dc068000000000ULL, 0x0000002d3b933117ULL },
+    { 0x0000000000000000ULL, 0x0621000000000000ULL, 0x0000000563f45a85ULL },
+    { 0x0000000000000000ULL, 0x0a00000000000000ULL, 0x0000001ef8d841b0ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000028fcbeebe4ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000003515dbe800ULL },
+    /* 33 */
+    { 0x015ce2d469d373b0ULL, 0x0000000000000052ULL, 0x0000000000000000ULL },
+    { 0xb327005de5eee800ULL, 0x0000001317e5ef3aULL, 0x0000000000000000ULL },
+    { 0xa2c4789df423983aULL, 0x720d6f4fdf5e13e8ULL, 0x0000000000000004ULL },
+    { 0xfd75b422d25e4cd7ULL, 0xf85c136ed32ac26bULL, 0x0000000108f936baULL },
+    { 0x4391c26df6e01678ULL, 0xe2ab552795c9cf51ULL, 0x0000002b884a27d6ULL },
+    { 0x5176ecc7cbb19db3ULL, 0x8a86da5faf0b5ccfULL, 0x00000032082b668cULL },
+    { 0x52f81eeb310179c8ULL, 0xd3366b5893b90064ULL, 0x00000020b8e74ec1ULL },
+    { 0x962c669f700e2839ULL, 0xee0864f155c841daULL, 0x0000002d20df8a22ULL },
+    { 0x83b67a3462587b15ULL, 0xf7992f5502110cdbULL, 0x0000000821fab022ULL },
+    { 0x929ae331927eeca6ULL, 0xeff63fd9c78d7fddULL, 0x000000082434d76dULL },
+    { 0x4fda7e7c958032c7ULL, 0xe8617f0ca2f8b937ULL, 0x0000001998c6da31ULL },
+    { 0x3534c8c955f9ad4bULL, 0x456954e76cd30999ULL, 0x0000000b9ebba44bULL },
+    { 0xd65d20f971080ca9ULL, 0x864ab6089b001002ULL, 0x0000001186826cb3ULL },
+    { 0xcf1facf2c44a981bULL, 0x70890c0855bea7c4ULL, 0x00000029cc7fa8dcULL },
+    { 0xfbbed4d059b65511ULL, 0x4c451903b8823158ULL, 0x0000003353393903ULL },
+    { 0x9def6413dab86e8cULL, 0x6d7fef47ec7ca27cULL, 0x00000000c4926883ULL },
+    { 0xac51bf0247c75084ULL, 0x7793bd06cf9382b1ULL, 0x0000001e99b40f82ULL },
+    { 0xeea1ea1820b7b727ULL, 0xdb173da5f6b8b22aULL, 0x0000001e6071edcaULL },
+    { 0x24c50f8b163b9d2fULL, 0xac57f0d8cf68bea6ULL, 0x0000002f3b263810ULL },
+    { 0xe60edca16cad31edULL, 0x3e44fc9ba0daa223ULL, 0x00000003e1cd1966ULL },
+    { 0xa73eaa72283d04eaULL, 0x4303f3d0538e2551ULL, 0x00000017ce2c08daULL },
+    { 0x4a705896db289aceULL, 0xccf6680a6e1c7af2ULL, 0x00000032d16a7272ULL },
+    { 0xb5293b089ca04759ULL, 0x6bbf085a45ebdabcULL, 0x0000001abaa6abefULL },
+    { 0x07dbf472d26863c2ULL, 0x9102a6772dde625bULL, 0x00000037be98c2dcULL },
+    { 0x12733bd005e1c0d3ULL, 0xb29de2a39f2e3fdbULL, 0x000000335ac8e261ULL },
+    { 0xd9b0b5e286b7a8fcULL, 0xa0f28624656c84a9ULL, 0x00000016bf3ced26ULL },
+    { 0x0ed61cba983b6ef2ULL, 0x731dbde29406b3feULL, 0x00000008fe7331ceULL },
+    { 0x3c0082713c0abe3cULL, 0xea3f60511e46bd21ULL, 0x00000030115c017cULL },
+    { 0xf7e1f1aeb2b18c73ULL, 0xa4c68608400e6fb6ULL, 0x0000001d15841628ULL },
+    { 0xeefa432ceb7a661fULL, 0x2d7c5ef9c3589036ULL, 0x00000009768cf255ULL },
+    { 0x3c4c4ef911e06a40ULL, 0xd53600a74beac899ULL, 0x00000013d4fc3c98ULL },
+    { 0x1f440197be568000ULL, 0x8fa6c95f3f5cc5afULL, 0x00000023958c4cdfULL },
+    { 0x97682bb941000000ULL, 0xb1cba75d7b89a9f2ULL, 0x000000340d484217ULL },
+    { 0x31ec474a00000000ULL, 0xebc4ce75c4ed8236ULL, 0x00000005844d965fULL },
+    { 0x60c4640000000000ULL, 0xa22421463ada3ff5ULL, 0x000000165555e002ULL },
+    { 0x1ee8000000000000ULL, 0xb6111e783d61178bULL, 0x000000009cf5f157ULL },
+    { 0x1000000000000000ULL, 0x8c852d43d663d5f3ULL, 0x000000146bfeadfbULL },
+    { 0x0000000000000000ULL, 0xf2ef81887fb96aa0ULL, 0x0000003a917bb66cULL },
+    { 0x0000000000000000ULL, 0x5dc245e552624000ULL, 0x000000195ddd4e9fULL },
+    { 0x0000000000000000ULL, 0x311726dc06800000ULL, 0x000000251af7ecf5ULL },
+    { 0x0000000000000000ULL, 0x5a85062100000000ULL, 0x000000391691569eULL },
+    { 0x0000000000000000ULL, 0x41b00a0000000000ULL, 0x00000024de9c0fdcULL },
+    { 0x0000000000000000ULL, 0xebe4000000000000ULL, 0x000000334850e208ULL },
+    { 0x0000000000000000ULL, 0xe800000000000000ULL, 0x0000000213c27d49ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000113527e110ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000003b9aca000ULL },
+    /* 34 */
+    { 0xef3ab327005de5efULL, 0x00000000001317e5ULL, 0x0000000000000000ULL },
+    { 0x13e8a2c4789df424ULL, 0x0004720d6f4fdf5eULL, 0x0000000000000000ULL },
+    { 0xc26bfd75b422d25fULL, 0x36baf85c136ed32aULL, 0x00000000000108f9ULL },
+    { 0xcf514391c26df6e1ULL, 0x27d6e2ab552795c9ULL, 0x0000003a064ca8e6ULL },
+    { 0x5ccf5176ecc7cbb2ULL, 0x668c8a86da5faf0bULL, 0x00000035965818f1ULL },
+    { 0x006452f81eeb3102ULL, 0x4ec1d3366b5893b9ULL, 0x0000003834988f63ULL },
+    { 0x41da962c669f700fULL, 0x8a22ee0864f155c8ULL, 0x000000171f32686bULL },
+    { 0x0cdb83b67a346259ULL, 0xb022f7992f550211ULL, 0x0000001909dc00deULL },
+    { 0x7fdd929ae331927fULL, 0xd76deff63fd9c78dULL, 0x00000033d93dbb14ULL },
+    { 0xb9374fda7e7c9581ULL, 0xda31e8617f0ca2f8ULL, 0x00000004da40606cULL },
+    { 0x09993534c8c955faULL, 0xa44b456954e76cd3ULL, 0x00000019581aa6bfULL },
+    { 0x1002d65d20f97109ULL, 0x6cb3864ab6089b00ULL, 0x0000002c9ebd65eaULL },
+    { 0xa7c4cf1facf2c44bULL, 0xa8dc70890c0855beULL, 0x0000003694cbbdb7ULL },
+    { 0x3158fbbed4d059b7ULL, 0x39034c451903b882ULL, 0x0000002ac2f74dc9ULL },
+    { 0xa27c9def6413dab9ULL, 0x68836d7fef47ec7cULL, 0x0000002ed9ced58cULL },
+    { 0x82b1ac51bf0247c8ULL, 0x0f827793bd06cf93ULL, 0x00000020b0fbf3c4ULL },
+    { 0xb22aeea1ea1820b8ULL, 0xedcadb173da5f6b8ULL, 0x0000002da61f1a47ULL },
+    { 0xbea624c50f8b163cULL, 0x3810ac57f0d8cf68ULL, 0x00000010bf4b8e28ULL },
+    { 0xa223e60edca16caeULL, 0x19663e44fc9ba0daULL, 0x000000095d3d4dfdULL },
+    { 0x2551a73eaa72283eULL, 0x08da4303f3d0538eULL, 0x0000003aede38de6ULL },
+    { 0x7af24a705896db29ULL, 0x7272ccf6680a6e1cULL, 0x000000358f2123baULL },
+    { 0xdabcb5293b089ca1ULL, 0xabef6bbf085a45ebULL, 0x0000002b691c6c9aULL },
+    { 0x625b07dbf472d269ULL, 0xc2dc9102a6772ddeULL, 0x000000240325a786ULL },
+    { 0x3fdb12733bd005e2ULL, 0xe261b29de2a39f2eULL, 0x0000001f606463dcULL },
+    { 0x84a9d9b0b5e286b8ULL, 0xed26a0f28624656cULL, 0x000000336dbafd90ULL },
+    { 0xb3fe0ed61cba983cULL, 0x31ce731dbde29406ULL, 0x00000021be48eb75ULL },
+    { 0xbd213c0082713c0bULL, 0x017cea3f60511e46ULL, 0x0000001b49570406ULL },
+    { 0x6fb6f7e1f1aeb2b2ULL, 0x1628a4c68608400eULL, 0x0000000165f96c4eULL },
+    { 0x9036eefa432ceb7bULL, 0xf2552d7c5ef9c358ULL, 0x000000122e524fe8ULL },
+    { 0xc8993c4c4ef911e1ULL, 0x3c98d53600a74beaULL, 0x000000363cb337f0ULL },
+    { 0xc5af1f440197be57ULL, 0x4cdf8fa6c95f3f5cULL, 0x00000037ef393ce4ULL },
+    { 0xa9f297682bb94100ULL, 0x4217b1cba75d7b89ULL, 0x0000003527c1e940ULL },
+    { 0x823631ec474a0000ULL, 0x965febc4ce75c4edULL, 0x0000000ef615ec61ULL },
+    { 0x3ff560c464000000ULL, 0xe002a22421463adaULL, 0x00000016b8a991b1ULL },
+    { 0x178b1ee800000000ULL, 0xf157b6111e783d61ULL, 0x000000296a2db7b5ULL },
+    { 0xd5f3100000000000ULL, 0xadfb8c852d43d663ULL, 0x0000002a5ca1f628ULL },
+    { 0x6aa0000000000000ULL, 0xb66cf2ef81887fb9ULL, 0x0000000978b1bbfdULL },
+    { 0x4000000000000000ULL, 0x4e9f5dc245e55262ULL, 0x0000003b12730b79ULL },
+    { 0x0000000000000000ULL, 0xecf5311726dc0680ULL, 0x0000001c3e77be83ULL },
+    { 0x0000000000000000ULL, 0x569e5a8506210000ULL, 0x0000001eb76126c9ULL },
+    { 0x0000000000000000ULL, 0x0fdc41b00a000000ULL, 0x0000002ee0b37878ULL },
+    { 0x0000000000000000ULL, 0xe208ebe400000000ULL, 0x0000001bf4400a26ULL },
+    { 0x0000000000000000ULL, 0x7d49e80000000000ULL, 0x000000090d9ab616ULL },
+    { 0x0000000000000000ULL, 0xe110000000000000ULL, 0x000000053c7925c9ULL },
+    { 0x0000000000000000ULL, 0xa000000000000000ULL, 0x0000002f00ef5f36ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000cb7e75a40ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000ee6b28000ULL },
+    /* 35 */
+    { 0x17e5ef3ab327005eULL, 0x0000000000000013ULL, 0x0000000000000000ULL },
+    { 0xdf5e13e8a2c4789eULL, 0x00000004720d6f4fULL, 0x0000000000000000ULL },
+    { 0xd32ac26bfd75b423ULL, 0x08f936baf85c136eULL, 0x0000000000000001ULL },
+    { 0x95c9cf514391c26eULL, 0xa8e627d6e2ab5527ULL, 0x000000003db1a69cULL },
+    { 0xaf0b5ccf5176ecc8ULL, 0x18f1668c8a86da5fULL, 0x0000002479a642e8ULL },
+    { 0x93b9006452f81eecULL, 0x8f634ec1d3366b58ULL, 0x000000360a15c788ULL },
+    { 0x55c841da962c66a0ULL, 0x686b8a22ee0864f1ULL, 0x0000001fcb9de608ULL },
+    { 0x02110cdb83b67a35ULL, 0x00deb022f7992f55ULL, 0x00000001f5263becULL },
+    { 0xc78d7fdd929ae332ULL, 0xbb14d76deff63fd9ULL, 0x00000036f2e6113dULL },
+    { 0xa2f8b9374fda7e7dULL, 0x606cda31e8617f0cULL, 0x0000000e5f710dceULL },
+    { 0x6cd309993534c8caULL, 0xa6bfa44b456954e7ULL, 0x000000300d01efdaULL },
+    { 0x9b001002d65d20faULL, 0x65ea6cb3864ab608ULL, 0x00000032e8a301b9ULL },
+    { 0x55bea7c4cf1facf3ULL, 0xbdb7a8dc70890c08ULL, 0x0000002b2a96a07dULL },
+    { 0xb8823158fbbed4d1ULL, 0x4dc939034c451903ULL, 0x0000001d46c0ac19ULL },
+    { 0xec7ca27c9def6414ULL, 0xd58c68836d7fef47ULL, 0x00000005e43a2290ULL },
+    { 0xcf9382b1ac51bf03ULL, 0xf3c40f827793bd06ULL, 0x00000021b8ca1b0dULL },
+    { 0xf6b8b22aeea1ea19ULL, 0x1a47edcadb173da5ULL, 0x000000033f9dd5ddULL },
+    { 0xcf68bea624c50f8cULL, 0x8e283810ac57f0d8ULL, 0x000000337abed9cfULL },
+    { 0xa0daa223e60edca2ULL, 0x4dfd19663e44fc9bULL, 0x0000003053428f49ULL },
+    { 0x538e2551a73eaa73ULL, 0x8de608da4303f3d0ULL, 0x00000011114c16a5ULL },
+    { 0x6e1c7af24a705897ULL, 0x23ba7272ccf6680aULL, 0x000000268bce0263ULL },
+    { 0x45ebdabcb5293b09ULL, 0x6c9aabef6bbf085aULL, 0x00000017152db0baULL },
+    { 0x2dde625b07dbf473ULL, 0xa786c2dc9102a677ULL, 0x0000002b67c0145dULL },
+    { 0x9f2e3fdb12733bd1ULL, 0x63dce261b29de2a3ULL, 0x00000015ce3cbc2aULL },
+    { 0x656c84a9d9b0b5e3ULL, 0xfd90ed26a0f28624ULL, 0x00000009dea56dd8ULL },
+    { 0x9406b3fe0ed61cbbULL, 0xeb7531ce731dbde2ULL, 0x0000003285a427eaULL },
+    { 0x1e46bd213c008272ULL, 0x0406017cea3f6051ULL, 0x00000036b24f04c5ULL },
+    { 0x400e6fb6f7e1f1afULL, 0x6c4e1628a4c68608ULL, 0x0000002ddf0d4321ULL },
+    { 0xc3589036eefa432dULL, 0x4fe8f2552d7c5ef9ULL, 0x00000007c82b858aULL },
+    { 0x4beac8993c4c4efaULL, 0x37f03c98d53600a7ULL, 0x00000020340be509ULL },
+    { 0x3f5cc5af1f440198ULL, 0x3ce44cdf8fa6c95fULL, 0x0000000225774a9fULL },
+    { 0x7b89a9f297682bbaULL, 0xe9404217b1cba75dULL, 0x000000251350e519ULL },
+    { 0xc4ed823631ec474aULL, 0xec61965febc4ce75ULL, 0x00000006086c91efULL },
+    { 0x3ada3ff560c46400ULL, 0x91b1e002a2242146ULL, 0x00000037dc8c00e1ULL },
+    { 0x3d61178b1ee80000ULL, 0xb7b5f157b6111e78ULL, 0x0000003484f7a097ULL },
+    { 0xd663d5f310000000ULL, 0xf628adfb8c852d43ULL, 0x0000002353132907ULL },
+    { 0x7fb96aa000000000ULL, 0xbbfdb66cf2ef8188ULL, 0x00000001da8bbccdULL },
+    { 0x5262400000000000ULL, 0x0b794e9f5dc245e5ULL, 0x0000002fe6b8e601ULL },
+    { 0x0680000000000000ULL, 0xbe83ecf5311726dcULL, 0x000000003e46af25ULL },
+    { 0x0000000000000000ULL, 0x26c9569e5a850621ULL, 0x00000008c9bacb4dULL },
+    { 0x0000000000000000ULL, 0x78780fdc41b00a00ULL, 0x00000011f6969cafULL },
+    { 0x0000000000000000ULL, 0x0a26e208ebe40000ULL, 0x00000028dadc98f0ULL },
+    { 0x0000000000000000ULL, 0xb6167d49e8000000ULL, 0x00000037e37a797eULL },
+    { 0x0000000000000000ULL, 0x25c9e11000000000ULL, 0x0000001d8094b415ULL },
+    { 0x0000000000000000ULL, 0x5f36a00000000000ULL, 0x00000004ec7ef221ULL },
+    { 0x0000000000000000ULL, 0x5a40000000000000ULL, 0x00000007c51f32ddULL },
+    { 0x0000000000000000ULL, 0x8000000000000000ULL, 0x0000003389a3b3b6ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002a7dd90100ULL },
+    /* 36 */
+    { 0x6f4fdf5e13e8a2c5ULL, 0x000000000004720dULL, 0x0000000000000000ULL },
+    { 0x136ed32ac26bfd76ULL, 0x000108f936baf85cULL, 0x0000000000000000ULL },
+    { 0x552795c9cf514392ULL, 0xa69ca8e627d6e2abULL, 0x0000000000003db1ULL },
+    { 0xda5faf0b5ccf5177ULL, 0x42e818f1668c8a86ULL, 0x000000295cd082a2ULL },
+    { 0x6b5893b9006452f9ULL, 0xc7888f634ec1d336ULL, 0x00000025c787c629ULL },
+    { 0x64f155c841da962dULL, 0xe608686b8a22ee08ULL, 0x00000009ba3f78a3ULL },
+    { 0x2f5502110cdb83b7ULL, 0x3bec00deb022f799ULL, 0x00000026291da4a2ULL },
+    { 0x3fd9c78d7fdd929bULL, 0x113dbb14d76deff6ULL, 0x00000025c5e77374ULL },
+    { 0x7f0ca2f8b9374fdbULL, 0x0dce606cda31e861ULL, 0x0000001b06272edbULL },
+    { 0x54e76cd309993535ULL, 0xefdaa6bfa44b4569ULL, 0x0000003300a1b743ULL },
+    { 0xb6089b001002d65eULL, 0x01b965ea6cb3864aULL, 0x0000000fd15b4939ULL },
+    { 0x0c0855bea7c4cf20ULL, 0xa07dbdb7a8dc7089ULL, 0x0000000d45ddbf60ULL },
+    { 0x1903b8823158fbbfULL, 0xac194dc939034c45ULL, 0x000000167f69c500ULL },
+    { 0xef47ec7ca27c9df0ULL, 0x2290d58c68836d7fULL, 0x000000002811e3f2ULL },
+    { 0xbd06cf9382b1ac52ULL, 0x1b0df3c40f827793ULL, 0x00000038605f3b9eULL },
+    { 0x3da5f6b8b22aeea2ULL, 0xd5dd1a47edcadb17ULL, 0x00000024cfd53eebULL },
+    { 0xf0d8cf68bea624c6ULL, 0xd9cf8e283810ac57ULL, 0x00000036e8e2b2d0ULL },
+    { 0xfc9ba0daa223e60fULL, 0x8f494dfd19663e44ULL, 0x00000030a07aa87cULL },
+    { 0xf3d0538e2551a73fULL, 0x16a58de608da4303ULL, 0x0000001d00566022ULL },
+    { 0x680a6e1c7af24a71ULL, 0x026323ba7272ccf6ULL, 0x00000007efd4ad2aULL },
+    { 0x085a45ebdabcb52aULL, 0xb0ba6c9aabef6bbfULL, 0x00000009c7f36ec1ULL },
+    { 0xa6772dde625b07dcULL, 0x145da786c2dc9102ULL, 0x0000002d18d81ca0ULL },
+    { 0xe2a39f2e3fdb1274ULL, 0xbc2a63dce261b29dULL, 0x00000025457c2604ULL },
+    { 0x8624656c84a9d9b1ULL, 0x6dd8fd90ed26a0f2ULL, 0x000000011a3ab2fdULL },
+    { 0xbde29406b3fe0ed7ULL, 0x27eaeb7531ce731dULL, 0x0000003b018d0fa6ULL },
+    { 0x60511e46bd213c01ULL, 0x04c50406017cea3fULL, 0x00000026afaa4315ULL },
+    { 0x8608400e6fb6f7e2ULL, 0x43216c4e1628a4c6ULL, 0x00000004e4cedc35ULL },
+    { 0x5ef9c3589036eefbULL, 0x858a4fe8f2552d7cULL, 0x0000000c66ad1d09ULL },
+    { 0x00a74beac8993c4dULL, 0xe50937f03c98d536ULL, 0x000000023788b8fdULL },
+    { 0xc95f3f5cc5af1f45ULL, 0x4a9f3ce44cdf8fa6ULL, 0x0000003b1d4d3e29ULL },
+    { 0xa75d7b89a9f29769ULL, 0xe519e9404217b1cbULL, 0x000000099d2a2bb4ULL },
+    { 0xce75c4ed823631edULL, 0x91efec61965febc4ULL, 0x0000002a1e2d871eULL },
+    { 0x21463ada3ff560c5ULL, 0x00e191b1e002a224ULL, 0x000000071e1e34f6ULL },
+    { 0x1e783d61178b1ee8ULL, 0xa097b7b5f157b611ULL, 0x0000003946f2a0f7ULL },
+    { 0x2d43d663d5f31000ULL, 0x2907f628adfb8c85ULL, 0x00000039a7bcf753ULL },
+    { 0x81887fb96aa00000ULL, 0xbccdbbfdb66cf2efULL, 0x000000135cbd22e5ULL },
+    { 0x45e5526240000000ULL, 0xe6010b794e9f5dc2ULL, 0x000000357d6c4510ULL },
+    { 0x26dc068000000000ULL, 0xaf25be83ecf53117ULL, 0x00000003ef39efc2ULL },
+    { 0x0621000000000000ULL, 0xcb4d26c9569e5a85ULL, 0x0000002d5414add0ULL },
+    { 0x0a00000000000000ULL, 0x9caf78780fdc41b0ULL, 0x000000309d19d4c4ULL },
+    { 0x0000000000000000ULL, 0x98f00a26e208ebe4ULL, 0x0000002dc6fdd5f4ULL },
+    { 0x0000000000000000ULL, 0x797eb6167d49e800ULL, 0x00000038f324536aULL },
+    { 0x0000000000000000ULL, 0xb41525c9e1100000ULL, 0x00000018ca614e0eULL },
+    { 0x0000000000000000ULL, 0xf2215f36a0000000ULL, 0x000000036c64ce86ULL },
+    { 0x0000000000000000ULL, 0x32dd5a4000000000ULL, 0x0000001f6b65d413ULL },
+    { 0x0000000000000000ULL, 0xb3b6800000000000ULL, 0x000000047854c317ULL },
+    { 0x0000000000000000ULL, 0x0100000000000000ULL, 0x0000000584bfdf17ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000055b23c0caULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002f08236400ULL },
+    /* 37 */
+    { 0xf85c136ed32ac26cULL, 0x0000000108f936baULL, 0x0000000000000000ULL },
+    { 0xe2ab552795c9cf52ULL, 0x3db1a69ca8e627d6ULL, 0x0000000000000000ULL },
+    { 0x8a86da5faf0b5cd0ULL, 0x82a242e818f1668cULL, 0x000000000e5d3ef2ULL },
+    { 0xd3366b5893b90065ULL, 0xc629c7888f634ec1ULL, 0x0000003876bd561bULL },
+    { 0xee0864f155c841dbULL, 0x78a3e608686b8a22ULL, 0x000000067776c07bULL },
+    { 0xf7992f5502110cdcULL, 0xa4a23bec00deb022ULL, 0x0000001cbf75c5cdULL },
+    { 0xeff63fd9c78d7fdeULL, 0x7374113dbb14d76dULL, 0x0000002fe148b14fULL },
+    { 0xe8617f0ca2f8b938ULL, 0x2edb0dce606cda31ULL, 0x000000127fa5e4e5ULL },
+    { 0x456954e76cd3099aULL, 0xb743efdaa6bfa44bULL, 0x000000355c5f82edULL },
+    { 0x864ab6089b001003ULL, 0x493901b965ea6cb3ULL, 0x0000003758f879c1ULL },
+    { 0x70890c0855bea7c5ULL, 0xbf60a07dbdb7a8dcULL, 0x0000002d00beb377ULL },
+    { 0x4c451903b8823159ULL, 0xc500ac194dc93903ULL, 0x0000001be182e21fULL },
+    { 0x6d7fef47ec7ca27dULL, 0xe3f22290d58c6883ULL, 0x00000007659cbb83ULL },
+    { 0x7793bd06cf9382b2ULL, 0x3b9e1b0df3c40f82ULL, 0x0000001eb547ff7dULL },
+    { 0xdb173da5f6b8b22bULL, 0x3eebd5dd1a47edcaULL, 0x0000001d28761e63ULL },
+    { 0xac57f0d8cf68bea7ULL, 0xb2d0d9cf8e283810ULL, 0x000000171b8283ceULL },
+    { 0x3e44fc9ba0daa224ULL, 0xa87c8f494dfd1966ULL, 0x000000302030cceeULL },
+    { 0x4303f3d0538e2552ULL, 0x602216a58de608daULL, 0x00000037912260e6ULL },
+    { 0xccf6680a6e1c7af3ULL, 0xad2a026323ba7272ULL, 0x00000035a3737794ULL },
+    { 0x6bbf085a45ebdabdULL, 0x6ec1b0ba6c9aabefULL, 0x000000229dce2a75ULL },
+    { 0x9102a6772dde625cULL, 0x1ca0145da786c2dcULL, 0x0000001b5787eda4ULL },
+    { 0xb29de2a39f2e3fdcULL, 0x2604bc2a63dce261ULL, 0x0000002635d39b94ULL },
+    { 0xa0f28624656c84aaULL, 0xb2fd6dd8fd90ed26ULL, 0x000000227e56dc36ULL },
+    { 0x731dbde29406b3ffULL, 0x0fa627eaeb7531ceULL, 0x0000000cbc533e01ULL },
+    { 0xea3f60511e46bd22ULL, 0x431504c50406017cULL, 0x000000003f3f8b80ULL },
+    { 0xa4c68608400e6fb7ULL, 0xdc3543216c4e1628ULL, 0x0000001ddd0367acULL },
+    { 0x2d7c5ef9c3589037ULL, 0x1d09858a4fe8f255ULL, 0x000000283f452445ULL },
+    { 0xd53600a74beac89aULL, 0xb8fde50937f03c98ULL, 0x00000010177b326aULL },
+    { 0x8fa6c95f3f5cc5b0ULL, 0x3e294a9f3ce44cdfULL, 0x00000018d92a027dULL },
+    { 0xb1cba75d7b89a9f3ULL, 0x2bb4e519e9404217ULL, 0x0000001d290dbc16ULL },
+    { 0xebc4ce75c4ed8237ULL, 0x871e91efec61965fULL, 0x00000005297a7a1bULL },
+    { 0xa22421463ada3ff6ULL, 0x34f600e191b1e002ULL, 0x0000000668c90ca4ULL },
+    { 0xb6111e783d61178cULL, 0xa0f7a097b7b5f157ULL, 0x000000263b7e1ffaULL },
+    { 0x8c852d43d663d5f4ULL, 0xf7532907f628adfbULL, 0x0000003a5aa3a9fcULL },
+    { 0xf2ef81887fb96aa0ULL, 0x22e5bccdbbfdb66cULL, 0x0000003ae5f48da3ULL },
+    { 0x5dc245e552624000ULL, 0x4510e6010b794e9fULL, 0x00000025fbaeaa40ULL },
+    { 0x311726dc06800000ULL, 0xefc2af25be83ecf5ULL, 0x0000000ef6c727abULL },
+    { 0x5a85062100000000ULL, 0xadd0cb4d26c9569eULL, 0x000000280837c4aaULL },
+    { 0x41b00a0000000000ULL, 0xd4c49caf78780fdcULL, 0x00000027bd425b9bULL },
+    { 0xebe4000000000000ULL, 0xd5f498f00a26e208ULL, 0x0000002448424445ULL },
+    { 0xe800000000000000ULL, 0x536a797eb6167d49ULL, 0x0000001042892f36ULL },
+    { 0x0000000000000000ULL, 0x4e0eb41525c9e110ULL, 0x0000000ca61295dfULL },
+    { 0x0000000000000000ULL, 0xce86f2215f36a000ULL, 0x00000033fe028bf0ULL },
+    { 0x0000000000000000ULL, 0xd41332dd5a400000ULL, 0x00000038113359f1ULL },
+    { 0x0000000000000000ULL, 0xc317b3b680000000ULL, 0x000000384e18d19cULL },
+    { 0x0000000000000000ULL, 0xdf17010000000000ULL, 0x000000247fbf849dULL },
+    { 0x0000000000000000ULL, 0xc0ca000000000000ULL, 0x00000024c1df1319ULL },
+    { 0x0000000000000000ULL, 0x6400000000000000ULL, 0x00000005ff00d9a3ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000260ad714e8ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000003604471000ULL },
+    /* 38 */
+    { 0x36baf85c136ed32bULL, 0x00000000000108f9ULL, 0x0000000000000000ULL },
+    { 0x27d6e2ab552795caULL, 0x00003db1a69ca8e6ULL, 0x0000000000000000ULL },
+    { 0x668c8a86da5faf0cULL, 0x3ef282a242e818f1ULL, 0x0000000000000e5dULL },
+    { 0x4ec1d3366b5893baULL, 0x561bc629c7888f63ULL, 0x00000015b5e355a9ULL },
+    { 0x8a22ee0864f155c9ULL, 0xc07b78a3e608686bULL, 0x000000276d3bd152ULL },
+    { 0xb022f7992f550212ULL, 0xc5cda4a23bec00deULL, 0x0000001344658af5ULL },
+    { 0xd76deff63fd9c78eULL, 0xb14f7374113dbb14ULL, 0x00000039393150baULL },
+    { 0xda31e8617f0ca2f9ULL, 0xe4e52edb0dce606cULL, 0x0000002b77bf494fULL },
+    { 0xa44b456954e76cd4ULL, 0x82edb743efdaa6bfULL, 0x000000129a0f8e47ULL },
+    { 0x6cb3864ab6089b01ULL, 0x79c1493901b965eaULL, 0x00000010a669f98cULL },
+    { 0xa8dc70890c0855bfULL, 0xb377bf60a07dbdb7ULL, 0x00000020b4ffa238ULL },
+    { 0x39034c451903b883ULL, 0xe21fc500ac194dc9ULL, 0x0000000d33a54cc0ULL },
+    { 0x68836d7fef47ec7dULL, 0xbb83e3f22290d58cULL, 0x0000002ce8bd8bf0ULL },
+    { 0x0f827793bd06cf94ULL, 0xff7d3b9e1b0df3c4ULL, 0x000000380cc626d5ULL },
+    { 0xedcadb173da5f6b9ULL, 0x1e633eebd5dd1a47ULL, 0x00000031d34669acULL },
+    { 0x3810ac57f0d8cf69ULL, 0x83ceb2d0d9cf8e28ULL, 0x000000281312f72eULL },
+    { 0x19663e44fc9ba0dbULL, 0xcceea87c8f494dfdULL, 0x0000000ad480a18eULL },
+    { 0x08da4303f3d0538fULL, 0x60e6602216a58de6ULL, 0x000000213f92f61aULL },
+    { 0x7272ccf6680a6e1dULL, 0x7794ad2a026323baULL, 0x0000000624483333ULL },
+    { 0xabef6bbf085a45ecULL, 0x2a756ec1b0ba6c9aULL, 0x0000000bfbadcfb4ULL },
+    { 0xc2dc9102a6772ddfULL, 0xeda41ca0145da786ULL, 0x00000029f2b8c4abULL },
+    { 0xe261b29de2a39f2fULL, 0x9b942604bc2a63dcULL, 0x0000002807b970d5ULL },
+    { 0xed26a0f28624656dULL, 0xdc36b2fd6dd8fd90ULL, 0x00000031bc0348a4ULL },
+    { 0x31ce731dbde29407ULL, 0x3e010fa627eaeb75ULL, 0x00000026626f29ebULL },
+    { 0x017cea3f60511e47ULL, 0x8b80431504c50406ULL, 0x00000036c5872a2bULL },
+    { 0x1628a4c68608400fULL, 0x67acdc3543216c4eULL, 0x0000000a237ad6b1ULL },
+    { 0xf2552d7c5ef9c359ULL, 0x24451d09858a4fe8ULL, 0x000000294e29308bULL },
+    { 0x3c98d53600a74bebULL, 0x326ab8fde50937f0ULL, 0x00000020657d89e3ULL },
+    { 0x4cdf8fa6c95f3f5dULL, 0x027d3e294a9f3ce4ULL, 0x00000034e5fe329eULL },
+    { 0x4217b1cba75d7b8aULL, 0xbc162bb4e519e940ULL, 0x00000024ca1d0aa1ULL },
+    { 0x965febc4ce75c4eeULL, 0x7a1b871e91efec61ULL, 0x00000025a823dfd2ULL },
+    { 0xe002a22421463adbULL, 0x0ca434f600e191b1ULL, 0x000000310167e10dULL },
+    { 0xf157b6111e783d62ULL, 0x1ffaa0f7a097b7b5ULL, 0x0000000309cdbef6ULL },
+    { 0xadfb8c852d43d664ULL, 0xa9fcf7532907f628ULL, 0x000000394e303519ULL },
+    { 0xb66cf2ef81887fbaULL, 0x8da322e5bccdbbfdULL, 0x00000005f9b1cf4eULL },
+    { 0x4e9f5dc245e55263ULL, 0xaa404510e6010b79ULL, 0x000000124a23c8f0ULL },
+    { 0xecf5311726dc0680ULL, 0x27abefc2af25be83ULL, 0x0000003808c120ebULL },
+    { 0x569e5a8506210000ULL, 0xc4aaadd0cb4d26c9ULL, 0x00000036c0540afdULL },
+    { 0x0fdc41b00a000000ULL, 0x5b9bd4c49caf7878ULL, 0x0000003b15c3e1eaULL },
+    { 0xe208ebe400000000ULL, 0x4445d5f498f00a26ULL, 0x0000003690d0f210ULL },
+    { 0x7d49e80000000000ULL, 0x2f36536a797eb616ULL, 0x00000003c9920031ULL },
+    { 0xe110000000000000ULL, 0x95df4e0eb41525c9ULL, 0x0000000b739ebb28ULL },
+    { 0xa000000000000000ULL, 0x8bf0ce86f2215f36ULL, 0x000000097314a594ULL },
+    { 0x0000000000000000ULL, 0x59f1d41332dd5a40ULL, 0x000000229611e4e1ULL },
+    { 0x0000000000000000ULL, 0xd19cc317b3b68000ULL, 0x0000003477fca852ULL },
+    { 0x0000000000000000ULL, 0x849ddf1701000000ULL, 0x00000013486292a9ULL },
+    { 0x0000000000000000ULL, 0x1319c0ca00000000ULL, 0x00000027780fec07ULL },
+    { 0x0000000000000000ULL, 0xd9a3640000000000ULL, 0x00000001a5ae01feULL },
+    { 0x0000000000000000ULL, 0x14e8000000000000ULL, 0x0000003b5640ac11ULL },
+    { 0x0000000000000000ULL, 0x1000000000000000ULL, 0x00000003fa25860fULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000381cb82a0ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002540be4000ULL },
+    /* 39 */
+    { 0xa8e627d6e2ab5528ULL, 0x000000003db1a69cULL, 0x0000000000000000ULL },
+    { 0x18f1668c8a86da60ULL, 0x0e5d3ef282a242e8ULL, 0x0000000000000000ULL },
+    { 0x8f634ec1d3366b59ULL, 0x55a9561bc629c788ULL, 0x0000000003582cefULL },
+    { 0x686b8a22ee0864f2ULL, 0xd152c07b78a3e608ULL, 0x00000037b974684dULL },
+    { 0x00deb022f7992f56ULL, 0x8af5c5cda4a23becULL, 0x000000121e4b654fULL },
+    { 0xbb14d76deff63fdaULL, 0x50bab14f7374113dULL, 0x00000012851f0015ULL },
+    { 0x606cda31e8617f0dULL, 0x494fe4e52edb0dceULL, 0x00000004f67e68dfULL },
+    { 0xa6bfa44b456954e8ULL, 0x8e4782edb743efdaULL, 0x00000033fce7b3a9ULL },
+    { 0x65ea6cb3864ab609ULL, 0xf98c79c1493901b9ULL, 0x000000277a4fdc75ULL },
+    { 0xbdb7a8dc70890c09ULL, 0xa238b377bf60a07dULL, 0x0000001b77d89579ULL },
+    { 0x4dc939034c451904ULL, 0x4cc0e21fc500ac19ULL, 0x0000001c51eea179ULL },
+    { 0xd58c68836d7fef48ULL, 0x8bf0bb83e3f22290ULL, 0x0000001c3e0856b5ULL },
+    { 0xf3c40f827793bd07ULL, 0x26d5ff7d3b9e1b0dULL, 0x0000002a4505ea74ULL },
+    { 0x1a47edcadb173da6ULL, 0x69ac1e633eebd5ddULL, 0x0000001b0b2e5542ULL },
+    { 0x8e283810ac57f0d9ULL, 0xf72e83ceb2d0d9cfULL, 0x0000000f7682a3ecULL },
+    { 0x4dfd19663e44fc9cULL, 0xa18ecceea87c8f49ULL, 0x000000372c3f6566ULL },
+    { 0x8de608da4303f3d1ULL, 0xf61a60e6602216a5ULL, 0x00000017e54a149cULL },
+    { 0x23ba7272ccf6680bULL, 0x33337794ad2a0263ULL, 0x000000248b9ffa64ULL },
+    { 0x6c9aabef6bbf085bULL, 0xcfb42a756ec1b0baULL, 0x000000175462b9ebULL },
+    { 0xa786c2dc9102a678ULL, 0xc4abeda41ca0145dULL, 0x00000036e7738a0eULL },
+    { 0x63dce261b29de2a4ULL, 0x70d59b942604bc2aULL, 0x0000000370419661ULL },
+    { 0xfd90ed26a0f28625ULL, 0x48a4dc36b2fd6dd8ULL, 0x00000016afebfe63ULL },
+    { 0xeb7531ce731dbde3ULL, 0x29eb3e010fa627eaULL, 0x000000171dc6093fULL },
+    { 0x0406017cea3f6052ULL, 0x2a2b8b80431504c5ULL, 0x0000000eb4da45e1ULL },
+    { 0x6c4e1628a4c68609ULL, 0xd6b167acdc354321ULL, 0x000000346cdd129eULL },
+    { 0x4fe8f2552d7c5efaULL, 0x308b24451d09858aULL, 0x00000024fb855f05ULL },
+    { 0x37f03c98d53600a8ULL, 0x89e3326ab8fde509ULL, 0x0000000135535d5dULL },
+    { 0x3ce44cdf8fa6c960ULL, 0x329e027d3e294a9fULL, 0x00000015c7561e18ULL },
+    { 0xe9404217b1cba75eULL, 0x0aa1bc162bb4e519ULL, 0x00000005a24bf591ULL },
+    { 0xec61965febc4ce76ULL, 0xdfd27a1b871e91efULL, 0x00000021c5261e07ULL },
+    { 0x91b1e002a2242147ULL, 0xe10d0ca434f600e1ULL, 0x00000001d5585d5dULL },
+    { 0xb7b5f157b6111e79ULL, 0xbef61ffaa0f7a097ULL, 0x00000015dba17757ULL },
+    { 0xf628adfb8c852d44ULL, 0x3519a9fcf7532907ULL, 0x000000146e10d61cULL },
+    { 0xbbfdb66cf2ef8189ULL, 0xcf4e8da322e5bccdULL, 0x00000006914b1d83ULL },
+    { 0x0b794e9f5dc245e6ULL, 0xc8f0aa404510e601ULL, 0x0000001eb079d179ULL },
+    { 0xbe83ecf5311726ddULL, 0x20eb27abefc2af25ULL, 0x0000001c5af27091ULL },
+    { 0x26c9569e5a850621ULL, 0x0afdc4aaadd0cb4dULL, 0x00000021ca568394ULL },
+    { 0x78780fdc41b00a00ULL, 0xe1ea5b9bd4c49cafULL, 0x00000022780be9a7ULL },
+    { 0x0a26e208ebe40000ULL, 0xf2104445d5f498f0ULL, 0x000000271693625aULL },
+    { 0xb6167d49e8000000ULL, 0x00312f36536a797eULL, 0x000000152cc72086ULL },
+    { 0x25c9e11000000000ULL, 0xbb2895df4e0eb415ULL, 0x0000001f33112f9eULL },
+    { 0x5f36a00000000000ULL, 0xa5948bf0ce86f221ULL, 0x00000024f51c30a2ULL },
+    { 0x5a40000000000000ULL, 0xe4e159f1d41332ddULL, 0x00000025de812e43ULL },
+    { 0x8000000000000000ULL, 0xa852d19cc317b3b6ULL, 0x0000000fcecd31e4ULL },
+    { 0x0000000000000000ULL, 0x92a9849ddf170100ULL, 0x000000353d0cc4f2ULL },
+    { 0x0000000000000000ULL, 0xec071319c0ca0000ULL, 0x000000387a78b343ULL },
+    { 0x0000000000000000ULL, 0x01fed9a364000000ULL, 0x0000000fd07735e6ULL },
+    { 0x0000000000000000ULL, 0xac1114e800000000ULL, 0x000000358d886d0aULL },
+    { 0x0000000000000000ULL, 0x860f100000000000ULL, 0x000000027c1bddddULL },
+    { 0x0000000000000000ULL, 0x82a0000000000000ULL, 0x0000003393d6e987ULL },
+    { 0x0000000000000000ULL, 0x4000000000000000ULL, 0x0000001f8d0a6152ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000013267b6680ULL },
+    /* 40 */
+    { 0xa69ca8e627d6e2acULL, 0x0000000000003db1ULL, 0x0000000000000000ULL },
+    { 0x42e818f1668c8a87ULL, 0x00000e5d3ef282a2ULL, 0x0000000000000000ULL },
+    { 0xc7888f634ec1d337ULL, 0x2cef55a9561bc629ULL, 0x0000000000000358ULL },
+    { 0xe608686b8a22ee09ULL, 0x684dd152c07b78a3ULL, 0x0000001487abc42cULL },
+    { 0x3bec00deb022f79aULL, 0x654f8af5c5cda4a2ULL, 0x0000000a56e3b85bULL },
+    { 0x113dbb14d76deff7ULL, 0x001550bab14f7374ULL, 0x00000015479c64d1ULL },
+    { 0x0dce606cda31e862ULL, 0x68df494fe4e52edbULL, 0x00000030a963e07eULL },
+    { 0xefdaa6bfa44b456aULL, 0xb3a98e4782edb743ULL, 0x0000001d6e9a4af7ULL },
+    { 0x01b965ea6cb3864bULL, 0xdc75f98c79c14939ULL, 0x00000039ac2d9b8dULL },
+    { 0xa07dbdb7a8dc708aULL, 0x9579a238b377bf60ULL, 0x000000210795bf70ULL },
+    { 0xac194dc939034c46ULL, 0xa1794cc0e21fc500ULL, 0x0000001a3685c980ULL },
+    { 0x2290d58c68836d80ULL, 0x56b58bf0bb83e3f2ULL, 0x0000001df2fd9712ULL },
+    { 0x1b0df3c40f827794ULL, 0xea7426d5ff7d3b9eULL, 0x00000004451278e1ULL },
+    { 0xd5dd1a47edcadb18ULL, 0x554269ac1e633eebULL, 0x0000003499a211d2ULL },
+    { 0xd9cf8e283810ac58ULL, 0xa3ecf72e83ceb2d0ULL, 0x00000030f8d38f94ULL },
+    { 0x8f494dfd19663e45ULL, 0x6566a18ecceea87cULL, 0x000000229ba782ddULL },
+    { 0x16a58de608da4304ULL, 0x149cf61a60e66022ULL, 0x000000338c3c58fcULL },
+    { 0x026323ba7272ccf7ULL, 0xfa6433337794ad2aULL, 0x0000003ab12b7b67ULL },
+    { 0xb0ba6c9aabef6bc0ULL, 0xb9ebcfb42a756ec1ULL, 0x000000183593c3a6ULL },
+    { 0x145da786c2dc9103ULL, 0x8a0ec4abeda41ca0ULL, 0x00000026d1a8bf6dULL },
+    { 0xbc2a63dce261b29eULL, 0x966170d59b942604ULL, 0x00000019810ce325ULL },
+    { 0x6dd8fd90ed26a0f3ULL, 0xfe6348a4dc36b2fdULL, 0x00000008c0629447ULL },
+    { 0x27eaeb7531ce731eULL, 0x093f29eb3e010fa6ULL, 0x00000010c328b832ULL },
+    { 0x04c50406017cea40ULL, 0x45e12a2b8b804315ULL, 0x0000000ba66299f4ULL },
+    { 0x43216c4e1628a4c7ULL, 0x129ed6b167acdc35ULL, 0x00000038dfcdad4fULL },
+    { 0x858a4fe8f2552d7dULL, 0x5f05308b24451d09ULL, 0x00000012691a33b9ULL },
+    { 0xe50937f03c98d537ULL, 0x5d5d89e3326ab8fdULL, 0x0000002b28fba049ULL },
+    { 0x4a9f3ce44cdf8fa7ULL, 0x1e18329e027d3e29ULL, 0x0000001114e09cb8ULL },
+    { 0xe519e9404217b1ccULL, 0xf5910aa1bc162bb4ULL, 0x0000002ade42f5f7ULL },
+    { 0x91efec61965febc5ULL, 0x1e07dfd27a1b871eULL, 0x00000039bb85ce78ULL },
+    { 0x00e191b1e002a225ULL, 0x5d5de10d0ca434f6ULL, 0x0000001bf78ca904ULL },
+    { 0xa097b7b5f157b612ULL, 0x7757bef61ffaa0f7ULL, 0x0000000104283f03ULL },
+    { 0x2907f628adfb8c86ULL, 0xd61c3519a9fcf753ULL, 0x00000000ce99bff6ULL },
+    { 0xbccdbbfdb66cf2f0ULL, 0x1d83cf4e8da322e5ULL, 0x0000003978981227ULL },
+    { 0xe6010b794e9f5dc3ULL, 0xd179c8f0aa404510ULL, 0x000000091b73ff5bULL },
+    { 0xaf25be83ecf53118ULL, 0x709120eb27abefc2ULL, 0x0000001560cb87dcULL },
+    { 0xcb4d26c9569e5a86ULL, 0x83940afdc4aaadd0ULL, 0x00000033533b1ab6ULL },
+    { 0x9caf78780fdc41b1ULL, 0xe9a7e1ea5b9bd4c4ULL, 0x0000002a7eae4969ULL },
+    { 0x98f00a26e208ebe4ULL, 0x625af2104445d5f4ULL, 0x00000018a8e3d26dULL },
+    { 0x797eb6167d49e800ULL, 0x208600312f36536aULL, 0x0000001977ce701bULL },
+    { 0xb41525c9e1100000ULL, 0x2f9ebb2895df4e0eULL, 0x0000000650e5da51ULL },
+    { 0xf2215f36a0000000ULL, 0x30a2a5948bf0ce86ULL, 0x00000012e7104a32ULL },
+    { 0x32dd5a4000000000ULL, 0x2e43e4e159f1d413ULL, 0x0000000baf8e5861ULL },
+    { 0xb3b6800000000000ULL, 0x31e4a852d19cc317ULL, 0x00000016a06c2919ULL },
+    { 0x0100000000000000ULL, 0xc4f292a9849ddf17ULL, 0x00000005ddbb97b6ULL },
+    { 0x0000000000000000ULL, 0xb343ec071319c0caULL, 0x0000002a8de69920ULL },
+    { 0x0000000000000000ULL, 0x35e601fed9a36400ULL, 0x000000079d164bb5ULL },
+    { 0x0000000000000000ULL, 0x6d0aac1114e80000ULL, 0x0000002a30fd6b5aULL },
+    { 0x0000000000000000ULL, 0xdddd860f10000000ULL, 0x000000150dce681dULL },
+    { 0x0000000000000000ULL, 0xe98782a000000000ULL, 0x00000006f4311638ULL },
+    { 0x0000000000000000ULL, 0x6152400000000000ULL, 0x0000000d403b9ee4ULL },
+    { 0x0000000000000000ULL, 0x6680000000000000ULL, 0x000000352c84b505ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000141e36be1ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000034630b8a00ULL },
+    /* 41 */
+    { 0x82a242e818f1668dULL, 0x000000000e5d3ef2ULL, 0x0000000000000000ULL },
+    { 0xc629c7888f634ec2ULL, 0x03582cef55a9561bULL, 0x0000000000000000ULL },
+    { 0x78a3e608686b8a23ULL, 0xc42c684dd152c07bULL, 0x0000000000c75809ULL },
+    { 0xa4a23bec00deb023ULL, 0xb85b654f8af5c5cdULL, 0x00000002461df38bULL },
+    { 0x7374113dbb14d76eULL, 0x64d1001550bab14fULL, 0x0000002087f836ccULL },
+    { 0x2edb0dce606cda32ULL, 0xe07e68df494fe4e5ULL, 0x0000002f96d2184bULL },
+    { 0xb743efdaa6bfa44cULL, 0x4af7b3a98e4782edULL, 0x00000011aa9e0d5aULL },
+    { 0x493901b965ea6cb4ULL, 0x9b8ddc75f98c79c1ULL, 0x0000001505df6e91ULL },
+    { 0xbf60a07dbdb7a8ddULL, 0xbf709579a238b377ULL, 0x00000021e6e429e3ULL },
+    { 0xc500ac194dc93904ULL, 0xc980a1794cc0e21fULL, 0x0000003506d3d13bULL },
+    { 0xe3f22290d58c6884ULL, 0x971256b58bf0bb83ULL, 0x0000000deb970997ULL },
+    { 0x3b9e1b0df3c40f83ULL, 0x78e1ea7426d5ff7dULL, 0x000000234b79b838ULL },
+    { 0x3eebd5dd1a47edcbULL, 0x11d2554269ac1e63ULL, 0x0000000d26015852ULL },
+    { 0xb2d0d9cf8e283811ULL, 0x8f94a3ecf72e83ceULL, 0x000000131bbaf43dULL },
+    { 0xa87c8f494dfd1967ULL, 0x82dd6566a18ecceeULL, 0x0000000e5550347dULL },
+    { 0x602216a58de608dbULL, 0x58fc149cf61a60e6ULL, 0x0000001d390cc8d0ULL },
+    { 0xad2a026323ba7273ULL, 0x7b67fa6433337794ULL, 0x00000030827c069bULL },
+    { 0x6ec1b0ba6c9aabf0ULL, 0xc3a6b9ebcfb42a75ULL, 0x000000243373e2a1ULL },
+    { 0x1ca0145da786c2ddULL, 0xbf6d8a0ec4abeda4ULL, 0x00000025a9e6c386ULL },
+    { 0x2604bc2a63dce262ULL, 0xe325966170d59b94ULL, 0x0000001f5f97b9c2ULL },
+    { 0xb2fd6dd8fd90ed27ULL, 0x9447fe6348a4dc36ULL, 0x0000002d60301580ULL },
+    { 0x0fa627eaeb7531cfULL, 0xb832093f29eb3e01ULL, 0x0000001defeb3ff0ULL },
+    { 0x431504c50406017dULL, 0x99f445e12a2b8b80ULL, 0x000000380c004792ULL },
+    { 0xdc3543216c4e1629ULL, 0xad4f129ed6b167acULL, 0x00000022221f9687ULL },
+    { 0x1d09858a4fe8f256ULL, 0x33b95f05308b2445ULL, 0x0000001f96fa899cULL },
+    { 0xb8fde50937f03c99ULL, 0xa0495d5d89e3326aULL, 0x000000245e5e1739ULL },
+    { 0x3e294a9f3ce44ce0ULL, 0x9cb81e18329e027dULL, 0x0000000d6ac8cd20ULL },
+    { 0x2bb4e519e9404218ULL, 0xf5f7f5910aa1bc16ULL, 0x0000000797d6715aULL },
+    { 0x871e91efec619660ULL, 0xce781e07dfd27a1bULL, 0x000000152dafe2d7ULL },
+    { 0x34f600e191b1e003ULL, 0xa9045d5de10d0ca4ULL, 0x000000323f122c18ULL },
+    { 0xa0f7a097b7b5f158ULL, 0x3f037757bef61ffaULL, 0x00000005bddd2382ULL },
+    { 0xf7532907f628adfcULL, 0xbff6d61c3519a9fcULL, 0x0000001e53467a4fULL },
+    { 0x22e5bccdbbfdb66dULL, 0x12271d83cf4e8da3ULL, 0x0000001291764b4eULL },
+    { 0x4510e6010b794ea0ULL, 0xff5bd179c8f0aa40ULL, 0x000000122d6389a7ULL },
+    { 0xefc2af25be83ecf6ULL, 0x87dc709120eb27abULL, 0x000000271d6e5601ULL },
+    { 0xadd0cb4d26c9569fULL, 0x1ab683940afdc4aaULL, 0x000000005b3cbdc1ULL },
+    { 0xd4c49caf78780fddULL, 0x4969e9a7e1ea5b9bULL, 0x0000002cf5ea8132ULL },
+    { 0xd5f498f00a26e209ULL, 0xd26d625af2104445ULL, 0x0000000bb553407dULL },
+    { 0x536a797eb6167d4aULL, 0x701b208600312f36ULL, 0x0000001d4b931382ULL },
+    { 0x4e0eb41525c9e110ULL, 0xda512f9ebb2895dfULL, 0x0000001e5eb49d45ULL },
+    { 0xce86f2215f36a000ULL, 0x4a3230a2a5948bf0ULL, 0x00000010438d2914ULL },
+    { 0xd41332dd5a400000ULL, 0x58612e43e4e159f1ULL, 0x00000004b95e35f2ULL },
+    { 0xc317b3b680000000ULL, 0x291931e4a852d19cULL, 0x000000386ce6c9dcULL },
+    { 0xdf17010000000000ULL, 0x97b6c4f292a9849dULL, 0x0000003342974015ULL },
+    { 0xc0ca000000000000ULL, 0x9920b343ec071319ULL, 0x0000000507056d0cULL },
+    { 0x6400000000000000ULL, 0x4bb535e601fed9a3ULL, 0x00000002eee897d0ULL },
+    { 0x0000000000000000ULL, 0x6b5a6d0aac1114e8ULL, 0x000000307f64aa2bULL },
+    { 0x0000000000000000ULL, 0x681ddddd860f1000ULL, 0x0000000a1bfeae3cULL },
+    { 0x0000000000000000ULL, 0x1638e98782a00000ULL, 0x0000000e10852e41ULL },
+    { 0x0000000000000000ULL, 0x9ee4615240000000ULL, 0x0000000f2779d797ULL },
+    { 0x0000000000000000ULL, 0xb505668000000000ULL, 0x000000234d4bdb30ULL },
+    { 0x0000000000000000ULL, 0x6be1000000000000ULL, 0x0000000b572b92b5ULL },
+    { 0x0000000000000000ULL, 0x8a00000000000000ULL, 0x0000002a3d8ee779ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001c4c4aeae4ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000003515dbe800ULL },
+    /* 42 */
+    { 0x3ef282a242e818f2ULL, 0x0000000000000e5dULL, 0x0000000000000000ULL },
+    { 0x561bc629c7888f64ULL, 0x000003582cef55a9ULL, 0x0000000000000000ULL },
+    { 0xc07b78a3e608686cULL, 0x5809c42c684dd152ULL, 0x00000000000000c7ULL },
+    { 0xc5cda4a23bec00dfULL, 0xf38bb85b654f8af5ULL, 0x0000002e69d2818dULL },
+    { 0xb14f7374113dbb15ULL, 0x36cc64d1001550baULL, 0x000000210cf5b7b6ULL },
+    { 0xe4e52edb0dce606dULL, 0x184be07e68df494fULL, 0x0000002a6ccdd96eULL },
+    { 0x82edb743efdaa6c0ULL, 0x0d5a4af7b3a98e47ULL, 0x00000019a22af98eULL },
+    { 0x79c1493901b965ebULL, 0x6e919b8ddc75f98cULL, 0x0000002112f7ee21ULL },
+    { 0xb377bf60a07dbdb8ULL, 0x29e3bf709579a238ULL, 0x00000007c8b273b0ULL },
+    { 0xe21fc500ac194dcaULL, 0xd13bc980a1794cc0ULL, 0x00000029042bb12dULL },
+    { 0xbb83e3f22290d58dULL, 0x0997971256b58bf0ULL, 0x0000000aaaeccc81ULL },
+    { 0xff7d3b9e1b0df3c5ULL, 0xb83878e1ea7426d5ULL, 0x0000001e0b3b8693ULL },
+    { 0x1e633eebd5dd1a48ULL, 0x585211d2554269acULL, 0x0000002264c66531ULL },
+    { 0x83ceb2d0d9cf8e29ULL, 0xf43d8f94a3ecf72eULL, 0x0000000b7d30fb2aULL },
+    { 0xcceea87c8f494dfeULL, 0x347d82dd6566a18eULL, 0x0000000a004301d8ULL },
+    { 0x60e6602216a58de7ULL, 0xc8d058fc149cf61aULL, 0x0000003256d31a14ULL },
+    { 0x7794ad2a026323bbULL, 0x069b7b67fa643333ULL, 0x00000004d6d9384cULL },
+    { 0x2a756ec1b0ba6c9bULL, 0xe2a1c3a6b9ebcfb4ULL, 0x00000011b37dcc2fULL },
+    { 0xeda41ca0145da787ULL, 0xc386bf6d8a0ec4abULL, 0x0000000b262f663aULL },
+    { 0x9b942604bc2a63ddULL, 0xb9c2e325966170d5ULL, 0x0000000dae980b75ULL },
+    { 0xdc36b2fd6dd8fd91ULL, 0x15809447fe6348a4ULL, 0x0000001b68fe8e2aULL },
+    { 0x3e010fa627eaeb76ULL, 0x3ff0b832093f29ebULL, 0x00000009cc66c67dULL },
+    { 0x8b80431504c50407ULL, 0x479299f445e12a2bULL, 0x0000001d2977c5b6ULL },
+    { 0x67acdc3543216c4fULL, 0x9687ad4f129ed6b1ULL, 0x0000002a70b5ac25ULL },
+    { 0x24451d09858a4fe9ULL, 0x899c33b95f05308bULL, 0x00000008c06b7b56ULL },
+    { 0x326ab8fde50937f1ULL, 0x1739a0495d5d89e3ULL, 0x00000014260a1078ULL },
+    { 0x027d3e294a9f3ce5ULL, 0xcd209cb81e18329eULL, 0x0000001bf5f702eeULL },
+    { 0xbc162bb4e519e941ULL, 0x715af5f7f5910aa1ULL, 0x0000003799aa5798ULL },
+    { 0x7a1b871e91efec62ULL, 0xe2d7ce781e07dfd2ULL, 0x000000237e4c70d9ULL },
+    { 0x0ca434f600e191b2ULL, 0x2c18a9045d5de10dULL, 0x00000032bb061f66ULL },
+    { 0x1ffaa0f7a097b7b6ULL, 0x23823f037757bef6ULL, 0x00000017c9f0d495ULL },
+    { 0xa9fcf7532907f629ULL, 0x7a4fbff6d61c3519ULL, 0x00000022b95c0ee4ULL },
+    { 0x8da322e5bccdbbfeULL, 0x4b4e12271d83cf4eULL, 0x0000003532563dbaULL },
+    { 0xaa404510e6010b7aULL, 0x89a7ff5bd179c8f0ULL, 0x0000002b5fff4a91ULL },
+    { 0x27abefc2af25be84ULL, 0x560187dc709120ebULL, 0x00000021e2b95d88ULL },
+    { 0xc4aaadd0cb4d26caULL, 0xbdc11ab683940afdULL, 0x0000001fbe41ab18ULL },
+    { 0x5b9bd4c49caf7879ULL, 0x81324969e9a7e1eaULL, 0x00000005c2b12d0cULL },
+    { 0x4445d5f498f00a27ULL, 0x407dd26d625af210ULL, 0x00000002e9562d1dULL },
+    { 0x2f36536a797eb617ULL, 0x1382701b20860031ULL, 0x00000006cf8ce013ULL },
+    { 0x95df4e0eb41525caULL, 0x9d45da512f9ebb28ULL, 0x000000047107d9b2ULL },
+    { 0x8bf0ce86f2215f37ULL, 0x29144a3230a2a594ULL, 0x00000029963ea56fULL },
+    { 0x59f1d41332dd5a40ULL, 0x35f258612e43e4e1ULL, 0x00000019e1ae19b8ULL },
+    { 0xd19cc317b3b68000ULL, 0xc9dc291931e4a852ULL, 0x0000002ae3d0a8b8ULL },
+    { 0x849ddf1701000000ULL, 0x401597b6c4f292a9ULL, 0x0000002b0640fb31ULL },
+    { 0x1319c0ca00000000ULL, 0x6d0c9920b343ec07ULL, 0x0000000b778c6385ULL },
+    { 0xd9a3640000000000ULL, 0x97d04bb535e601feULL, 0x0000001f10cec8eaULL },
+    { 0x14e8000000000000ULL, 0xaa2b6b5a6d0aac11ULL, 0x000000369ed5708aULL },
+    { 0x1000000000000000ULL, 0xae3c681ddddd860fULL, 0x00000020490fca22ULL },
+    { 0x0000000000000000ULL, 0x2e411638e98782a0ULL, 0x00000008132019d1ULL },
+    { 0x0000000000000000ULL, 0xd7979ee461524000ULL, 0x00000030b423e1c5ULL },
+    { 0x0000000000000000ULL, 0xdb30b50566800000ULL, 0x0000002e104fbef1ULL },
+    { 0x0000000000000000ULL, 0x92b56be100000000ULL, 0x000000384fc0ebf9ULL },
+    { 0x0000000000000000ULL, 0xe7798a0000000000ULL, 0x0000003a1bb6fec2ULL },
+    { 0x0000000000000000ULL, 0xeae4000000000000ULL, 0x0000002d61320c90ULL },
+    { 0x0000000000000000ULL, 0xe800000000000000ULL, 0x00000021bdc2327fULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001dc7ce7d10ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000003b9aca000ULL },
+    /* 43 */
+    { 0x55a9561bc629c789ULL, 0x0000000003582cefULL, 0x0000000000000000ULL },
+    { 0xd152c07b78a3e609ULL, 0x00c75809c42c684dULL, 0x0000000000000000ULL },
+    { 0x8af5c5cda4a23bedULL, 0x818df38bb85b654fULL, 0x00000000002e69d2ULL },
+    { 0x50bab14f7374113eULL, 0xb7b636cc64d10015ULL, 0x000000310323c0bfULL },
+    { 0x494fe4e52edb0dcfULL, 0xd96e184be07e68dfULL, 0x0000002ca342c933ULL },
+    { 0x8e4782edb743efdbULL, 0xf98e0d5a4af7b3a9ULL, 0x0000000c12761564ULL },
+    { 0xf98c79c1493901baULL, 0xee216e919b8ddc75ULL, 0x0000001782918971ULL },
+    { 0xa238b377bf60a07eULL, 0x73b029e3bf709579ULL, 0x0000001a86c4da7eULL },
+    { 0x4cc0e21fc500ac1aULL, 0xb12dd13bc980a179ULL, 0x0000001d711ef8e9ULL },
+    { 0x8bf0bb83e3f22291ULL, 0xcc810997971256b5ULL, 0x0000003669228a96ULL },
+    { 0x26d5ff7d3b9e1b0eULL, 0x8693b83878e1ea74ULL, 0x000000231c4fc033ULL },
+    { 0x69ac1e633eebd5deULL, 0x6531585211d25542ULL, 0x0000000bff2ba882ULL },
+    { 0xf72e83ceb2d0d9d0ULL, 0xfb2af43d8f94a3ecULL, 0x0000001e5c2a22e2ULL },
+    { 0xa18ecceea87c8f4aULL, 0x01d8347d82dd6566ULL, 0x00000034d9211851ULL },
+    { 0xf61a60e6602216a6ULL, 0x1a14c8d058fc149cULL, 0x00000012dc67db9dULL },
+    { 0x33337794ad2a0264ULL, 0x384c069b7b67fa64ULL, 0x000000249400715dULL },
+    { 0xcfb42a756ec1b0bbULL, 0xcc2fe2a1c3a6b9ebULL, 0x00000015b456f1adULL },
+    { 0xc4abeda41ca0145eULL, 0x663ac386bf6d8a0eULL, 0x0000002877250127ULL },
+    { 0x70d59b942604bc2bULL, 0x0b75b9c2e3259661ULL, 0x000000092c622114ULL },
+    { 0x48a4dc36b2fd6dd9ULL, 0x8e2a15809447fe63ULL, 0x00000004aac2d7acULL },
+    { 0x29eb3e010fa627ebULL, 0xc67d3ff0b832093fULL, 0x000000282d196072ULL },
+    { 0x2a2b8b80431504c6ULL, 0xc5b6479299f445e1ULL, 0x0000001ab924d5b3ULL },
+    { 0xd6b167acdc354322ULL, 0xac259687ad4f129eULL, 0x00000029db43cc27ULL },
+    { 0x308b24451d09858bULL, 0x7b56899c33b95f05ULL, 0x000000093ca98623ULL },
+    { 0x89e3326ab8fde50aULL, 0x10781739a0495d5dULL, 0x0000000842e12318ULL },
+    { 0x329e027d3e294aa0ULL, 0x02eecd209cb81e18ULL, 0x000000059a589297ULL },
+    { 0x0aa1bc162bb4e51aULL, 0x5798715af5f7f591ULL, 0x0000002328fbf53eULL },
+    { 0xdfd27a1b871e91f0ULL, 0x70d9e2d7ce781e07ULL, 0x0000000e83e204f2ULL },
+    { 0xe10d0ca434f600e2ULL, 0x1f662c18a9045d5dULL, 0x0000003872996766ULL },
+    { 0xbef61ffaa0f7a098ULL, 0xd49523823f037757ULL, 0x00000017c6fc0466ULL },
+    { 0x3519a9fcf7532908ULL, 0x0ee47a4fbff6d61cULL, 0x00000017f12b64a4ULL },
+    { 0xcf4e8da322e5bcceULL, 0x3dba4b4e12271d83ULL, 0x0000002632a11162ULL },
+    { 0xc8f0aa404510e602ULL, 0x4a9189a7ff5bd179ULL, 0x00000016dfa09621ULL },
+    { 0x20eb27abefc2af26ULL, 0x5d88560187dc7091ULL, 0x00000007c050ab1dULL },
+    { 0x0afdc4aaadd0cb4eULL, 0xab18bdc11ab68394ULL, 0x00000006d64fdba3ULL },
+    { 0xe1ea5b9bd4c49cb0ULL, 0x2d0c81324969e9a7ULL, 0x000000261b64c59fULL },
+    { 0xf2104445d5f498f1ULL, 0x2d1d407dd26d625aULL, 0x000000250fa094d8ULL },
+    { 0x00312f36536a797fULL, 0xe0131382701b2086ULL, 0x00000032551b750eULL },
+    { 0xbb2895df4e0eb416ULL, 0xd9b29d45da512f9eULL, 0x0000000376a2edc7ULL },
+    { 0xa5948bf0ce86f222ULL, 0xa56f29144a3230a2ULL, 0x0000002e8802d178ULL },
+    { 0xe4e159f1d41332deULL, 0x19b835f258612e43ULL, 0x0000001c171355e0ULL },
+    { 0xa852d19cc317b3b7ULL, 0xa8b8c9dc291931e4ULL, 0x000000342d6dc18aULL },
+    { 0x92a9849ddf170100ULL, 0xfb31401597b6c4f2ULL, 0x0000002048b97ed0ULL },
+    { 0xec071319c0ca0000ULL, 0x63856d0c9920b343ULL, 0x00000030a8405b9aULL },
+    { 0x01fed9a364000000ULL, 0xc8ea97d04bb535e6ULL, 0x00000023f24970ecULL },
+    { 0xac1114e800000000ULL, 0x708aaa2b6b5a6d0aULL, 0x000000372179c4a5ULL },
+    { 0x860f100000000000ULL, 0xca22ae3c681dddddULL, 0x0000002684f8336fULL },
+    { 0x82a0000000000000ULL, 0x19d12e411638e987ULL, 0x0000001a072dcc84ULL },
+    { 0x4000000000000000ULL, 0xe1c5d7979ee46152ULL, 0x0000001ec1d2f9ddULL },
+    { 0x0000000000000000ULL, 0xbef1db30b5056680ULL, 0x00000033a9317dd9ULL },
+    { 0x0000000000000000ULL, 0xebf992b56be10000ULL, 0x00000032b2aa6bacULL },
+    { 0x0000000000000000ULL, 0xfec2e7798a000000ULL, 0x0000002842f0eb24ULL },
+    { 0x0000000000000000ULL, 0x0c90eae400000000ULL, 0x000000089d155d9eULL },
+    { 0x0000000000000000ULL, 0x327fe80000000000ULL, 0x00000024cc75ab3aULL },
+    { 0x0000000000000000ULL, 0x7d10000000000000ULL, 0x0000000d8cd3c742ULL },
+    { 0x0000000000000000ULL, 0xa000000000000000ULL, 0x0000000f7b06624eULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000124e6a4a40ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000ee6b28000ULL },
+    /* 44 */
+    { 0x2cef55a9561bc62aULL, 0x0000000000000358ULL, 0x0000000000000000ULL },
+    { 0x684dd152c07b78a4ULL, 0x000000c75809c42cULL, 0x0000000000000000ULL },
+    { 0x654f8af5c5cda4a3ULL, 0x69d2818df38bb85bULL, 0x000000000000002eULL },
+    { 0x001550bab14f7375ULL, 0xc0bfb7b636cc64d1ULL, 0x0000000ace73cbfdULL },
+    { 0x68df494fe4e52edcULL, 0xc933d96e184be07eULL, 0x0000003b14da5cc2ULL },
+    { 0xb3a98e4782edb744ULL, 0x1564f98e0d5a4af7ULL, 0x0000002d5a25af10ULL },
+    { 0xdc75f98c79c1493aULL, 0x8971ee216e919b8dULL, 0x00000003bea7d523ULL },
+    { 0x9579a238b377bf61ULL, 0xda7e73b029e3bf70ULL, 0x000000084629fadeULL },
+    { 0xa1794cc0e21fc501ULL, 0xf8e9b12dd13bc980ULL, 0x00000033e31a6d22ULL },
+    { 0x56b58bf0bb83e3f3ULL, 0x8a96cc8109979712ULL, 0x00000008248330d2ULL },
+    { 0xea7426d5ff7d3b9fULL, 0xc0338693b83878e1ULL, 0x00000031053e4133ULL },
+    { 0x554269ac1e633eecULL, 0xa8826531585211d2ULL, 0x0000000c0c9654abULL },
+    { 0xa3ecf72e83ceb2d1ULL, 0x22e2fb2af43d8f94ULL, 0x00000027f7a0debaULL },
+    { 0x6566a18ecceea87dULL, 0x185101d8347d82ddULL, 0x0000002b56962bf5ULL },
+    { 0x149cf61a60e66023ULL, 0xdb9d1a14c8d058fcULL, 0x0000003910ccb157ULL },
+    { 0xfa6433337794ad2bULL, 0x715d384c069b7b67ULL, 0x0000001474bca4ceULL },
+    { 0xb9ebcfb42a756ec2ULL, 0xf1adcc2fe2a1c3a6ULL, 0x0000003010f39380ULL },
+    { 0x8a0ec4abeda41ca1ULL, 0x0127663ac386bf6dULL, 0x0000001e05aa2f4fULL },
+    { 0x966170d59b942605ULL, 0x21140b75b9c2e325ULL, 0x0000001265091d2cULL },
+    { 0xfe6348a4dc36b2feULL, 0xd7ac8e2a15809447ULL, 0x0000000a464e56ccULL },
+    { 0x093f29eb3e010fa7ULL, 0x6072c67d3ff0b832ULL, 0x0000002fb19024bfULL },
+    { 0x45e12a2b8b804316ULL, 0xd5b3c5b6479299f4ULL, 0x0000002c8ef17ae4ULL },
+    { 0x129ed6b167acdc36ULL, 0xcc27ac259687ad4fULL, 0x00000035479d8d55ULL },
+    { 0x5f05308b24451d0aULL, 0x86237b56899c33b9ULL, 0x00000013f9eda7a1ULL },
+    { 0x5d5d89e3326ab8feULL, 0x231810781739a049ULL, 0x000000259b94529dULL },
+    { 0x1e18329e027d3e2aULL, 0x929702eecd209cb8ULL, 0x000000249619a5f6ULL },
+    { 0xf5910aa1bc162bb5ULL, 0xf53e5798715af5f7ULL, 0x0000003968df8c2fULL },
+    { 0x1e07dfd27a1b871fULL, 0x04f270d9e2d7ce78ULL, 0x0000000b2a84bd34ULL },
+    { 0x5d5de10d0ca434f7ULL, 0x67661f662c18a904ULL, 0x0000000c1c97e5c1ULL },
+    { 0x7757bef61ffaa0f8ULL, 0x0466d49523823f03ULL, 0x0000002d07c55842ULL },
+    { 0xd61c3519a9fcf754ULL, 0x64a40ee47a4fbff6ULL, 0x0000000f5eee7053ULL },
+    { 0x1d83cf4e8da322e6ULL, 0x11623dba4b4e1227ULL, 0x000000136a9e2789ULL },
+    { 0xd179c8f0aa404511ULL, 0x96214a9189a7ff5bULL, 0x0000001fe9e2410aULL },
+    { 0x709120eb27abefc3ULL, 0xab1d5d88560187dcULL, 0x00000002770056acULL },
+    { 0x83940afdc4aaadd1ULL, 0xdba3ab18bdc11ab6ULL, 0x0000002833d6f33dULL },
+    { 0xe9a7e1ea5b9bd4c5ULL, 0xc59f2d0c81324969ULL, 0x0000000e6705a832ULL },
+    { 0x625af2104445d5f5ULL, 0x94d82d1d407dd26dULL, 0x0000000bd23ea112ULL },
+    { 0x208600312f36536bULL, 0x750ee0131382701bULL, 0x00000004538a05e3ULL },
+    { 0x2f9ebb2895df4e0fULL, 0xedc7d9b29d45da51ULL, 0x00000034f58252f4ULL },
+    { 0x30a2a5948bf0ce87ULL, 0xd178a56f29144a32ULL, 0x0000003906e55d04ULL },
+    { 0x2e43e4e159f1d414ULL, 0x55e019b835f25861ULL, 0x000000011f309dfdULL },
+    { 0x31e4a852d19cc318ULL, 0xc18aa8b8c9dc2919ULL, 0x0000003afbf8347fULL },
+    { 0xc4f292a9849ddf18ULL, 0x7ed0fb31401597b6ULL, 0x0000001dbeda3103ULL },
+    { 0xb343ec071319c0caULL, 0x5b9a63856d0c9920ULL, 0x00000000d05735acULL },
+    { 0x35e601fed9a36400ULL, 0x70ecc8ea97d04bb5ULL, 0x000000282153b017ULL },
+    { 0x6d0aac1114e80000ULL, 0xc4a5708aaa2b6b5aULL, 0x000000057532ffd9ULL },
+    { 0xdddd860f10000000ULL, 0x336fca22ae3c681dULL, 0x00000032b3fe41a0ULL },
+    { 0xe98782a000000000ULL, 0xcc8419d12e411638ULL, 0x000000254cb81d6bULL },
+    { 0x6152400000000000ULL, 0xf9dde1c5d7979ee4ULL, 0x00000019195088caULL },
+    { 0x6680000000000000ULL, 0x7dd9bef1db30b505ULL, 0x0000002f42509babULL },
+    { 0x0000000000000000ULL, 0x6bacebf992b56be1ULL, 0x00000027edb2354cULL },
+    { 0x0000000000000000ULL, 0xeb24fec2e7798a00ULL, 0x00000011cb05ed5eULL },
+    { 0x0000000000000000ULL, 0x5d9e0c90eae40000ULL, 0x000000161995e083ULL },
+    { 0x0000000000000000ULL, 0xab3a327fe8000000ULL, 0x0000001e960165d7ULL },
+    { 0x0000000000000000ULL, 0xc7427d1000000000ULL, 0x0000003236dd97c1ULL },
+    { 0x0000000000000000ULL, 0x624ea00000000000ULL, 0x0000002d1e17180cULL },
+    { 0x0000000000000000ULL, 0x4a40000000000000ULL, 0x00000002e22507beULL },
+    { 0x0000000000000000ULL, 0x8000000000000000ULL, 0x0000002c4e2b9116ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000053d1ac100ULL },
+    /* 45 */
+    { 0xc42c684dd152c07cULL, 0x0000000000c75809ULL, 0x0000000000000000ULL },
+    { 0xb85b654f8af5c5ceULL, 0x002e69d2818df38bULL, 0x0000000000000000ULL },
+    { 0x64d1001550bab150ULL, 0xcbfdc0bfb7b636ccULL, 0x00000000000ace73ULL },
+    { 0xe07e68df494fe4e6ULL, 0x5cc2c933d96e184bULL, 0x0000001af6079108ULL },
+    { 0x4af7b3a98e4782eeULL, 0xaf101564f98e0d5aULL, 0x00000001f26f4abdULL },
+    { 0x9b8ddc75f98c79c2ULL, 0xd5238971ee216e91ULL, 0x0000002c2a09b0bdULL },
+    { 0xbf709579a238b378ULL, 0xfadeda7e73b029e3ULL, 0x0000002c32e7323bULL },
+    { 0xc980a1794cc0e220ULL, 0x6d22f8e9b12dd13bULL, 0x0000000df7159a5eULL },
+    { 0x971256b58bf0bb84ULL, 0x30d28a96cc810997ULL, 0x00000015fc3f3885ULL },
+    { 0x78e1ea7426d5ff7eULL, 0x4133c0338693b838ULL, 0x0000001f02c8fd1eULL },
+    { 0x11d2554269ac1e64ULL, 0x54aba88265315852ULL, 0x000000070b5205e0ULL },
+    { 0x8f94a3ecf72e83cfULL, 0xdeba22e2fb2af43dULL, 0x000000343b2781e8ULL },
+    { 0x82dd6566a18eccefULL, 0x2bf5185101d8347dULL, 0x000000363822a1c2ULL },
+    { 0x58fc149cf61a60e7ULL, 0xb157db9d1a14c8d0ULL, 0x0000002d358924baULL },
+    { 0x7b67fa6433337795ULL, 0xa4ce715d384c069bULL, 0x0000002b77c13e66ULL },
+    { 0xc3a6b9ebcfb42a76ULL, 0x9380f1adcc2fe2a1ULL, 0x00000017e60bb65bULL },
+    { 0xbf6d8a0ec4abeda5ULL, 0x2f4f0127663ac386ULL, 0x00000015525db5a8ULL },
+    { 0xe325966170d59b95ULL, 0x1d2c21140b75b9c2ULL, 0x000000272898601fULL },
+    { 0x9447fe6348a4dc37ULL, 0x56ccd7ac8e2a1580ULL, 0x000000073e894530ULL },
+    { 0xb832093f29eb3e02ULL, 0x24bf6072c67d3ff0ULL, 0x0000000b413b916cULL },
+    { 0x99f445e12a2b8b81ULL, 0x7ae4d5b3c5b64792ULL, 0x000000192ddb8b59ULL },
+    { 0xad4f129ed6b167adULL, 0x8d55cc27ac259687ULL, 0x00000014d56d45e1ULL },
+    { 0x33b95f05308b2446ULL, 0xa7a186237b56899cULL, 0x0000003483f3c52fULL },
+    { 0xa0495d5d89e3326bULL, 0x529d231810781739ULL, 0x0000000b1872ab5aULL },
+    { 0x9cb81e18329e027eULL, 0xa5f6929702eecd20ULL, 0x0000001507a72ecdULL },
+    { 0xf5f7f5910aa1bc17ULL, 0x8c2ff53e5798715aULL, 0x0000002fe197ef11ULL },
+    { 0xce781e07dfd27a1cULL, 0xbd3404f270d9e2d7ULL, 0x0000000415eb3afcULL },
+    { 0xa9045d5de10d0ca5ULL, 0xe5c167661f662c18ULL, 0x0000003ad86c3bb9ULL },
+    { 0x3f037757bef61ffbULL, 0x58420466d4952382ULL, 0x0000002b485a7877ULL },
+    { 0xbff6d61c3519a9fdULL, 0x705364a40ee47a4fULL, 0x0000001bc9807a5eULL },
+    { 0x12271d83cf4e8da4ULL, 0x278911623dba4b4eULL, 0x00000015fcfd4efeULL },
+    { 0xff5bd179c8f0aa41ULL, 0x410a96214a9189a7ULL, 0x0000003b2cc8eaa8ULL },
+    { 0x87dc709120eb27acULL, 0x56acab1d5d885601ULL, 0x000000272cb9544aULL },
+    { 0x1ab683940afdc4abULL, 0xf33ddba3ab18bdc1ULL, 0x000000114eec97b2ULL },
+    { 0x4969e9a7e1ea5b9cULL, 0xa832c59f2d0c8132ULL, 0x00000029aa42c8c3ULL },
+    { 0xd26d625af2104446ULL, 0xa11294d82d1d407dULL, 0x0000002d8e1144ceULL },
+    { 0x701b208600312f37ULL, 0x05e3750ee0131382ULL, 0x000000301c0f3894ULL },
+    { 0xda512f9ebb2895e0ULL, 0x52f4edc7d9b29d45ULL, 0x0000002276dbc374ULL },
+    { 0x4a3230a2a5948bf1ULL, 0x5d04d178a56f2914ULL, 0x0000001b15742399ULL },
+    { 0x58612e43e4e159f2ULL, 0x9dfd55e019b835f2ULL, 0x00000023b52b1492ULL },
+    { 0x291931e4a852d19dULL, 0x347fc18aa8b8c9dcULL, 0x0000002223101ddaULL },
+    { 0x97b6c4f292a9849eULL, 0x31037ed0fb314015ULL, 0x00000032ce0933e2ULL },
+    { 0x9920b343ec07131aULL, 0x35ac5b9a63856d0cULL, 0x00000034aa0fc501ULL },
+    { 0x4bb535e601fed9a4ULL, 0xb01770ecc8ea97d0ULL, 0x000000004819f725ULL },
+    { 0x6b5a6d0aac1114e8ULL, 0xffd9c4a5708aaa2bULL, 0x00000008c65f1212ULL },
+    { 0x681ddddd860f1000ULL, 0x41a0336fca22ae3cULL, 0x000000046c741734ULL },
+    { 0x1638e98782a00000ULL, 0x1d6bcc8419d12e41ULL, 0x0000000c2ab8a202ULL },
+    { 0x9ee4615240000000ULL, 0x88caf9dde1c5d797ULL, 0x000000007e0f3632ULL },
+    { 0xb505668000000000ULL, 0x9bab7dd9bef1db30ULL, 0x0000000bc414f1a0ULL },
+    { 0x6be1000000000000ULL, 0x354c6bacebf992b5ULL, 0x0000002564fce600ULL },
+    { 0x8a00000000000000ULL, 0xed5eeb24fec2e779ULL, 0x000000000c68d6d7ULL },
+    { 0x0000000000000000ULL, 0xe0835d9e0c90eae4ULL, 0x0000003246440c97ULL },
+    { 0x0000000000000000ULL, 0x65d7ab3a327fe800ULL, 0x000000235c932cc1ULL },
+    { 0x0000000000000000ULL, 0x97c1c7427d100000ULL, 0x0000002d0768928fULL },
+    { 0x0000000000000000ULL, 0x180c624ea0000000ULL, 0x000000216ecc413dULL },
+    { 0x0000000000000000ULL, 0x07be4a4000000000ULL, 0x0000000e397b8715ULL },
+    { 0x0000000000000000ULL, 0x9116800000000000ULL, 0x00000004e5801bb1ULL },
+    { 0x0000000000000000ULL, 0xc100000000000000ULL, 0x0000002957cd9384ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001ee8bfda4aULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000113abe6400ULL },
+    /* 46 */
+    { 0x5809c42c684dd153ULL, 0x00000000000000c7ULL, 0x0000000000000000ULL },
+    { 0xf38bb85b654f8af6ULL, 0x0000002e69d2818dULL, 0x0000000000000000ULL },
+    { 0x36cc64d1001550bbULL, 0xce73cbfdc0bfb7b6ULL, 0x000000000000000aULL },
+    { 0x184be07e68df4950ULL, 0x91085cc2c933d96eULL, 0x00000002841d6893ULL },
+    { 0x0d5a4af7b3a98e48ULL, 0x4abdaf101564f98eULL, 0x000000225ba69cd9ULL },
+    { 0x6e919b8ddc75f98dULL, 0xb0bdd5238971ee21ULL, 0x00000032979c226dULL },
+    { 0x29e3bf709579a239ULL, 0x323bfadeda7e73b0ULL, 0x000000198a0e9fc7ULL },
+    { 0xd13bc980a1794cc1ULL, 0x9a5e6d22f8e9b12dULL, 0x0000002e61053889ULL },
+    { 0x0997971256b58bf1ULL, 0x388530d28a96cc81ULL, 0x0000002009c733c3ULL },
+    { 0xb83878e1ea7426d6ULL, 0xfd1e4133c0338693ULL, 0x0000002d7410bcf8ULL },
+    { 0x585211d2554269adULL, 0x05e054aba8826531ULL, 0x00000039f8e2b4f4ULL },
+    { 0xf43d8f94a3ecf72fULL, 0x81e8deba22e2fb2aULL, 0x00000038d0e6c919ULL },
+    { 0x347d82dd6566a18fULL, 0xa1c22bf5185101d8ULL, 0x00000005f05cf1ecULL },
+    { 0xc8d058fc149cf61bULL, 0x24bab157db9d1a14ULL, 0x00000037185bc693ULL },
+    { 0x069b7b67fa643334ULL, 0x3e66a4ce715d384cULL, 0x00000022426f3a29ULL },
+    { 0xe2a1c3a6b9ebcfb5ULL, 0xb65b9380f1adcc2fULL, 0x000000099a51bcf7ULL },
+    { 0xc386bf6d8a0ec4acULL, 0xb5a82f4f0127663aULL, 0x00000039acce43f9ULL },
+    { 0xb9c2e325966170d6ULL, 0x601f1d2c21140b75ULL, 0x0000003a23da136aULL },
+    { 0x15809447fe6348a5ULL, 0x453056ccd7ac8e2aULL, 0x00000018c478ee49ULL },
+    { 0x3ff0b832093f29ecULL, 0x916c24bf6072c67dULL, 0x000000110f3f93adULL },
+    { 0x479299f445e12a2cULL, 0x8b597ae4d5b3c5b6ULL, 0x0000002869765c45ULL },
+    { 0x9687ad4f129ed6b2ULL, 0x45e18d55cc27ac25ULL, 0x00000010312a531bULL },
+    { 0x899c33b95f05308cULL, 0xc52fa7a186237b56ULL, 0x0000000659988a65ULL },
+    { 0x1739a0495d5d89e4ULL, 0xab5a529d23181078ULL, 0x00000017b1fae7e4ULL },
+    { 0xcd209cb81e18329fULL, 0x2ecda5f6929702eeULL, 0x000000353dc15495ULL },
+    { 0x715af5f7f5910aa2ULL, 0xef118c2ff53e5798ULL, 0x00000022bbfd43e3ULL },
+    { 0xe2d7ce781e07dfd3ULL, 0x3afcbd3404f270d9ULL, 0x0000003511eab681ULL },
+    { 0x2c18a9045d5de10eULL, 0x3bb9e5c167661f66ULL, 0x0000001e16bbb430ULL },
+    { 0x23823f037757bef7ULL, 0x787758420466d495ULL, 0x0000000b3aedd4e8ULL },
+    { 0x7a4fbff6d61c351aULL, 0x7a5e705364a40ee4ULL, 0x0000003620536830ULL },
+    { 0x4b4e12271d83cf4fULL, 0x4efe278911623dbaULL, 0x0000000b4983a141ULL },
+    { 0x89a7ff5bd179c8f1ULL, 0xeaa8410a96214a91ULL, 0x0000000f34b1a054ULL },
+    { 0x560187dc709120ecULL, 0x544a56acab1d5d88ULL, 0x00000013c56cf15dULL },
+    { 0xbdc11ab683940afeULL, 0x97b2f33ddba3ab18ULL, 0x00000015badb7b34ULL },
+    { 0x81324969e9a7e1ebULL, 0xc8c3a832c59f2d0cULL, 0x0000000c3ec2ff68ULL },
+    { 0x407dd26d625af211ULL, 0x44cea11294d82d1dULL, 0x0000001865a08be1ULL },
+    { 0x1382701b20860032ULL, 0x389405e3750ee013ULL, 0x000000347310c3b7ULL },
+    { 0x9d45da512f9ebb29ULL, 0xc37452f4edc7d9b2ULL, 0x0000002aa8d2b90bULL },
+    { 0x29144a3230a2a595ULL, 0x23995d04d178a56fULL, 0x00000002bd28ab52ULL },
+    { 0x35f258612e43e4e2ULL, 0x14929dfd55e019b8ULL, 0x000000131fde92c9ULL },
+    { 0xc9dc291931e4a853ULL, 0x1dda347fc18aa8b8ULL, 0x0000002ed152d4d8ULL },
+    { 0x401597b6c4f292aaULL, 0x33e231037ed0fb31ULL, 0x00000032518dc6ebULL },
+    { 0x6d0c9920b343ec08ULL, 0xc50135ac5b9a6385ULL, 0x00000036c32bee4dULL },
+    { 0x97d04bb535e601ffULL, 0xf725b01770ecc8eaULL, 0x000000121b6d278bULL },
+    { 0xaa2b6b5a6d0aac12ULL, 0x1212ffd9c4a5708aULL, 0x000000209696cd45ULL },
+    { 0xae3c681ddddd8610ULL, 0x173441a0336fca22ULL, 0x0000001014edc0a8ULL },
+    { 0x2e411638e98782a0ULL, 0xa2021d6bcc8419d1ULL, 0x0000002722fba2deULL },
+    { 0xd7979ee461524000ULL, 0x363288caf9dde1c5ULL, 0x00000033d5f39de3ULL },
+    { 0xdb30b50566800000ULL, 0xf1a09bab7dd9bef1ULL, 0x00000034e6df88b0ULL },
+    { 0x92b56be100000000ULL, 0xe600354c6bacebf9ULL, 0x0000002932acfd26ULL },
+    { 0xe7798a0000000000ULL, 0xd6d7ed5eeb24fec2ULL, 0x000000090e8719e4ULL },
+    { 0xeae4000000000000ULL, 0x0c97e0835d9e0c90ULL, 0x0000003547e19320ULL },
+    { 0xe800000000000000ULL, 0x2cc165d7ab3a327fULL, 0x000000077647de0bULL },
+    { 0x0000000000000000ULL, 0x928f97c1c7427d10ULL, 0x000000029a125020ULL },
+    { 0x0000000000000000ULL, 0x413d180c624ea000ULL, 0x000000079578f600ULL },
+    { 0x0000000000000000ULL, 0x871507be4a400000ULL, 0x000000000f3086c5ULL },
+    { 0x0000000000000000ULL, 0x1bb1911680000000ULL, 0x0000002dfd90f806ULL },
+    { 0x0000000000000000ULL, 0x9384c10000000000ULL, 0x000000016c13671bULL },
+    { 0x0000000000000000ULL, 0xda4a000000000000ULL, 0x000000066bac18bdULL },
+    { 0x0000000000000000ULL, 0x6400000000000000ULL, 0x0000002c341a2cc2ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002d42958ae8ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000003604471000ULL },
+    /* 47 */
+    { 0x818df38bb85b6550ULL, 0x00000000002e69d2ULL, 0x0000000000000000ULL },
+    { 0xb7b636cc64d10016ULL, 0x000ace73cbfdc0bfULL, 0x0000000000000000ULL },
+    { 0xd96e184be07e68e0ULL, 0x689391085cc2c933ULL, 0x000000000002841dULL },
+    { 0xf98e0d5a4af7b3aaULL, 0x9cd94abdaf101564ULL, 0x00000006d8e21fb6ULL },
+    { 0xee216e919b8ddc76ULL, 0x226db0bdd5238971ULL, 0x0000002a849086b4ULL },
+    { 0x73b029e3bf70957aULL, 0x9fc7323bfadeda7eULL, 0x00000029f0da20e2ULL },
+    { 0xb12dd13bc980a17aULL, 0x38899a5e6d22f8e9ULL, 0x00000034c3d9d87bULL },
+    { 0xcc810997971256b6ULL, 0x33c3388530d28a96ULL, 0x0000001cb088f3f7ULL },
+    { 0x8693b83878e1ea75ULL, 0xbcf8fd1e4133c033ULL, 0x000000398e66304eULL },
+    { 0x6531585211d25543ULL, 0xb4f405e054aba882ULL, 0x000000125529313aULL },
+    { 0xfb2af43d8f94a3edULL, 0xc91981e8deba22e2ULL, 0x0000000dab336aeeULL },
+    { 0x01d8347d82dd6567ULL, 0xf1eca1c22bf51851ULL, 0x0000003798ba44f6ULL },
+    { 0x1a14c8d058fc149dULL, 0xc69324bab157db9dULL, 0x000000397f11ec85ULL },
+    { 0x384c069b7b67fa65ULL, 0x3a293e66a4ce715dULL, 0x0000001f25a6ecabULL },
+    { 0xcc2fe2a1c3a6b9ecULL, 0xbcf7b65b9380f1adULL, 0x00000027ddef9a15ULL },
+    { 0x663ac386bf6d8a0fULL, 0x43f9b5a82f4f0127ULL, 0x000000050fb1eb26ULL },
+    { 0x0b75b9c2e3259662ULL, 0x136a601f1d2c2114ULL, 0x00000008e8cda2b8ULL },
+    { 0x8e2a15809447fe64ULL, 0xee49453056ccd7acULL, 0x0000002adbc67176ULL },
+    { 0xc67d3ff0b8320940ULL, 0x93ad916c24bf6072ULL, 0x0000001bb0d4130bULL },
+    { 0xc5b6479299f445e2ULL, 0x5c458b597ae4d5b3ULL, 0x00000002b208f974ULL },
+    { 0xac259687ad4f129fULL, 0x531b45e18d55cc27ULL, 0x0000001b179f59c2ULL },
+    { 0x7b56899c33b95f06ULL, 0x8a65c52fa7a18623ULL, 0x0000002d3ea69d16ULL },
+    { 0x10781739a0495d5eULL, 0xe7e4ab5a529d2318ULL, 0x000000053f867edeULL },
+    { 0x02eecd209cb81e19ULL, 0x54952ecda5f69297ULL, 0x00000033e6391607ULL },
+    { 0x5798715af5f7f592ULL, 0x43e3ef118c2ff53eULL, 0x00000001b4ed0c45ULL },
+    { 0x70d9e2d7ce781e08ULL, 0xb6813afcbd3404f2ULL, 0x00000010208706c8ULL },
+    { 0x1f662c18a9045d5eULL, 0xb4303bb9e5c16766ULL, 0x0000002ebb6bf257ULL },
+    { 0xd49523823f037758ULL, 0xd4e8787758420466ULL, 0x000000146b8eb6f5ULL },
+    { 0x0ee47a4fbff6d61dULL, 0x68307a5e705364a4ULL, 0x000000393cb5a19bULL },
+    { 0x3dba4b4e12271d84ULL, 0xa1414efe27891162ULL, 0x000000242efa7993ULL },
+    { 0x4a9189a7ff5bd17aULL, 0xa054eaa8410a9621ULL, 0x000000225f6d8bbbULL },
+    { 0x5d88560187dc7092ULL, 0xf15d544a56acab1dULL, 0x0000002baf6611acULL },
+    { 0xab18bdc11ab68395ULL, 0x7b3497b2f33ddba3ULL, 0x0000002844322b05ULL },
+    { 0x2d0c81324969e9a8ULL, 0xff68c8c3a832c59fULL, 0x0000000146b58fd0ULL },
+    { 0x2d1d407dd26d625bULL, 0x8be144cea11294d8ULL, 0x00000030a93bb4d6ULL },
+    { 0xe0131382701b2087ULL, 0xc3b7389405e3750eULL, 0x00000031f3f65abeULL },
+    { 0xd9b29d45da512f9fULL, 0xb90bc37452f4edc7ULL, 0x0000002c6a737cb0ULL },
+    { 0xa56f29144a3230a3ULL, 0xab5223995d04d178ULL, 0x0000002925807922ULL },
+    { 0x19b835f258612e44ULL, 0x92c914929dfd55e0ULL, 0x00000008127258ccULL },
+    { 0xa8b8c9dc291931e5ULL, 0xd4d81dda347fc18aULL, 0x0000002fa1861086ULL },
+    { 0xfb31401597b6c4f3ULL, 0xc6eb33e231037ed0ULL, 0x0000001f64943cd5ULL },
+    { 0x63856d0c9920b344ULL, 0xee4dc50135ac5b9aULL, 0x00000031c61a8d67ULL },
+    { 0xc8ea97d04bb535e7ULL, 0x278bf725b01770ecULL, 0x0000001832c34939ULL },
+    { 0x708aaa2b6b5a6d0bULL, 0xcd451212ffd9c4a5ULL, 0x0000000d4eac255cULL },
+    { 0xca22ae3c681ddddeULL, 0xc0a8173441a0336fULL, 0x000000159b6ba0afULL },
+    { 0x19d12e411638e988ULL, 0xa2dea2021d6bcc84ULL, 0x00000028ebab507bULL },
+    { 0xe1c5d7979ee46153ULL, 0x9de3363288caf9ddULL, 0x0000001cc94ad7c7ULL },
+    { 0xbef1db30b5056680ULL, 0x88b0f1a09bab7dd9ULL, 0x0000002e7a15dac1ULL },
+    { 0xebf992b56be10000ULL, 0xfd26e600354c6bacULL, 0x0000002d0f85b7fcULL },
+    { 0xfec2e7798a000000ULL, 0x19e4d6d7ed5eeb24ULL, 0x0000003ae74fe029ULL },
+    { 0x0c90eae400000000ULL, 0x93200c97e0835d9eULL, 0x0000000991d1bf9bULL },
+    { 0x327fe80000000000ULL, 0xde0b2cc165d7ab3aULL, 0x0000002438f9a645ULL },
+    { 0x7d10000000000000ULL, 0x5020928f97c1c742ULL, 0x00000010446b473eULL },
+    { 0xa000000000000000ULL, 0xf600413d180c624eULL, 0x0000000e8224e098ULL },
+    { 0x0000000000000000ULL, 0x86c5871507be4a40ULL, 0x000000239d2ebd4cULL },
+    { 0x0000000000000000ULL, 0xf8061bb191168000ULL, 0x00000011d154fb4cULL },
+    { 0x0000000000000000ULL, 0x671b9384c1000000ULL, 0x00000011ebb357c3ULL },
+    { 0x0000000000000000ULL, 0x18bdda4a00000000ULL, 0x0000002d7ee990f2ULL },
+    { 0x0000000000000000ULL, 0x2cc2640000000000ULL, 0x000000385e15ab0aULL },
+    { 0x0000000000000000ULL, 0x8ae8000000000000ULL, 0x000000025e77c14dULL },
+    { 0x0000000000000000ULL, 0x1000000000000000ULL, 0x000000120de6372bULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000a06b99aa0ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002540be4000ULL },
+    /* 48 */
+    { 0x69d2818df38bb85cULL, 0x000000000000002eULL, 0x0000000000000000ULL },
+    { 0xc0bfb7b636cc64d2ULL, 0x0000000ace73cbfdULL, 0x0000000000000000ULL },
+    { 0xc933d96e184be07fULL, 0x841d689391085cc2ULL, 0x0000000000000002ULL },
+    { 0x1564f98e0d5a4af8ULL, 0x1fb69cd94abdaf10ULL, 0x0000000095f83d0aULL },
+    { 0x8971ee216e919b8eULL, 0x86b4226db0bdd523ULL, 0x000000025b6e2706ULL },
+    { 0xda7e73b029e3bf71ULL, 0x20e29fc7323bfadeULL, 0x0000000184fdb296ULL },
+    { 0xf8e9b12dd13bc981ULL, 0xd87b38899a5e6d22ULL, 0x00000022f45a7919ULL },
+    { 0x8a96cc8109979713ULL, 0xf3f733c3388530d2ULL, 0x00000006048504f8ULL },
+    { 0xc0338693b83878e2ULL, 0x304ebcf8fd1e4133ULL, 0x00000039f6c12c24ULL },
+    { 0xa8826531585211d3ULL, 0x313ab4f405e054abULL, 0x000000086d03c309ULL },
+    { 0x22e2fb2af43d8f95ULL, 0x6aeec91981e8debaULL, 0x0000000223e765ddULL },
+    { 0x185101d8347d82deULL, 0x44f6f1eca1c22bf5ULL, 0x000000338d86125eULL },
+    { 0xdb9d1a14c8d058fdULL, 0xec85c69324bab157ULL, 0x00000015f2e4c8b9ULL },
+    { 0x715d384c069b7b68ULL, 0xecab3a293e66a4ceULL, 0x0000002b49edd1deULL },
+    { 0xf1adcc2fe2a1c3a7ULL, 0x9a15bcf7b65b9380ULL, 0x00000033e755bc27ULL },
+    { 0x0127663ac386bf6eULL, 0xeb2643f9b5a82f4fULL, 0x000000093874f335ULL },
+    { 0x21140b75b9c2e326ULL, 0xa2b8136a601f1d2cULL, 0x0000000c8dcbd23bULL },
+    { 0xd7ac8e2a15809448ULL, 0x7176ee49453056ccULL, 0x0000000de28f5d9aULL },
+    { 0x6072c67d3ff0b833ULL, 0x130b93ad916c24bfULL, 0x00000023f58887feULL },
+    { 0xd5b3c5b6479299f5ULL, 0xf9745c458b597ae4ULL, 0x0000003b28039b06ULL },
+    { 0xcc27ac259687ad50ULL, 0x59c2531b45e18d55ULL, 0x000000019fb56219ULL },
+    { 0x86237b56899c33baULL, 0x9d168a65c52fa7a1ULL, 0x00000005e703c8e0ULL },
+    { 0x231810781739a04aULL, 0x7edee7e4ab5a529dULL, 0x000000344c03ed68ULL },
+    { 0x929702eecd209cb9ULL, 0x160754952ecda5f6ULL, 0x00000018546c25a5ULL },
+    { 0xf53e5798715af5f8ULL, 0x0c4543e3ef118c2fULL, 0x000000266fe53449ULL },
+    { 0x04f270d9e2d7ce79ULL, 0x06c8b6813afcbd34ULL, 0x0000001101fefbffULL },
+    { 0x67661f662c18a905ULL, 0xf257b4303bb9e5c1ULL, 0x0000003b60c39227ULL },
+    { 0x0466d49523823f04ULL, 0xb6f5d4e878775842ULL, 0x000000094d018482ULL },
+    { 0x64a40ee47a4fbff7ULL, 0xa19b68307a5e7053ULL, 0x0000001e6f33dc51ULL },
+    { 0x11623dba4b4e1228ULL, 0x7993a1414efe2789ULL, 0x00000013019a7204ULL },
+    { 0x96214a9189a7ff5cULL, 0x8bbba054eaa8410aULL, 0x000000010ab9b0e7ULL },
+    { 0xab1d5d88560187ddULL, 0x11acf15d544a56acULL, 0x00000035e9350114ULL },
+    { 0xdba3ab18bdc11ab7ULL, 0x2b057b3497b2f33dULL, 0x00000004ac35539cULL },
+    { 0xc59f2d0c8132496aULL, 0x8fd0ff68c8c3a832ULL, 0x000000245c575ea3ULL },
+    { 0x94d82d1d407dd26eULL, 0xb4d68be144cea112ULL, 0x00000026150abe11ULL },
+    { 0x750ee0131382701cULL, 0x5abec3b7389405e3ULL, 0x000000041f6233feULL },
+    { 0xedc7d9b29d45da52ULL, 0x7cb0b90bc37452f4ULL, 0x0000003b38b54177ULL },
+    { 0xd178a56f29144a33ULL, 0x7922ab5223995d04ULL, 0x0000001bd1fc0558ULL },
+    { 0x55e019b835f25862ULL, 0x58cc92c914929dfdULL, 0x000000149969abecULL },
+    { 0xc18aa8b8c9dc291aULL, 0x1086d4d81dda347fULL, 0x00000037075f0ef6ULL },
+    { 0x7ed0fb31401597b7ULL, 0x3cd5c6eb33e23103ULL, 0x000000394a972d34ULL },
+    { 0x5b9a63856d0c9921ULL, 0x8d67ee4dc50135acULL, 0x0000000c299b1572ULL },
+    { 0x70ecc8ea97d04bb6ULL, 0x4939278bf725b017ULL, 0x0000001aabda6805ULL },
+    { 0xc4a5708aaa2b6b5bULL, 0x255ccd451212ffd9ULL, 0x000000013b126446ULL },
+    { 0x336fca22ae3c681eULL, 0xa0afc0a8173441a0ULL, 0x000000105506369dULL },
+    { 0xcc8419d12e411639ULL, 0x507ba2dea2021d6bULL, 0x00000024b3578bebULL },
+    { 0xf9dde1c5d7979ee5ULL, 0xd7c79de3363288caULL, 0x00000036c9d4966aULL },
+    { 0x7dd9bef1db30b506ULL, 0xdac188b0f1a09babULL, 0x00000018e0551dbbULL },
+    { 0x6bacebf992b56be1ULL, 0xb7fcfd26e600354cULL, 0x0000002bbd006d89ULL },
+    { 0xeb24fec2e7798a00ULL, 0xe02919e4d6d7ed5eULL, 0x0000002010aca7b5ULL },
+    { 0x5d9e0c90eae40000ULL, 0xbf9b93200c97e083ULL, 0x0000002a58a1d491ULL },
+    { 0xab3a327fe8000000ULL, 0xa645de0b2cc165d7ULL, 0x00000021ef491fafULL },
+    { 0xc7427d1000000000ULL, 0x473e5020928f97c1ULL, 0x00000028e586b967ULL },
+    { 0x624ea00000000000ULL, 0xe098f600413d180cULL, 0x000000180bddb62aULL },
+    { 0x4a40000000000000ULL, 0xbd4c86c5871507beULL, 0x00000009fbb031eeULL },
+    { 0x8000000000000000ULL, 0xfb4cf8061bb19116ULL, 0x0000003795fae476ULL },
+    { 0x0000000000000000ULL, 0x57c3671b9384c100ULL, 0x0000001bb3dbcbc1ULL },
+    { 0x0000000000000000ULL, 0x90f218bdda4a0000ULL, 0x0000002d0421638fULL },
+    { 0x0000000000000000ULL, 0xab0a2cc264000000ULL, 0x000000216d3645b5ULL },
+    { 0x0000000000000000ULL, 0xc14d8ae800000000ULL, 0x0000002a4c439565ULL },
+    { 0x0000000000000000ULL, 0x372b100000000000ULL, 0x00000017b1137230ULL },
+    { 0x0000000000000000ULL, 0x9aa0000000000000ULL, 0x0000000b39de281fULL },
+    { 0x0000000000000000ULL, 0x4000000000000000ULL, 0x000000075bbed442ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000f6ccec680ULL },
+    /* 49 */
+    { 0xcbfdc0bfb7b636cdULL, 0x00000000000ace73ULL, 0x0000000000000000ULL },
+    { 0x5cc2c933d96e184cULL, 0x0002841d68939108ULL, 0x0000000000000000ULL },
+    { 0xaf101564f98e0d5bULL, 0x3d0a1fb69cd94abdULL, 0x00000000000095f8ULL },
+    { 0xd5238971ee216e92ULL, 0x270686b4226db0bdULL, 0x00000039cc29ed90ULL },
+    { 0xfadeda7e73b029e4ULL, 0xb29620e29fc7323bULL, 0x000000219027b9c3ULL },
+    { 0x6d22f8e9b12dd13cULL, 0x7919d87b38899a5eULL, 0x0000002d907c72ceULL },
+    { 0x30d28a96cc810998ULL, 0x04f8f3f733c33885ULL, 0x0000003012c0b9ffULL },
+    { 0x4133c0338693b839ULL, 0x2c24304ebcf8fd1eULL, 0x0000003b605797e9ULL },
+    { 0x54aba88265315853ULL, 0xc309313ab4f405e0ULL, 0x000000364a28e1bbULL },
+    { 0xdeba22e2fb2af43eULL, 0x65dd6aeec91981e8ULL, 0x0000002bb77a99c5ULL },
+    { 0x2bf5185101d8347eULL, 0x125e44f6f1eca1c2ULL, 0x0000002df5d51138ULL },
+    { 0xb157db9d1a14c8d1ULL, 0xc8b9ec85c69324baULL, 0x0000000d0e230518ULL },
+    { 0xa4ce715d384c069cULL, 0xd1deecab3a293e66ULL, 0x00000005c53f27bdULL },
+    { 0x9380f1adcc2fe2a2ULL, 0xbc279a15bcf7b65bULL, 0x0000002c3224683fULL },
+    { 0x2f4f0127663ac387ULL, 0xf335eb2643f9b5a8ULL, 0x0000000ed6e69accULL },
+    { 0x1d2c21140b75b9c3ULL, 0xd23ba2b8136a601fULL, 0x0000002fb7f97389ULL },
+    { 0x56ccd7ac8e2a1581ULL, 0x5d9a7176ee494530ULL, 0x0000002016c8f643ULL },
+    { 0x24bf6072c67d3ff1ULL, 0x87fe130b93ad916cULL, 0x0000000faf4e0eeaULL },
+    { 0x7ae4d5b3c5b64793ULL, 0x9b06f9745c458b59ULL, 0x000000369b266c89ULL },
+    { 0x8d55cc27ac259688ULL, 0x621959c2531b45e1ULL, 0x0000002009ee7203ULL },
+    { 0xa7a186237b56899dULL, 0xc8e09d168a65c52fULL, 0x00000000c9a78657ULL },
+    { 0x529d23181078173aULL, 0xed687edee7e4ab5aULL, 0x00000014705fdfd3ULL },
+    { 0xa5f6929702eecd21ULL, 0x25a5160754952ecdULL, 0x0000003157db1f6eULL },
+    { 0x8c2ff53e5798715bULL, 0x34490c4543e3ef11ULL, 0x00000019a5469b17ULL },
+    { 0xbd3404f270d9e2d8ULL, 0xfbff06c8b6813afcULL, 0x0000000567149906ULL },
+    { 0xe5c167661f662c19ULL, 0x9227f257b4303bb9ULL, 0x00000001a04ce0d1ULL },
+    { 0x58420466d4952383ULL, 0x8482b6f5d4e87877ULL, 0x00000030cb667e35ULL },
+    { 0x705364a40ee47a50ULL, 0xdc51a19b68307a5eULL, 0x0000000c75e6115bULL },
+    { 0x278911623dba4b4fULL, 0x72047993a1414efeULL, 0x000000156351d532ULL },
+    { 0x410a96214a9189a8ULL, 0xb0e78bbba054eaa8ULL, 0x0000000bbec76cadULL },
+    { 0x56acab1d5d885602ULL, 0x011411acf15d544aULL, 0x0000002870cad615ULL },
+    { 0xf33ddba3ab18bdc2ULL, 0x539c2b057b3497b2ULL, 0x00000004e3f2d8ffULL },
+    { 0xa832c59f2d0c8133ULL, 0x5ea38fd0ff68c8c3ULL, 0x0000003b72a6c1d5ULL },
+    { 0xa11294d82d1d407eULL, 0xbe11b4d68be144ceULL, 0x00000031add2fd36ULL },
+    { 0x05e3750ee0131383ULL, 0x33fe5abec3b73894ULL, 0x0000000cbee79d4eULL },
+    { 0x52f4edc7d9b29d46ULL, 0x41777cb0b90bc374ULL, 0x0000001235449af3ULL },
+    { 0x5d04d178a56f2915ULL, 0x05587922ab522399ULL, 0x00000038a32bdd46ULL },
+    { 0x9dfd55e019b835f3ULL, 0xabec58cc92c91492ULL, 0x000000104d91db5bULL },
+    { 0x347fc18aa8b8c9ddULL, 0x0ef61086d4d81ddaULL, 0x00000015580d3a4dULL },
+    { 0x31037ed0fb314016ULL, 0x2d343cd5c6eb33e2ULL, 0x00000011f10a83a3ULL },
+    { 0x35ac5b9a63856d0dULL, 0x15728d67ee4dc501ULL, 0x00000025fe14fd1dULL },
+    { 0xb01770ecc8ea97d1ULL, 0x68054939278bf725ULL, 0x00000006c587406cULL },
+    { 0xffd9c4a5708aaa2cULL, 0x6446255ccd451212ULL, 0x000000193d855522ULL },
+    { 0x41a0336fca22ae3dULL, 0x369da0afc0a81734ULL, 0x0000000801e79feeULL },
+    { 0x1d6bcc8419d12e42ULL, 0x8beb507ba2dea202ULL, 0x00000037769f25f3ULL },
+    { 0x88caf9dde1c5d798ULL, 0x966ad7c79de33632ULL, 0x00000038b4819382ULL },
+    { 0x9bab7dd9bef1db31ULL, 0x1dbbdac188b0f1a0ULL, 0x0000001e67a026b1ULL },
+    { 0x354c6bacebf992b6ULL, 0x6d89b7fcfd26e600ULL, 0x000000293cf1efe2ULL },
+    { 0xed5eeb24fec2e77aULL, 0xa7b5e02919e4d6d7ULL, 0x00000034b8274caeULL },
+    { 0xe0835d9e0c90eae4ULL, 0xd491bf9b93200c97ULL, 0x00000028aa419e67ULL },
+    { 0x65d7ab3a327fe800ULL, 0x1fafa645de0b2cc1ULL, 0x000000182cc56491ULL },
+    { 0x97c1c7427d100000ULL, 0xb967473e5020928fULL, 0x00000021ca0d0dfcULL },
+    { 0x180c624ea0000000ULL, 0xb62ae098f600413dULL, 0x0000003ad789bfd7ULL },
+    { 0x07be4a4000000000ULL, 0x31eebd4c86c58715ULL, 0x000000323969ad4cULL },
+    { 0x9116800000000000ULL, 0xe476fb4cf8061bb1ULL, 0x00000011bd942ea4ULL },
+    { 0xc100000000000000ULL, 0xcbc157c3671b9384ULL, 0x00000026645af7c3ULL },
+    { 0x0000000000000000ULL, 0x638f90f218bdda4aULL, 0x0000002d9658a04fULL },
+    { 0x0000000000000000ULL, 0x45b5ab0a2cc26400ULL, 0x000000127bf29f54ULL },
+    { 0x0000000000000000ULL, 0x9565c14d8ae80000ULL, 0x000000139f054cb5ULL },
+    { 0x0000000000000000ULL, 0x7230372b10000000ULL, 0x0000002a47399aa5ULL },
+    { 0x0000000000000000ULL, 0x281f9aa000000000ULL, 0x00000026855a59d2ULL },
+    { 0x0000000000000000ULL, 0xd442400000000000ULL, 0x00000030ee513f4eULL },
+    { 0x0000000000000000ULL, 0xc680000000000000ULL, 0x000000125a952816ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000054d84e1a1ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000257c590a00ULL },
+    /* 50 */
+    { 0xce73cbfdc0bfb7b7ULL, 0x000000000000000aULL, 0x0000000000000000ULL },
+    { 0x91085cc2c933d96fULL, 0x00000002841d6893ULL, 0x0000000000000000ULL },
+    { 0x4abdaf101564f98fULL, 0x95f83d0a1fb69cd9ULL, 0x0000000000000000ULL },
+    { 0xb0bdd5238971ee22ULL, 0xed90270686b4226dULL, 0x0000000022eae3bbULL },
+    { 0x323bfadeda7e73b1ULL, 0xb9c3b29620e29fc7ULL, 0x0000002bc1616b29ULL },
+    { 0x9a5e6d22f8e9b12eULL, 0x72ce7919d87b3889ULL, 0x00000009b70ac676ULL },
+    { 0x388530d28a96cc82ULL, 0xb9ff04f8f3f733c3ULL, 0x0000001b94141cb4ULL },
+    { 0xfd1e4133c0338694ULL, 0x97e92c24304ebcf8ULL, 0x0000002a14244451ULL },
+    { 0x05e054aba8826532ULL, 0xe1bbc309313ab4f4ULL, 0x00000012ff58814eULL },
+    { 0x81e8deba22e2fb2bULL, 0x99c565dd6aeec919ULL, 0x000000125db84f04ULL },
+    { 0xa1c22bf5185101d9ULL, 0x1138125e44f6f1ecULL, 0x000000011238a08fULL },
+    { 0x24bab157db9d1a15ULL, 0x0518c8b9ec85c693ULL, 0x000000214f792b8dULL },
+    { 0x3e66a4ce715d384dULL, 0x27bdd1deecab3a29ULL, 0x00000020d5710d31ULL },
+    { 0xb65b9380f1adcc30ULL, 0x683fbc279a15bcf7ULL, 0x0000000b71e170eaULL },
+    { 0xb5a82f4f0127663bULL, 0x9accf335eb2643f9ULL, 0x0000003693c25cf6ULL },
+    { 0x601f1d2c21140b76ULL, 0x7389d23ba2b8136aULL, 0x000000396ac8f17dULL },
+    { 0x453056ccd7ac8e2bULL, 0xf6435d9a7176ee49ULL, 0x0000001d357b4186ULL },
+    { 0x916c24bf6072c67eULL, 0x0eea87fe130b93adULL, 0x0000001f6c5c296aULL },
+    { 0x8b597ae4d5b3c5b7ULL, 0x6c899b06f9745c45ULL, 0x00000018b190b632ULL },
+    { 0x45e18d55cc27ac26ULL, 0x7203621959c2531bULL, 0x0000000bbd80cb26ULL },
+    { 0xc52fa7a186237b57ULL, 0x8657c8e09d168a65ULL, 0x00000008f385b39bULL },
+    { 0xab5a529d23181079ULL, 0xdfd3ed687edee7e4ULL, 0x0000002435ffc41bULL },
+    { 0x2ecda5f6929702efULL, 0x1f6e25a516075495ULL, 0x000000067d707bd1ULL },
+    { 0xef118c2ff53e5799ULL, 0x9b1734490c4543e3ULL, 0x00000030b0b04dbcULL },
+    { 0x3afcbd3404f270daULL, 0x9906fbff06c8b681ULL, 0x0000002be9c87762ULL },
+    { 0x3bb9e5c167661f67ULL, 0xe0d19227f257b430ULL, 0x00000016f4e27706ULL },
+    { 0x787758420466d496ULL, 0x7e358482b6f5d4e8ULL, 0x0000000199f8f826ULL },
+    { 0x7a5e705364a40ee5ULL, 0x115bdc51a19b6830ULL, 0x00000008f65ca152ULL },
+    { 0x4efe278911623dbbULL, 0xd53272047993a141ULL, 0x000000131b9f5ebbULL },
+    { 0xeaa8410a96214a92ULL, 0x6cadb0e78bbba054ULL, 0x0000002bbbb516d9ULL },
+    { 0x544a56acab1d5d89ULL, 0xd615011411acf15dULL, 0x000000329f82f802ULL },
+    { 0x97b2f33ddba3ab19ULL, 0xd8ff539c2b057b34ULL, 0x00000000a90ddcceULL },
+    { 0xc8c3a832c59f2d0dULL, 0xc1d55ea38fd0ff68ULL, 0x0000003029149916ULL },
+    { 0x44cea11294d82d1eULL, 0xfd36be11b4d68be1ULL, 0x000000054c6ebc1cULL },
+    { 0x389405e3750ee014ULL, 0x9d4e33fe5abec3b7ULL, 0x00000006bfe2d089ULL },
+    { 0xc37452f4edc7d9b3ULL, 0x9af341777cb0b90bULL, 0x000000200a763d26ULL },
+    { 0x23995d04d178a570ULL, 0xdd4605587922ab52ULL, 0x00000008fd0dbcafULL },
+    { 0x14929dfd55e019b9ULL, 0xdb5babec58cc92c9ULL, 0x00000028f25503f3ULL },
+    { 0x1dda347fc18aa8b9ULL, 0x3a4d0ef61086d4d8ULL, 0x00000038c70080dbULL },
+    { 0x33e231037ed0fb32ULL, 0x83a32d343cd5c6ebULL, 0x000000330afdd0ceULL },
+    { 0xc50135ac5b9a6386ULL, 0xfd1d15728d67ee4dULL, 0x000000301534bf72ULL },
+    { 0xf725b01770ecc8ebULL, 0x406c68054939278bULL, 0x0000001ac5dcb329ULL },
+    { 0x1212ffd9c4a5708bULL, 0x55226446255ccd45ULL, 0x000000099aca4a05ULL },
+    { 0x173441a0336fca23ULL, 0x9fee369da0afc0a8ULL, 0x000000013dd858f9ULL },
+    { 0xa2021d6bcc8419d2ULL, 0x25f38beb507ba2deULL, 0x0000003a1ecb1415ULL },
+    { 0x363288caf9dde1c6ULL, 0x9382966ad7c79de3ULL, 0x00000004ec88a5b3ULL },
+    { 0xf1a09bab7dd9bef2ULL, 0x26b11dbbdac188b0ULL, 0x00000029cf93879eULL },
+    { 0xe600354c6bacebfaULL, 0xefe26d89b7fcfd26ULL, 0x00000024d28ae2edULL },
+    { 0xd6d7ed5eeb24fec3ULL, 0x4caea7b5e02919e4ULL, 0x0000003766273cbdULL },
+    { 0x0c97e0835d9e0c91ULL, 0x9e67d491bf9b9320ULL, 0x0000002c1321c039ULL },
+    { 0x2cc165d7ab3a3280ULL, 0x64911fafa645de0bULL, 0x0000000d6a58af71ULL },
+    { 0x928f97c1c7427d10ULL, 0x0dfcb967473e5020ULL, 0x0000001a66bd6af5ULL },
+    { 0x413d180c624ea000ULL, 0xbfd7b62ae098f600ULL, 0x000000390e6505cbULL },
+    { 0x871507be4a400000ULL, 0xad4c31eebd4c86c5ULL, 0x0000002f7068e41fULL },
+    { 0x1bb1911680000000ULL, 0x2ea4e476fb4cf806ULL, 0x000000076017ce16ULL },
+    { 0x9384c10000000000ULL, 0xf7c3cbc157c3671bULL, 0x000000052a2990a6ULL },
+    { 0xda4a000000000000ULL, 0xa04f638f90f218bdULL, 0x00000026e00eeb3eULL },
+    { 0x6400000000000000ULL, 0x9f5445b5ab0a2cc2ULL, 0x0000000e94d02632ULL },
+    { 0x0000000000000000ULL, 0x4cb59565c14d8ae8ULL, 0x0000000bc954367bULL },
+    { 0x0000000000000000ULL, 0x9aa57230372b1000ULL, 0x0000001cb53b4931ULL },
+    { 0x0000000000000000ULL, 0x59d2281f9aa00000ULL, 0x0000000b8ca24cdeULL },
+    { 0x0000000000000000ULL, 0x3f4ed44240000000ULL, 0x00000033c524ea8bULL },
+    { 0x0000000000000000ULL, 0x2816c68000000000ULL, 0x000000206bc9204bULL },
+    { 0x0000000000000000ULL, 0xe1a1000000000000ULL, 0x000000117faeab14ULL },
+    { 0x0000000000000000ULL, 0x0a00000000000000ULL, 0x00000004dca04fe3ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000034dc9529e4ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000003515dbe800ULL },
+    /* 51 */
+    { 0x689391085cc2c934ULL, 0x000000000002841dULL, 0x0000000000000000ULL },
+    { 0x9cd94abdaf101565ULL, 0x000095f83d0a1fb6ULL, 0x0000000000000000ULL },
+    { 0x226db0bdd5238972ULL, 0xe3bbed90270686b4ULL, 0x00000000000022eaULL },
+    { 0x9fc7323bfadeda7fULL, 0x6b29b9c3b29620e2ULL, 0x00000036b082a67fULL },
+    { 0x38899a5e6d22f8eaULL, 0xc67672ce7919d87bULL, 0x0000001daabd9f78ULL },
+    { 0x33c3388530d28a97ULL, 0x1cb4b9ff04f8f3f7ULL, 0x0000001c1ec3fc50ULL },
+    { 0xbcf8fd1e4133c034ULL, 0x445197e92c24304eULL, 0x00000012a70e223cULL },
+    { 0xb4f405e054aba883ULL, 0x814ee1bbc309313aULL, 0x0000000e082f7500ULL },
+    { 0xc91981e8deba22e3ULL, 0x4f0499c565dd6aeeULL, 0x000000001e1b5d82ULL },
+    { 0xf1eca1c22bf51852ULL, 0xa08f1138125e44f6ULL, 0x0000001e57006a8eULL },
+    { 0xc69324bab157db9eULL, 0x2b8d0518c8b9ec85ULL, 0x00000021353e19b9ULL },
+    { 0x3a293e66a4ce715eULL, 0x0d3127bdd1deecabULL, 0x0000002b1cffcf5fULL },
+    { 0xbcf7b65b9380f1aeULL, 0x70ea683fbc279a15ULL, 0x0000001621834423ULL },
+    { 0x43f9b5a82f4f0128ULL, 0x5cf69accf335eb26ULL, 0x000000084073ea22ULL },
+    { 0x136a601f1d2c2115ULL, 0xf17d7389d23ba2b8ULL, 0x000000080033df60ULL },
+    { 0xee49453056ccd7adULL, 0x4186f6435d9a7176ULL, 0x000000169245ada5ULL },
+    { 0x93ad916c24bf6073ULL, 0x296a0eea87fe130bULL, 0x000000267a05eba6ULL },
+    { 0x5c458b597ae4d5b4ULL, 0xb6326c899b06f974ULL, 0x00000026b00377eaULL },
+    { 0x531b45e18d55cc28ULL, 0xcb267203621959c2ULL, 0x00000036a5e86d1cULL },
+    { 0x8a65c52fa7a18624ULL, 0xb39b8657c8e09d16ULL, 0x00000006b43ac9b3ULL },
+    { 0xe7e4ab5a529d2319ULL, 0xc41bdfd3ed687edeULL, 0x00000029d70caf3dULL },
+    { 0x54952ecda5f69298ULL, 0x7bd11f6e25a51607ULL, 0x0000000e618b2218ULL },
+    { 0x43e3ef118c2ff53fULL, 0x4dbc9b1734490c45ULL, 0x00000005b356ffbeULL },
+    { 0xb6813afcbd3404f3ULL, 0x77629906fbff06c8ULL, 0x0000002c4efb648aULL },
+    { 0xb4303bb9e5c16767ULL, 0x7706e0d19227f257ULL, 0x000000203d3cccc8ULL },
+    { 0xd4e8787758420467ULL, 0xf8267e358482b6f5ULL, 0x0000002eaca45ddeULL },
+    { 0x68307a5e705364a5ULL, 0xa152115bdc51a19bULL, 0x00000033ea02160cULL },
+    { 0xa1414efe27891163ULL, 0x5ebbd53272047993ULL, 0x00000002f0d0eca9ULL },
+    { 0xa054eaa8410a9622ULL, 0x16d96cadb0e78bbbULL, 0x000000276f3debe1ULL },
+    { 0xf15d544a56acab1eULL, 0xf802d615011411acULL, 0x00000034685d76deULL },
+    { 0x7b3497b2f33ddba4ULL, 0xdcced8ff539c2b05ULL, 0x00000033e9f9c8bdULL },
+    { 0xff68c8c3a832c5a0ULL, 0x9916c1d55ea38fd0ULL, 0x0000002c34b050acULL },
+    { 0x8be144cea11294d9ULL, 0xbc1cfd36be11b4d6ULL, 0x000000282fa48728ULL },
+    { 0xc3b7389405e3750fULL, 0xd0899d4e33fe5abeULL, 0x000000097bfbfc3aULL },
+    { 0xb90bc37452f4edc8ULL, 0x3d269af341777cb0ULL, 0x0000000db19f9296ULL },
+    { 0xab5223995d04d179ULL, 0xbcafdd4605587922ULL, 0x00000022faef3b2fULL },
+    { 0x92c914929dfd55e1ULL, 0x03f3db5babec58ccULL, 0x0000000b1d59b4adULL },
+    { 0xd4d81dda347fc18bULL, 0x80db3a4d0ef61086ULL, 0x000000284886195eULL },
+    { 0xc6eb33e231037ed1ULL, 0xd0ce83a32d343cd5ULL, 0x0000001600d69bfdULL },
+    { 0xee4dc50135ac5b9bULL, 0xbf72fd1d15728d67ULL, 0x0000003b18977b54ULL },
+    { 0x278bf725b01770edULL, 0xb329406c68054939ULL, 0x00000013bb5d8a92ULL },
+    { 0xcd451212ffd9c4a6ULL, 0x4a0555226446255cULL, 0x0000002227fe0a08ULL },
+    { 0xc0a8173441a03370ULL, 0x58f99fee369da0afULL, 0x00000001ee124c3cULL },
+    { 0xa2dea2021d6bcc85ULL, 0x141525f38beb507bULL, 0x0000000e0cfeac3bULL },
+    { 0x9de3363288caf9deULL, 0xa5b39382966ad7c7ULL, 0x0000000dc1599250ULL },
+    { 0x88b0f1a09bab7ddaULL, 0x879e26b11dbbdac1ULL, 0x00000012c6f3b3c5ULL },
+    { 0xfd26e600354c6badULL, 0xe2edefe26d89b7fcULL, 0x0000002dfdb0e510ULL },
+    { 0x19e4d6d7ed5eeb25ULL, 0x3cbd4caea7b5e029ULL, 0x00000003ee82ac7bULL },
+    { 0x93200c97e0835d9fULL, 0xc0399e67d491bf9bULL, 0x0000001cb1836879ULL },
+    { 0xde0b2cc165d7ab3bULL, 0xaf7164911fafa645ULL, 0x0000001c58eafbd8ULL },
+    { 0x5020928f97c1c743ULL, 0x6af50dfcb967473eULL, 0x000000327373a6d3ULL },
+    { 0xf600413d180c624fULL, 0x05cbbfd7b62ae098ULL, 0x00000031397ba409ULL },
+    { 0x86c5871507be4a40ULL, 0xe41fad4c31eebd4cULL, 0x0000000219ca905aULL },
+    { 0xf8061bb191168000ULL, 0xce162ea4e476fb4cULL, 0x0000001529883fffULL },
+    { 0x671b9384c1000000ULL, 0x90a6f7c3cbc157c3ULL, 0x0000003b8f2aeeb5ULL },
+    { 0x18bdda4a00000000ULL, 0xeb3ea04f638f90f2ULL, 0x0000002a461ec3aeULL },
+    { 0x2cc2640000000000ULL, 0x26329f5445b5ab0aULL, 0x00000028b9faf83eULL },
+    { 0x8ae8000000000000ULL, 0x367b4cb59565c14dULL, 0x0000000e7861af50ULL },
+    { 0x1000000000000000ULL, 0x49319aa57230372bULL, 0x00000012ad0e7bd7ULL },
+    { 0x0000000000000000ULL, 0x4cde59d2281f9aa0ULL, 0x00000032200a563cULL },
+    { 0x0000000000000000ULL, 0xea8b3f4ed4424000ULL, 0x0000000e0a2d111cULL },
+    { 0x0000000000000000ULL, 0x204b2816c6800000ULL, 0x00000006bb8a006dULL },
+    { 0x0000000000000000ULL, 0xab14e1a100000000ULL, 0x00000019686cdaeeULL },
+    { 0x0000000000000000ULL, 0x4fe30a0000000000ULL, 0x0000003791bd0d8eULL },
+    { 0x0000000000000000ULL, 0x29e4000000000000ULL, 0x000000212275acebULL },
+    { 0x0000000000000000ULL, 0xe800000000000000ULL, 0x00000036c0d84e35ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000c8d101910ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000003b9aca000ULL },
+    /* 52 */
+    { 0x1fb69cd94abdaf11ULL, 0x0000000095f83d0aULL, 0x0000000000000000ULL },
+    { 0x86b4226db0bdd524ULL, 0x22eae3bbed902706ULL, 0x0000000000000000ULL },
+    { 0x20e29fc7323bfadfULL, 0xa67f6b29b9c3b296ULL, 0x0000000008213f56ULL },
+    { 0xd87b38899a5e6d23ULL, 0x9f78c67672ce7919ULL, 0x000000142cc3e5b9ULL },
+    { 0xf3f733c3388530d3ULL, 0xfc501cb4b9ff04f8ULL, 0x0000002b37fd3c39ULL },
+    { 0x304ebcf8fd1e4134ULL, 0x223c445197e92c24ULL, 0x0000000d8035ffe6ULL },
+    { 0x313ab4f405e054acULL, 0x7500814ee1bbc309ULL, 0x00000035950a1303ULL },
+    { 0x6aeec91981e8debbULL, 0x5d824f0499c565ddULL, 0x00000000ce0e3a6dULL },
+    { 0x44f6f1eca1c22bf6ULL, 0x6a8ea08f1138125eULL, 0x0000001976ad9462ULL },
+    { 0xec85c69324bab158ULL, 0x19b92b8d0518c8b9ULL, 0x00000016ea10a0e2ULL },
+    { 0xecab3a293e66a4cfULL, 0xcf5f0d3127bdd1deULL, 0x00000034a4a38eb9ULL },
+    { 0x9a15bcf7b65b9381ULL, 0x442370ea683fbc27ULL, 0x0000002b432444d9ULL },
+    { 0xeb2643f9b5a82f50ULL, 0xea225cf69accf335ULL, 0x000000329612981bULL },
+    { 0xa2b8136a601f1d2dULL, 0xdf60f17d7389d23bULL, 0x000000067fd6cad7ULL },
+    { 0x7176ee49453056cdULL, 0xada54186f6435d9aULL, 0x0000003243020e3bULL },
+    { 0x130b93ad916c24c0ULL, 0xeba6296a0eea87feULL, 0x0000000de51aa287ULL },
+    { 0xf9745c458b597ae5ULL, 0x77eab6326c899b06ULL, 0x0000001fa57e4d71ULL },
+    { 0x59c2531b45e18d56ULL, 0x6d1ccb2672036219ULL, 0x0000001a6b3ec3ceULL },
+    { 0x9d168a65c52fa7a2ULL, 0xc9b3b39b8657c8e0ULL, 0x000000300ff6283cULL },
+    { 0x7edee7e4ab5a529eULL, 0xaf3dc41bdfd3ed68ULL, 0x0000000e273db7a6ULL },
+    { 0x160754952ecda5f7ULL, 0x22187bd11f6e25a5ULL, 0x00000026cf2c2da1ULL },
+    { 0x0c4543e3ef118c30ULL, 0xffbe4dbc9b173449ULL, 0x0000002584494c2aULL },
+    { 0x06c8b6813afcbd35ULL, 0x648a77629906fbffULL, 0x0000000a02f0a231ULL },
+    { 0xf257b4303bb9e5c2ULL, 0xccc87706e0d19227ULL, 0x0000000b80095e24ULL },
+    { 0xb6f5d4e878775843ULL, 0x5ddef8267e358482ULL, 0x0000000891726d9cULL },
+    { 0xa19b68307a5e7054ULL, 0x160ca152115bdc51ULL, 0x00000024682e3d64ULL },
+    { 0x7993a1414efe278aULL, 0xeca95ebbd5327204ULL, 0x000000174d99262cULL },
+    { 0x8bbba054eaa8410bULL, 0xebe116d96cadb0e7ULL, 0x0000000a75b4d975ULL },
+    { 0x11acf15d544a56adULL, 0x76def802d6150114ULL, 0x0000001b74a9d1cbULL },
+    { 0x2b057b3497b2f33eULL, 0xc8bddcced8ff539cULL, 0x0000002f5f6b7115ULL },
+    { 0x8fd0ff68c8c3a833ULL, 0x50ac9916c1d55ea3ULL, 0x00000005126fb480ULL },
+    { 0xb4d68be144cea113ULL, 0x8728bc1cfd36be11ULL, 0x0000001de02d8ec4ULL },
+    { 0x5abec3b7389405e4ULL, 0xfc3ad0899d4e33feULL, 0x0000002dc1fac481ULL },
+    { 0x7cb0b90bc37452f5ULL, 0x92963d269af34177ULL, 0x0000001e43b9da77ULL },
+    { 0x7922ab5223995d05ULL, 0x3b2fbcafdd460558ULL, 0x0000001bd7152823ULL },
+    { 0x58cc92c914929dfeULL, 0xb4ad03f3db5babecULL, 0x0000000833f167e7ULL },
+    { 0x1086d4d81dda3480ULL, 0x195e80db3a4d0ef6ULL, 0x00000035f2bd648eULL },
+    { 0x3cd5c6eb33e23104ULL, 0x9bfdd0ce83a32d34ULL, 0x0000002115c42a90ULL },
+    { 0x8d67ee4dc50135adULL, 0x7b54bf72fd1d1572ULL, 0x00000021ab6370e5ULL },
+    { 0x4939278bf725b018ULL, 0x8a92b329406c6805ULL, 0x000000356e2dcc6bULL },
+    { 0x255ccd451212ffdaULL, 0x0a084a0555226446ULL, 0x0000001909f606e2ULL },
+    { 0xa0afc0a8173441a1ULL, 0x4c3c58f99fee369dULL, 0x00000034a0fc4df6ULL },
+    { 0x507ba2dea2021d6cULL, 0xac3b141525f38bebULL, 0x00000039587e1cf6ULL },
+    { 0xd7c79de3363288cbULL, 0x9250a5b39382966aULL, 0x000000396ed7dd11ULL },
+    { 0xdac188b0f1a09bacULL, 0xb3c5879e26b11dbbULL, 0x0000000417587827ULL },
+    { 0xb7fcfd26e600354dULL, 0xe510e2edefe26d89ULL, 0x000000093e6ffeeeULL },
+    { 0xe02919e4d6d7ed5fULL, 0xac7b3cbd4caea7b5ULL, 0x000000379f3d3134ULL },
+    { 0xbf9b93200c97e084ULL, 0x6879c0399e67d491ULL, 0x0000000c4399b93bULL },
+    { 0xa645de0b2cc165d8ULL, 0xfbd8af7164911fafULL, 0x0000000dd4ffc8faULL },
+    { 0x473e5020928f97c2ULL, 0xa6d36af50dfcb967ULL, 0x0000003a6fcc7b81ULL },
+    { 0xe098f600413d180dULL, 0xa40905cbbfd7b62aULL, 0x0000001e2fd76277ULL },
+    { 0xbd4c86c5871507bfULL, 0x905ae41fad4c31eeULL, 0x0000001bdb252932ULL },
+    { 0xfb4cf8061bb19117ULL, 0x3fffce162ea4e476ULL, 0x0000000bc5d7af28ULL },
+    { 0x57c3671b9384c100ULL, 0xeeb590a6f7c3cbc1ULL, 0x000000095f1636e0ULL },
+    { 0x90f218bdda4a0000ULL, 0xc3aeeb3ea04f638fULL, 0x000000345f04edeaULL },
+    { 0xab0a2cc264000000ULL, 0xf83e26329f5445b5ULL, 0x00000036a90c45d8ULL },
+    { 0xc14d8ae800000000ULL, 0xaf50367b4cb59565ULL, 0x000000328466dc11ULL },
+    { 0x372b100000000000ULL, 0x7bd749319aa57230ULL, 0x000000041e18e724ULL },
+    { 0x9aa0000000000000ULL, 0x563c4cde59d2281fULL, 0x000000087e99e718ULL },
+    { 0x4000000000000000ULL, 0x111cea8b3f4ed442ULL, 0x00000005aa96fa09ULL },
+    { 0x0000000000000000ULL, 0x006d204b2816c680ULL, 0x000000021c6d1cf4ULL },
+    { 0x0000000000000000ULL, 0xdaeeab14e1a10000ULL, 0x00000038cfa1f06cULL },
+    { 0x0000000000000000ULL, 0x0d8e4fe30a000000ULL, 0x00000019584699c1ULL },
+    { 0x0000000000000000ULL, 0xaceb29e400000000ULL, 0x0000002cf2da48b7ULL },
+    { 0x0000000000000000ULL, 0x4e35e80000000000ULL, 0x0000002ac3e92690ULL },
+    { 0x0000000000000000ULL, 0x1910000000000000ULL, 0x000000219947569cULL },
+    { 0x0000000000000000ULL, 0xa000000000000000ULL, 0x000000245828ef66ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000017e4ed3a40ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000ee6b28000ULL },
+    /* 53 */
+    { 0x3d0a1fb69cd94abeULL, 0x00000000000095f8ULL, 0x0000000000000000ULL },
+    { 0x270686b4226db0beULL, 0x000022eae3bbed90ULL, 0x0000000000000000ULL },
+    { 0xb29620e29fc7323cULL, 0x3f56a67f6b29b9c3ULL, 0x0000000000000821ULL },
+    { 0x7919d87b38899a5fULL, 0xe5b99f78c67672ceULL, 0x00000007bdb34e79ULL },
+    { 0x04f8f3f733c33886ULL, 0x3c39fc501cb4b9ffULL, 0x0000001c61a628afULL },
+    { 0x2c24304ebcf8fd1fULL, 0xffe6223c445197e9ULL, 0x00000028ccd5dd8dULL },
+    { 0xc309313ab4f405e1ULL, 0x13037500814ee1bbULL, 0x000000210fd60640ULL },
+    { 0x65dd6aeec91981e9ULL, 0x3a6d5d824f0499c5ULL, 0x0000000eeb1fcb0cULL },
+    { 0x125e44f6f1eca1c3ULL, 0x94626a8ea08f1138ULL, 0x00000002d8dc0071ULL },
+    { 0xc8b9ec85c69324bbULL, 0xa0e219b92b8d0518ULL, 0x0000001a71df90d8ULL },
+    { 0xd1deecab3a293e67ULL, 0x8eb9cf5f0d3127bdULL, 0x00000032700fd2e3ULL },
+    { 0xbc279a15bcf7b65cULL, 0x44d9442370ea683fULL, 0x00000034fb7c3d30ULL },
+    { 0xf335eb2643f9b5a9ULL, 0x981bea225cf69accULL, 0x0000000b3d0d93baULL },
+    { 0xd23ba2b8136a6020ULL, 0xcad7df60f17d7389ULL, 0x0000002b71e12bc6ULL },
+    { 0x5d9a7176ee494531ULL, 0x0e3bada54186f643ULL, 0x0000002e48f2a266ULL },
+    { 0x87fe130b93ad916dULL, 0xa287eba6296a0eeaULL, 0x00000017c2fcd826ULL },
+    { 0x9b06f9745c458b5aULL, 0x4d7177eab6326c89ULL, 0x00000008fed19552ULL },
+    { 0x621959c2531b45e2ULL, 0xc3ce6d1ccb267203ULL, 0x00000013299cae00ULL },
+    { 0xc8e09d168a65c530ULL, 0x283cc9b3b39b8657ULL, 0x000000002d96f7d4ULL },
+    { 0xed687edee7e4ab5bULL, 0xb7a6af3dc41bdfd3ULL, 0x00000031658d9ecdULL },
+    { 0x25a5160754952eceULL, 0x2da122187bd11f6eULL, 0x0000002fe5b63792ULL },
+    { 0x34490c4543e3ef12ULL, 0x4c2affbe4dbc9b17ULL, 0x0000002208e6edcbULL },
+    { 0xfbff06c8b6813afdULL, 0xa231648a77629906ULL, 0x0000002f557a24e8ULL },
+    { 0x9227f257b4303bbaULL, 0x5e24ccc87706e0d1ULL, 0x000000362a0a83ddULL },
+    { 0x8482b6f5d4e87878ULL, 0x6d9c5ddef8267e35ULL, 0x000000338a8bc99eULL },
+    { 0xdc51a19b68307a5fULL, 0x3d64160ca152115bULL, 0x00000024e30dfc30ULL },
+    { 0x72047993a1414effULL, 0x262ceca95ebbd532ULL, 0x0000000b3b510fbbULL },
+    { 0xb0e78bbba054eaa9ULL, 0xd975ebe116d96cadULL, 0x0000002b92f4fdb0ULL },
+    { 0x011411acf15d544bULL, 0xd1cb76def802d615ULL, 0x000000292d0c89e3ULL },
+    { 0x539c2b057b3497b3ULL, 0x7115c8bddcced8ffULL, 0x000000350b19dc55ULL },
+    { 0x5ea38fd0ff68c8c4ULL, 0xb48050ac9916c1d5ULL, 0x00000013e4b97799ULL },
+    { 0xbe11b4d68be144cfULL, 0x8ec48728bc1cfd36ULL, 0x00000023c9897035ULL },
+    { 0x33fe5abec3b73895ULL, 0xc481fc3ad0899d4eULL, 0x0000000c78497006ULL },
+    { 0x41777cb0b90bc375ULL, 0xda7792963d269af3ULL, 0x0000000193618261ULL },
+    { 0x05587922ab52239aULL, 0x28233b2fbcafdd46ULL, 0x00000016c8843119ULL },
+    { 0xabec58cc92c91493ULL, 0x67e7b4ad03f3db5bULL, 0x00000005db761d81ULL },
+    { 0x0ef61086d4d81ddbULL, 0x648e195e80db3a4dULL, 0x0000001e21310403ULL },
+    { 0x2d343cd5c6eb33e3ULL, 0x2a909bfdd0ce83a3ULL, 0x00000000ca39eaacULL },
+    { 0x15728d67ee4dc502ULL, 0x70e57b54bf72fd1dULL, 0x0000002815e8c887ULL },
+    { 0x68054939278bf726ULL, 0xcc6b8a92b329406cULL, 0x0000001f88e9ac8dULL },
+    { 0x6446255ccd451213ULL, 0x06e20a084a055522ULL, 0x0000002103d9a4eeULL },
+    { 0x369da0afc0a81735ULL, 0x4df64c3c58f99feeULL, 0x000000376b820db8ULL },
+    { 0x8beb507ba2dea203ULL, 0x1cf6ac3b141525f3ULL, 0x0000002ae9681740ULL },
+    { 0x966ad7c79de33633ULL, 0xdd119250a5b39382ULL, 0x0000000eed70dcefULL },
+    { 0x1dbbdac188b0f1a1ULL, 0x7827b3c5879e26b1ULL, 0x00000037d8fb4dbaULL },
+    { 0x6d89b7fcfd26e601ULL, 0xfeeee510e2edefe2ULL, 0x0000002b6a70911fULL },
+    { 0xa7b5e02919e4d6d8ULL, 0x3134ac7b3cbd4caeULL, 0x000000077319a9a9ULL },
+    { 0xd491bf9b93200c98ULL, 0xb93b6879c0399e67ULL, 0x0000002764a43e43ULL },
+    { 0x1fafa645de0b2cc2ULL, 0xc8fafbd8af716491ULL, 0x0000000fc4a38ef9ULL },
+    { 0xb967473e50209290ULL, 0x7b81a6d36af50dfcULL, 0x0000003a2859d79cULL },
+    { 0xb62ae098f600413eULL, 0x6277a40905cbbfd7ULL, 0x000000246f14a6e5ULL },
+    { 0x31eebd4c86c58716ULL, 0x2932905ae41fad4cULL, 0x000000356863ce79ULL },
+    { 0xe476fb4cf8061bb2ULL, 0xaf283fffce162ea4ULL, 0x0000001c35c10a31ULL },
+    { 0xcbc157c3671b9385ULL, 0x36e0eeb590a6f7c3ULL, 0x0000000b9168d92cULL },
+    { 0x638f90f218bdda4aULL, 0xedeac3aeeb3ea04fULL, 0x0000000a4b61bda0ULL },
+    { 0x45b5ab0a2cc26400ULL, 0x45d8f83e26329f54ULL, 0x000000257823360eULL },
+    { 0x9565c14d8ae80000ULL, 0xdc11af50367b4cb5ULL, 0x0000000352ba48d8ULL },
+    { 0x7230372b10000000ULL, 0xe7247bd749319aa5ULL, 0x000000327dd793b0ULL },
+    { 0x281f9aa000000000ULL, 0xe718563c4cde59d2ULL, 0x00000029303c0adfULL },
+    { 0xd442400000000000ULL, 0xfa09111cea8b3f4eULL, 0x0000003421a44cdcULL },
+    { 0xc680000000000000ULL, 0x1cf4006d204b2816ULL, 0x00000033733cddb1ULL },
+    { 0x0000000000000000ULL, 0xf06cdaeeab14e1a1ULL, 0x000000293cc367b9ULL },
+    { 0x0000000000000000ULL, 0x99c10d8e4fe30a00ULL, 0x0000002b4ad66fa6ULL },
+    { 0x0000000000000000ULL, 0x48b7aceb29e40000ULL, 0x00000026ca2b7194ULL },
+    { 0x0000000000000000ULL, 0x26904e35e8000000ULL, 0x00000022866b14b9ULL },
+    { 0x0000000000000000ULL, 0x569c191000000000ULL, 0x0000002b1bd68d43ULL },
+    { 0x0000000000000000ULL, 0xef66a00000000000ULL, 0x0000000fadad3604ULL },
+    { 0x0000000000000000ULL, 0x3a40000000000000ULL, 0x0000000126288f83ULL },
+    { 0x0000000000000000ULL, 0x8000000000000000ULL, 0x0000001e8dc55676ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001b97268100ULL },
+    /* 54 */
+    { 0xed90270686b4226eULL, 0x0000000022eae3bbULL, 0x0000000000000000ULL },
+    { 0xb9c3b29620e29fc8ULL, 0x08213f56a67f6b29ULL, 0x0000000000000000ULL },
+    { 0x72ce7919d87b388aULL, 0x4e79e5b99f78c676ULL, 0x0000000001e49403ULL },
+    { 0xb9ff04f8f3f733c4ULL, 0x28af3c39fc501cb4ULL, 0x00000000c515e932ULL },
+    { 0x97e92c24304ebcf9ULL, 0xdd8dffe6223c4451ULL, 0x0000000badb47065ULL },
+    { 0xe1bbc309313ab4f5ULL, 0x064013037500814eULL, 0x00000017b7a76238ULL },
+    { 0x99c565dd6aeec91aULL, 0xcb0c3a6d5d824f04ULL, 0x0000000d0b50bbdbULL },
+    { 0x1138125e44f6f1edULL, 0x007194626a8ea08fULL, 0x000000332cb1650aULL },
+    { 0x0518c8b9ec85c694ULL, 0x90d8a0e219b92b8dULL, 0x00000002542655dfULL },
+    { 0x27bdd1deecab3a2aULL, 0xd2e38eb9cf5f0d31ULL, 0x000000340d8f77afULL },
+    { 0x683fbc279a15bcf8ULL, 0x3d3044d9442370eaULL, 0x00000028efea0b30ULL },
+    { 0x9accf335eb2643faULL, 0x93ba981bea225cf6ULL, 0x0000000b3b44ff2fULL },
+    { 0x7389d23ba2b8136bULL, 0x2bc6cad7df60f17dULL, 0x0000000b13d069dfULL },
+    { 0xf6435d9a7176ee4aULL, 0xa2660e3bada54186ULL, 0x00000033f6073ee0ULL },
+    { 0x0eea87fe130b93aeULL, 0xd826a287eba6296aULL, 0x000000344d4076d0ULL },
+    { 0x6c899b06f9745c46ULL, 0x95524d7177eab632ULL, 0x00000030a017b941ULL },
+    { 0x7203621959c2531cULL, 0xae00c3ce6d1ccb26ULL, 0x0000000f45118b2eULL },
+    { 0x8657c8e09d168a66ULL, 0xf7d4283cc9b3b39bULL, 0x0000000ade53aee2ULL },
+    { 0xdfd3ed687edee7e5ULL, 0x9ecdb7a6af3dc41bULL, 0x00000034d85a1273ULL },
+    { 0x1f6e25a516075496ULL, 0x37922da122187bd1ULL, 0x0000001aeb822c62ULL },
+    { 0x9b1734490c4543e4ULL, 0xedcb4c2affbe4dbcULL, 0x00000016de319e4cULL },
+    { 0x9906fbff06c8b682ULL, 0x24e8a231648a7762ULL, 0x00000011e9519a7cULL },
+    { 0xe0d19227f257b431ULL, 0x83dd5e24ccc87706ULL, 0x0000001ce791c672ULL },
+    { 0x7e358482b6f5d4e9ULL, 0xc99e6d9c5ddef826ULL, 0x0000001aa9a1b3e9ULL },
+    { 0x115bdc51a19b6831ULL, 0xfc303d64160ca152ULL, 0x000000366ed345a7ULL },
+    { 0xd53272047993a142ULL, 0x0fbb262ceca95ebbULL, 0x000000271cb16029ULL },
+    { 0x6cadb0e78bbba055ULL, 0xfdb0d975ebe116d9ULL, 0x000000098f73fecaULL },
+    { 0xd615011411acf15eULL, 0x89e3d1cb76def802ULL, 0x0000002f43348aaeULL },
+    { 0xd8ff539c2b057b35ULL, 0xdc557115c8bddcceULL, 0x00000028a3502d33ULL },
+    { 0xc1d55ea38fd0ff69ULL, 0x7799b48050ac9916ULL, 0x0000000c13232851ULL },
+    { 0xfd36be11b4d68be2ULL, 0x70358ec48728bc1cULL, 0x00000012f7d2a76fULL },
+    { 0x9d4e33fe5abec3b8ULL, 0x7006c481fc3ad089ULL, 0x00000019f23dc6a9ULL },
+    { 0x9af341777cb0b90cULL, 0x8261da7792963d26ULL, 0x000000277344a5c1ULL },
+    { 0xdd4605587922ab53ULL, 0x311928233b2fbcafULL, 0x0000002d0e0dad18ULL },
+    { 0xdb5babec58cc92caULL, 0x1d8167e7b4ad03f3ULL, 0x00000005a1f16c20ULL },
+    { 0x3a4d0ef61086d4d9ULL, 0x0403648e195e80dbULL, 0x000000077a37ea13ULL },
+    { 0x83a32d343cd5c6ecULL, 0xeaac2a909bfdd0ceULL, 0x000000046d6c3361ULL },
+    { 0xfd1d15728d67ee4eULL, 0xc88770e57b54bf72ULL, 0x00000016cc4a1c8cULL },
+    { 0x406c68054939278cULL, 0xac8dcc6b8a92b329ULL, 0x00000020c756eeb9ULL },
+    { 0x55226446255ccd46ULL, 0xa4ee06e20a084a05ULL, 0x0000002b3b08fd91ULL },
+    { 0x9fee369da0afc0a9ULL, 0x0db84df64c3c58f9ULL, 0x00000021e912feeaULL },
+    { 0x25f38beb507ba2dfULL, 0x17401cf6ac3b1415ULL, 0x000000367eae69aaULL },
+    { 0x9382966ad7c79de4ULL, 0xdcefdd119250a5b3ULL, 0x000000279a33f996ULL },
+    { 0x26b11dbbdac188b1ULL, 0x4dba7827b3c5879eULL, 0x0000002320233a93ULL },
+    { 0xefe26d89b7fcfd27ULL, 0x911ffeeee510e2edULL, 0x000000224bfaf732ULL },
+    { 0x4caea7b5e02919e5ULL, 0xa9a93134ac7b3cbdULL, 0x0000000bc6059383ULL },
+    { 0x9e67d491bf9b9321ULL, 0x3e43b93b6879c039ULL, 0x0000001ea7b5f1feULL },
+    { 0x64911fafa645de0cULL, 0x8ef9c8fafbd8af71ULL, 0x0000003b3213ad8fULL },
+    { 0x0dfcb967473e5021ULL, 0xd79c7b81a6d36af5ULL, 0x000000216cc0da65ULL },
+    { 0xbfd7b62ae098f601ULL, 0xa6e56277a40905cbULL, 0x00000017b64520baULL },
+    { 0xad4c31eebd4c86c6ULL, 0xce792932905ae41fULL, 0x0000002b75528b5fULL },
+    { 0x2ea4e476fb4cf807ULL, 0x0a31af283fffce16ULL, 0x000000164e83ba4dULL },
+    { 0xf7c3cbc157c3671cULL, 0xd92c36e0eeb590a6ULL, 0x00000011efee5f4cULL },
+    { 0xa04f638f90f218beULL, 0xbda0edeac3aeeb3eULL, 0x00000011e484789bULL },
+    { 0x9f5445b5ab0a2cc3ULL, 0x360e45d8f83e2632ULL, 0x0000002442df0d45ULL },
+    { 0x4cb59565c14d8ae8ULL, 0x48d8dc11af50367bULL, 0x000000101d4e6b56ULL },
+    { 0x9aa57230372b1000ULL, 0x93b0e7247bd74931ULL, 0x0000001416f5e2a7ULL },
+    { 0x59d2281f9aa00000ULL, 0x0adfe718563c4cdeULL, 0x00000027045cd83aULL },
+    { 0x3f4ed44240000000ULL, 0x4cdcfa09111cea8bULL, 0x0000000d8399f188ULL },
+    { 0x2816c68000000000ULL, 0xddb11cf4006d204bULL, 0x0000001fbc20b734ULL },
+    { 0xe1a1000000000000ULL, 0x67b9f06cdaeeab14ULL, 0x0000000c4f0ee525ULL },
+    { 0x0a00000000000000ULL, 0x6fa699c10d8e4fe3ULL, 0x00000008b585c41cULL },
+    { 0x0000000000000000ULL, 0x719448b7aceb29e4ULL, 0x000000069eecffc1ULL },
+    { 0x0000000000000000ULL, 0x14b926904e35e800ULL, 0x0000002d0a242395ULL },
+    { 0x0000000000000000ULL, 0x8d43569c19100000ULL, 0x00000022b5eac59eULL },
+    { 0x0000000000000000ULL, 0x3604ef66a0000000ULL, 0x00000024ea6c9aefULL },
+    { 0x0000000000000000ULL, 0x8f833a4000000000ULL, 0x00000037b21662c4ULL },
+    { 0x0000000000000000ULL, 0x5676800000000000ULL, 0x0000002dc3ecac9bULL },
+    { 0x0000000000000000ULL, 0x8100000000000000ULL, 0x000000242ad9e502ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000000953e93caULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002f08236400ULL },
+    /* 55 */
+    { 0xe3bbed90270686b5ULL, 0x00000000000022eaULL, 0x0000000000000000ULL },
+    { 0x6b29b9c3b29620e3ULL, 0x000008213f56a67fULL, 0x0000000000000000ULL },
+    { 0xc67672ce7919d87cULL, 0x94034e79e5b99f78ULL, 0x00000000000001e4ULL },
+    { 0x1cb4b9ff04f8f3f8ULL, 0xe93228af3c39fc50ULL, 0x00000035385229ddULL },
+    { 0x445197e92c24304fULL, 0x7065dd8dffe6223cULL, 0x00000033aaebf18eULL },
+    { 0x814ee1bbc309313bULL, 0x6238064013037500ULL, 0x000000212a077c07ULL },
+    { 0x4f0499c565dd6aefULL, 0xbbdbcb0c3a6d5d82ULL, 0x00000001b819d2a4ULL },
+    { 0xa08f1138125e44f7ULL, 0x650a007194626a8eULL, 0x000000265ae6a63fULL },
+    { 0x2b8d0518c8b9ec86ULL, 0x55df90d8a0e219b9ULL, 0x0000000ec29e1bd8ULL },
+    { 0x0d3127bdd1deecacULL, 0x77afd2e38eb9cf5fULL, 0x000000325e98e2a1ULL },
+    { 0x70ea683fbc279a16ULL, 0x0b303d3044d94423ULL, 0x000000259836edd0ULL },
+    { 0x5cf69accf335eb27ULL, 0xff2f93ba981bea22ULL, 0x00000030705f01f2ULL },
+    { 0xf17d7389d23ba2b9ULL, 0x69df2bc6cad7df60ULL, 0x0000003893bd3706ULL },
+    { 0x4186f6435d9a7177ULL, 0x3ee0a2660e3bada5ULL, 0x000000017e472ee1ULL },
+    { 0x296a0eea87fe130cULL, 0x76d0d826a287eba6ULL, 0x0000003471af542cULL },
+    { 0xb6326c899b06f975ULL, 0xb94195524d7177eaULL, 0x0000000a5a44b133ULL },
+    { 0xcb267203621959c3ULL, 0x8b2eae00c3ce6d1cULL, 0x0000000c0af85f0bULL },
+    { 0xb39b8657c8e09d17ULL, 0xaee2f7d4283cc9b3ULL, 0x00000002b00e9801ULL },
+    { 0xc41bdfd3ed687edfULL, 0x12739ecdb7a6af3dULL, 0x000000006452d7a6ULL },
+    { 0x7bd11f6e25a51608ULL, 0x2c6237922da12218ULL, 0x00000026aaaac9b6ULL },
+    { 0x4dbc9b1734490c46ULL, 0x9e4cedcb4c2affbeULL, 0x0000002a6a6114e9ULL },
+    { 0x77629906fbff06c9ULL, 0x9a7c24e8a231648aULL, 0x0000003664bd4bfdULL },
+    { 0x7706e0d19227f258ULL, 0xc67283dd5e24ccc8ULL, 0x0000003b0bf1a715ULL },
+    { 0xf8267e358482b6f6ULL, 0xb3e9c99e6d9c5ddeULL, 0x0000000511e6f3ddULL },
+    { 0xa152115bdc51a19cULL, 0x45a7fc303d64160cULL, 0x000000339e840c11ULL },
+    { 0x5ebbd53272047994ULL, 0x60290fbb262ceca9ULL, 0x00000004057f3f23ULL },
+    { 0x16d96cadb0e78bbcULL, 0xfecafdb0d975ebe1ULL, 0x000000083c8d3933ULL },
+    { 0xf802d615011411adULL, 0x8aae89e3d1cb76deULL, 0x0000000c1b2915a0ULL },
+    { 0xdcced8ff539c2b06ULL, 0x2d33dc557115c8bdULL, 0x0000002561085434ULL },
+    { 0x9916c1d55ea38fd1ULL, 0x28517799b48050acULL, 0x0000000c25f750a5ULL },
+    { 0xbc1cfd36be11b4d7ULL, 0xa76f70358ec48728ULL, 0x0000002674275962ULL },
+    { 0xd0899d4e33fe5abfULL, 0xc6a97006c481fc3aULL, 0x00000016f83d4003ULL },
+    { 0x3d269af341777cb1ULL, 0xa5c18261da779296ULL, 0x00000000e1118980ULL },
+    { 0xbcafdd4605587923ULL, 0xad18311928233b2fULL, 0x0000001df3fcd23fULL },
+    { 0x03f3db5babec58cdULL, 0x6c201d8167e7b4adULL, 0x0000000ed364f273ULL },
+    { 0x80db3a4d0ef61087ULL, 0xea130403648e195eULL, 0x0000001adfb5856fULL },
+    { 0xd0ce83a32d343cd6ULL, 0x3361eaac2a909bfdULL, 0x0000001a0e9d8010ULL },
+    { 0xbf72fd1d15728d68ULL, 0x1c8cc88770e57b54ULL, 0x00000003c5a34288ULL },
+    { 0xb329406c6805493aULL, 0xeeb9ac8dcc6b8a92ULL, 0x0000001fb0e1056eULL },
+    { 0x4a0555226446255dULL, 0xfd91a4ee06e20a08ULL, 0x00000019d417eed4ULL },
+    { 0x58f99fee369da0b0ULL, 0xfeea0db84df64c3cULL, 0x0000003197392ab4ULL },
+    { 0x141525f38beb507cULL, 0x69aa17401cf6ac3bULL, 0x0000002a24301b1aULL },
+    { 0xa5b39382966ad7c8ULL, 0xf996dcefdd119250ULL, 0x0000000626529b0dULL },
+    { 0x879e26b11dbbdac2ULL, 0x3a934dba7827b3c5ULL, 0x0000000340f8f09dULL },
+    { 0xe2edefe26d89b7fdULL, 0xf732911ffeeee510ULL, 0x000000249b913fbeULL },
+    { 0x3cbd4caea7b5e02aULL, 0x9383a9a93134ac7bULL, 0x0000002c76700aebULL },
+    { 0xc0399e67d491bf9cULL, 0xf1fe3e43b93b6879ULL, 0x00000036d96ff7b3ULL },
+    { 0xaf7164911fafa646ULL, 0xad8f8ef9c8fafbd8ULL, 0x00000029e593283dULL },
+    { 0x6af50dfcb967473fULL, 0xda65d79c7b81a6d3ULL, 0x0000000e5c4b2942ULL },
+    { 0x05cbbfd7b62ae099ULL, 0x20baa6e56277a409ULL, 0x0000000f90c19a49ULL },
+    { 0xe41fad4c31eebd4dULL, 0x8b5fce792932905aULL, 0x0000001106c26892ULL },
+    { 0xce162ea4e476fb4dULL, 0xba4d0a31af283fffULL, 0x000000221eba8e31ULL },
+    { 0x90a6f7c3cbc157c4ULL, 0x5f4cd92c36e0eeb5ULL, 0x0000000b940110b2ULL },
+    { 0xeb3ea04f638f90f3ULL, 0x789bbda0edeac3aeULL, 0x0000002987d0c97aULL },
+    { 0x26329f5445b5ab0bULL, 0x0d45360e45d8f83eULL, 0x0000001c83d9158fULL },
+    { 0x367b4cb59565c14eULL, 0x6b5648d8dc11af50ULL, 0x000000214e8dcf90ULL },
+    { 0x49319aa57230372cULL, 0xe2a793b0e7247bd7ULL, 0x00000021a00f6963ULL },
+    { 0x4cde59d2281f9aa0ULL, 0xd83a0adfe718563cULL, 0x0000001741a1c8b0ULL },
+    { 0xea8b3f4ed4424000ULL, 0xf1884cdcfa09111cULL, 0x000000292cc2fe09ULL },
+    { 0x204b2816c6800000ULL, 0xb734ddb11cf4006dULL, 0x0000000250ad8e4aULL },
+    { 0xab14e1a100000000ULL, 0xe52567b9f06cdaeeULL, 0x0000001165665974ULL },
+    { 0x4fe30a0000000000ULL, 0xc41c6fa699c10d8eULL, 0x0000001b377db437ULL },
+    { 0x29e4000000000000ULL, 0xffc1719448b7acebULL, 0x0000000cfbea8794ULL },
+    { 0xe800000000000000ULL, 0x239514b926904e35ULL, 0x00000022b109015aULL },
+    { 0x0000000000000000ULL, 0xc59e8d43569c1910ULL, 0x00000014fcb3e388ULL },
+    { 0x0000000000000000ULL, 0x9aef3604ef66a000ULL, 0x0000001fd83e57deULL },
+    { 0x0000000000000000ULL, 0x62c48f833a400000ULL, 0x00000033d44dfb9aULL },
+    { 0x0000000000000000ULL, 0xac9b567680000000ULL, 0x00000023f21c8940ULL },
+    { 0x0000000000000000ULL, 0xe502810000000000ULL, 0x0000000f0ee2aa91ULL },
+    { 0x0000000000000000ULL, 0x93ca000000000000ULL, 0x00000021f7fe75f0ULL },
+    { 0x0000000000000000ULL, 0x6400000000000000ULL, 0x0000003803864a21ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000007c63c80e8ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000003604471000ULL },
+    /* 56 */
+    { 0xa67f6b29b9c3b297ULL, 0x0000000008213f56ULL, 0x0000000000000000ULL },
+    { 0x9f78c67672ce791aULL, 0x01e494034e79e5b9ULL, 0x0000000000000000ULL },
+    { 0xfc501cb4b9ff04f9ULL, 0x29dde93228af3c39ULL, 0x000000000070d31cULL },
+    { 0x223c445197e92c25ULL, 0xf18e7065dd8dffe6ULL, 0x000000068ead8d45ULL },
+    { 0x7500814ee1bbc30aULL, 0x7c07623806401303ULL, 0x0000001048f65431ULL },
+    { 0x5d824f0499c565deULL, 0xd2a4bbdbcb0c3a6dULL, 0x0000000b85815bf1ULL },
+    { 0x6a8ea08f1138125fULL, 0xa63f650a00719462ULL, 0x000000384dc37e9aULL },
+    { 0x19b92b8d0518c8baULL, 0x1bd855df90d8a0e2ULL, 0x0000002401d2a59aULL },
+    { 0xcf5f0d3127bdd1dfULL, 0xe2a177afd2e38eb9ULL, 0x00000023e19935e6ULL },
+    { 0x442370ea683fbc28ULL, 0xedd00b303d3044d9ULL, 0x00000035c1d5ba8aULL },
+    { 0xea225cf69accf336ULL, 0x01f2ff2f93ba981bULL, 0x0000002058cfa161ULL },
+    { 0xdf60f17d7389d23cULL, 0x370669df2bc6cad7ULL, 0x00000016961ab887ULL },
+    { 0xada54186f6435d9bULL, 0x2ee13ee0a2660e3bULL, 0x0000001f7b7045adULL },
+    { 0xeba6296a0eea87ffULL, 0x542c76d0d826a287ULL, 0x000000285284c3fbULL },
+    { 0x77eab6326c899b07ULL, 0xb133b94195524d71ULL, 0x0000003a845d328cULL },
+    { 0x6d1ccb267203621aULL, 0x5f0b8b2eae00c3ceULL, 0x00000020c1e888a2ULL },
+    { 0xc9b3b39b8657c8e1ULL, 0x9801aee2f7d4283cULL, 0x00000025ce14f504ULL },
+    { 0xaf3dc41bdfd3ed69ULL, 0xd7a612739ecdb7a6ULL, 0x0000000111cf7442ULL },
+    { 0x22187bd11f6e25a6ULL, 0xc9b62c6237922da1ULL, 0x0000000f901dbe50ULL },
+    { 0xffbe4dbc9b17344aULL, 0x14e99e4cedcb4c2aULL, 0x00000012cf5612fbULL },
+    { 0x648a77629906fc00ULL, 0x4bfd9a7c24e8a231ULL, 0x0000003a75a28a85ULL },
+    { 0xccc87706e0d19228ULL, 0xa715c67283dd5e24ULL, 0x0000001f091c571fULL },
+    { 0x5ddef8267e358483ULL, 0xf3ddb3e9c99e6d9cULL, 0x000000075ea581acULL },
+    { 0x160ca152115bdc52ULL, 0x0c1145a7fc303d64ULL, 0x0000002844c74442ULL },
+    { 0xeca95ebbd5327205ULL, 0x3f2360290fbb262cULL, 0x0000000f60b75af7ULL },
+    { 0xebe116d96cadb0e8ULL, 0x3933fecafdb0d975ULL, 0x00000039910c3a43ULL },
+    { 0x76def802d6150115ULL, 0x15a08aae89e3d1cbULL, 0x0000000fa6d47023ULL },
+    { 0xc8bddcced8ff539dULL, 0x54342d33dc557115ULL, 0x000000082b32b19aULL },
+    { 0x50ac9916c1d55ea4ULL, 0x50a528517799b480ULL, 0x00000023eeb8743fULL },
+    { 0x8728bc1cfd36be12ULL, 0x5962a76f70358ec4ULL, 0x0000000ebdde8947ULL },
+    { 0xfc3ad0899d4e33ffULL, 0x4003c6a97006c481ULL, 0x000000109cbdce77ULL },
+    { 0x92963d269af34178ULL, 0x8980a5c18261da77ULL, 0x0000001bc3db7991ULL },
+    { 0x3b2fbcafdd460559ULL, 0xd23fad1831192823ULL, 0x00000021e2b03416ULL },
+    { 0xb4ad03f3db5babedULL, 0xf2736c201d8167e7ULL, 0x0000000550412918ULL },
+    { 0x195e80db3a4d0ef7ULL, 0x856fea130403648eULL, 0x00000005cef622a9ULL },
+    { 0x9bfdd0ce83a32d35ULL, 0x80103361eaac2a90ULL, 0x000000277840d38fULL },
+    { 0x7b54bf72fd1d1573ULL, 0x42881c8cc88770e5ULL, 0x00000021694800a3ULL },
+    { 0x8a92b329406c6806ULL, 0x056eeeb9ac8dcc6bULL, 0x00000026030c36f5ULL },
+    { 0x0a084a0555226447ULL, 0xeed4fd91a4ee06e2ULL, 0x000000390c672c09ULL },
+    { 0x4c3c58f99fee369eULL, 0x2ab4feea0db84df6ULL, 0x00000002500c9905ULL },
+    { 0xac3b141525f38becULL, 0x1b1a69aa17401cf6ULL, 0x0000000133f77b54ULL },
+    { 0x9250a5b39382966bULL, 0x9b0df996dcefdd11ULL, 0x000000139519c1a0ULL },
+    { 0xb3c5879e26b11dbcULL, 0xf09d3a934dba7827ULL, 0x0000002564d83946ULL },
+    { 0xe510e2edefe26d8aULL, 0x3fbef732911ffeeeULL, 0x000000108458f4f1ULL },
+    { 0xac7b3cbd4caea7b6ULL, 0x0aeb9383a9a93134ULL, 0x000000382b8fb826ULL },
+    { 0x6879c0399e67d492ULL, 0xf7b3f1fe3e43b93bULL, 0x00000008db84e153ULL },
+    { 0xfbd8af7164911fb0ULL, 0x283dad8f8ef9c8faULL, 0x000000138cdbbc79ULL },
+    { 0xa6d36af50dfcb968ULL, 0x2942da65d79c7b81ULL, 0x0000001c358805dbULL },
+    { 0xa40905cbbfd7b62bULL, 0x9a4920baa6e56277ULL, 0x000000330706291bULL },
+    { 0x905ae41fad4c31efULL, 0x68928b5fce792932ULL, 0x000000066d3f7246ULL },
+    { 0x3fffce162ea4e477ULL, 0x8e31ba4d0a31af28ULL, 0x0000001064ac3ccaULL },
+    { 0xeeb590a6f7c3cbc2ULL, 0x10b25f4cd92c36e0ULL, 0x0000002f293ed40dULL },
+    { 0xc3aeeb3ea04f6390ULL, 0xc97a789bbda0edeaULL, 0x000000030abf7670ULL },
+    { 0xf83e26329f5445b6ULL, 0x158f0d45360e45d8ULL, 0x0000001a42a16c73ULL },
+    { 0xaf50367b4cb59566ULL, 0xcf906b5648d8dc11ULL, 0x0000001acb8dbf1fULL },
+    { 0x7bd749319aa57231ULL, 0x6963e2a793b0e724ULL, 0x0000000768123f65ULL },
+    { 0x563c4cde59d22820ULL, 0xc8b0d83a0adfe718ULL, 0x000000179c9b707bULL },
+    { 0x111cea8b3f4ed443ULL, 0xfe09f1884cdcfa09ULL, 0x0000001cd2192892ULL },
+    { 0x006d204b2816c680ULL, 0x8e4ab734ddb11cf4ULL, 0x00000022396d1919ULL },
+    { 0xdaeeab14e1a10000ULL, 0x5974e52567b9f06cULL, 0x00000005f33efb72ULL },
+    { 0x0d8e4fe30a000000ULL, 0xb437c41c6fa699c1ULL, 0x0000001a9fc1fbb7ULL },
+    { 0xaceb29e400000000ULL, 0x8794ffc1719448b7ULL, 0x0000002ac59c37f2ULL },
+    { 0x4e35e80000000000ULL, 0x015a239514b92690ULL, 0x0000003877e4458fULL },
+    { 0x1910000000000000ULL, 0xe388c59e8d43569cULL, 0x000000214bc76d7dULL },
+    { 0xa000000000000000ULL, 0x57de9aef3604ef66ULL, 0x0000001d4f8ebb5cULL },
+    { 0x0000000000000000ULL, 0xfb9a62c48f833a40ULL, 0x00000015801606f3ULL },
+    { 0x0000000000000000ULL, 0x8940ac9b56768000ULL, 0x00000038ce82742aULL },
+    { 0x0000000000000000ULL, 0xaa91e50281000000ULL, 0x00000009e75a08fcULL },
+    { 0x0000000000000000ULL, 0x75f093ca00000000ULL, 0x0000003ad4159a22ULL },
+    { 0x0000000000000000ULL, 0x4a21640000000000ULL, 0x00000008060495d8ULL },
+    { 0x0000000000000000ULL, 0x80e8000000000000ULL, 0x000000325bdcf4a0ULL },
+    { 0x0000000000000000ULL, 0x1000000000000000ULL, 0x000000255ec1a947ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000108ba7b2a0ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002540be4000ULL },
+    /* 57 */
+    { 0x3f56a67f6b29b9c4ULL, 0x0000000000000821ULL, 0x0000000000000000ULL },
+    { 0xe5b99f78c67672cfULL, 0x000001e494034e79ULL, 0x0000000000000000ULL },
+    { 0x3c39fc501cb4ba00ULL, 0xd31c29dde93228afULL, 0x0000000000000070ULL },
+    { 0xffe6223c445197eaULL, 0x8d45f18e7065dd8dULL, 0x0000001a44df832bULL },
+    { 0x13037500814ee1bcULL, 0x54317c0762380640ULL, 0x0000000a23e47838ULL },
+    { 0x3a6d5d824f0499c6ULL, 0x5bf1d2a4bbdbcb0cULL, 0x0000000d1d767fc9ULL },
+    { 0x94626a8ea08f1139ULL, 0x7e9aa63f650a0071ULL, 0x0000002ee1f0ed91ULL },
+    { 0xa0e219b92b8d0519ULL, 0xa59a1bd855df90d8ULL, 0x00000021e0269b3eULL },
+    { 0x8eb9cf5f0d3127beULL, 0x35e6e2a177afd2e3ULL, 0x0000000e960b91cbULL },
+    { 0x44d9442370ea6840ULL, 0xba8aedd00b303d30ULL, 0x0000002f504afba7ULL },
+    { 0x981bea225cf69acdULL, 0xa16101f2ff2f93baULL, 0x000000270d689593ULL },
+    { 0xcad7df60f17d738aULL, 0xb887370669df2bc6ULL, 0x000000225f74ed24ULL },
+    { 0x0e3bada54186f644ULL, 0x45ad2ee13ee0a266ULL, 0x000000088cbb24a0ULL },
+    { 0xa287eba6296a0eebULL, 0xc3fb542c76d0d826ULL, 0x0000002550f74af6ULL },
+    { 0x4d7177eab6326c8aULL, 0x328cb133b9419552ULL, 0x00000039745f883bULL },
+    { 0xc3ce6d1ccb267204ULL, 0x88a25f0b8b2eae00ULL, 0x0000000dc8718b5cULL },
+    { 0x283cc9b3b39b8658ULL, 0xf5049801aee2f7d4ULL, 0x000000158b70a164ULL },
+    { 0xb7a6af3dc41bdfd4ULL, 0x7442d7a612739ecdULL, 0x0000001781831d21ULL },
+    { 0x2da122187bd11f6fULL, 0xbe50c9b62c623792ULL, 0x00000007ca05bda5ULL },
+    { 0x4c2affbe4dbc9b18ULL, 0x12fb14e99e4cedcbULL, 0x000000269713e342ULL },
+    { 0xa231648a77629907ULL, 0x8a854bfd9a7c24e8ULL, 0x0000000f62536bd6ULL },
+    { 0x5e24ccc87706e0d2ULL, 0x571fa715c67283ddULL, 0x00000031f3a55600ULL },
+    { 0x6d9c5ddef8267e36ULL, 0x81acf3ddb3e9c99eULL, 0x000000001448f94bULL },
+    { 0x3d64160ca152115cULL, 0x44420c1145a7fc30ULL, 0x00000011948a7291ULL },
+    { 0x262ceca95ebbd533ULL, 0x5af73f2360290fbbULL, 0x00000021d290e85fULL },
+    { 0xd975ebe116d96caeULL, 0x3a433933fecafdb0ULL, 0x00000016339ef210ULL },
+    { 0xd1cb76def802d616ULL, 0x702315a08aae89e3ULL, 0x00000003c73d5898ULL },
+    { 0x7115c8bddcced900ULL, 0xb19a54342d33dc55ULL, 0x000000237e03d392ULL },
+    { 0xb48050ac9916c1d6ULL, 0x743f50a528517799ULL, 0x0000002227a12862ULL },
+    { 0x8ec48728bc1cfd37ULL, 0x89475962a76f7035ULL, 0x00000016ec523566ULL },
+    { 0xc481fc3ad0899d4fULL, 0xce774003c6a97006ULL, 0x00000017dfa2eed7ULL },
+    { 0xda7792963d269af4ULL, 0x79918980a5c18261ULL, 0x000000323f11f867ULL },
+    { 0x28233b2fbcafdd47ULL, 0x3416d23fad183119ULL, 0x000000181795522aULL },
+    { 0x67e7b4ad03f3db5cULL, 0x2918f2736c201d81ULL, 0x00000009d385e549ULL },
+    { 0x648e195e80db3a4eULL, 0x22a9856fea130403ULL, 0x0000001108b53350ULL },
+    { 0x2a909bfdd0ce83a4ULL, 0xd38f80103361eaacULL, 0x00000012a8712714ULL },
+    { 0x70e57b54bf72fd1eULL, 0x00a342881c8cc887ULL, 0x00000004d959c5c6ULL },
+    { 0xcc6b8a92b329406dULL, 0x36f5056eeeb9ac8dULL, 0x0000002e19de3f0cULL },
+    { 0x06e20a084a055523ULL, 0x2c09eed4fd91a4eeULL, 0x00000002d80d2b03ULL },
+    { 0x4df64c3c58f99fefULL, 0x99052ab4feea0db8ULL, 0x00000000bd1148c4ULL },
+    { 0x1cf6ac3b141525f4ULL, 0x7b541b1a69aa1740ULL, 0x0000002dc6235eb1ULL },
+    { 0xdd119250a5b39383ULL, 0xc1a09b0df996dcefULL, 0x0000002952bc9e27ULL },
+    { 0x7827b3c5879e26b2ULL, 0x3946f09d3a934dbaULL, 0x0000000941a9dd22ULL },
+    { 0xfeeee510e2edefe3ULL, 0xf4f13fbef732911fULL, 0x00000007f7e4cf52ULL },
+    { 0x3134ac7b3cbd4cafULL, 0xb8260aeb9383a9a9ULL, 0x00000013509c6817ULL },
+    { 0xb93b6879c0399e68ULL, 0xe153f7b3f1fe3e43ULL, 0x0000000585c842b4ULL },
+    { 0xc8fafbd8af716492ULL, 0xbc79283dad8f8ef9ULL, 0x0000002a1d4ca065ULL },
+    { 0x7b81a6d36af50dfdULL, 0x05db2942da65d79cULL, 0x00000017aff393e0ULL },
+    { 0x6277a40905cbbfd8ULL, 0x291b9a4920baa6e5ULL, 0x0000003428cdccf8ULL },
+    { 0x2932905ae41fad4dULL, 0x724668928b5fce79ULL, 0x00000039c785e799ULL },
+    { 0xaf283fffce162ea5ULL, 0x3cca8e31ba4d0a31ULL, 0x00000023ba1e0ca0ULL },
+    { 0x36e0eeb590a6f7c4ULL, 0xd40d10b25f4cd92cULL, 0x000000254ee5b096ULL },
+    { 0xedeac3aeeb3ea050ULL, 0x7670c97a789bbda0ULL, 0x000000231e119607ULL },
+    { 0x45d8f83e26329f55ULL, 0x6c73158f0d45360eULL, 0x00000001bccf21bdULL },
+    { 0xdc11af50367b4cb6ULL, 0xbf1fcf906b5648d8ULL, 0x0000002c1a873ac5ULL },
+    { 0xe7247bd749319aa6ULL, 0x3f656963e2a793b0ULL, 0x0000002e0a9d56c8ULL },
+    { 0xe718563c4cde59d3ULL, 0x707bc8b0d83a0adfULL, 0x0000002e9fb08451ULL },
+    { 0xfa09111cea8b3f4fULL, 0x2892fe09f1884cdcULL, 0x00000012f62a7479ULL },
+    { 0x1cf4006d204b2817ULL, 0x19198e4ab734ddb1ULL, 0x0000001c359be2fdULL },
+    { 0xf06cdaeeab14e1a1ULL, 0xfb725974e52567b9ULL, 0x0000003aedd1b2f8ULL },
+    { 0x99c10d8e4fe30a00ULL, 0xfbb7b437c41c6fa6ULL, 0x00000039f87f13cfULL },
+    { 0x48b7aceb29e40000ULL, 0x37f28794ffc17194ULL, 0x000000306cc4dfaaULL },
+    { 0x26904e35e8000000ULL, 0x458f015a239514b9ULL, 0x00000027a1d0dd4aULL },
+    { 0x569c191000000000ULL, 0x6d7de388c59e8d43ULL, 0x000000114af06839ULL },
+    { 0xef66a00000000000ULL, 0xbb5c57de9aef3604ULL, 0x0000000d5ef53190ULL },
+    { 0x3a40000000000000ULL, 0x06f3fb9a62c48f83ULL, 0x00000021b2b131a4ULL },
+    { 0x8000000000000000ULL, 0x742a8940ac9b5676ULL, 0x0000002630c7d73eULL },
+    { 0x0000000000000000ULL, 0x08fcaa91e5028100ULL, 0x0000000e8a88f6e2ULL },
+    { 0x0000000000000000ULL, 0x9a2275f093ca0000ULL, 0x00000034a0bdfe65ULL },
+    { 0x0000000000000000ULL, 0x95d84a2164000000ULL, 0x00000017a7f4d588ULL },
+    { 0x0000000000000000ULL, 0xf4a080e800000000ULL, 0x0000001fcd1ec36eULL },
+    { 0x0000000000000000ULL, 0xa947100000000000ULL, 0x00000019d577b349ULL },
+    { 0x0000000000000000ULL, 0xb2a0000000000000ULL, 0x00000011268d5501ULL },
+    { 0x0000000000000000ULL, 0x4000000000000000ULL, 0x000000006531ab32ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000bb3222680ULL },
+    /* 58 */
+    { 0x4e79e5b99f78c677ULL, 0x0000000001e49403ULL, 0x0000000000000000ULL },
+    { 0x28af3c39fc501cb5ULL, 0x0070d31c29dde932ULL, 0x0000000000000000ULL },
+    { 0xdd8dffe6223c4452ULL, 0x832b8d45f18e7065ULL, 0x00000000001a44dfULL },
+    { 0x064013037500814fULL, 0x783854317c076238ULL, 0x000000340a604f42ULL },
+    { 0xcb0c3a6d5d824f05ULL, 0x7fc95bf1d2a4bbdbULL, 0x0000000f79e5c026ULL },
+    { 0x007194626a8ea090ULL, 0xed917e9aa63f650aULL, 0x00000008f6baa826ULL },
+    { 0x90d8a0e219b92b8eULL, 0x9b3ea59a1bd855dfULL, 0x00000009104a2928ULL },
+    { 0xd2e38eb9cf5f0d32ULL, 0x91cb35e6e2a177afULL, 0x000000097454de59ULL },
+    { 0x3d3044d9442370ebULL, 0xfba7ba8aedd00b30ULL, 0x00000014dac236b4ULL },
+    { 0x93ba981bea225cf7ULL, 0x9593a16101f2ff2fULL, 0x0000002a236dd976ULL },
+    { 0x2bc6cad7df60f17eULL, 0xed24b887370669dfULL, 0x0000001b9c2c9306ULL },
+    { 0xa2660e3bada54187ULL, 0x24a045ad2ee13ee0ULL, 0x000000019cd795bdULL },
+    { 0xd826a287eba6296bULL, 0x4af6c3fb542c76d0ULL, 0x0000002c09ce375fULL },
+    { 0x95524d7177eab633ULL, 0x883b328cb133b941ULL, 0x000000162fe528c3ULL },
+    { 0xae00c3ce6d1ccb27ULL, 0x8b5c88a25f0b8b2eULL, 0x0000002d869fe1c1ULL },
+    { 0xf7d4283cc9b3b39cULL, 0xa164f5049801aee2ULL, 0x0000002d1024e11eULL },
+    { 0x9ecdb7a6af3dc41cULL, 0x1d217442d7a61273ULL, 0x0000000721b7868dULL },
+    { 0x37922da122187bd2ULL, 0xbda5be50c9b62c62ULL, 0x00000020db0994e7ULL },
+    { 0xedcb4c2affbe4dbdULL, 0xe34212fb14e99e4cULL, 0x00000035f4d42435ULL },
+    { 0x24e8a231648a7763ULL, 0x6bd68a854bfd9a7cULL, 0x0000000c8bf57571ULL },
+    { 0x83dd5e24ccc87707ULL, 0x5600571fa715c672ULL, 0x0000001a686ed013ULL },
+    { 0xc99e6d9c5ddef827ULL, 0xf94b81acf3ddb3e9ULL, 0x0000000480831224ULL },
+    { 0xfc303d64160ca153ULL, 0x729144420c1145a7ULL, 0x000000089bcf8b04ULL },
+    { 0x0fbb262ceca95ebcULL, 0xe85f5af73f236029ULL, 0x000000010917e884ULL },
+    { 0xfdb0d975ebe116daULL, 0xf2103a433933fecaULL, 0x0000001ef1eaa2aeULL },
+    { 0x89e3d1cb76def803ULL, 0x5898702315a08aaeULL, 0x00000028bb916631ULL },
+    { 0xdc557115c8bddccfULL, 0xd392b19a54342d33ULL, 0x0000000b7d415d73ULL },
+    { 0x7799b48050ac9917ULL, 0x2862743f50a52851ULL, 0x0000001af7cb7a1fULL },
+    { 0x70358ec48728bc1dULL, 0x356689475962a76fULL, 0x00000007412591e2ULL },
+    { 0x7006c481fc3ad08aULL, 0xeed7ce774003c6a9ULL, 0x00000034ab153f74ULL },
+    { 0x8261da7792963d27ULL, 0xf86779918980a5c1ULL, 0x0000001b39bfaeddULL },
+    { 0x311928233b2fbcb0ULL, 0x522a3416d23fad18ULL, 0x00000033ae766d45ULL },
+    { 0x1d8167e7b4ad03f4ULL, 0xe5492918f2736c20ULL, 0x0000001023d9da39ULL },
+    { 0x0403648e195e80dcULL, 0x335022a9856fea13ULL, 0x0000000d7ad97967ULL },
+    { 0xeaac2a909bfdd0cfULL, 0x2714d38f80103361ULL, 0x000000180739c4afULL },
+    { 0xc88770e57b54bf73ULL, 0xc5c600a342881c8cULL, 0x00000028c7e9841fULL },
+    { 0xac8dcc6b8a92b32aULL, 0x3f0c36f5056eeeb9ULL, 0x0000000765caad50ULL },
+    { 0xa4ee06e20a084a06ULL, 0x2b032c09eed4fd91ULL, 0x00000012af0d0fc3ULL },
+    { 0x0db84df64c3c58faULL, 0x48c499052ab4feeaULL, 0x0000002d70eb9affULL },
+    { 0x17401cf6ac3b1416ULL, 0x5eb17b541b1a69aaULL, 0x0000003b702084f3ULL },
+    { 0xdcefdd119250a5b4ULL, 0x9e27c1a09b0df996ULL, 0x00000038a9f9e6e8ULL },
+    { 0x4dba7827b3c5879fULL, 0xdd223946f09d3a93ULL, 0x000000362919da55ULL },
+    { 0x911ffeeee510e2eeULL, 0xcf52f4f13fbef732ULL, 0x00000013fde1aa46ULL },
+    { 0xa9a93134ac7b3cbeULL, 0x6817b8260aeb9383ULL, 0x000000107c98b5f2ULL },
+    { 0x3e43b93b6879c03aULL, 0x42b4e153f7b3f1feULL, 0x00000038708f5bd8ULL },
+    { 0x8ef9c8fafbd8af72ULL, 0xa065bc79283dad8fULL, 0x000000325a227560ULL },
+    { 0xd79c7b81a6d36af6ULL, 0x93e005db2942da65ULL, 0x000000167f642e33ULL },
+    { 0xa6e56277a40905ccULL, 0xccf8291b9a4920baULL, 0x0000000c024448cbULL },
+    { 0xce792932905ae420ULL, 0xe799724668928b5fULL, 0x0000002f73774e7dULL },
+    { 0x0a31af283fffce17ULL, 0x0ca03cca8e31ba4dULL, 0x0000001d50810864ULL },
+    { 0xd92c36e0eeb590a7ULL, 0xb096d40d10b25f4cULL, 0x000000174b67785dULL },
+    { 0xbda0edeac3aeeb3fULL, 0x96077670c97a789bULL, 0x00000015d058eaf1ULL },
+    { 0x360e45d8f83e2633ULL, 0x21bd6c73158f0d45ULL, 0x000000383fa6992bULL },
+    { 0x48d8dc11af50367cULL, 0x3ac5bf1fcf906b56ULL, 0x0000000a0adafc91ULL },
+    { 0x93b0e7247bd74932ULL, 0x56c83f656963e2a7ULL, 0x00000021d05b8661ULL },
+    { 0x0adfe718563c4cdfULL, 0x8451707bc8b0d83aULL, 0x00000016a9db298cULL },
+    { 0x4cdcfa09111cea8cULL, 0x74792892fe09f188ULL, 0x00000020b7753e52ULL },
+    { 0xddb11cf4006d204cULL, 0xe2fd19198e4ab734ULL, 0x0000001332b30d23ULL },
+    { 0x67b9f06cdaeeab15ULL, 0xb2f8fb725974e525ULL, 0x000000085b033225ULL },
+    { 0x6fa699c10d8e4fe4ULL, 0x13cffbb7b437c41cULL, 0x00000008c70acaf3ULL },
+    { 0x719448b7aceb29e4ULL, 0xdfaa37f28794ffc1ULL, 0x00000038988aa7c2ULL },
+    { 0x14b926904e35e800ULL, 0xdd4a458f015a2395ULL, 0x0000002d5f608bc6ULL },
+    { 0x8d43569c19100000ULL, 0x68396d7de388c59eULL, 0x0000002e4d3e2752ULL },
+    { 0x3604ef66a0000000ULL, 0x3190bb5c57de9aefULL, 0x000000132fd8f505ULL },
+    { 0x8f833a4000000000ULL, 0x31a406f3fb9a62c4ULL, 0x000000013590455bULL },
+    { 0x5676800000000000ULL, 0xd73e742a8940ac9bULL, 0x000000153b949f71ULL },
+    { 0x8100000000000000ULL, 0xf6e208fcaa91e502ULL, 0x0000001a8170b42eULL },
+    { 0x0000000000000000ULL, 0xfe659a2275f093caULL, 0x0000000aef4baad9ULL },
+    { 0x0000000000000000ULL, 0xd58895d84a216400ULL, 0x00000032c1707660ULL },
+    { 0x0000000000000000ULL, 0xc36ef4a080e80000ULL, 0x000000168bc35730ULL },
+    { 0x0000000000000000ULL, 0xb349a94710000000ULL, 0x0000000b5a869d55ULL },
+    { 0x0000000000000000ULL, 0x5501b2a000000000ULL, 0x00000013f42373cbULL },
+    { 0x0000000000000000ULL, 0xab32400000000000ULL, 0x0000002f5788f843ULL },
+    { 0x0000000000000000ULL, 0x2680000000000000ULL, 0x0000000fc15ef610ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000003c2a36761ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001695a68a00ULL },
+    /* 59 */
+    { 0x94034e79e5b99f79ULL, 0x00000000000001e4ULL, 0x0000000000000000ULL },
+    { 0xe93228af3c39fc51ULL, 0x00000070d31c29ddULL, 0x0000000000000000ULL },
+    { 0x7065dd8dffe6223dULL, 0x44df832b8d45f18eULL, 0x000000000000001aULL },
+    { 0x6238064013037501ULL, 0x4f42783854317c07ULL, 0x000000061dc1ac08ULL },
+    { 0xbbdbcb0c3a6d5d83ULL, 0xc0267fc95bf1d2a4ULL, 0x00000001ef4a8e3bULL },
+    { 0x650a007194626a8fULL, 0xa826ed917e9aa63fULL, 0x0000000de9699c3aULL },
+    { 0x55df90d8a0e219baULL, 0x29289b3ea59a1bd8ULL, 0x0000000da83868daULL },
+    { 0x77afd2e38eb9cf60ULL, 0xde5991cb35e6e2a1ULL, 0x00000032cb6542aeULL },
+    { 0x0b303d3044d94424ULL, 0x36b4fba7ba8aedd0ULL, 0x00000028b6fa61eeULL },
+    { 0xff2f93ba981bea23ULL, 0xd9769593a16101f2ULL, 0x0000003776a49609ULL },
+    { 0x69df2bc6cad7df61ULL, 0x9306ed24b8873706ULL, 0x000000024b12eb66ULL },
+    { 0x3ee0a2660e3bada6ULL, 0x95bd24a045ad2ee1ULL, 0x00000017e1e7fad5ULL },
+    { 0x76d0d826a287eba7ULL, 0x375f4af6c3fb542cULL, 0x00000031baa73360ULL },
+    { 0xb94195524d7177ebULL, 0x28c3883b328cb133ULL, 0x0000001666f0314bULL },
+    { 0x8b2eae00c3ce6d1dULL, 0xe1c18b5c88a25f0bULL, 0x000000117fd6e42fULL },
+    { 0xaee2f7d4283cc9b4ULL, 0xe11ea164f5049801ULL, 0x0000000b25fb31aeULL },
+    { 0x12739ecdb7a6af3eULL, 0x868d1d217442d7a6ULL, 0x00000028b79f7941ULL },
+    { 0x2c6237922da12219ULL, 0x94e7bda5be50c9b6ULL, 0x0000000f41a12ac5ULL },
+    { 0x9e4cedcb4c2affbfULL, 0x2435e34212fb14e9ULL, 0x0000002e00c8e39cULL },
+    { 0x9a7c24e8a231648bULL, 0x75716bd68a854bfdULL, 0x000000245ac1685dULL },
+    { 0xc67283dd5e24ccc9ULL, 0xd0135600571fa715ULL, 0x00000015c29388c0ULL },
+    { 0xb3e9c99e6d9c5ddfULL, 0x1224f94b81acf3ddULL, 0x0000002ce489c4a3ULL },
+    { 0x45a7fc303d64160dULL, 0x8b04729144420c11ULL, 0x00000025f7c81c03ULL },
+    { 0x60290fbb262cecaaULL, 0xe884e85f5af73f23ULL, 0x00000000d32e72c5ULL },
+    { 0xfecafdb0d975ebe2ULL, 0xa2aef2103a433933ULL, 0x0000002e1440aafaULL },
+    { 0x8aae89e3d1cb76dfULL, 0x66315898702315a0ULL, 0x0000003a5b09f365ULL },
+    { 0x2d33dc557115c8beULL, 0x5d73d392b19a5434ULL, 0x000000179bdcdbbdULL },
+    { 0x28517799b48050adULL, 0x7a1f2862743f50a5ULL, 0x0000002c1709552dULL },
+    { 0xa76f70358ec48729ULL, 0x91e2356689475962ULL, 0x0000000a96a48769ULL },
+    { 0xc6a97006c481fc3bULL, 0x3f74eed7ce774003ULL, 0x000000189474317fULL },
+    { 0xa5c18261da779297ULL, 0xaeddf86779918980ULL, 0x0000001da0908775ULL },
+    { 0xad18311928233b30ULL, 0x6d45522a3416d23fULL, 0x0000001b667535c2ULL },
+    { 0x6c201d8167e7b4aeULL, 0xda39e5492918f273ULL, 0x0000002d44be1fdbULL },
+    { 0xea130403648e195fULL, 0x7967335022a9856fULL, 0x00000033303a18ddULL },
+    { 0x3361eaac2a909bfeULL, 0xc4af2714d38f8010ULL, 0x0000003390e492b3ULL },
+    { 0x1c8cc88770e57b55ULL, 0x841fc5c600a34288ULL, 0x00000029db068891ULL },
+    { 0xeeb9ac8dcc6b8a93ULL, 0xad503f0c36f5056eULL, 0x00000021e16f9ff2ULL },
+    { 0xfd91a4ee06e20a09ULL, 0x0fc32b032c09eed4ULL, 0x0000003880ad3d8fULL },
+    { 0xfeea0db84df64c3dULL, 0x9aff48c499052ab4ULL, 0x000000214f2258c1ULL },
+    { 0x69aa17401cf6ac3cULL, 0x84f35eb17b541b1aULL, 0x0000002d13c8d7a4ULL },
+    { 0xf996dcefdd119251ULL, 0xe6e89e27c1a09b0dULL, 0x000000264e1de221ULL },
+    { 0x3a934dba7827b3c6ULL, 0xda55dd223946f09dULL, 0x00000007e4b74495ULL },
+    { 0xf732911ffeeee511ULL, 0xaa46cf52f4f13fbeULL, 0x00000022e3ed5fe5ULL },
+    { 0x9383a9a93134ac7cULL, 0xb5f26817b8260aebULL, 0x00000035791bf8bcULL },
+    { 0xf1fe3e43b93b687aULL, 0x5bd842b4e153f7b3ULL, 0x0000002bf0093961ULL },
+    { 0xad8f8ef9c8fafbd9ULL, 0x7560a065bc79283dULL, 0x00000016ab08e9f0ULL },
+    { 0xda65d79c7b81a6d4ULL, 0x2e3393e005db2942ULL, 0x00000037fc719db6ULL },
+    { 0x20baa6e56277a40aULL, 0x48cbccf8291b9a49ULL, 0x0000002a6acd6e90ULL },
+    { 0x8b5fce792932905bULL, 0x4e7de79972466892ULL, 0x0000002198049c47ULL },
+    { 0xba4d0a31af284000ULL, 0x08640ca03cca8e31ULL, 0x000000109a34800dULL },
+    { 0x5f4cd92c36e0eeb6ULL, 0x785db096d40d10b2ULL, 0x0000000308d063b7ULL },
+    { 0x789bbda0edeac3afULL, 0xeaf196077670c97aULL, 0x0000002ab7acc508ULL },
+    { 0x0d45360e45d8f83fULL, 0x992b21bd6c73158fULL, 0x00000002138a0c4aULL },
+    { 0x6b5648d8dc11af51ULL, 0xfc913ac5bf1fcf90ULL, 0x000000115e67f194ULL },
+    { 0xe2a793b0e7247bd8ULL, 0x866156c83f656963ULL, 0x00000022b04af733ULL },
+    { 0xd83a0adfe718563dULL, 0x298c8451707bc8b0ULL, 0x0000000bff1fed97ULL },
+    { 0xf1884cdcfa09111dULL, 0x3e5274792892fe09ULL, 0x0000002331f9a7cfULL },
+    { 0xb734ddb11cf4006eULL, 0x0d23e2fd19198e4aULL, 0x0000003040ac059fULL },
+    { 0xe52567b9f06cdaefULL, 0x3225b2f8fb725974ULL, 0x000000250832ad45ULL },
+    { 0xc41c6fa699c10d8fULL, 0xcaf313cffbb7b437ULL, 0x000000101c65747eULL },
+    { 0xffc1719448b7acecULL, 0xa7c2dfaa37f28794ULL, 0x0000001d857027eeULL },
+    { 0x239514b926904e36ULL, 0x8bc6dd4a458f015aULL, 0x0000003790f72526ULL },
+    { 0xc59e8d43569c1910ULL, 0x275268396d7de388ULL, 0x00000008f98554ecULL },
+    { 0x9aef3604ef66a000ULL, 0xf5053190bb5c57deULL, 0x00000036fbd9fc9eULL },
+    { 0x62c48f833a400000ULL, 0x455b31a406f3fb9aULL, 0x00000025029504e2ULL },
+    { 0xac9b567680000000ULL, 0x9f71d73e742a8940ULL, 0x00000034aecc4806ULL },
+    { 0xe502810000000000ULL, 0xb42ef6e208fcaa91ULL, 0x000000018ac060e6ULL },
+    { 0x93ca000000000000ULL, 0xaad9fe659a2275f0ULL, 0x00000035b7054153ULL },
+    { 0x6400000000000000ULL, 0x7660d58895d84a21ULL, 0x000000137af70994ULL },
+    { 0x0000000000000000ULL, 0x5730c36ef4a080e8ULL, 0x00000022910cacdfULL },
+    { 0x0000000000000000ULL, 0x9d55b349a9471000ULL, 0x000000340022eb2cULL },
+    { 0x0000000000000000ULL, 0x73cb5501b2a00000ULL, 0x0000000a633c9a05ULL },
+    { 0x0000000000000000ULL, 0xf843ab3240000000ULL, 0x0000000144fbd246ULL },
+    { 0x0000000000000000ULL, 0xf610268000000000ULL, 0x000000108620f10eULL },
+    { 0x0000000000000000ULL, 0x6761000000000000ULL, 0x000000037bc18cbfULL },
+    { 0x0000000000000000ULL, 0x8a00000000000000ULL, 0x0000002c908e92ecULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000003712d3a8e4ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000003515dbe800ULL },
+    /* 60 */
+    { 0x29dde93228af3c3aULL, 0x000000000070d31cULL, 0x0000000000000000ULL },
+    { 0xf18e7065dd8dffe7ULL, 0x001a44df832b8d45ULL, 0x0000000000000000ULL },
+    { 0x7c07623806401304ULL, 0xac084f4278385431ULL, 0x0000000000061dc1ULL },
+    { 0xd2a4bbdbcb0c3a6eULL, 0x8e3bc0267fc95bf1ULL, 0x0000002d17c03902ULL },
+    { 0xa63f650a00719463ULL, 0x9c3aa826ed917e9aULL, 0x0000000098535975ULL },
+    { 0x1bd855df90d8a0e3ULL, 0x68da29289b3ea59aULL, 0x0000001b621e4d50ULL },
+    { 0xe2a177afd2e38ebaULL, 0x42aede5991cb35e6ULL, 0x00000012b8c8cd75ULL },
+    { 0xedd00b303d3044daULL, 0x61ee36b4fba7ba8aULL, 0x0000001b4d44f10eULL },
+    { 0x01f2ff2f93ba981cULL, 0x9609d9769593a161ULL, 0x000000035944292eULL },
+    { 0x370669df2bc6cad8ULL, 0xeb669306ed24b887ULL, 0x0000000ad8bf496eULL },
+    { 0x2ee13ee0a2660e3cULL, 0xfad595bd24a045adULL, 0x00000019d351c555ULL },
+    { 0x542c76d0d826a288ULL, 0x3360375f4af6c3fbULL, 0x0000001404cbf5ebULL },
+    { 0xb133b94195524d72ULL, 0x314b28c3883b328cULL, 0x00000036c30dab2eULL },
+    { 0x5f0b8b2eae00c3cfULL, 0xe42fe1c18b5c88a2ULL, 0x0000000ac14a6c80ULL },
+    { 0x9801aee2f7d4283dULL, 0x31aee11ea164f504ULL, 0x0000001e028601e3ULL },
+    { 0xd7a612739ecdb7a7ULL, 0x7941868d1d217442ULL, 0x00000034e5d27649ULL },
+    { 0xc9b62c6237922da2ULL, 0x2ac594e7bda5be50ULL, 0x000000111b5f051bULL },
+    { 0x14e99e4cedcb4c2bULL, 0xe39c2435e34212fbULL, 0x000000065348b3ecULL },
+    { 0x4bfd9a7c24e8a232ULL, 0x685d75716bd68a85ULL, 0x0000003727b0d3dfULL },
+    { 0xa715c67283dd5e25ULL, 0x88c0d0135600571fULL, 0x0000003404229aa3ULL },
+    { 0xf3ddb3e9c99e6d9dULL, 0xc4a31224f94b81acULL, 0x000000261365bdd9ULL },
+    { 0x0c1145a7fc303d65ULL, 0x1c038b0472914442ULL, 0x00000032b3fdb470ULL },
+    { 0x3f2360290fbb262dULL, 0x72c5e884e85f5af7ULL, 0x0000001a1a3e2146ULL },
+    { 0x3933fecafdb0d976ULL, 0xaafaa2aef2103a43ULL, 0x00000010670c3e34ULL },
+    { 0x15a08aae89e3d1ccULL, 0xf365663158987023ULL, 0x0000000c43402d2dULL },
+    { 0x54342d33dc557116ULL, 0xdbbd5d73d392b19aULL, 0x0000000ab2e10b9aULL },
+    { 0x50a528517799b481ULL, 0x552d7a1f2862743fULL, 0x000000240e4705d7ULL },
+    { 0x5962a76f70358ec5ULL, 0x876991e235668947ULL, 0x0000003222d4a1b6ULL },
+    { 0x4003c6a97006c482ULL, 0x317f3f74eed7ce77ULL, 0x0000002a7f92d0faULL },
+    { 0x8980a5c18261da78ULL, 0x8775aeddf8677991ULL, 0x0000003a40af853aULL },
+    { 0xd23fad1831192824ULL, 0x35c26d45522a3416ULL, 0x0000000da09bcafbULL },
+    { 0xf2736c201d8167e8ULL, 0x1fdbda39e5492918ULL, 0x0000003a7d485e90ULL },
+    { 0x856fea130403648fULL, 0x18dd7967335022a9ULL, 0x000000218e7c8eb0ULL },
+    { 0x80103361eaac2a91ULL, 0x92b3c4af2714d38fULL, 0x000000290034f3d4ULL },
+    { 0x42881c8cc88770e6ULL, 0x8891841fc5c600a3ULL, 0x000000317e576a3aULL },
+    { 0x056eeeb9ac8dcc6cULL, 0x9ff2ad503f0c36f5ULL, 0x0000000da0dde0bfULL },
+    { 0xeed4fd91a4ee06e3ULL, 0x3d8f0fc32b032c09ULL, 0x0000002c9dba5a23ULL },
+    { 0x2ab4feea0db84df7ULL, 0x58c19aff48c49905ULL, 0x00000008347ecf44ULL },
+    { 0x1b1a69aa17401cf7ULL, 0xd7a484f35eb17b54ULL, 0x0000000fe9c7f138ULL },
+    { 0x9b0df996dcefdd12ULL, 0xe221e6e89e27c1a0ULL, 0x0000000d3c117dc3ULL },
+    { 0xf09d3a934dba7828ULL, 0x4495da55dd223946ULL, 0x0000002d9b8e690bULL },
+    { 0x3fbef732911ffeefULL, 0x5fe5aa46cf52f4f1ULL, 0x000000029f9eaf95ULL },
+    { 0x0aeb9383a9a93135ULL, 0xf8bcb5f26817b826ULL, 0x00000022c76b7c11ULL },
+    { 0xf7b3f1fe3e43b93cULL, 0x39615bd842b4e153ULL, 0x000000042f314db9ULL },
+    { 0x283dad8f8ef9c8fbULL, 0xe9f07560a065bc79ULL, 0x0000002b20381c02ULL },
+    { 0x2942da65d79c7b82ULL, 0x9db62e3393e005dbULL, 0x00000000adad724bULL },
+    { 0x9a4920baa6e56278ULL, 0x6e9048cbccf8291bULL, 0x000000119b1186afULL },
+    { 0x68928b5fce792933ULL, 0x9c474e7de7997246ULL, 0x00000028d88e30d0ULL },
+    { 0x8e31ba4d0a31af29ULL, 0x800d08640ca03ccaULL, 0x0000003092270d4cULL },
+    { 0x10b25f4cd92c36e1ULL, 0x63b7785db096d40dULL, 0x00000011cfc465d0ULL },
+    { 0xc97a789bbda0edebULL, 0xc508eaf196077670ULL, 0x0000003084fbb3caULL },
+    { 0x158f0d45360e45d9ULL, 0x0c4a992b21bd6c73ULL, 0x0000002f360394fcULL },
+    { 0xcf906b5648d8dc12ULL, 0xf194fc913ac5bf1fULL, 0x0000003aaf3b77dfULL },
+    { 0x6963e2a793b0e725ULL, 0xf733866156c83f65ULL, 0x0000003424155e74ULL },
+    { 0xc8b0d83a0adfe719ULL, 0xed97298c8451707bULL, 0x0000001b3bb1e005ULL },
+    { 0xfe09f1884cdcfa0aULL, 0xa7cf3e5274792892ULL, 0x00000001615770fbULL },
+    { 0x8e4ab734ddb11cf5ULL, 0x059f0d23e2fd1919ULL, 0x0000003a97d64872ULL },
+    { 0x5974e52567b9f06dULL, 0xad453225b2f8fb72ULL, 0x0000001a8c3d0224ULL },
+    { 0xb437c41c6fa699c2ULL, 0x747ecaf313cffbb7ULL, 0x000000088a1c1ee7ULL },
+    { 0x8794ffc1719448b8ULL, 0x27eea7c2dfaa37f2ULL, 0x00000035e3cbeef8ULL },
+    { 0x015a239514b92691ULL, 0x25268bc6dd4a458fULL, 0x00000039c73fd5bdULL },
+    { 0xe388c59e8d43569dULL, 0x54ec275268396d7dULL, 0x0000002c09ed7ab7ULL },
+    { 0x57de9aef3604ef67ULL, 0xfc9ef5053190bb5cULL, 0x0000002aaf6c2c21ULL },
+    { 0xfb9a62c48f833a40ULL, 0x04e2455b31a406f3ULL, 0x00000007e9c56b6dULL },
+    { 0x8940ac9b56768000ULL, 0x48069f71d73e742aULL, 0x00000019620b1bf4ULL },
+    { 0xaa91e50281000000ULL, 0x60e6b42ef6e208fcULL, 0x00000038e04d9b90ULL },
+    { 0x75f093ca00000000ULL, 0x4153aad9fe659a22ULL, 0x000000219da162c5ULL },
+    { 0x4a21640000000000ULL, 0x09947660d58895d8ULL, 0x0000002ded533a41ULL },
+    { 0x80e8000000000000ULL, 0xacdf5730c36ef4a0ULL, 0x0000000f24884c26ULL },
+    { 0x1000000000000000ULL, 0xeb2c9d55b349a947ULL, 0x000000090139fbdaULL },
+    { 0x0000000000000000ULL, 0x9a0573cb5501b2a0ULL, 0x00000032f8917eaaULL },
+    { 0x0000000000000000ULL, 0xd246f843ab324000ULL, 0x00000027b8a6867fULL },
+    { 0x0000000000000000ULL, 0xf10ef61026800000ULL, 0x0000001dc2bfb5d4ULL },
+    { 0x0000000000000000ULL, 0x8cbf676100000000ULL, 0x00000031944f7bebULL },
+    { 0x0000000000000000ULL, 0x92ec8a0000000000ULL, 0x00000036d7dca506ULL },
+    { 0x0000000000000000ULL, 0xa8e4000000000000ULL, 0x0000000187d61607ULL },
+    { 0x0000000000000000ULL, 0xe800000000000000ULL, 0x00000001c88e306bULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000191fb6b510ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000003b9aca000ULL },
+    /* 61 */
+    { 0xd31c29dde93228b0ULL, 0x0000000000000070ULL, 0x0000000000000000ULL },
+    { 0x8d45f18e7065dd8eULL, 0x0000001a44df832bULL, 0x0000000000000000ULL },
+    { 0x54317c0762380641ULL, 0x1dc1ac084f427838ULL, 0x0000000000000006ULL },
+    { 0x5bf1d2a4bbdbcb0dULL, 0x39028e3bc0267fc9ULL, 0x000000016c8e5ca2ULL },
+    { 0x7e9aa63f650a0072ULL, 0x59759c3aa826ed91ULL, 0x00000025c539e34dULL },
+    { 0xa59a1bd855df90d9ULL, 0x4d5068da29289b3eULL, 0x000000120262f458ULL },
+    { 0x35e6e2a177afd2e4ULL, 0xcd7542aede5991cbULL, 0x000000148f35b78aULL },
+    { 0xba8aedd00b303d31ULL, 0xf10e61ee36b4fba7ULL, 0x0000002051472506ULL },
+    { 0xa16101f2ff2f93bbULL, 0x292e9609d9769593ULL, 0x000000019dc0cd6eULL },
+    { 0xb887370669df2bc7ULL, 0x496eeb669306ed24ULL, 0x00000019a6196f19ULL },
+    { 0x45ad2ee13ee0a267ULL, 0xc555fad595bd24a0ULL, 0x00000005e336b0ebULL },
+    { 0xc3fb542c76d0d827ULL, 0xf5eb3360375f4af6ULL, 0x00000036e509903dULL },
+    { 0x328cb133b9419553ULL, 0xab2e314b28c3883bULL, 0x0000000e6d24085fULL },
+    { 0x88a25f0b8b2eae01ULL, 0x6c80e42fe1c18b5cULL, 0x00000016464c1c38ULL },
+    { 0xf5049801aee2f7d5ULL, 0x01e331aee11ea164ULL, 0x0000000d231f7fbeULL },
+    { 0x7442d7a612739eceULL, 0x76497941868d1d21ULL, 0x0000002c3d526c9cULL },
+    { 0xbe50c9b62c623793ULL, 0x051b2ac594e7bda5ULL, 0x000000246ddd8c7bULL },
+    { 0x12fb14e99e4cedccULL, 0xb3ece39c2435e342ULL, 0x0000001ca48f673aULL },
+    { 0x8a854bfd9a7c24e9ULL, 0xd3df685d75716bd6ULL, 0x0000000daaf626eeULL },
+    { 0x571fa715c67283deULL, 0x9aa388c0d0135600ULL, 0x000000379b3c64a0ULL },
+    { 0x81acf3ddb3e9c99fULL, 0xbdd9c4a31224f94bULL, 0x0000002564bf70e9ULL },
+    { 0x44420c1145a7fc31ULL, 0xb4701c038b047291ULL, 0x000000366c15d51fULL },
+    { 0x5af73f2360290fbcULL, 0x214672c5e884e85fULL, 0x0000000761c16646ULL },
+    { 0x3a433933fecafdb1ULL, 0x3e34aafaa2aef210ULL, 0x0000001054129716ULL },
+    { 0x702315a08aae89e4ULL, 0x2d2df36566315898ULL, 0x000000052dc91c2cULL },
+    { 0xb19a54342d33dc56ULL, 0x0b9adbbd5d73d392ULL, 0x0000000a491fa063ULL },
+    { 0x743f50a52851779aULL, 0x05d7552d7a1f2862ULL, 0x000000170f8fd2f5ULL },
+    { 0x89475962a76f7036ULL, 0xa1b6876991e23566ULL, 0x000000390c7f7ac6ULL },
+    { 0xce774003c6a97007ULL, 0xd0fa317f3f74eed7ULL, 0x0000002e3f5f149cULL },
+    { 0x79918980a5c18262ULL, 0x853a8775aeddf867ULL, 0x0000002482fb1ccfULL },
+    { 0x3416d23fad18311aULL, 0xcafb35c26d45522aULL, 0x00000030512e618dULL },
+    { 0x2918f2736c201d82ULL, 0x5e901fdbda39e549ULL, 0x000000210383e2acULL },
+    { 0x22a9856fea130404ULL, 0x8eb018dd79673350ULL, 0x0000002822041ca8ULL },
+    { 0xd38f80103361eaadULL, 0xf3d492b3c4af2714ULL, 0x000000273ecd6c40ULL },
+    { 0x00a342881c8cc888ULL, 0x6a3a8891841fc5c6ULL, 0x0000000f1f77ec15ULL },
+    { 0x36f5056eeeb9ac8eULL, 0xe0bf9ff2ad503f0cULL, 0x00000004fc6e4a81ULL },
+    { 0x2c09eed4fd91a4efULL, 0x5a233d8f0fc32b03ULL, 0x0000001e3d53d87aULL },
+    { 0x99052ab4feea0db9ULL, 0xcf4458c19aff48c4ULL, 0x0000001c7cc0e382ULL },
+    { 0x7b541b1a69aa1741ULL, 0xf138d7a484f35eb1ULL, 0x0000001e74dca71dULL },
+    { 0xc1a09b0df996dcf0ULL, 0x7dc3e221e6e89e27ULL, 0x00000006f8b2d63bULL },
+    { 0x3946f09d3a934dbbULL, 0x690b4495da55dd22ULL, 0x0000000dd9f4be30ULL },
+    { 0xf4f13fbef7329120ULL, 0xaf955fe5aa46cf52ULL, 0x0000000b457afc78ULL },
+    { 0xb8260aeb9383a9aaULL, 0x7c11f8bcb5f26817ULL, 0x0000001c19704781ULL },
+    { 0xe153f7b3f1fe3e44ULL, 0x4db939615bd842b4ULL, 0x0000001e25e2f309ULL },
+    { 0xbc79283dad8f8efaULL, 0x1c02e9f07560a065ULL, 0x000000022a89c8faULL },
+    { 0x05db2942da65d79dULL, 0x724b9db62e3393e0ULL, 0x0000003a3baedfc5ULL },
+    { 0x291b9a4920baa6e6ULL, 0x86af6e9048cbccf8ULL, 0x0000002df8b9fb05ULL },
+    { 0x724668928b5fce7aULL, 0x30d09c474e7de799ULL, 0x000000014961d04aULL },
+    { 0x3cca8e31ba4d0a32ULL, 0x0d4c800d08640ca0ULL, 0x00000011461bfc07ULL },
+    { 0xd40d10b25f4cd92dULL, 0x65d063b7785db096ULL, 0x00000001a4543206ULL },
+    { 0x7670c97a789bbda1ULL, 0xb3cac508eaf19607ULL, 0x000000017d5552adULL },
+    { 0x6c73158f0d45360fULL, 0x94fc0c4a992b21bdULL, 0x000000287176f341ULL },
+    { 0xbf1fcf906b5648d9ULL, 0x77dff194fc913ac5ULL, 0x0000000f44fd7603ULL },
+    { 0x3f656963e2a793b1ULL, 0x5e74f733866156c8ULL, 0x00000000ceb975fbULL },
+    { 0x707bc8b0d83a0ae0ULL, 0xe005ed97298c8451ULL, 0x0000003a86c21fddULL },
+    { 0x2892fe09f1884cddULL, 0x70fba7cf3e527479ULL, 0x00000033a8c93417ULL },
+    { 0x19198e4ab734ddb2ULL, 0x4872059f0d23e2fdULL, 0x0000000575367636ULL },
+    { 0xfb725974e52567baULL, 0x0224ad453225b2f8ULL, 0x0000000ca384b10dULL },
+    { 0xfbb7b437c41c6fa7ULL, 0x1ee7747ecaf313cfULL, 0x00000003075c01b0ULL },
+    { 0x37f28794ffc17195ULL, 0xeef827eea7c2dfaaULL, 0x00000029019ce777ULL },
+    { 0x458f015a239514baULL, 0xd5bd25268bc6dd4aULL, 0x0000001bec97950bULL },
+    { 0x6d7de388c59e8d44ULL, 0x7ab754ec27526839ULL, 0x00000002c16a81ffULL },
+    { 0xbb5c57de9aef3605ULL, 0x2c21fc9ef5053190ULL, 0x0000003b7bc1a9b0ULL },
+    { 0x06f3fb9a62c48f84ULL, 0x6b6d04e2455b31a4ULL, 0x0000002904b1647dULL },
+    { 0x742a8940ac9b5677ULL, 0x1bf448069f71d73eULL, 0x0000001d3397b679ULL },
+    { 0x08fcaa91e5028100ULL, 0x9b9060e6b42ef6e2ULL, 0x0000001c32abad9bULL },
+    { 0x9a2275f093ca0000ULL, 0x62c54153aad9fe65ULL, 0x000000243af0a3efULL },
+    { 0x95d84a2164000000ULL, 0x3a4109947660d588ULL, 0x00000037bc81c4a7ULL },
+    { 0xf4a080e800000000ULL, 0x4c26acdf5730c36eULL, 0x00000026ef89fc4cULL },
+    { 0xa947100000000000ULL, 0xfbdaeb2c9d55b349ULL, 0x00000011c3aeed31ULL },
+    { 0xb2a0000000000000ULL, 0x7eaa9a0573cb5501ULL, 0x0000000ba344669fULL },
+    { 0x4000000000000000ULL, 0x867fd246f843ab32ULL, 0x0000002522a15e12ULL },
+    { 0x0000000000000000ULL, 0xb5d4f10ef6102680ULL, 0x000000045032fc7bULL },
+    { 0x0000000000000000ULL, 0x7beb8cbf67610000ULL, 0x0000001ccdb51321ULL },
+    { 0x0000000000000000ULL, 0xa50692ec8a000000ULL, 0x00000007cbce40eaULL },
+    { 0x0000000000000000ULL, 0x1607a8e400000000ULL, 0x00000036a1e8f008ULL },
+    { 0x0000000000000000ULL, 0x306be80000000000ULL, 0x00000001e1f765eaULL },
+    { 0x0000000000000000ULL, 0xb510000000000000ULL, 0x0000003686c2c996ULL },
+    { 0x0000000000000000ULL, 0xa000000000000000ULL, 0x0000002316da867eULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001d7b702a40ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000ee6b28000ULL },
+    /* 62 */
+    { 0x832b8d45f18e7066ULL, 0x00000000001a44dfULL, 0x0000000000000000ULL },
+    { 0x783854317c076239ULL, 0x00061dc1ac084f42ULL, 0x0000000000000000ULL },
+    { 0x7fc95bf1d2a4bbdcULL, 0x5ca239028e3bc026ULL, 0x0000000000016c8eULL },
+    { 0xed917e9aa63f650bULL, 0xe34d59759c3aa826ULL, 0x00000021256d71d1ULL },
+    { 0x9b3ea59a1bd855e0ULL, 0xf4584d5068da2928ULL, 0x00000030de4b2d80ULL },
+    { 0x91cb35e6e2a177b0ULL, 0xb78acd7542aede59ULL, 0x0000001e064917bdULL },
+    { 0xfba7ba8aedd00b31ULL, 0x2506f10e61ee36b4ULL, 0x0000002c2c0319adULL },
+    { 0x9593a16101f2ff30ULL, 0xcd6e292e9609d976ULL, 0x0000002850397ef2ULL },
+    { 0xed24b887370669e0ULL, 0x6f19496eeb669306ULL, 0x0000003888278ddbULL },
+    { 0x24a045ad2ee13ee1ULL, 0xb0ebc555fad595bdULL, 0x000000331748ceccULL },
+    { 0x4af6c3fb542c76d1ULL, 0x903df5eb3360375fULL, 0x0000002fa88a47e9ULL },
+    { 0x883b328cb133b942ULL, 0x085fab2e314b28c3ULL, 0x00000036617758c4ULL },
+    { 0x8b5c88a25f0b8b2fULL, 0x1c386c80e42fe1c1ULL, 0x0000002da475c49cULL },
+    { 0xa164f5049801aee3ULL, 0x7fbe01e331aee11eULL, 0x0000002458e52937ULL },
+    { 0x1d217442d7a61274ULL, 0x6c9c76497941868dULL, 0x0000000cebff6d88ULL },
+    { 0xbda5be50c9b62c63ULL, 0x8c7b051b2ac594e7ULL, 0x0000001fc3850b15ULL },
+    { 0xe34212fb14e99e4dULL, 0x673ab3ece39c2435ULL, 0x000000050467dd07ULL },
+    { 0x6bd68a854bfd9a7dULL, 0x26eed3df685d7571ULL, 0x00000001b944783cULL },
+    { 0x5600571fa715c673ULL, 0x64a09aa388c0d013ULL, 0x0000000e0157ed38ULL },
+    { 0xf94b81acf3ddb3eaULL, 0x70e9bdd9c4a31224ULL, 0x0000000d214a0ba7ULL },
+    { 0x729144420c1145a8ULL, 0xd51fb4701c038b04ULL, 0x00000026fc43ea75ULL },
+    { 0xe85f5af73f23602aULL, 0x6646214672c5e884ULL, 0x0000001b6f5d7dd3ULL },
+    { 0xf2103a433933fecbULL, 0x97163e34aafaa2aeULL, 0x0000003138647e8eULL },
+    { 0x5898702315a08aafULL, 0x1c2c2d2df3656631ULL, 0x00000021330986efULL },
+    { 0xd392b19a54342d34ULL, 0xa0630b9adbbd5d73ULL, 0x00000037ac11cd37ULL },
+    { 0x2862743f50a52852ULL, 0xd2f505d7552d7a1fULL, 0x0000000cf39933cfULL },
+    { 0x356689475962a770ULL, 0x7ac6a1b6876991e2ULL, 0x0000003063475c33ULL },
+    { 0xeed7ce774003c6aaULL, 0x149cd0fa317f3f74ULL, 0x0000000bfc6c41a3ULL },
+    { 0xf86779918980a5c2ULL, 0x1ccf853a8775aeddULL, 0x00000025f85b38c3ULL },
+    { 0x522a3416d23fad19ULL, 0x618dcafb35c26d45ULL, 0x0000002d6d9d1d46ULL },
+    { 0xe5492918f2736c21ULL, 0xe2ac5e901fdbda39ULL, 0x000000106309e60dULL },
+    { 0x335022a9856fea14ULL, 0x1ca88eb018dd7967ULL, 0x000000033ba30a58ULL },
+    { 0x2714d38f80103362ULL, 0x6c40f3d492b3c4afULL, 0x0000001483e19ce5ULL },
+    { 0xc5c600a342881c8dULL, 0xec156a3a8891841fULL, 0x000000356aab1eafULL },
+    { 0x3f0c36f5056eeebaULL, 0x4a81e0bf9ff2ad50ULL, 0x00000028f5c7c4a6ULL },
+    { 0x2b032c09eed4fd92ULL, 0xd87a5a233d8f0fc3ULL, 0x00000026b7b7f7b7ULL },
+    { 0x48c499052ab4feebULL, 0xe382cf4458c19affULL, 0x0000002ace0d7d30ULL },
+    { 0x5eb17b541b1a69abULL, 0xa71df138d7a484f3ULL, 0x0000000b61fe95faULL },
+    { 0x9e27c1a09b0df997ULL, 0xd63b7dc3e221e6e8ULL, 0x0000003a5c123678ULL },
+    { 0xdd223946f09d3a94ULL, 0xbe30690b4495da55ULL, 0x0000001c226feed0ULL },
+    { 0xcf52f4f13fbef733ULL, 0xfc78af955fe5aa46ULL, 0x000000309a0c4766ULL },
+    { 0x6817b8260aeb9384ULL, 0x47817c11f8bcb5f2ULL, 0x00000017fa74f448ULL },
+    { 0x42b4e153f7b3f1ffULL, 0xf3094db939615bd8ULL, 0x00000010d42ee3e8ULL },
+    { 0xa065bc79283dad90ULL, 0xc8fa1c02e9f07560ULL, 0x000000363cdd2847ULL },
+    { 0x93e005db2942da66ULL, 0xdfc5724b9db62e33ULL, 0x00000010b6b92f7eULL },
+    { 0xccf8291b9a4920bbULL, 0xfb0586af6e9048cbULL, 0x0000001d8a493aafULL },
+    { 0xe799724668928b60ULL, 0xd04a30d09c474e7dULL, 0x00000028f942236fULL },
+    { 0x0ca03cca8e31ba4eULL, 0xfc070d4c800d0864ULL, 0x0000001a089ca03bULL },
+    { 0xb096d40d10b25f4dULL, 0x320665d063b7785dULL, 0x0000000df75a912cULL },
+    { 0x96077670c97a789cULL, 0x52adb3cac508eaf1ULL, 0x0000000a4a4070c9ULL },
+    { 0x21bd6c73158f0d46ULL, 0xf34194fc0c4a992bULL, 0x0000002edfc8a02aULL },
+    { 0x3ac5bf1fcf906b57ULL, 0x760377dff194fc91ULL, 0x0000000a000856bbULL },
+    { 0x56c83f656963e2a8ULL, 0x75fb5e74f7338661ULL, 0x0000002ba58bb5d5ULL },
+    { 0x8451707bc8b0d83bULL, 0x1fdde005ed97298cULL, 0x00000031b3425714ULL },
+    { 0x74792892fe09f189ULL, 0x341770fba7cf3e52ULL, 0x00000004af832f3fULL },
+    { 0xe2fd19198e4ab735ULL, 0x76364872059f0d23ULL, 0x0000000eb7389c3eULL },
+    { 0xb2f8fb725974e526ULL, 0xb10d0224ad453225ULL, 0x0000000e8b02e8a0ULL },
+    { 0x13cffbb7b437c41dULL, 0x01b01ee7747ecaf3ULL, 0x0000002569f74d06ULL },
+    { 0xdfaa37f28794ffc2ULL, 0xe777eef827eea7c2ULL, 0x0000000166055866ULL },
+    { 0xdd4a458f015a2396ULL, 0x950bd5bd25268bc6ULL, 0x00000017f59114ddULL },
+    { 0x68396d7de388c59fULL, 0x81ff7ab754ec2752ULL, 0x0000003397543afcULL },
+    { 0x3190bb5c57de9af0ULL, 0xa9b02c21fc9ef505ULL, 0x0000003acaa3538bULL },
+    { 0x31a406f3fb9a62c5ULL, 0x647d6b6d04e2455bULL, 0x00000020848de20bULL },
+    { 0xd73e742a8940ac9cULL, 0xb6791bf448069f71ULL, 0x00000002a70c587fULL },
+    { 0xf6e208fcaa91e503ULL, 0xad9b9b9060e6b42eULL, 0x0000001dbc467447ULL },
+    { 0xfe659a2275f093caULL, 0xa3ef62c54153aad9ULL, 0x00000010b059db72ULL },
+    { 0xd58895d84a216400ULL, 0xc4a73a4109947660ULL, 0x0000001ab1193f1fULL },
+    { 0xc36ef4a080e80000ULL, 0xfc4c4c26acdf5730ULL, 0x000000076587e831ULL },
+    { 0xb349a94710000000ULL, 0xed31fbdaeb2c9d55ULL, 0x0000000ba35ecc86ULL },
+    { 0x5501b2a000000000ULL, 0x669f7eaa9a0573cbULL, 0x0000001f6a3fac46ULL },
+    { 0xab32400000000000ULL, 0x5e12867fd246f843ULL, 0x0000001064380b1dULL },
+    { 0x2680000000000000ULL, 0xfc7bb5d4f10ef610ULL, 0x00000006d670085eULL },
+    { 0x0000000000000000ULL, 0x13217beb8cbf6761ULL, 0x000000161d9f588dULL },
+    { 0x0000000000000000ULL, 0x40eaa50692ec8a00ULL, 0x00000020d8b58accULL },
+    { 0x0000000000000000ULL, 0xf0081607a8e40000ULL, 0x0000002f8e764c68ULL },
+    { 0x0000000000000000ULL, 0x65ea306be8000000ULL, 0x000000186ec50f57ULL },
+    { 0x0000000000000000ULL, 0xc996b51000000000ULL, 0x0000001459553e74ULL },
+    { 0x0000000000000000ULL, 0x867ea00000000000ULL, 0x0000001b31132774ULL },
+    { 0x0000000000000000ULL, 0x2a40000000000000ULL, 0x0000001b2174092cULL },
+    { 0x0000000000000000ULL, 0x8000000000000000ULL, 0x0000000a487103d6ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000031f1324100ULL },
+    /* 63 */
+    { 0x44df832b8d45f18fULL, 0x000000000000001aULL, 0x0000000000000000ULL },
+    { 0x4f42783854317c08ULL, 0x000000061dc1ac08ULL, 0x0000000000000000ULL },
+    { 0xc0267fc95bf1d2a5ULL, 0x6c8e5ca239028e3bULL, 0x0000000000000001ULL },
+    { 0xa826ed917e9aa640ULL, 0x71d1e34d59759c3aULL, 0x0000000054e13ca5ULL },
+    { 0x29289b3ea59a1bd9ULL, 0x2d80f4584d5068daULL, 0x0000002685446375ULL },
+    { 0xde5991cb35e6e2a2ULL, 0x17bdb78acd7542aeULL, 0x0000001b48568dcbULL },
+    { 0x36b4fba7ba8aedd1ULL, 0x19ad2506f10e61eeULL, 0x0000002f49454229ULL },
+    { 0xd9769593a16101f3ULL, 0x7ef2cd6e292e9609ULL, 0x0000000991c4c7f3ULL },
+    { 0x9306ed24b8873707ULL, 0x8ddb6f19496eeb66ULL, 0x00000038b17c7593ULL },
+    { 0x95bd24a045ad2ee2ULL, 0xceccb0ebc555fad5ULL, 0x000000225ae9568aULL },
+    { 0x375f4af6c3fb542dULL, 0x47e9903df5eb3360ULL, 0x0000002051971b16ULL },
+    { 0x28c3883b328cb134ULL, 0x58c4085fab2e314bULL, 0x00000005300bab7dULL },
+    { 0xe1c18b5c88a25f0cULL, 0xc49c1c386c80e42fULL, 0x0000001d2f3f7be5ULL },
+    { 0xe11ea164f5049802ULL, 0x29377fbe01e331aeULL, 0x000000357f3d8d8dULL },
+    { 0x868d1d217442d7a7ULL, 0x6d886c9c76497941ULL, 0x00000020ddd9f859ULL },
+    { 0x94e7bda5be50c9b7ULL, 0x0b158c7b051b2ac5ULL, 0x00000014d250e587ULL },
+    { 0x2435e34212fb14eaULL, 0xdd07673ab3ece39cULL, 0x0000001f71353115ULL },
+    { 0x75716bd68a854bfeULL, 0x783c26eed3df685dULL, 0x000000051728eba6ULL },
+    { 0xd0135600571fa716ULL, 0xed3864a09aa388c0ULL, 0x00000026c25d8c07ULL },
+    { 0x1224f94b81acf3deULL, 0x0ba770e9bdd9c4a3ULL, 0x00000001d876f44cULL },
+    { 0x8b04729144420c12ULL, 0xea75d51fb4701c03ULL, 0x00000011b4aa9af1ULL },
+    { 0xe884e85f5af73f24ULL, 0x7dd36646214672c5ULL, 0x00000038534f1601ULL },
+    { 0xa2aef2103a433934ULL, 0x7e8e97163e34aafaULL, 0x0000000058e69706ULL },
+    { 0x66315898702315a1ULL, 0x86ef1c2c2d2df365ULL, 0x0000000183181e75ULL },
+    { 0x5d73d392b19a5435ULL, 0xcd37a0630b9adbbdULL, 0x0000001b5d2903cdULL },
+    { 0x7a1f2862743f50a6ULL, 0x33cfd2f505d7552dULL, 0x0000002feabba95bULL },
+    { 0x91e2356689475963ULL, 0x5c337ac6a1b68769ULL, 0x000000153c160785ULL },
+    { 0x3f74eed7ce774004ULL, 0x41a3149cd0fa317fULL, 0x0000001f0ce28f04ULL },
+    { 0xaeddf86779918981ULL, 0x38c31ccf853a8775ULL, 0x00000000fdb36da5ULL },
+    { 0x6d45522a3416d240ULL, 0x1d46618dcafb35c2ULL, 0x0000002677fb7bcdULL },
+    { 0xda39e5492918f274ULL, 0xe60de2ac5e901fdbULL, 0x0000002fc1c4adebULL },
+    { 0x7967335022a98570ULL, 0x0a581ca88eb018ddULL, 0x00000036eca7bb1fULL },
+    { 0xc4af2714d38f8011ULL, 0x9ce56c40f3d492b3ULL, 0x000000073a2705c5ULL },
+    { 0x841fc5c600a34289ULL, 0x1eafec156a3a8891ULL, 0x0000002e02a52fc3ULL },
+    { 0xad503f0c36f5056fULL, 0xc4a64a81e0bf9ff2ULL, 0x0000002d6e0cf773ULL },
+    { 0x0fc32b032c09eed5ULL, 0xf7b7d87a5a233d8fULL, 0x0000001af451f85fULL },
+    { 0x9aff48c499052ab5ULL, 0x7d30e382cf4458c1ULL, 0x00000016581e1cf3ULL },
+    { 0x84f35eb17b541b1bULL, 0x95faa71df138d7a4ULL, 0x00000038b113b4a0ULL },
+    { 0xe6e89e27c1a09b0eULL, 0x3678d63b7dc3e221ULL, 0x0000002563a9b3a4ULL },
+    { 0xda55dd223946f09eULL, 0xeed0be30690b4495ULL, 0x000000263bd8310bULL },
+    { 0xaa46cf52f4f13fbfULL, 0x4766fc78af955fe5ULL, 0x00000002c7412fd8ULL },
+    { 0xb5f26817b8260aecULL, 0xf44847817c11f8bcULL, 0x000000325b3a587aULL },
+    { 0x5bd842b4e153f7b4ULL, 0xe3e8f3094db93961ULL, 0x0000001ca0a4a0b6ULL },
+    { 0x7560a065bc79283eULL, 0x2847c8fa1c02e9f0ULL, 0x0000002a951c19fbULL },
+    { 0x2e3393e005db2943ULL, 0x2f7edfc5724b9db6ULL, 0x0000003a7a24f449ULL },
+    { 0x48cbccf8291b9a4aULL, 0x3aaffb0586af6e90ULL, 0x000000110a328f5fULL },
+    { 0x4e7de79972466893ULL, 0x236fd04a30d09c47ULL, 0x000000162c1b0106ULL },
+    { 0x08640ca03cca8e32ULL, 0xa03bfc070d4c800dULL, 0x000000016de0ee3aULL },
+    { 0x785db096d40d10b3ULL, 0x912c320665d063b7ULL, 0x0000000da660799aULL },
+    { 0xeaf196077670c97bULL, 0x70c952adb3cac508ULL, 0x00000023fcea7aaaULL },
+    { 0x992b21bd6c731590ULL, 0xa02af34194fc0c4aULL, 0x00000027af0cbc28ULL },
+    { 0xfc913ac5bf1fcf91ULL, 0x56bb760377dff194ULL, 0x00000009757a4e48ULL },
+    { 0x866156c83f656964ULL, 0xb5d575fb5e74f733ULL, 0x00000010d7ba7567ULL },
+    { 0x298c8451707bc8b1ULL, 0x57141fdde005ed97ULL, 0x00000018259d6a14ULL },
+    { 0x3e5274792892fe0aULL, 0x2f3f341770fba7cfULL, 0x00000004bc5e1229ULL },
+    { 0x0d23e2fd19198e4bULL, 0x9c3e76364872059fULL, 0x0000000996ca7c4eULL },
+    { 0x3225b2f8fb725975ULL, 0xe8a0b10d0224ad45ULL, 0x000000124d8a6a1aULL },
+    { 0xcaf313cffbb7b438ULL, 0x4d0601b01ee7747eULL, 0x0000000643e23507ULL },
+    { 0xa7c2dfaa37f28795ULL, 0x5866e777eef827eeULL, 0x00000001b32a7ac7ULL },
+    { 0x8bc6dd4a458f015bULL, 0x14dd950bd5bd2526ULL, 0x0000002e69e83101ULL },
+    { 0x275268396d7de389ULL, 0x3afc81ff7ab754ecULL, 0x000000004076791cULL },
+    { 0xf5053190bb5c57dfULL, 0x538ba9b02c21fc9eULL, 0x0000000692a9f467ULL },
+    { 0x455b31a406f3fb9bULL, 0xe20b647d6b6d04e2ULL, 0x000000180ebafa0bULL },
+    { 0x9f71d73e742a8941ULL, 0x587fb6791bf44806ULL, 0x00000002c447fb60ULL },
+    { 0xb42ef6e208fcaa92ULL, 0x7447ad9b9b9060e6ULL, 0x000000166ea6b1b6ULL },
+    { 0xaad9fe659a2275f1ULL, 0xdb72a3ef62c54153ULL, 0x0000002a7b1e6fe1ULL },
+    { 0x7660d58895d84a22ULL, 0x3f1fc4a73a410994ULL, 0x000000349623a5e7ULL },
+    { 0x5730c36ef4a080e8ULL, 0xe831fc4c4c26acdfULL, 0x00000035d75ec33dULL },
+    { 0x9d55b349a9471000ULL, 0xcc86ed31fbdaeb2cULL, 0x0000000e69f20c6eULL },
+    { 0x73cb5501b2a00000ULL, 0xac46669f7eaa9a05ULL, 0x00000019cc218f37ULL },
+    { 0xf843ab3240000000ULL, 0x0b1d5e12867fd246ULL, 0x0000000cf65dc9f0ULL },
+    { 0xf610268000000000ULL, 0x085efc7bb5d4f10eULL, 0x00000037e3b3dd1eULL },
+    { 0x6761000000000000ULL, 0x588d13217beb8cbfULL, 0x00000006fe169fefULL },
+    { 0x8a00000000000000ULL, 0x8acc40eaa50692ecULL, 0x00000037ba20a425ULL },
+    { 0x0000000000000000ULL, 0x4c68f0081607a8e4ULL, 0x00000008bdb0315aULL },
+    { 0x0000000000000000ULL, 0x0f5765ea306be800ULL, 0x00000015063566bdULL },
+    { 0x0000000000000000ULL, 0x3e74c996b5100000ULL, 0x0000002c04d98d2bULL },
+    { 0x0000000000000000ULL, 0x2774867ea0000000ULL, 0x0000000a118a9bffULL },
+    { 0x0000000000000000ULL, 0x092c2a4000000000ULL, 0x0000003b685eec3aULL },
+    { 0x0000000000000000ULL, 0x03d6800000000000ULL, 0x0000000d83347d8bULL },
+    { 0x0000000000000000ULL, 0x4100000000000000ULL, 0x000000205df06f90ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000219633ed4aULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000113abe6400ULL },
+    /* 64 */
+    { 0xac084f4278385432ULL, 0x0000000000061dc1ULL, 0x0000000000000000ULL },
+    { 0x8e3bc0267fc95bf2ULL, 0x00016c8e5ca23902ULL, 0x0000000000000000ULL },
+    { 0x9c3aa826ed917e9bULL, 0x3ca571d1e34d5975ULL, 0x00000000000054e1ULL },
+    { 0x68da29289b3ea59bULL, 0x63752d80f4584d50ULL, 0x00000034712a569cULL },
+    { 0x42aede5991cb35e7ULL, 0x8dcb17bdb78acd75ULL, 0x00000024697b3c74ULL },
+    { 0x61ee36b4fba7ba8bULL, 0x422919ad2506f10eULL, 0x0000001b23271287ULL },
+    { 0x9609d9769593a162ULL, 0xc7f37ef2cd6e292eULL, 0x0000001f7e07ffd8ULL },
+    { 0xeb669306ed24b888ULL, 0x75938ddb6f19496eULL, 0x0000003279287482ULL },
+    { 0xfad595bd24a045aeULL, 0x568aceccb0ebc555ULL, 0x0000001e5ffaad3bULL },
+    { 0x3360375f4af6c3fcULL, 0x1b1647e9903df5ebULL, 0x0000000dd0d2df73ULL },
+    { 0x314b28c3883b328dULL, 0xab7d58c4085fab2eULL, 0x0000001accd74159ULL },
+    { 0xe42fe1c18b5c88a3ULL, 0x7be5c49c1c386c80ULL, 0x00000014e0bdce2dULL },
+    { 0x31aee11ea164f505ULL, 0x8d8d29377fbe01e3ULL, 0x0000000a970e604bULL },
+    { 0x7941868d1d217443ULL, 0xf8596d886c9c7649ULL, 0x00000011974e4d1bULL },
+    { 0x2ac594e7bda5be51ULL, 0xe5870b158c7b051bULL, 0x0000000683261400ULL },
+    { 0xe39c2435e34212fcULL, 0x3115dd07673ab3ecULL, 0x000000003570e7e7ULL },
+    { 0x685d75716bd68a86ULL, 0xeba6783c26eed3dfULL, 0x00000035d419fdd2ULL },
+    { 0x88c0d01356005720ULL, 0x8c07ed3864a09aa3ULL, 0x000000311bd78dcbULL },
+    { 0xc4a31224f94b81adULL, 0xf44c0ba770e9bdd9ULL, 0x0000002f6458aceeULL },
+    { 0x1c038b0472914443ULL, 0x9af1ea75d51fb470ULL, 0x00000037a2c90932ULL },
+    { 0x72c5e884e85f5af8ULL, 0x16017dd366462146ULL, 0x0000000bc84ee4d3ULL },
+    { 0xaafaa2aef2103a44ULL, 0x97067e8e97163e34ULL, 0x0000003125b42442ULL },
+    { 0xf365663158987024ULL, 0x1e7586ef1c2c2d2dULL, 0x0000000f8111e43eULL },
+    { 0xdbbd5d73d392b19bULL, 0x03cdcd37a0630b9aULL, 0x0000000e76946cd5ULL },
+    { 0x552d7a1f28627440ULL, 0xa95b33cfd2f505d7ULL, 0x0000003198accd19ULL },
+    { 0x876991e235668948ULL, 0x07855c337ac6a1b6ULL, 0x00000005f98c2570ULL },
+    { 0x317f3f74eed7ce78ULL, 0x8f0441a3149cd0faULL, 0x0000001a1578a868ULL },
+    { 0x8775aeddf8677992ULL, 0x6da538c31ccf853aULL, 0x00000018582e8489ULL },
+    { 0x35c26d45522a3417ULL, 0x7bcd1d46618dcafbULL, 0x0000001fff5d79fdULL },
+    { 0x1fdbda39e5492919ULL, 0xadebe60de2ac5e90ULL, 0x0000003b04ccc2d2ULL },
+    { 0x18dd7967335022aaULL, 0xbb1f0a581ca88eb0ULL, 0x000000310d783b29ULL },
+    { 0x92b3c4af2714d390ULL, 0x05c59ce56c40f3d4ULL, 0x00000009b75ba5b5ULL },
+    { 0x8891841fc5c600a4ULL, 0x2fc31eafec156a3aULL, 0x0000002a25c8da97ULL },
+    { 0x9ff2ad503f0c36f6ULL, 0xf773c4a64a81e0bfULL, 0x00000023336bff22ULL },
+    { 0x3d8f0fc32b032c0aULL, 0xf85ff7b7d87a5a23ULL, 0x00000008242c2137ULL },
+    { 0x58c19aff48c49906ULL, 0x1cf37d30e382cf44ULL, 0x0000000d0815b1ceULL },
+    { 0xd7a484f35eb17b55ULL, 0xb4a095faa71df138ULL, 0x0000002ffd4c2b2bULL },
+    { 0xe221e6e89e27c1a1ULL, 0xb3a43678d63b7dc3ULL, 0x0000000a2d0e27b1ULL },
+    { 0x4495da55dd223947ULL, 0x310beed0be30690bULL, 0x000000295fd92116ULL },
+    { 0x5fe5aa46cf52f4f2ULL, 0x2fd84766fc78af95ULL, 0x000000052ab8c3ebULL },
+    { 0xf8bcb5f26817b827ULL, 0x587af44847817c11ULL, 0x00000036c23b3450ULL },
+    { 0x39615bd842b4e154ULL, 0xa0b6e3e8f3094db9ULL, 0x00000012b4f8f614ULL },
+    { 0xe9f07560a065bc7aULL, 0x19fb2847c8fa1c02ULL, 0x00000004cd831b5cULL },
+    { 0x9db62e3393e005dcULL, 0xf4492f7edfc5724bULL, 0x0000001571ad2fdeULL },
+    { 0x6e9048cbccf8291cULL, 0x8f5f3aaffb0586afULL, 0x00000033e91bbebaULL },
+    { 0x9c474e7de7997247ULL, 0x0106236fd04a30d0ULL, 0x0000002b6fd866f1ULL },
+    { 0x800d08640ca03ccbULL, 0xee3aa03bfc070d4cULL, 0x000000381cf532aaULL },
+    { 0x63b7785db096d40eULL, 0x799a912c320665d0ULL, 0x00000027cc41b22cULL },
+    { 0xc508eaf196077671ULL, 0x7aaa70c952adb3caULL, 0x0000000a5aeade64ULL },
+    { 0x0c4a992b21bd6c74ULL, 0xbc28a02af34194fcULL, 0x0000001765065b50ULL },
+    { 0xf194fc913ac5bf20ULL, 0x4e4856bb760377dfULL, 0x00000012cc2e41d2ULL },
+    { 0xf733866156c83f66ULL, 0x7567b5d575fb5e74ULL, 0x00000030f733b546ULL },
+    { 0xed97298c8451707cULL, 0x6a1457141fdde005ULL, 0x0000001067a91fefULL },
+    { 0xa7cf3e5274792893ULL, 0x12292f3f341770fbULL, 0x00000037be356a02ULL },
+    { 0x059f0d23e2fd191aULL, 0x7c4e9c3e76364872ULL, 0x000000007b700cfeULL },
+    { 0xad453225b2f8fb73ULL, 0x6a1ae8a0b10d0224ULL, 0x0000003b4085b362ULL },
+    { 0x747ecaf313cffbb8ULL, 0x35074d0601b01ee7ULL, 0x00000016e9f5af86ULL },
+    { 0x27eea7c2dfaa37f3ULL, 0x7ac75866e777eef8ULL, 0x0000001f3f5e7afcULL },
+    { 0x25268bc6dd4a4590ULL, 0x310114dd950bd5bdULL, 0x0000003ac8f5062cULL },
+    { 0x54ec275268396d7eULL, 0x791c3afc81ff7ab7ULL, 0x0000000a4a039920ULL },
+    { 0xfc9ef5053190bb5dULL, 0xf467538ba9b02c21ULL, 0x000000078f8bfc23ULL },
+    { 0x04e2455b31a406f4ULL, 0xfa0be20b647d6b6dULL, 0x000000085f113542ULL },
+    { 0x48069f71d73e742bULL, 0xfb60587fb6791bf4ULL, 0x0000000f9820018bULL },
+    { 0x60e6b42ef6e208fdULL, 0xb1b67447ad9b9b90ULL, 0x000000209792e0b4ULL },
+    { 0x4153aad9fe659a23ULL, 0x6fe1db72a3ef62c5ULL, 0x0000002a123688c8ULL },
+    { 0x09947660d58895d9ULL, 0xa5e73f1fc4a73a41ULL, 0x0000002eaafa83b9ULL },
+    { 0xacdf5730c36ef4a1ULL, 0xc33de831fc4c4c26ULL, 0x0000002b397c9590ULL },
+    { 0xeb2c9d55b349a948ULL, 0x0c6ecc86ed31fbdaULL, 0x00000021b486f1d0ULL },
+    { 0x9a0573cb5501b2a0ULL, 0x8f37ac46669f7eaaULL, 0x0000003070a92d99ULL },
+    { 0xd246f843ab324000ULL, 0xc9f00b1d5e12867fULL, 0x00000023c0db2733ULL },
+    { 0xf10ef61026800000ULL, 0xdd1e085efc7bb5d4ULL, 0x0000000c0edaaa4dULL },
+    { 0x8cbf676100000000ULL, 0x9fef588d13217bebULL, 0x00000012210a6078ULL },
+    { 0x92ec8a0000000000ULL, 0xa4258acc40eaa506ULL, 0x0000001c15cb8d96ULL },
+    { 0xa8e4000000000000ULL, 0x315a4c68f0081607ULL, 0x0000002312ea4318ULL },
+    { 0xe800000000000000ULL, 0x66bd0f5765ea306bULL, 0x00000005a20096dfULL },
+    { 0x0000000000000000ULL, 0x8d2b3e74c996b510ULL, 0x0000003403c1a755ULL },
+    { 0x0000000000000000ULL, 0x9bff2774867ea000ULL, 0x00000013eb4364ccULL },
+    { 0x0000000000000000ULL, 0xec3a092c2a400000ULL, 0x0000002fa3ab18acULL },
+    { 0x0000000000000000ULL, 0x7d8b03d680000000ULL, 0x0000002842ffed6cULL },
+    { 0x0000000000000000ULL, 0x6f90410000000000ULL, 0x0000001942882a92ULL },
+    { 0x0000000000000000ULL, 0xed4a000000000000ULL, 0x000000221840e7c9ULL },
+    { 0x0000000000000000ULL, 0x6400000000000000ULL, 0x0000002f03c821c0ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002ccb5ff6e8ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000003604471000ULL },
+    /* 65 */
+    { 0x39028e3bc0267fcaULL, 0x000000016c8e5ca2ULL, 0x0000000000000000ULL },
+    { 0x59759c3aa826ed92ULL, 0x54e13ca571d1e34dULL, 0x0000000000000000ULL },
+    { 0x4d5068da29289b3fULL, 0x569c63752d80f458ULL, 0x0000000013c33b72ULL },
+    { 0xcd7542aede5991ccULL, 0x3c748dcb17bdb78aULL, 0x0000001a9f185d57ULL },
+    { 0xf10e61ee36b4fba8ULL, 0x1287422919ad2506ULL, 0x000000144fae107fULL },
+    { 0x292e9609d9769594ULL, 0xffd8c7f37ef2cd6eULL, 0x0000001d961a963bULL },
+    { 0x496eeb669306ed25ULL, 0x748275938ddb6f19ULL, 0x0000000df83e365eULL },
+    { 0xc555fad595bd24a1ULL, 0xad3b568aceccb0ebULL, 0x00000015fdf6af82ULL },
+    { 0xf5eb3360375f4af7ULL, 0xdf731b1647e9903dULL, 0x0000001e6cefff54ULL },
+    { 0xab2e314b28c3883cULL, 0x4159ab7d58c4085fULL, 0x00000013c2d0eacdULL },
+    { 0x6c80e42fe1c18b5dULL, 0xce2d7be5c49c1c38ULL, 0x0000002fca2af007ULL },
+    { 0x01e331aee11ea165ULL, 0x604b8d8d29377fbeULL, 0x00000001d13cab9aULL },
+    { 0x76497941868d1d22ULL, 0x4d1bf8596d886c9cULL, 0x00000023f189270eULL },
+    { 0x051b2ac594e7bda6ULL, 0x1400e5870b158c7bULL, 0x00000003546b1de8ULL },
+    { 0xb3ece39c2435e343ULL, 0xe7e73115dd07673aULL, 0x0000003608ef5d38ULL },
+    { 0xd3df685d75716bd7ULL, 0xfdd2eba6783c26eeULL, 0x0000000d3fdab05fULL },
+    { 0x9aa388c0d0135601ULL, 0x8dcb8c07ed3864a0ULL, 0x00000016598a0b79ULL },
+    { 0xbdd9c4a31224f94cULL, 0xaceef44c0ba770e9ULL, 0x0000001c4d2d1f9aULL },
+    { 0xb4701c038b047292ULL, 0x09329af1ea75d51fULL, 0x0000002403612681ULL },
+    { 0x214672c5e884e860ULL, 0xe4d316017dd36646ULL, 0x0000001e0b240368ULL },
+    { 0x3e34aafaa2aef211ULL, 0x244297067e8e9716ULL, 0x000000186c29119cULL },
+    { 0x2d2df36566315899ULL, 0xe43e1e7586ef1c2cULL, 0x000000245ac45d79ULL },
+    { 0x0b9adbbd5d73d393ULL, 0x6cd503cdcd37a063ULL, 0x0000001c614dcc7cULL },
+    { 0x05d7552d7a1f2863ULL, 0xcd19a95b33cfd2f5ULL, 0x0000001cf850bde4ULL },
+    { 0xa1b6876991e23567ULL, 0x257007855c337ac6ULL, 0x00000035459cd54eULL },
+    { 0xd0fa317f3f74eed8ULL, 0xa8688f0441a3149cULL, 0x0000001231e100aaULL },
+    { 0x853a8775aeddf868ULL, 0x84896da538c31ccfULL, 0x00000027bc0010beULL },
+    { 0xcafb35c26d45522bULL, 0x79fd7bcd1d46618dULL, 0x0000002c5bbdbb85ULL },
+    { 0x5e901fdbda39e54aULL, 0xc2d2adebe60de2acULL, 0x0000001f13d22046ULL },
+    { 0x8eb018dd79673351ULL, 0x3b29bb1f0a581ca8ULL, 0x0000001079af968cULL },
+    { 0xf3d492b3c4af2715ULL, 0xa5b505c59ce56c40ULL, 0x00000020a66cdbe9ULL },
+    { 0x6a3a8891841fc5c7ULL, 0xda972fc31eafec15ULL, 0x000000366676c3faULL },
+    { 0xe0bf9ff2ad503f0dULL, 0xff22f773c4a64a81ULL, 0x0000003a680e476fULL },
+    { 0x5a233d8f0fc32b04ULL, 0x2137f85ff7b7d87aULL, 0x0000001a1384e962ULL },
+    { 0xcf4458c19aff48c5ULL, 0xb1ce1cf37d30e382ULL, 0x00000016d8fd501fULL },
+    { 0xf138d7a484f35eb2ULL, 0x2b2bb4a095faa71dULL, 0x00000007612478f6ULL },
+    { 0x7dc3e221e6e89e28ULL, 0x27b1b3a43678d63bULL, 0x0000003950cb48fcULL },
+    { 0x690b4495da55dd23ULL, 0x2116310beed0be30ULL, 0x0000003ab59ccc9fULL },
+    { 0xaf955fe5aa46cf53ULL, 0xc3eb2fd84766fc78ULL, 0x000000250cd794c2ULL },
+    { 0x7c11f8bcb5f26818ULL, 0x3450587af4484781ULL, 0x0000002d58eabe19ULL },
+    { 0x4db939615bd842b5ULL, 0xf614a0b6e3e8f309ULL, 0x00000005de4be000ULL },
+    { 0x1c02e9f07560a066ULL, 0x1b5c19fb2847c8faULL, 0x00000000394b8b9fULL },
+    { 0x724b9db62e3393e1ULL, 0x2fdef4492f7edfc5ULL, 0x000000250b823afbULL },
+    { 0x86af6e9048cbccf9ULL, 0xbeba8f5f3aaffb05ULL, 0x0000003a7be96231ULL },
+    { 0x30d09c474e7de79aULL, 0x66f10106236fd04aULL, 0x0000000b9508fbc4ULL },
+    { 0x0d4c800d08640ca1ULL, 0x32aaee3aa03bfc07ULL, 0x0000002dba7a7171ULL },
+    { 0x65d063b7785db097ULL, 0xb22c799a912c3206ULL, 0x0000001a5b1f31b5ULL },
+    { 0xb3cac508eaf19608ULL, 0xde647aaa70c952adULL, 0x0000002a4deccd5eULL },
+    { 0x94fc0c4a992b21beULL, 0x5b50bc28a02af341ULL, 0x00000016169dcc32ULL },
+    { 0x77dff194fc913ac6ULL, 0x41d24e4856bb7603ULL, 0x0000000bb97e45fcULL },
+    { 0x5e74f733866156c9ULL, 0xb5467567b5d575fbULL, 0x0000003abbb21c7dULL },
+    { 0xe005ed97298c8452ULL, 0x1fef6a1457141fddULL, 0x0000001d44c97a7bULL },
+    { 0x70fba7cf3e52747aULL, 0x6a0212292f3f3417ULL, 0x0000001caace8aabULL },
+    { 0x4872059f0d23e2feULL, 0x0cfe7c4e9c3e7636ULL, 0x00000027e9138114ULL },
+    { 0x0224ad453225b2f9ULL, 0xb3626a1ae8a0b10dULL, 0x00000004ab1e49fdULL },
+    { 0x1ee7747ecaf313d0ULL, 0xaf8635074d0601b0ULL, 0x0000003b11bdc733ULL },
+    { 0xeef827eea7c2dfabULL, 0x7afc7ac75866e777ULL, 0x0000000c08b44d74ULL },
+    { 0xd5bd25268bc6dd4bULL, 0x062c310114dd950bULL, 0x0000001b1ec61539ULL },
+    { 0x7ab754ec2752683aULL, 0x9920791c3afc81ffULL, 0x0000000d46e6e4bfULL },
+    { 0x2c21fc9ef5053191ULL, 0xfc23f467538ba9b0ULL, 0x0000002c9c23c845ULL },
+    { 0x6b6d04e2455b31a5ULL, 0x3542fa0be20b647dULL, 0x000000104b6d2fe9ULL },
+    { 0x1bf448069f71d73fULL, 0x018bfb60587fb679ULL, 0x000000364c487df2ULL },
+    { 0x9b9060e6b42ef6e3ULL, 0xe0b4b1b67447ad9bULL, 0x0000003858af265cULL },
+    { 0x62c54153aad9fe66ULL, 0x88c86fe1db72a3efULL, 0x000000159ff21af6ULL },
+    { 0x3a4109947660d589ULL, 0x83b9a5e73f1fc4a7ULL, 0x000000396697024aULL },
+    { 0x4c26acdf5730c36fULL, 0x9590c33de831fc4cULL, 0x000000115969d2daULL },
+    { 0xfbdaeb2c9d55b34aULL, 0xf1d00c6ecc86ed31ULL, 0x00000032e4a2d018ULL },
+    { 0x7eaa9a0573cb5502ULL, 0x2d998f37ac46669fULL, 0x00000005ced018d3ULL },
+    { 0x867fd246f843ab33ULL, 0x2733c9f00b1d5e12ULL, 0x000000312b32745dULL },
+    { 0xb5d4f10ef6102680ULL, 0xaa4ddd1e085efc7bULL, 0x00000015b05c05a0ULL },
+    { 0x7beb8cbf67610000ULL, 0x60789fef588d1321ULL, 0x0000002568652b2eULL },
+    { 0xa50692ec8a000000ULL, 0x8d96a4258acc40eaULL, 0x0000000acc466d8bULL },
+    { 0x1607a8e400000000ULL, 0x4318315a4c68f008ULL, 0x000000207e03022cULL },
+    { 0x306be80000000000ULL, 0x96df66bd0f5765eaULL, 0x0000000a4e39dcdeULL },
+    { 0xb510000000000000ULL, 0xa7558d2b3e74c996ULL, 0x00000033d35be21dULL },
+    { 0xa000000000000000ULL, 0x64cc9bff2774867eULL, 0x00000006e77ec709ULL },
+    { 0x0000000000000000ULL, 0x18acec3a092c2a40ULL, 0x000000022fe93493ULL },
+    { 0x0000000000000000ULL, 0xed6c7d8b03d68000ULL, 0x000000223fa0c3efULL },
+    { 0x0000000000000000ULL, 0x2a926f9041000000ULL, 0x00000037dcca258aULL },
+    { 0x0000000000000000ULL, 0xe7c9ed4a00000000ULL, 0x000000202b5a6164ULL },
+    { 0x0000000000000000ULL, 0x21c0640000000000ULL, 0x000000177e6e980eULL },
+    { 0x0000000000000000ULL, 0xf6e8000000000000ULL, 0x000000034a52cb69ULL },
+    { 0x0000000000000000ULL, 0x1000000000000000ULL, 0x00000018abf99c63ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000171095caa0ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002540be4000ULL },
+    /* 66 */
+    { 0x5ca239028e3bc027ULL, 0x0000000000016c8eULL, 0x0000000000000000ULL },
+    { 0xe34d59759c3aa827ULL, 0x000054e13ca571d1ULL, 0x0000000000000000ULL },
+    { 0xf4584d5068da2929ULL, 0x3b72569c63752d80ULL, 0x00000000000013c3ULL },
+    { 0xb78acd7542aede5aULL, 0x5d573c748dcb17bdULL, 0x0000002d74bf29a6ULL },
+    { 0x2506f10e61ee36b5ULL, 0x107f1287422919adULL, 0x00000026bc1a8710ULL },
+    { 0xcd6e292e9609d977ULL, 0x963bffd8c7f37ef2ULL, 0x00000003bd83e2baULL },
+    { 0x6f19496eeb669307ULL, 0x365e748275938ddbULL, 0x0000002b71716e9aULL },
+    { 0xb0ebc555fad595beULL, 0xaf82ad3b568aceccULL, 0x00000023e7c62892ULL },
+    { 0x903df5eb33603760ULL, 0xff54df731b1647e9ULL, 0x0000002227247105ULL },
+    { 0x085fab2e314b28c4ULL, 0xeacd4159ab7d58c4ULL, 0x000000016578e406ULL },
+    { 0x1c386c80e42fe1c2ULL, 0xf007ce2d7be5c49cULL, 0x000000019c4c02ceULL },
+    { 0x7fbe01e331aee11fULL, 0xab9a604b8d8d2937ULL, 0x000000302e717a9cULL },
+    { 0x6c9c76497941868eULL, 0x270e4d1bf8596d88ULL, 0x000000247a476e77ULL },
+    { 0x8c7b051b2ac594e8ULL, 0x1de81400e5870b15ULL, 0x0000001bbe0bcf31ULL },
+    { 0x673ab3ece39c2436ULL, 0x5d38e7e73115dd07ULL, 0x0000000b6f973bd1ULL },
+    { 0x26eed3df685d7572ULL, 0xb05ffdd2eba6783cULL, 0x00000030bf13653cULL },
+    { 0x64a09aa388c0d014ULL, 0x0b798dcb8c07ed38ULL, 0x0000000e21581c6aULL },
+    { 0x70e9bdd9c4a31225ULL, 0x1f9aaceef44c0ba7ULL, 0x00000018b0c397dbULL },
+    { 0xd51fb4701c038b05ULL, 0x268109329af1ea75ULL, 0x0000003304c68fd7ULL },
+    { 0x6646214672c5e885ULL, 0x0368e4d316017dd3ULL, 0x0000003217f6ab20ULL },
+    { 0x97163e34aafaa2afULL, 0x119c244297067e8eULL, 0x0000000774247c87ULL },
+    { 0x1c2c2d2df3656632ULL, 0x5d79e43e1e7586efULL, 0x0000001f72ba282eULL },
+    { 0xa0630b9adbbd5d74ULL, 0xcc7c6cd503cdcd37ULL, 0x0000000acb93e8afULL },
+    { 0xd2f505d7552d7a20ULL, 0xbde4cd19a95b33cfULL, 0x00000028ee6c6748ULL },
+    { 0x7ac6a1b6876991e3ULL, 0xd54e257007855c33ULL, 0x00000010efbf5cbeULL },
+    { 0x149cd0fa317f3f75ULL, 0x00aaa8688f0441a3ULL, 0x0000002c6e8be7f3ULL },
+    { 0x1ccf853a8775aedeULL, 0x10be84896da538c3ULL, 0x0000003894157a00ULL },
+    { 0x618dcafb35c26d46ULL, 0xbb8579fd7bcd1d46ULL, 0x0000000003e6085dULL },
+    { 0xe2ac5e901fdbda3aULL, 0x2046c2d2adebe60dULL, 0x00000015d2e48760ULL },
+    { 0x1ca88eb018dd7968ULL, 0x968c3b29bb1f0a58ULL, 0x00000016618f92efULL },
+    { 0x6c40f3d492b3c4b0ULL, 0xdbe9a5b505c59ce5ULL, 0x00000037c88feec8ULL },
+    { 0xec156a3a88918420ULL, 0xc3fada972fc31eafULL, 0x0000002ec421a144ULL },
+    { 0x4a81e0bf9ff2ad51ULL, 0x476fff22f773c4a6ULL, 0x0000001002bef7ecULL },
+    { 0xd87a5a233d8f0fc4ULL, 0xe9622137f85ff7b7ULL, 0x000000370354398aULL },
+    { 0xe382cf4458c19b00ULL, 0x501fb1ce1cf37d30ULL, 0x0000002057c79ed7ULL },
+    { 0xa71df138d7a484f4ULL, 0x78f62b2bb4a095faULL, 0x0000003221a76644ULL },
+    { 0xd63b7dc3e221e6e9ULL, 0x48fc27b1b3a43678ULL, 0x0000000ff147877bULL },
+    { 0xbe30690b4495da56ULL, 0xcc9f2116310beed0ULL, 0x0000001cb45d4c6cULL },
+    { 0xfc78af955fe5aa47ULL, 0x94c2c3eb2fd84766ULL, 0x0000001954f19dcfULL },
+    { 0x47817c11f8bcb5f3ULL, 0xbe193450587af448ULL, 0x0000003054cc2bb2ULL },
+    { 0xf3094db939615bd9ULL, 0xe000f614a0b6e3e8ULL, 0x000000299de33437ULL },
+    { 0xc8fa1c02e9f07561ULL, 0x8b9f1b5c19fb2847ULL, 0x0000000d0269100bULL },
+    { 0xdfc5724b9db62e34ULL, 0x3afb2fdef4492f7eULL, 0x00000002b028c530ULL },
+    { 0xfb0586af6e9048ccULL, 0x6231beba8f5f3aafULL, 0x0000000b3ac16dadULL },
+    { 0xd04a30d09c474e7eULL, 0xfbc466f10106236fULL, 0x000000285e77585cULL },
+    { 0xfc070d4c800d0865ULL, 0x717132aaee3aa03bULL, 0x00000015a63f1688ULL },
+    { 0x320665d063b7785eULL, 0x31b5b22c799a912cULL, 0x0000001fc4a4fe49ULL },
+    { 0x52adb3cac508eaf2ULL, 0xcd5ede647aaa70c9ULL, 0x000000110ab68896ULL },
+    { 0xf34194fc0c4a992cULL, 0xcc325b50bc28a02aULL, 0x000000231c83665fULL },
+    { 0x760377dff194fc92ULL, 0x45fc41d24e4856bbULL, 0x000000164dfc0876ULL },
+    { 0x75fb5e74f7338662ULL, 0x1c7db5467567b5d5ULL, 0x0000001b89a49024ULL },
+    { 0x1fdde005ed97298dULL, 0x7a7b1fef6a145714ULL, 0x0000000868669ae1ULL },
+    { 0x341770fba7cf3e53ULL, 0x8aab6a0212292f3fULL, 0x000000347f8ff912ULL },
+    { 0x76364872059f0d24ULL, 0x81140cfe7c4e9c3eULL, 0x00000004512b8df7ULL },
+    { 0xb10d0224ad453226ULL, 0x49fdb3626a1ae8a0ULL, 0x00000039a06690e8ULL },
+    { 0x01b01ee7747ecaf4ULL, 0xc733af8635074d06ULL, 0x0000003615814557ULL },
+    { 0xe777eef827eea7c3ULL, 0x4d747afc7ac75866ULL, 0x000000146ffc01baULL },
+    { 0x950bd5bd25268bc7ULL, 0x1539062c310114ddULL, 0x0000002b607f7188ULL },
+    { 0x81ff7ab754ec2753ULL, 0xe4bf9920791c3afcULL, 0x0000001faf2c4978ULL },
+    { 0xa9b02c21fc9ef506ULL, 0xc845fc23f467538bULL, 0x0000001c25d1280bULL },
+    { 0x647d6b6d04e2455cULL, 0x2fe93542fa0be20bULL, 0x00000002be47e73dULL },
+    { 0xb6791bf448069f72ULL, 0x7df2018bfb60587fULL, 0x0000000e3f09d95eULL },
+    { 0xad9b9b9060e6b42fULL, 0x265ce0b4b1b67447ULL, 0x0000001600291951ULL },
+    { 0xa3ef62c54153aadaULL, 0x1af688c86fe1db72ULL, 0x00000012e4e883eeULL },
+    { 0xc4a73a4109947661ULL, 0x024a83b9a5e73f1fULL, 0x00000037702eeb1bULL },
+    { 0xfc4c4c26acdf5731ULL, 0xd2da9590c33de831ULL, 0x0000000649dbdcfdULL },
+    { 0xed31fbdaeb2c9d56ULL, 0xd018f1d00c6ecc86ULL, 0x0000003b19118056ULL },
+    { 0x669f7eaa9a0573ccULL, 0x18d32d998f37ac46ULL, 0x0000001436736ef0ULL },
+    { 0x5e12867fd246f844ULL, 0x745d2733c9f00b1dULL, 0x00000037e6e50e22ULL },
+    { 0xfc7bb5d4f10ef611ULL, 0x05a0aa4ddd1e085eULL, 0x0000000805a6a7e4ULL },
+    { 0x13217beb8cbf6761ULL, 0x2b2e60789fef588dULL, 0x00000035172b5657ULL },
+    { 0x40eaa50692ec8a00ULL, 0x6d8b8d96a4258accULL, 0x000000144ba87234ULL },
+    { 0xf0081607a8e40000ULL, 0x022c4318315a4c68ULL, 0x0000000c34f26e05ULL },
+    { 0x65ea306be8000000ULL, 0xdcde96df66bd0f57ULL, 0x000000012a8775cdULL },
+    { 0xc996b51000000000ULL, 0xe21da7558d2b3e74ULL, 0x0000002fee609af3ULL },
+    { 0x867ea00000000000ULL, 0xc70964cc9bff2774ULL, 0x00000038c8934bd2ULL },
+    { 0x2a40000000000000ULL, 0x349318acec3a092cULL, 0x00000031135136efULL },
+    { 0x8000000000000000ULL, 0xc3efed6c7d8b03d6ULL, 0x00000037b1c046a8ULL },
+    { 0x0000000000000000ULL, 0x258a2a926f904100ULL, 0x000000274b3354a8ULL },
+    { 0x0000000000000000ULL, 0x6164e7c9ed4a0000ULL, 0x0000002726521a8cULL },
+    { 0x0000000000000000ULL, 0x980e21c064000000ULL, 0x00000020af539cf8ULL },
+    { 0x0000000000000000ULL, 0xcb69f6e800000000ULL, 0x00000039e15ae242ULL },
+    { 0x0000000000000000ULL, 0x9c63100000000000ULL, 0x0000000f8d447e27ULL },
+    { 0x0000000000000000ULL, 0xcaa0000000000000ULL, 0x0000000938fe29adULL },
+    { 0x0000000000000000ULL, 0x4000000000000000ULL, 0x0000002876c7e622ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x00000007f9758680ULL },
+    /* 67 */
+    { 0x71d1e34d59759c3bULL, 0x0000000054e13ca5ULL, 0x0000000000000000ULL },
+    { 0x2d80f4584d5068dbULL, 0x13c33b72569c6375ULL, 0x0000000000000000ULL },
+    { 0x17bdb78acd7542afULL, 0x29a65d573c748dcbULL, 0x000000000499f1bdULL },
+    { 0x19ad2506f10e61efULL, 0x8710107f12874229ULL, 0x0000002c0af9a874ULL },
+    { 0x7ef2cd6e292e960aULL, 0xe2ba963bffd8c7f3ULL, 0x0000001b2195e609ULL },
+    { 0x8ddb6f19496eeb67ULL, 0x6e9a365e74827593ULL, 0x000000024d3b31c5ULL },
+    { 0xceccb0ebc555fad6ULL, 0x2892af82ad3b568aULL, 0x0000002df7dddc92ULL },
+    { 0x47e9903df5eb3361ULL, 0x7105ff54df731b16ULL, 0x0000002207b98ab4ULL },
+    { 0x58c4085fab2e314cULL, 0xe406eacd4159ab7dULL, 0x0000002a0326c0a2ULL },
+    { 0xc49c1c386c80e430ULL, 0x02cef007ce2d7be5ULL, 0x00000025ed0b4c34ULL },
+    { 0x29377fbe01e331afULL, 0x7a9cab9a604b8d8dULL, 0x0000000c1c186c05ULL },
+    { 0x6d886c9c76497942ULL, 0x6e77270e4d1bf859ULL, 0x000000014692308bULL },
+    { 0x0b158c7b051b2ac6ULL, 0xcf311de81400e587ULL, 0x0000002076c3eed7ULL },
+    { 0xdd07673ab3ece39dULL, 0x3bd15d38e7e73115ULL, 0x000000323f3d3eedULL },
+    { 0x783c26eed3df685eULL, 0x653cb05ffdd2eba6ULL, 0x000000373c3a6da1ULL },
+    { 0xed3864a09aa388c1ULL, 0x1c6a0b798dcb8c07ULL, 0x0000002593eb3d0aULL },
+    { 0x0ba770e9bdd9c4a4ULL, 0x97db1f9aaceef44cULL, 0x000000025aa982dbULL },
+    { 0xea75d51fb4701c04ULL, 0x8fd7268109329af1ULL, 0x0000003320c61fecULL },
+    { 0x7dd36646214672c6ULL, 0xab200368e4d31601ULL, 0x00000037142fc6ccULL },
+    { 0x7e8e97163e34aafbULL, 0x7c87119c24429706ULL, 0x0000002fa730d112ULL },
+    { 0x86ef1c2c2d2df366ULL, 0x282e5d79e43e1e75ULL, 0x000000044de0a092ULL },
+    { 0xcd37a0630b9adbbeULL, 0xe8afcc7c6cd503cdULL, 0x0000002207a22f23ULL },
+    { 0x33cfd2f505d7552eULL, 0x6748bde4cd19a95bULL, 0x000000085c56d37cULL },
+    { 0x5c337ac6a1b6876aULL, 0x5cbed54e25700785ULL, 0x0000001cf7060f05ULL },
+    { 0x41a3149cd0fa3180ULL, 0xe7f300aaa8688f04ULL, 0x000000013f9e0123ULL },
+    { 0x38c31ccf853a8776ULL, 0x7a0010be84896da5ULL, 0x000000085c2ade5bULL },
+    { 0x1d46618dcafb35c3ULL, 0x085dbb8579fd7bcdULL, 0x000000154c6d962aULL },
+    { 0xe60de2ac5e901fdcULL, 0x87602046c2d2adebULL, 0x00000009c957cd34ULL },
+    { 0x0a581ca88eb018deULL, 0x92ef968c3b29bb1fULL, 0x0000000c3af60a15ULL },
+    { 0x9ce56c40f3d492b4ULL, 0xeec8dbe9a5b505c5ULL, 0x0000000505e8a1c3ULL },
+    { 0x1eafec156a3a8892ULL, 0xa144c3fada972fc3ULL, 0x0000002d9e8089edULL },
+    { 0xc4a64a81e0bf9ff3ULL, 0xf7ec476fff22f773ULL, 0x0000003753d95dc8ULL },
+    { 0xf7b7d87a5a233d90ULL, 0x398ae9622137f85fULL, 0x0000002ecaa72c3aULL },
+    { 0x7d30e382cf4458c2ULL, 0x9ed7501fb1ce1cf3ULL, 0x0000000d8e7792c1ULL },
+    { 0x95faa71df138d7a5ULL, 0x664478f62b2bb4a0ULL, 0x0000002d14adf453ULL },
+    { 0x3678d63b7dc3e222ULL, 0x877b48fc27b1b3a4ULL, 0x000000136aff1bc3ULL },
+    { 0xeed0be30690b4496ULL, 0x4c6ccc9f2116310bULL, 0x0000002d867332e3ULL },
+    { 0x4766fc78af955fe6ULL, 0x9dcf94c2c3eb2fd8ULL, 0x00000034ec0c66e9ULL },
+    { 0xf44847817c11f8bdULL, 0x2bb2be193450587aULL, 0x0000003664a01caeULL },
+    { 0xe3e8f3094db93962ULL, 0x3437e000f614a0b6ULL, 0x000000288d61e9d1ULL },
+    { 0x2847c8fa1c02e9f1ULL, 0x100b8b9f1b5c19fbULL, 0x00000030b5875d71ULL },
+    { 0x2f7edfc5724b9db7ULL, 0xc5303afb2fdef449ULL, 0x0000001a530f86c8ULL },
+    { 0x3aaffb0586af6e91ULL, 0x6dad6231beba8f5fULL, 0x0000002ebed72833ULL },
+    { 0x236fd04a30d09c48ULL, 0x585cfbc466f10106ULL, 0x0000000bf95f8479ULL },
+    { 0xa03bfc070d4c800eULL, 0x1688717132aaee3aULL, 0x0000001c40bc55afULL },
+    { 0x912c320665d063b8ULL, 0xfe4931b5b22c799aULL, 0x00000028c40f2800ULL },
+    { 0x70c952adb3cac509ULL, 0x8896cd5ede647aaaULL, 0x000000003b349f22ULL },
+    { 0xa02af34194fc0c4bULL, 0x665fcc325b50bc28ULL, 0x000000080a5c2bd3ULL },
+    { 0x56bb760377dff195ULL, 0x087645fc41d24e48ULL, 0x00000031386a7878ULL },
+    { 0xb5d575fb5e74f734ULL, 0x90241c7db5467567ULL, 0x0000001bf2870ff4ULL },
+    { 0x57141fdde005ed98ULL, 0x9ae17a7b1fef6a14ULL, 0x00000038f1180206ULL },
+    { 0x2f3f341770fba7d0ULL, 0xf9128aab6a021229ULL, 0x0000000189b05913ULL },
+    { 0x9c3e7636487205a0ULL, 0x8df781140cfe7c4eULL, 0x00000004a67adda5ULL },
+    { 0xe8a0b10d0224ad46ULL, 0x90e849fdb3626a1aULL, 0x000000268bd213a8ULL },
+    { 0x4d0601b01ee7747fULL, 0x4557c733af863507ULL, 0x000000273f51b721ULL },
+    { 0x5866e777eef827efULL, 0x01ba4d747afc7ac7ULL, 0x00000007bf19326eULL },
+    { 0x14dd950bd5bd2527ULL, 0x71881539062c3101ULL, 0x000000199ce9c749ULL },
+    { 0x3afc81ff7ab754edULL, 0x4978e4bf9920791cULL, 0x0000001119929c56ULL },
+    { 0x538ba9b02c21fc9fULL, 0x280bc845fc23f467ULL, 0x00000014171b256bULL },
+    { 0xe20b647d6b6d04e3ULL, 0xe73d2fe93542fa0bULL, 0x00000018f3055bd7ULL },
+    { 0x587fb6791bf44807ULL, 0xd95e7df2018bfb60ULL, 0x0000003244d6914fULL },
+    { 0x7447ad9b9b9060e7ULL, 0x1951265ce0b4b1b6ULL, 0x0000001297608b63ULL },
+    { 0xdb72a3ef62c54154ULL, 0x83ee1af688c86fe1ULL, 0x0000001712c120a2ULL },
+    { 0x3f1fc4a73a410995ULL, 0xeb1b024a83b9a5e7ULL, 0x00000025d6ab798cULL },
+    { 0xe831fc4c4c26ace0ULL, 0xdcfdd2da9590c33dULL, 0x00000020cf63d949ULL },
+    { 0xcc86ed31fbdaeb2dULL, 0x8056d018f1d00c6eULL, 0x000000113297b8a9ULL },
+    { 0xac46669f7eaa9a06ULL, 0x6ef018d32d998f37ULL, 0x000000277710f573ULL },
+    { 0x0b1d5e12867fd247ULL, 0x0e22745d2733c9f0ULL, 0x0000001ae05d27b1ULL },
+    { 0x085efc7bb5d4f10fULL, 0xa7e405a0aa4ddd1eULL, 0x00000029395026b2ULL },
+    { 0x588d13217beb8cc0ULL, 0x56572b2e60789fefULL, 0x0000002998b784f1ULL },
+    { 0x8acc40eaa50692edULL, 0x72346d8b8d96a425ULL, 0x0000003830d27584ULL },
+    { 0x4c68f0081607a8e4ULL, 0x6e05022c4318315aULL, 0x0000001ed6674ae6ULL },
+    { 0x0f5765ea306be800ULL, 0x75cddcde96df66bdULL, 0x00000035a6af2953ULL },
+    { 0x3e74c996b5100000ULL, 0x9af3e21da7558d2bULL, 0x000000136e9d2ab2ULL },
+    { 0x2774867ea0000000ULL, 0x4bd2c70964cc9bffULL, 0x0000002995b45a17ULL },
+    { 0x092c2a4000000000ULL, 0x36ef349318acec3aULL, 0x000000056c8f927fULL },
+    { 0x03d6800000000000ULL, 0x46a8c3efed6c7d8bULL, 0x0000001d9e948e5cULL },
+    { 0x4100000000000000ULL, 0x54a8258a2a926f90ULL, 0x000000157c14366fULL },
+    { 0x0000000000000000ULL, 0x1a8c6164e7c9ed4aULL, 0x00000019ebd3869aULL },
+    { 0x0000000000000000ULL, 0x9cf8980e21c06400ULL, 0x00000023e14bebd7ULL },
+    { 0x0000000000000000ULL, 0xe242cb69f6e80000ULL, 0x00000032338bda72ULL },
+    { 0x0000000000000000ULL, 0x7e279c6310000000ULL, 0x0000001abf9c2798ULL },
+    { 0x0000000000000000ULL, 0x29adcaa000000000ULL, 0x000000238147586aULL },
+    { 0x0000000000000000ULL, 0xe622400000000000ULL, 0x00000018b7cbe521ULL },
+    { 0x0000000000000000ULL, 0x8680000000000000ULL, 0x00000007e48914f1ULL },
+    { 0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000383c08fd21ULL },
+};
+
+#endif /* _IO_FLOAT_RYU_PRINTF */
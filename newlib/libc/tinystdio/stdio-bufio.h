@@ -58,16 +58,17 @@ struct __file_bufio {
         __off_t (*lseek)(int fd, __off_t offset, int whence);
         int     (*close)(int fd);
 #ifndef __SINGLE_THREAD__
-	_LOCK_T lock;
+	_LOCK_RECURSIVE_T lock;
 #endif
 };
 
 #define FDEV_SETUP_BUFIO(_fd, _buf, _size, _read, _write, _lseek, _close, _rwflag, _bflags) \
         {                                                               \
-                .xfile = FDEV_SETUP_EXT(__bufio_put, __bufio_get,       \
-                                        __bufio_flush, __bufio_close,   \
-                                        __bufio_seek, __bufio_setvbuf,  \
-                                        (_rwflag) | __SBUF),            \
+                .xfile = FDEV_SETUP_EXT_BLOCK(__bufio_put, __bufio_get, \
+                                              __bufio_flush, __bufio_close, \
+                                              __bufio_seek, __bufio_setvbuf, \
+                                              __bufio_write, __bufio_read, \
+                                              (_rwflag) | __SBUF),      \
                 .fd = _fd,                                              \
                 .dir = 0,                                               \
                 .bflags = (_bflags),                                    \
@@ -82,36 +83,68 @@ struct __file_bufio {
                 .close = _close,                                        \
         }
 
+/*
+ * The stream lock is recursive so that it can be held across a whole
+ * stdio call (or a flockfile/funlockfile section) while the stream
+ * functions below are invoked
+ */
 static inline void __bufio_lock_init(FILE *f) {
 	(void) f;
-	__lock_init(((struct __file_bufio *) f)->lock);
+	__lock_init_recursive(((struct __file_bufio *) f)->lock);
 }
 
 static inline void __bufio_lock_close(FILE *f) {
 	(void) f;
-        __lock_release(((struct __file_bufio *) f)->lock);
-	__lock_close(((struct __file_bufio *) f)->lock);
+        __lock_release_recursive(((struct __file_bufio *) f)->lock);
+	__lock_close_recursive(((struct __file_bufio *) f)->lock);
 }
 
 static inline void __bufio_lock(FILE *f) {
 	(void) f;
-	__lock_acquire(((struct __file_bufio *) f)->lock);
+	__lock_acquire_recursive(((struct __file_bufio *) f)->lock);
+}
+
+static inline int __bufio_trylock(FILE *f) {
+	(void) f;
+#ifdef _RETARGETABLE_LOCKING
+	return __lock_try_acquire_recursive(((struct __file_bufio *) f)->lock);
+#else
+	return 1;
+#endif
 }
 
 static inline void __bufio_unlock(FILE *f) {
 	(void) f;
-	__lock_release(((struct __file_bufio *) f)->lock);
+	__lock_release_recursive(((struct __file_bufio *) f)->lock);
 }
 
 int
 __bufio_flush(FILE *f);
 
+/*
+ * put, get, write and read are called by stdio with the stream lock
+ * already held
+ */
 int
 __bufio_put(char c, FILE *f);
 
 int
 __bufio_get(FILE *f);
 
+ssize_t
+__bufio_write(FILE *f, const void *buf, size_t count);
+
+ssize_t
+__bufio_read(FILE *f, void *buf, size_t count);
+
+/*
+ * Make sure input is waiting in the buffer without consuming it.
+ * Returns the number of bytes available at buf + off, or
+ * _FDEV_EOF/_FDEV_ERR. Callers advance 'off' past what they use.
+ */
+ssize_t
+__bufio_fill(FILE *f);
+
 off_t
 __bufio_seek(FILE *f, off_t offset, int whence);
 
@@ -48,6 +48,7 @@
 #ifndef __DOXYGEN__
 #define __need_NULL
 #define __need_size_t
+#define __need_wchar_t
 #include <stddef.h>
 #endif	/* !__DOXYGEN__ */
 
@@ -277,10 +278,18 @@ struct __file_close {
                 .close = (_close),                                      \
         }
 
+/*
+ * The optional 'write' and 'read' functions move blocks of data
+ * without going through the per-character put/get functions. They
+ * return the number of bytes transferred, which may be less than
+ * requested, or _FDEV_ERR/_FDEV_EOF when nothing could be moved.
+ */
 struct __file_ext {
         struct __file_close cfile;              /* close file struct */
         __off_t (*seek)(struct __file *, __off_t offset, int whence);
         int     (*setvbuf)(struct __file *, char *buf, int mode, size_t size);
+        __ssize_t (*write)(struct __file *, const void *buf, size_t count);
+        __ssize_t (*read)(struct __file *, void *buf, size_t count);
 };
 
 #define FDEV_SETUP_EXT(put, get, flush, close, _seek, _setvbuf, rwflag) \
@@ -290,6 +299,15 @@ struct __file_ext {
                 .setvbuf = (_setvbuf),                                  \
         }
 
+#define FDEV_SETUP_EXT_BLOCK(put, get, flush, close, _seek, _setvbuf, _write, _read, rwflag) \
+        {                                                               \
+                .cfile = FDEV_SETUP_CLOSE(put, get, flush, close, (rwflag) | __SEXT), \
+                .seek = (_seek),                                        \
+                .setvbuf = (_setvbuf),                                  \
+                .write = (_write),                                      \
+                .read = (_read),                                        \
+        }
+
 #endif /* not __DOXYGEN__ */
 
 /*@{*/
@@ -923,6 +941,8 @@ extern FILE *fopen(const char *path, const char *mode);
 extern FILE *freopen(const char *path, const char *mode, FILE *stream);
 extern FILE *fdopen(int, const char *);
 extern FILE *fmemopen(void *buf, size_t size, const char *mode);
+extern FILE *open_memstream(char **bufp, size_t *sizep);
+extern FILE *open_wmemstream(wchar_t **bufp, size_t *sizep);
 extern int fseek(FILE *stream, long offset, int whence);
 extern int fseeko(FILE *stream, __off_t offset, int whence);
 extern int fsetpos(FILE *stream, fpos_t *pos);
@@ -940,6 +960,35 @@ extern int setvbuf(FILE *stream, char *buf, int mode, size_t size);
 extern FILE *tmpfile(void);
 extern char *tmpnam (char *s);
 
+/*
+ * Stream locking. stdio functions lock the stream once per call;
+ * flockfile/funlockfile extend that across several calls and the
+ * *_unlocked functions skip the locking entirely.
+ */
+extern void flockfile(FILE *stream);
+extern int ftrylockfile(FILE *stream);
+extern void funlockfile(FILE *stream);
+extern int getc_unlocked(FILE *stream);
+extern int getchar_unlocked(void);
+extern int putc_unlocked(int c, FILE *stream);
+extern int putchar_unlocked(int c);
+#define getchar_unlocked() getc_unlocked(stdin)
+#define putchar_unlocked(__c) putc_unlocked(__c, stdout)
+extern int fgetc_unlocked(FILE *stream);
+extern int fputc_unlocked(int c, FILE *stream);
+extern size_t fread_unlocked(void *ptr, size_t size, size_t nmemb, FILE *stream);
+extern size_t fwrite_unlocked(const void *ptr, size_t size, size_t nmemb, FILE *stream);
+extern char *fgets_unlocked(char *str, int size, FILE *stream);
+extern int fputs_unlocked(const char *str, FILE *stream);
+
+#ifndef _SSIZE_T_DECLARED
+typedef _ssize_t ssize_t;
+#define	_SSIZE_T_DECLARED
+#endif
+
+extern ssize_t getdelim(char **lineptr, size_t *n, int delim, FILE *stream);
+extern ssize_t getline(char **lineptr, size_t *n, FILE *stream);
+
 /*
  * The format of tmpnam names is TXXXXXX, which works with mktemp
  */
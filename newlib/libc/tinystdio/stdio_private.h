@@ -34,6 +34,7 @@
 
 #include <stdio-bufio.h>
 #include <stdbool.h>
+#include <string.h>
 #include <sys/lock.h>
 
 /* values for PRINTF_LEVEL */
@@ -65,6 +66,51 @@ __file_str_put(char c, FILE *stream);
 int
 __file_str_put_alloc(char c, FILE *stream);
 
+/*
+ * Direct access to __file_str_put streams for vfprintf. Like
+ * __file_str_put, these silently truncate at the end of the buffer.
+ */
+static inline void
+__file_str_putc(struct __file_str *sstream, char c)
+{
+	if (sstream->pos != sstream->end)
+            *sstream->pos++ = c;
+}
+
+static inline void
+__file_str_write(struct __file_str *sstream, const char *s, size_t n)
+{
+        size_t room = sstream->end - sstream->pos;
+
+        if (n > room)
+                n = room;
+        memcpy(sstream->pos, s, n);
+        sstream->pos += n;
+}
+
+static inline void
+__file_str_pad(struct __file_str *sstream, char c, size_t n)
+{
+        size_t room = sstream->end - sstream->pos;
+
+        if (n > room)
+                n = room;
+        memset(sstream->pos, c, n);
+        sstream->pos += n;
+}
+
+/*
+ * Block transfer helpers. These use the __file_ext write/read
+ * functions when the stream provides them and fall back to the
+ * per-character put/get functions otherwise. Both return the number
+ * of bytes transferred and expect the caller to hold the stream lock.
+ */
+size_t
+__file_write(FILE *stream, const void *buf, size_t count);
+
+size_t
+__file_read(FILE *stream, void *buf, size_t count);
+
 extern const char __match_inf[];
 extern const char __match_inity[];
 extern const char __match_nan[];
@@ -132,7 +178,13 @@ double
 __atod_engine(uint64_t m10, int e10);
 
 float
-__atof_engine(uint32_t m10, int e10);
+__atof_engine(uint64_t m10, int e10);
+
+double
+__atod_resolve(double lo, uint64_t w, int e10, const char *tail, int ntail);
+
+float
+__atof_resolve(float lo, uint64_t w, int e10, const char *tail, int ntail);
 
 #ifdef __SIZEOF_INT128__
 typedef __uint128_t _u128;
@@ -505,4 +557,80 @@ __atomic_exchange_ungetc(__ungetc_t *p, __ungetc_t v);
 
 #endif /* ATOMIC_UNGETC */
 
+/*
+ * Stream locking. Only bufio streams carry a lock; stdio entry points
+ * take it once per call and the stream functions run with it held.
+ * Defining STDIO_UNLOCKED before including this file builds the
+ * *_unlocked variant of a function without any locking.
+ */
+#ifdef STDIO_UNLOCKED
+#define __flockfile(stream)	((void) (stream))
+#define __flockfile_read(stream)	((void) (stream))
+#define __funlockfile(stream)	((void) (stream))
+#else
+static inline void
+__flockfile(FILE *stream)
+{
+	if (stream->flags & __SBUF)
+		__bufio_lock(stream);
+}
+
+/*
+ * Lock a stream for reading. Reading from buffered stdin flushes
+ * stdout first so that prompts appear; that happens before taking
+ * the stdin lock so the two locks are never held together. The
+ * *_unlocked functions don't flush, as the caller may hold the lock.
+ */
+static inline void
+__flockfile_read(FILE *stream)
+{
+	if (stream->flags & __SBUF) {
+		if (stream == stdin)
+			fflush(stdout);
+		__bufio_lock(stream);
+	}
+}
+
+static inline void
+__funlockfile(FILE *stream)
+{
+	if (stream->flags & __SBUF)
+		__bufio_unlock(stream);
+}
+#endif
+
+static inline int
+__getc_unlocked(FILE *stream)
+{
+	int rv;
+	__ungetc_t unget;
+
+	if ((stream->flags & __SRD) == 0)
+		return EOF;
+
+	if ((unget = __atomic_exchange_ungetc(&stream->unget, 0)) != 0)
+		return (unsigned char) unget;
+
+	rv = stream->get(stream);
+	if (rv < 0) {
+		/* if != _FDEV_ERR, assume it's _FDEV_EOF */
+		stream->flags |= (rv == _FDEV_ERR)? __SERR: __SEOF;
+		return EOF;
+	}
+
+	return (unsigned char)rv;
+}
+
+static inline int
+__putc_unlocked(int c, FILE *stream)
+{
+	if ((stream->flags & __SWR) == 0)
+		return EOF;
+
+	if (stream->put(c, stream) < 0)
+		return EOF;
+
+	return (unsigned char) c;
+}
+
 #endif /* _STDIO_PRIVATE_H_ */
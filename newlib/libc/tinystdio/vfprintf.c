@@ -74,6 +74,13 @@ typedef int64_t printf_float_int_t;
 #define EXP_BIAS 1023
 #include "dtoa_engine.h"
 
+#ifdef _IO_FLOAT_RYU_PRINTF
+#define dtoa dtoa_fixed
+#undef DTOA_MAX_DIG
+#define DTOA_MAX_DIG DTOA_FIXED_MAX_DIG
+#define __dtoa_engine(x,dtoa,dig,f,dec) __dtoa_fixed_engine(x,dtoa,dig,f,dec)
+#endif
+
 #if defined(_WANT_IO_LONG_DOUBLE) && __SIZEOF_LONG_DOUBLE__ > __SIZEOF_DOUBLE__
 # define PICOLIBC_LONG_DOUBLE_PRINTF_SCANF
 # include "ldtoa_engine.h"
@@ -391,11 +398,47 @@ int vfprintf (FILE * stream, const char *fmt, va_list ap_orig)
 
     int stream_len = 0;
 
-#define my_putc(c, stream) do { ++stream_len; if (put(c, stream) < 0) goto fail; } while(0)
+    /*
+     * sprintf and snprintf targets are filled in directly rather
+     * than through the put function one byte at a time
+     */
+#if defined(PREFER_SIZE_OVER_SPEED) || defined(__OPTIMIZE_SIZE__)
+    struct __file_str * const str = NULL;
+#else
+    struct __file_str * const str = put == __file_str_put ? (struct __file_str *) stream : NULL;
+#endif
+
+#define my_putc(c, stream) do {                                         \
+        ++stream_len;                                                   \
+        if (str)                                                        \
+            __file_str_putc(str, c);                                    \
+        else if (put(c, stream) < 0)                                    \
+            goto fail;                                                  \
+    } while(0)
+#define my_write(s, n, stream) do {                                     \
+        size_t _n = (n);                                                \
+        stream_len += _n;                                               \
+        if (str)                                                        \
+            __file_str_write(str, s, _n);                               \
+        else if (__file_write(stream, s, _n) != _n)                     \
+            goto fail;                                                  \
+    } while(0)
+#define my_pad(c, n, stream) do {                                       \
+        int _n = (n);                                                   \
+        stream_len += _n;                                               \
+        if (str)                                                        \
+            __file_str_pad(str, c, _n);                                 \
+        else                                                            \
+            while (_n-- > 0)                                            \
+                if (put(c, stream) < 0)                                 \
+                    goto fail;                                          \
+    } while(0)
 
     if ((stream->flags & __SWR) == 0)
 	return EOF;
 
+    __flockfile(stream);
+
 #ifdef PRINTF_POSITIONAL
     va_copy(ap, ap_orig);
 #endif
@@ -403,12 +446,16 @@ int vfprintf (FILE * stream, const char *fmt, va_list ap_orig)
     for (;;) {
 
 	for (;;) {
-	    c = *fmt++;
+	    /* Send literal text up to the next conversion in one block */
+	    pnt = fmt;
+	    while ((c = *fmt) != '\0' && c != '%')
+		fmt++;
+	    if (fmt != pnt)
+		my_write (pnt, fmt - pnt, stream);
 	    if (!c) goto ret;
-	    if (c == '%') {
-		c = *fmt++;
-		if (c != '%') break;
-	    }
+	    fmt++;
+	    c = *fmt++;
+	    if (c != '%') break;
 	    my_putc (c, stream);
 	}
 
@@ -590,7 +637,11 @@ int vfprintf (FILE * stream, const char *fmt, va_list ap_orig)
         {
 #if PRINTF_LEVEL >= PRINTF_FLT
             uint8_t sign;		/* sign character (or 0)	*/
+#if DTOA_MAX_DIG > 255
+            int ndigs;			/* number of digits to convert */
+#else
             uint8_t ndigs;		/* number of digits to convert */
+#endif
             unsigned char case_convert; /* subtract to correct case */
 	    int exp;			/* exponent of most significant decimal digit */
 	    int n;                      /* total width */
@@ -867,9 +918,8 @@ int vfprintf (FILE * stream, const char *fmt, va_list ap_orig)
 		if (width > ndigs) {
 		    width -= ndigs;
 		    if (!(flags & FL_LPAD)) {
-			do {
-			    my_putc (' ', stream);
-			} while (--width);
+			my_pad (' ', width, stream);
+			width = 0;
 		    }
 		} else {
 		    width = 0;
@@ -973,10 +1023,8 @@ int vfprintf (FILE * stream, const char *fmt, va_list ap_orig)
 
                 /* Output before first digit	*/
                 if (!(flags & (FL_LPAD | FL_ZFILL))) {
-                    while (width) {
-                        my_putc (' ', stream);
-                        width--;
-                    }
+                    my_pad (' ', width, stream);
+                    width = 0;
                 }
                 if (sign)
                     my_putc (sign, stream);
@@ -989,10 +1037,8 @@ int vfprintf (FILE * stream, const char *fmt, va_list ap_orig)
 #endif
 
                 if (!(flags & FL_LPAD)) {
-                    while (width) {
-                        my_putc ('0', stream);
-                        width--;
-                    }
+                    my_pad ('0', width, stream);
+                    width = 0;
                 }
 
                 if (flags & FL_FLTFIX) {		/* 'f' format		*/
@@ -1041,10 +1087,14 @@ int vfprintf (FILE * stream, const char *fmt, va_list ap_orig)
                         _dtoa.flags &= ~DTOA_CARRY;
                     my_putc (_dtoa.digits[0], stream);
                     if (prec > 0) {
+                        int ncopy = ndigs - 1;
+                        if (ncopy > prec)
+                            ncopy = prec;
+                        if (ncopy < 0)
+                            ncopy = 0;
                         my_putc ('.', stream);
-                        uint8_t pos = 1;
-                        for (pos = 1; pos < 1 + prec; pos++)
-                            my_putc (pos < ndigs ? _dtoa.digits[pos] : '0', stream);
+                        my_write (_dtoa.digits + 1, ncopy, stream);
+                        my_pad ('0', prec - ncopy, stream);
                     } else if (flags & FL_ALT)
                         my_putc ('.', stream);
 
@@ -1100,16 +1150,13 @@ int vfprintf (FILE * stream, const char *fmt, va_list ap_orig)
                 size = strnlen (pnt, (flags & FL_PREC) ? prec : ~0);
 
             str_lpad:
-                if (!(flags & FL_LPAD)) {
-                    while ((size_t) width > size) {
-                        my_putc (' ', stream);
-                        width--;
-                    }
+                if (!(flags & FL_LPAD) && (size_t) width > size) {
+                    my_pad (' ', width - (int) size, stream);
+                    width = size;
                 }
                 width -= size;
-                while (size--) {
-                    my_putc (*pnt++, stream);
-                }
+                if (size)
+                    my_write (pnt, size, stream);
 
             } else {
                 if (c == 'd' || c == 'i') {
@@ -1214,9 +1261,9 @@ int vfprintf (FILE * stream, const char *fmt, va_list ap_orig)
                             len = width;
                         }
                     }
-                    while (len < width) {
-                        my_putc (' ', stream);
-                        len++;
+                    if (len < width) {
+                        my_pad (' ', width - len, stream);
+                        len = width;
                     }
                 }
 
@@ -1236,29 +1283,33 @@ int vfprintf (FILE * stream, const char *fmt, va_list ap_orig)
                 }
 
                 /* Output leading zeros */
-                while (prec > buf_len) {
-                    my_putc ('0', stream);
-                    prec--;
+                if (prec > buf_len)
+                    my_pad ('0', prec - buf_len, stream);
+
+                /* Output value; __ultoa_invert leaves it backwards */
+                for (len = 0; len < buf_len / 2; len++) {
+                    char t = buf[len];
+                    buf[len] = buf[buf_len - 1 - len];
+                    buf[buf_len - 1 - len] = t;
                 }
-
-                /* Output value */
-                while (buf_len)
-                    my_putc (buf[--buf_len], stream);
+                my_write (buf, buf_len, stream);
             }
         }
 
 	/* Tail is possible.	*/
-	while (width-- > 0) {
-	    my_putc (' ', stream);
-	}
+	if (width > 0)
+	    my_pad (' ', width, stream);
     } /* for (;;) */
 
   ret:
 #ifdef PRINTF_POSITIONAL
     va_end(ap);
 #endif
+    __funlockfile(stream);
     return stream_len;
 #undef my_putc
+#undef my_write
+#undef my_pad
 #undef ap
   fail:
     stream_len = -1;
@@ -62,7 +62,7 @@ typedef long int_scanf_t;
 static int
 scanf_getc(FILE *stream, int *lenp)
 {
-	int c = getc(stream);
+	int c = __getc_unlocked(stream);
 	if (c >= 0)
 		++(*lenp);
 	return c;
@@ -441,6 +441,8 @@ int vfscanf (FILE * stream, const char *fmt, va_list ap_orig)
 
     nconvs = 0;
 
+    __flockfile_read(stream);
+
     /* Initialization of stream_flags at each pass simplifies the register
        allocation with GCC 3.3 - 4.2.  Only the GCC 4.3 is good to move it
        to the begin.	*/
@@ -577,13 +579,15 @@ int vfscanf (FILE * stream, const char *fmt, va_list ap_orig)
 
 	    if (c == 'c') {
 		if (!(flags & FL_WIDTH)) width = 1;
-		do {
+		if (addr) {
+		    /* Fixed-width input can be moved in one block */
+		    size_t got = __file_read(stream, addr, width);
+		    scanf_len += got;
+		    if (got != (size_t) width)
+			goto eof;
+		} else do {
 		    if ((i = scanf_getc (stream, lenp)) < 0)
 			goto eof;
-		    if (addr) {
-			*(char *)addr = i;
-			addr = (char*)addr + 1;
-		    }
 		} while (--width);
 		c = 1;			/* no matter with smart GCC	*/
 
@@ -692,6 +696,7 @@ int vfscanf (FILE * stream, const char *fmt, va_list ap_orig)
 #ifdef PRINTF_POSITIONAL
     va_end(ap);
 #endif
+    __funlockfile(stream);
     return nconvs;
 
   eof:
@@ -699,6 +704,7 @@ int vfscanf (FILE * stream, const char *fmt, va_list ap_orig)
     va_end(ap);
 #endif
 #undef ap
+    __funlockfile(stream);
     return nconvs ? nconvs : EOF;
 }
 
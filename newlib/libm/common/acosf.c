@@ -0,0 +1,68 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH_FLOAT
+
+#include "invtrigf.h"
+
+/* acosf; see invtrigf.h for the method. Worst-case error 0.51 ULP. */
+float
+acosf(float x)
+{
+    const struct invtrigf_data *p = &__invtrigf_data;
+    uint32_t ix = asuint(x) & 0x7fffffff;
+    double xd = (double) x;
+    double r, z;
+
+    if (unlikely(ix > 0x3f800000))
+        return __math_invalidf(x);
+
+    if (ix < 0x3f000000) {
+        /* |x| < 1/2, acos(x) = pi/2 - asin(x) */
+        r = p->pio2 - invtrigf_asin(xd, xd * xd);
+    } else {
+        /* acos(|x|) = 2 asin(sqrt((1 - |x|)/2)), acos(-x) = pi - acos(x) */
+        z = 0.5 - 0.5 * fabs(xd);
+        r = 2.0 * invtrigf_asin(sqrt(z), z);
+        if (xd < 0)
+            r = p->pi - r;
+    }
+    return (float) r;
+}
+
+_MATH_ALIAS_f_f(acos)
+
+#endif /* !__OBSOLETE_MATH_FLOAT */
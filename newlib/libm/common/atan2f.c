@@ -0,0 +1,88 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH_FLOAT
+
+#include "invtrigf.h"
+
+/* atan2f; see invtrigf.h for the method. Worst-case error 0.54 ULP. */
+float
+atan2f(float y, float x)
+{
+    const struct invtrigf_data *p = &__invtrigf_data;
+    uint32_t ix = asuint(x) & 0x7fffffff;
+    uint32_t iy = asuint(y) & 0x7fffffff;
+    double ax = fabs((double) x);
+    double ay = fabs((double) y);
+    double t, r;
+    float ret;
+    int swap;
+
+    if (unlikely(ix - 1 >= 0x7f7fffff || iy - 1 >= 0x7f7fffff)) {
+        /* x or y is zero, inf or nan */
+        if (ix > 0x7f800000 || iy > 0x7f800000)
+            return x + y;
+        /* atan2(+-0, +-0) and atan2(+-inf, +-inf) */
+        if (ix == iy) {
+            ay = (double) (iy != 0);
+            ax = 1.0;
+        }
+    }
+
+    /* The quotient of two floats is always zero or a normal double */
+    swap = ay > ax;
+    if (swap)
+        t = ax / ay;
+    else
+        t = ay / ax;
+    /* atan(t) rounds to t; skipping the polynomial avoids underflow in it */
+    r = t;
+    if (likely(t >= 0x1p-30))
+        r = invtrigf_atan(t);
+    if (swap)
+        r = p->pio2 - r;
+    if (asuint(x) >> 31)
+        r = p->pi - r;
+
+    ret = (float) r;
+    if (unlikely(ret == 0.0f && t != 0.0))
+        return __math_uflowf(asuint(y) >> 31);
+    return copysignf(ret, y);
+}
+
+_MATH_ALIAS_f_ff(atan2)
+
+#endif /* !__OBSOLETE_MATH_FLOAT */
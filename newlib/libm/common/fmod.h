@@ -0,0 +1,178 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _FMOD_H_
+#define _FMOD_H_
+
+#include <stdint.h>
+
+/*
+ * Integer kernels for fmod and remquo.
+ *
+ * With |x| = mx * 2^(e + n) and |y| = my * 2^e, the remainder is
+ * exactly (mx * 2^n mod my) * 2^e. Instead of shifting 2^n in one
+ * bit at a time, each step shifts in as many bits as the word has
+ * free above my and reduces with a single integer division, so an
+ * exponent difference of n costs about n / (word bits - significand
+ * bits) steps instead of n.
+ *
+ * Both significands normally have the same leading bit, so the
+ * first step is a single subtraction; only a subnormal y needs a
+ * division there.
+ *
+ * When q is not NULL, the low bits of the integer quotient are
+ * returned there as well.
+ */
+
+/* Below this many bits, shift and subtract beats a division */
+#define FMOD_BIT_STEPS  8
+
+/* Leading zeros in a 32-bit word, whatever the size of int */
+static inline int
+fmod_clz32(uint32_t v)
+{
+    return __builtin_clzll(v) - 32;
+}
+
+static inline uint32_t
+fmod_reduce32(uint32_t mx, uint32_t my, int n, uint32_t *q)
+{
+    int      spare = fmod_clz32(my);
+    uint32_t quo = 0;
+
+    if (mx >= my) {
+        mx -= my;
+        quo = 1;
+        if (mx >= my) {
+            quo += mx / my;
+            mx %= my;
+        }
+    }
+    while (n > 0) {
+        if (n < FMOD_BIT_STEPS) {
+            do {
+                mx <<= 1;
+                quo <<= 1;
+                if (mx >= my) {
+                    mx -= my;
+                    quo++;
+                }
+            } while (--n);
+            break;
+        }
+        int s = n < spare ? n : spare;
+        uint32_t t = mx << s;
+
+        quo = (quo << s) + t / my;
+        mx = t % my;
+        n -= s;
+    }
+    if (q)
+        *q = quo;
+    return mx;
+}
+
+static inline uint64_t
+fmod_reduce64(uint64_t mx, uint64_t my, int n, uint64_t *q)
+{
+    int      spare = __builtin_clzll(my);
+    uint64_t quo = 0;
+
+    if (mx >= my) {
+        mx -= my;
+        quo = 1;
+        if (mx >= my) {
+            quo += mx / my;
+            mx %= my;
+        }
+    }
+    while (n > 0) {
+        if (n < FMOD_BIT_STEPS) {
+            do {
+                mx <<= 1;
+                quo <<= 1;
+                if (mx >= my) {
+                    mx -= my;
+                    quo++;
+                }
+            } while (--n);
+            break;
+        }
+        int s = n < spare ? n : spare;
+        uint64_t t = mx << s;
+
+        quo = (quo << s) + t / my;
+        mx = t % my;
+        n -= s;
+    }
+    if (q)
+        *q = quo;
+    return mx;
+}
+
+#ifdef __SIZEOF_INT128__
+
+static inline int
+fmod_clz128(unsigned __int128 v)
+{
+    uint64_t hi = (uint64_t) (v >> 64);
+
+    if (hi)
+        return __builtin_clzll(hi);
+    return 64 + __builtin_clzll((uint64_t) v);
+}
+
+static inline unsigned __int128
+fmod_reduce128(unsigned __int128 mx, unsigned __int128 my, int n)
+{
+    int spare = fmod_clz128(my);
+
+    if (mx >= my) {
+        mx -= my;
+        if (mx >= my)
+            mx %= my;
+    }
+    while (n > 0) {
+        int s = n < spare ? n : spare;
+
+        mx = (mx << s) % my;
+        n -= s;
+    }
+    return mx;
+}
+
+#endif
+
+#endif /* _FMOD_H_ */
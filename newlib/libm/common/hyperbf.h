@@ -0,0 +1,106 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _HYPERBF_H_
+#define _HYPERBF_H_
+
+#include <stdint.h>
+#include <math.h>
+#include "fdlibm.h"
+#include "math_config.h"
+
+/*
+ * Single precision sinh, cosh and tanh.
+ *
+ * Everything is evaluated in double. Away from zero the functions
+ * are built from e = exp(|x|) computed with the expf table and
+ * polynomial, whose relative error is below 2^-33:
+ *
+ *	sinh(x) = (e - 1/e) / 2
+ *	cosh(x) = (e + 1/e) / 2
+ *	tanh(x) = 1 - 2 / (exp(2|x|) + 1)
+ *
+ * For |x| < 1/2 the cancellation in sinh and tanh would eat into
+ * that margin, so short minimax polynomials are used instead:
+ *
+ *	sinh(x) = x + x * z * sinh_poly(z),	z = x^2
+ *	tanh(x) = x + x * z * tanh_poly(z)
+ *
+ * with relative errors below 2^-33 and 2^-31.4.
+ */
+
+extern const struct hyperbf_data {
+    double sinh_poly[3];
+    double tanh_poly[5];
+} __hyperbf_data HIDDEN;
+
+/* Top 12 bits of the float representation with the sign bit cleared */
+static inline uint32_t
+hyperbf_top12 (float x)
+{
+    return (asuint (x) >> 20) & 0x7ff;
+}
+
+/* exp(x) for |x| < 128, the core of expf */
+static inline double
+hyperbf_exp (double x)
+{
+    const struct exp2f_data *d = &__exp2f_data;
+    double z = d->invln2_scaled * x;
+    double kd, r, r2, s, y;
+    uint64_t ki, t;
+
+#if TOINT_INTRINSICS
+    kd = roundtoint (z);
+    ki = converttoint (z);
+#else
+    kd = (double) (z + d->shift);
+    ki = asuint64 (kd);
+    kd -= d->shift;
+#endif
+    r = z - kd;
+
+    /* exp(x) = 2^(k/N) * 2^(r/N) ~= s * (C0*r^3 + C1*r^2 + C2*r + 1) */
+    t = d->tab[ki % (1 << EXP2F_TABLE_BITS)];
+    t += ki << (52 - EXP2F_TABLE_BITS);
+    s = asdouble (t);
+    z = d->poly_scaled[0] * r + d->poly_scaled[1];
+    r2 = r * r;
+    y = d->poly_scaled[2] * r + 1;
+    y = z * r2 + y;
+    return y * s;
+}
+
+#endif /* _HYPERBF_H_ */
@@ -0,0 +1,96 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _INVTRIGF_H_
+#define _INVTRIGF_H_
+
+#include <stdint.h>
+#include <math.h>
+#include "fdlibm.h"
+#include "math_config.h"
+
+/*
+ * Single precision atan, atan2, asin and acos.
+ *
+ * Everything is evaluated in double, so a single minimax polynomial
+ * over the whole reduced range replaces the fdlibm breakpoint tables:
+ *
+ *	atan(t) = t + t * z * atan_poly(z),	z = t^2, 0 <= t <= 1
+ *	asin(s) = s + s * z * asin_poly(z),	z = s^2, 0 <= s <= 1/2
+ *
+ * Larger arguments are folded into those ranges with
+ * atan(x) = pi/2 - atan(1/x) and asin(x) = pi/2 - 2 asin(sqrt((1-x)/2)),
+ * costing one double division or square root instead of the chains
+ * of float divisions in fdlibm. The relative error of the polynomials
+ * is below 2^-28.5 for atan and 2^-31.7 for asin, so the final
+ * rounding to float dominates.
+ */
+
+extern const struct invtrigf_data {
+    double pio2;
+    double pi;
+    double atan_poly[9];
+    double asin_poly[6];
+} __invtrigf_data HIDDEN;
+
+/* atan(t) for 0 <= t <= 1 */
+static inline double
+invtrigf_atan (double t)
+{
+    const double *c = __invtrigf_data.atan_poly;
+    double z = t * t;
+    double z2 = z * z;
+    double z4 = z2 * z2;
+    double p01 = c[0] + z * c[1];
+    double p23 = c[2] + z * c[3];
+    double p45 = c[4] + z * c[5];
+    double p67 = c[6] + z * c[7];
+    double p = (p01 + z2 * p23) + z4 * ((p45 + z2 * p67) + z4 * c[8]);
+
+    return t + t * z * p;
+}
+
+/* asin(s) for |s| <= 1/2, given z = s * s */
+static inline double
+invtrigf_asin (double s, double z)
+{
+    const double *c = __invtrigf_data.asin_poly;
+    double z2 = z * z;
+    double p = (c[0] + z * c[1]) + z2 * ((c[2] + z * c[3]) + z2 * (c[4] + z * c[5]));
+
+    return s + s * z * p;
+}
+
+#endif /* _INVTRIGF_H_ */
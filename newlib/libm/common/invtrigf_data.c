@@ -0,0 +1,69 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH_FLOAT
+
+#include "invtrigf.h"
+
+/*
+ * Minimax fits of (atan(t)/t - 1)/t^2 over t in [0, 1] and
+ * (asin(s)/s - 1)/s^2 over s in [0, 1/2], weighted for relative error
+ */
+const struct invtrigf_data __invtrigf_data = {
+    .pio2 = 0x1.921fb54442d18p+0,
+    .pi = 0x1.921fb54442d18p+1,
+    .atan_poly = {
+        -0x1.55553e59abe9dp-2,
+        0x1.9991fd0723635p-3,
+        -0x1.2421b409a4450p-3,
+        0x1.c099f3bdf20cdp-4,
+        -0x1.5834750f39abap-4,
+        0x1.dac98b7d1f44ap-5,
+        -0x1.fed0babe4d0cep-6,
+        0x1.65a5b449a1b9ap-7,
+        -0x1.d62ed103f695fp-10,
+    },
+    .asin_poly = {
+        0x1.55554c5fa6f12p-3,
+        0x1.33387ca036c85p-4,
+        0x1.6caed1bd7262fp-5,
+        0x1.0491a390f68cfp-5,
+        0x1.d91f854c05c53p-7,
+        0x1.3355cb15f4910p-5,
+    },
+};
+
+#endif /* !__OBSOLETE_MATH_FLOAT */
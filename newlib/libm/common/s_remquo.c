@@ -58,6 +58,7 @@ C99, POSIX.
 */
 
 #include "fdlibm.h"
+#include "fmod.h"
 
 #ifdef _NEED_FLOAT64
 
@@ -78,15 +79,16 @@ static const __float64 Zero[] = {_F_64(0.0), _F_64(-0.0),};
  * Return the IEEE remainder and set *quo to the last n bits of the
  * quotient, rounded to the nearest integer.  We choose n=31--if that many fit--
  * because we wind up computing all the integer bits of the quotient anyway as
- * a side-effect of computing the remainder by the shift and subtract
- * method.  In practice, this is far more bits than are needed to use
- * remquo in reduction algorithms.
+ * a side-effect of computing the remainder by integer division of
+ * the significands.  In practice, this is far more bits than are needed to
+ * use remquo in reduction algorithms.
  */
 __float64
 remquo64(__float64 x, __float64 y, int *quo)
 {
-	__int32_t n,hx,hy,hz,ix,iy,sx,i;
-	__uint32_t lx,ly,lz,q,sxy;
+	__int32_t n,hx,hy,ix,iy,sx;
+	__uint32_t lx,ly,q,sxy;
+	__uint64_t mx,my,mq;
 
 	EXTRACT_WORDS(hx,lx,x);
 	EXTRACT_WORDS(hy,ly,y);
@@ -112,85 +114,29 @@ remquo64(__float64 x, __float64 y, int *quo)
 	    }
 	}
 
-    /* determine ix = ilogb(x) */
-	if(hx<0x00100000) {	/* subnormal x */
-	    if(hx==0) {
-		for (ix = -1043, i=lx; i>0; i<<=1) ix -=1;
-	    } else {
-		for (ix = -1022,i=(hx<<11); i>0; i<<=1) ix -=1;
-	    }
-	} else ix = (hx>>20)-1023;
-
-    /* determine iy = ilogb(y) */
-	if(hy<0x00100000) {	/* subnormal y */
-	    if(hy==0) {
-		for (iy = -1043, i=ly; i>0; i<<=1) iy -=1;
-	    } else {
-		for (iy = -1022,i=(hy<<11); i>0; i<<=1) iy -=1;
-	    }
-	} else iy = (hy>>20)-1023;
-
-    /* set up {hx,lx}, {hy,ly} and align y to x */
-	if(ix >= -1022) 
-	    hx = 0x00100000|(0x000fffff&hx);
-	else {		/* subnormal x, shift x to normal */
-	    n = -1022-ix;
-	    if(n<=31) {
-	        hx = (hx<<n)|(lx>>(32-n));
-	        lx <<= n;
-	    } else {
-		hx = lx<<(n-32);
-		lx = 0;
-	    }
-	}
-	if(iy >= -1022) 
-	    hy = 0x00100000|(0x000fffff&hy);
-	else {		/* subnormal y, shift y to normal */
-	    n = -1022-iy;
-	    if(n<=31) {
-	        hy = (hy<<n)|(ly>>(32-n));
-	        ly <<= n;
-	    } else {
-		hy = ly<<(n-32);
-		ly = 0;
-	    }
-	}
+    /* |x| = mx * 2^(ix - 1075), |y| = my * 2^(iy - 1075) */
+	ix = hx>>20;
+	iy = hy>>20;
+	mx = ((__uint64_t)(hx&0x000fffff)<<32)|lx;
+	my = ((__uint64_t)(hy&0x000fffff)<<32)|ly;
+	if(ix) mx |= 0x0010000000000000ULL; else ix = 1;
+	if(iy) my |= 0x0010000000000000ULL; else iy = 1;
 
-    /* fix point fmod */
-	n = ix - iy;
-	q = 0;
-	while(n--) {
-	    hz=hx-hy;lz=lx-ly; if(lx<ly) hz -= 1;
-	    if(hz<0){hx = hx+hx+(lx>>31); lx = lx+lx;}
-	    else {hx = hz+hz+(lz>>31); lx = lz+lz; q++;}
-	    q <<= 1;
-	}
-	hz=hx-hy;lz=lx-ly; if(lx<ly) hz -= 1;
-	if(hz>=0) {hx=hz;lx=lz;q++;}
+    /* fix point fmod, several quotient bits per step */
+	mx = fmod_reduce64(mx, my, ix - iy, &mq);
+	q = (__uint32_t) mq;
 
     /* convert back to floating value and restore the sign */
-	if((hx|lx)==0) {			/* return sign(x)*0 */
+	if(mx==0) {			/* return sign(x)*0 */
 	    q &= QUO_MASK;
 	    *quo = (sxy ? -q : q);
 	    return Zero[(__uint32_t)sx>>31];
 	}
-	while(hx<0x00100000) {		/* normalize x */
-	    hx = hx+hx+(lx>>31); lx = lx+lx;
-	    iy -= 1;
-	}
-	if(iy>= -1022) {	/* normalize output */
-	    hx = ((hx-0x00100000)|((iy+1023)<<20));
-	} else {		/* subnormal output */
-	    n = -1022 - iy;
-	    if(n<=20) {
-		lx = (lx>>n)|((__uint32_t)hx<<(32-n));
-		hx >>= n;
-	    } else if (n<=31) {
-		lx = (hx<<(32-n))|(lx>>n); hx = sx;
-	    } else {
-		lx = hx>>(n-32); hx = sx;
-	    }
-	}
+	n = __builtin_clzll(mx) - 11;	/* normalize x */
+	if(n > iy - 1) n = iy - 1;	/* or leave it subnormal */
+	mx = (mx<<n) + ((__uint64_t)(iy-1-n)<<52);
+	hx = (__uint32_t)(mx>>32);
+	lx = (__uint32_t)mx;
 fixup:
 	INSERT_WORDS(x,hx,lx);
 	y = fabs64(y);
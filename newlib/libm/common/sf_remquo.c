@@ -14,6 +14,7 @@
 
 #include <math.h>
 #include "fdlibm.h"
+#include "fmod.h"
 
 /* For quotient, return either all 31 bits that can from calculation (using
  * int32_t), or as many as can fit into an int that is smaller than 32 bits.  */
@@ -29,15 +30,15 @@ static const float Zero[] = {0.0, -0.0,};
  * Return the IEEE remainder and set *quo to the last n bits of the
  * quotient, rounded to the nearest integer.  We choose n=31--if that many fit--
  * we wind up computing all the integer bits of the quotient anyway as
- * a side-effect of computing the remainder by the shift and subtract
- * method.  In practice, this is far more bits than are needed to use
- * remquo in reduction algorithms.
+ * a side-effect of computing the remainder by integer division of
+ * the significands.  In practice, this is far more bits than are needed to
+ * use remquo in reduction algorithms.
  */
 float
 remquof(float x, float y, int *quo)
 {
-	__int32_t n,hx,hy,hz,ix,iy,sx,i;
-	__uint32_t q,sxy;
+	__int32_t n,ix,iy;
+	__uint32_t hx,hy,sx,q,sxy;
 
 	GET_FLOAT_WORD(hx,x);
 	GET_FLOAT_WORD(hy,y);
@@ -59,57 +60,25 @@ remquof(float x, float y, int *quo)
 	    return Zero[(__uint32_t)sx>>31];	/* |x|=|y| return x*0*/
 	}
 
-    /* determine ix = ilogb(x) */
-	if(hx<0x00800000) {	/* subnormal x */
-	    for (ix = -126,i=(hx<<8); i>0; i<<=1) ix -=1;
-	} else ix = (hx>>23)-127;
+    /* |x| = hx * 2^(ix - 150), |y| = hy * 2^(iy - 150) */
+	ix = hx>>23;
+	iy = hy>>23;
+	hx &= 0x007fffff;
+	hy &= 0x007fffff;
+	if(ix) hx |= 0x00800000; else ix = 1;
+	if(iy) hy |= 0x00800000; else iy = 1;
 
-    /* determine iy = ilogb(y) */
-	if(hy<0x00800000) {	/* subnormal y */
-	    for (iy = -126,i=(hy<<8); i>0; i<<=1) iy -=1;
-	} else iy = (hy>>23)-127;
-
-    /* set up {hx,lx}, {hy,ly} and align y to x */
-	if(ix >= -126)
-	    hx = 0x00800000|(0x007fffff&hx);
-	else {		/* subnormal x, shift x to normal */
-	    n = -126-ix;
-	    hx <<= n;
-	}
-	if(iy >= -126)
-	    hy = 0x00800000|(0x007fffff&hy);
-	else {		/* subnormal y, shift y to normal */
-	    n = -126-iy;
-	    hy <<= n;
-	}
-
-    /* fix point fmod */
-	n = ix - iy;
-	q = 0;
-	while(n--) {
-	    hz=hx-hy;
-	    if(hz<0) hx = hx << 1;
-	    else {hx = hz << 1; q++;}
-	    q <<= 1;
-	}
-	hz=hx-hy;
-	if(hz>=0) {hx=hz;q++;}
+    /* fix point fmod, several quotient bits per step */
+	hx = fmod_reduce32(hx, hy, ix - iy, &q);
 
     /* convert back to floating value and restore the sign */
 	if(hx==0) {				/* return sign(x)*0 */
 	    *quo = (sxy ? -q : q);
 	    return Zero[(__uint32_t)sx>>31];
 	}
-	while(hx<0x00800000) {		/* normalize x */
-	    hx <<= 1;
-	    iy -= 1;
-	}
-	if(iy>= -126) {		/* normalize output */
-	    hx = ((hx-0x00800000)|((iy+127)<<23));
-	} else {		/* subnormal output */
-	    n = -126 - iy;
-	    hx >>= n;
-	}
+	n = fmod_clz32(hx) - 8;		/* normalize x */
+	if(n > iy - 1) n = iy - 1;	/* or leave it subnormal */
+	hx = (hx<<n) + ((__uint32_t)(iy-1-n)<<23);
 fixup:
 	SET_FLOAT_WORD(x,hx);
 	y = fabsf(y);
@@ -0,0 +1,82 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH_DOUBLE
+
+#include "sincos.h"
+
+/* sincos; the reduction and both polynomials are shared */
+void __inhibit_new_builtin_calls
+sincos(double x, double *sinx, double *cosx)
+{
+    uint32_t top = sincos_top12(x);
+    double hi, lo, s, c;
+    int32_t n;
+
+    if (unlikely(top < 0x3e4)) {
+        /* |x| < 2^-27 */
+        if (top == 0)
+            force_eval_double(x * x);
+        *sinx = x;
+        *cosx = 1.0;
+        return;
+    }
+    if (sincos_small(x)) {
+        *sinx = sincos_sin_small(x);
+        *cosx = sincos_cos_poly(x, 0.0);
+        return;
+    }
+    if (unlikely(top >= 0x7ff)) {
+        *sinx = *cosx = __math_invalid(x);
+        return;
+    }
+
+    hi = sincos_reduce_any(x, top, &lo, &n);
+
+    s = sincos_sin_poly(hi, lo);
+    c = sincos_cos_poly(hi, lo);
+    if (n & 1) {
+        double t = s;
+        s = c;
+        c = t;
+    }
+    *sinx = sincos_sign(n, s);
+    *cosx = sincos_sign(n + 1, c);
+}
+
+_MATH_ALIAS_v_dDD(sincos)
+
+#endif /* !__OBSOLETE_MATH_DOUBLE */
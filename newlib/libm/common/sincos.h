@@ -0,0 +1,182 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _SINCOS_H_
+#define _SINCOS_H_
+
+#include <stdint.h>
+#include <math.h>
+#include "fdlibm.h"
+#include "math_config.h"
+
+/*
+ * Double precision sin, cos and tan.
+ *
+ * Arguments below 2^20 are reduced inline to r = x - n * pi/2 the way
+ * the medium case of __rem_pio2 does it, with 33 + 53 bits of pi/2,
+ * which is plenty unless r lands close to a multiple of pi/2; those
+ * few arguments are redone with four pieces of pi/2 keeping every
+ * rounding error. Larger arguments fall back to __rem_pio2. r is
+ * carried as a double-double and fed to the fdlibm sin and cos
+ * polynomials, evaluated in the shorter-latency form from FreeBSD;
+ * the quadrant picks the polynomial and flips the sign bit.
+ */
+
+/* Top 12 bits of 2^20, above which __rem_pio2 does the reduction */
+#define SINCOS_TOP_REDUCE	0x413
+
+extern const struct sincos_data {
+    double invpio2;
+    double pio2_1, pio2_1t;	/* 33 + 53 bits of pi/2 */
+    double pio2_2, pio2_3, pio2_3t;	/* pio2_1 + 33 + 33 + 53 bits */
+    double sin_poly[6];		/* sin(r) = r + r^3 * sin_poly(r^2) */
+    double cos_poly[6];		/* cos(r) = 1 - r^2/2 + r^4 * cos_poly(r^2) */
+} __sincos_data HIDDEN;
+
+/* Top 12 bits of the double representation with the sign bit cleared */
+static inline uint32_t
+sincos_top12 (double x)
+{
+    return (asuint64 (x) >> 52) & 0x7ff;
+}
+
+/* |x| <= pi/4; comparing the bits raises nothing for a NaN */
+static inline int
+sincos_small (double x)
+{
+    return (asuint64 (x) & 0x7fffffffffffffffULL) <= 0x3fe921fb54442d18ULL;
+}
+
+/* Return a + b as hi, with the rounding error in *lo */
+static inline double
+sincos_two_sum (double a, double b, double *lo)
+{
+    double s = a + b;
+    double bb = s - a;
+    *lo = (a - (s - bb)) + (b - bb);
+    return s;
+}
+
+/*
+ * Reduce |x| < 2^20 to hi + *lo in [-pi/4, pi/4] (plus rounding),
+ * returning the quadrant. n * pio2_1 is exact and, while |hi| stays
+ * above 2^-6, the error in n * pio2_1t is far below an ULP of hi.
+ */
+static inline double
+sincos_reduce (double x, double *lo, int32_t *np)
+{
+    const struct sincos_data *p = &__sincos_data;
+    double half = asdouble (asuint64 (0.5) | (asuint64 (x) & 0x8000000000000000ULL));
+    int32_t n = (int32_t) (x * p->invpio2 + half);
+    double nd = (double) n;
+    double r = x - nd * p->pio2_1;
+    double w = nd * p->pio2_1t;
+    double hi = r - w;
+    double e1, e2, e3;
+
+    *np = n;
+    if (likely (sincos_top12 (hi) >= 0x3f9)) {
+        *lo = (r - hi) - w;
+        return hi;
+    }
+
+    /* Near a multiple of pi/2; n * pio2_2 and n * pio2_3 are exact too */
+    hi = sincos_two_sum (r, -nd * p->pio2_2, &e1);
+    hi = sincos_two_sum (hi, -nd * p->pio2_3, &e2);
+    hi = sincos_two_sum (hi, -nd * p->pio2_3t, &e3);
+    return sincos_two_sum (hi, e1 + e2 + e3, lo);
+}
+
+/* Reduce any finite x, handing huge arguments to __rem_pio2 */
+static inline double
+sincos_reduce_any (double x, uint32_t top, double *lo, int32_t *np)
+{
+    if (likely (top < SINCOS_TOP_REDUCE))
+        return sincos_reduce (x, lo, np);
+
+    double y[2];
+    *np = __rem_pio2 (x, y);
+    *lo = y[1];
+    return y[0];
+}
+
+/* sin(x) for |x| <= pi/4 */
+static inline double
+sincos_sin_small (double x)
+{
+    const double *c = __sincos_data.sin_poly;
+    double z = x * x;
+    double w = z * z;
+    double r = c[1] + z * (c[2] + z * c[3]) + z * w * (c[4] + z * c[5]);
+
+    return x + z * x * (c[0] + z * r);
+}
+
+/* sin(hi + lo) for |hi + lo| <= pi/4 */
+static inline double
+sincos_sin_poly (double x, double y)
+{
+    const double *c = __sincos_data.sin_poly;
+    double z = x * x;
+    double w = z * z;
+    double r = c[1] + z * (c[2] + z * c[3]) + z * w * (c[4] + z * c[5]);
+    double v = z * x;
+
+    return x - ((z * (0.5 * y - v * r) - y) - v * c[0]);
+}
+
+/* cos(hi + lo) for |hi + lo| <= pi/4 */
+static inline double
+sincos_cos_poly (double x, double y)
+{
+    const double *c = __sincos_data.cos_poly;
+    double z = x * x;
+    double w = z * z;
+    double r = z * (c[0] + z * (c[1] + z * c[2])) + w * w * (c[3] + z * (c[4] + z * c[5]));
+    double hz = 0.5 * z;
+    double a = 1.0 - hz;
+
+    /* a + ((1 - a) - hz) is 1 - hz with the rounding error kept */
+    return a + (((1.0 - a) - hz) + (z * r - x * y));
+}
+
+/* Negate y in quadrants 2 and 3 */
+static inline double
+sincos_sign (uint32_t n, double y)
+{
+    return asdouble (asuint64 (y) ^ ((uint64_t) (n & 2) << 62));
+}
+
+#endif /* _SINCOS_H_ */
@@ -0,0 +1,67 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH_DOUBLE
+
+#include "sincos.h"
+
+/* The polynomials are the ones from k_sin.c and k_cos.c */
+const struct sincos_data __sincos_data = {
+    .invpio2 = 0x1.45f306dc9c883p-1,
+    .pio2_1 = 0x1.921fb54400000p+0,
+    .pio2_1t = 0x1.0b4611a626331p-34,
+    .pio2_2 = 0x1.0b4611a600000p-34,
+    .pio2_3 = 0x1.3198a2e000000p-69,
+    .pio2_3t = 0x1.b839a252049c1p-104,
+    .sin_poly = {
+        -0x1.5555555555549p-3,
+        0x1.111111110f8a6p-7,
+        -0x1.a01a019c161d5p-13,
+        0x1.71de357b1fe7dp-19,
+        -0x1.ae5e68a2b9cebp-26,
+        0x1.5d93a5acfd57cp-33,
+    },
+    .cos_poly = {
+        0x1.555555555554cp-5,
+        -0x1.6c16c16c15177p-10,
+        0x1.a01a019cb1590p-16,
+        -0x1.27e4f809c52adp-22,
+        0x1.1ee9ebdb4b1c4p-29,
+        -0x1.8fae9be8838d4p-37,
+    },
+};
+
+#endif /* !__OBSOLETE_MATH_DOUBLE */
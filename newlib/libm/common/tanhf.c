@@ -0,0 +1,72 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH_FLOAT
+
+#include "hyperbf.h"
+
+/* tanhf; see hyperbf.h for the method. Worst-case error 0.51 ULP. */
+float
+tanhf(float x)
+{
+    const double *c = __hyperbf_data.tanh_poly;
+    uint32_t top = hyperbf_top12(x);
+    double a = fabs((double) x);
+    double z, y;
+
+    if (top < hyperbf_top12(0.5f)) {
+        z = a * a;
+        double z2 = z * z;
+        y = a + a * z * ((c[0] + z * c[1]) + z2 * (c[2] + z * c[3]) + z2 * z2 * c[4]);
+    } else {
+        if (unlikely(top >= hyperbf_top12(16.0f))) {
+            if (top >= hyperbf_top12(INFINITY)) {
+                /* tanh(+-inf) is exactly +-1 */
+                if (asuint(x) << 1 == 0xff000000)
+                    return copysignf(1.0f, x);
+                return x + x;
+            }
+            /* Still rounds to +-1, inexactly */
+            a = 16.0;
+        }
+        y = 1.0 - 2.0 / (hyperbf_exp(2.0 * a) + 1.0);
+    }
+    return copysignf((float) y, x);
+}
+
+_MATH_ALIAS_f_f(tanh)
+
+#endif /* !__OBSOLETE_MATH_FLOAT */
@@ -0,0 +1,117 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef V_TEMPLATE
+
+#include "v_math.h"
+
+#if V_DOUBLE_MATH
+#define V_TEMPLATE "v_exp.c"
+#include "v_instance.h"
+#endif
+
+#else
+
+/*
+ * Vector exp, see exp.c for the algorithm. |x| >= 512, where the
+ * result may need the careful scaling of specialcase, inf and nan
+ * use the scalar code.
+ */
+
+#define N (1 << EXP_TABLE_BITS)
+#define InvLn2N __exp_data.invln2N
+#define NegLn2hiN __exp_data.negln2hiN
+#define NegLn2loN __exp_data.negln2loN
+#define Shift __exp_data.shift
+#define T __exp_data.tab
+#define C2 __exp_data.poly[5 - EXP_POLY_ORDER]
+#define C3 __exp_data.poly[6 - EXP_POLY_ORDER]
+#define C4 __exp_data.poly[7 - EXP_POLY_ORDER]
+#define C5 __exp_data.poly[8 - EXP_POLY_ORDER]
+#define C6 __exp_data.poly[9 - EXP_POLY_ORDER]
+
+V_ATTR v_f64_t
+V_NAME_D1(exp)(v_f64_t x)
+{
+    v_u64_t abstop, ki, idx, top, sbits;
+    v_f64_t xs, kd, z, r, r2, scale, tail, tmp, y;
+    v_s64_t special, tiny;
+
+    abstop = (v_u64_t) x >> 52 & 0x7ff;
+    /* |x| < 0x1p-54, the result is 1 + x */
+    tiny = v_lt_u64(abstop, asuint64(0x1p-54) >> 52);
+    /* |x| >= 512 or x is nan */
+    special = ~v_lt_u64(abstop, asuint64(512.0) >> 52);
+    xs = v_sel_f64(special | tiny, v_f64(0.0), x);
+
+    /* exp(x) = 2^(k/N) * exp(r), with exp(r) in [2^(-1/2N),2^(1/2N)].  */
+    /* x = ln2/N*k + r, with int k and r in [-ln2/2N, ln2/2N].  */
+    z = InvLn2N * xs;
+#if EXP_USE_TOINT_NARROW
+    /* z - kd is in [-0.5-2^-16, 0.5] in all rounding modes.  */
+    kd = z + Shift;
+    ki = (v_u64_t) kd >> 16;
+    kd = __builtin_convertvector((v_s64_t) (ki << 32) >> 32, v_f64_t);
+#else
+    /* z - kd is in [-1, 1] in non-nearest rounding modes.  */
+    kd = z + Shift;
+    ki = (v_u64_t) kd;
+    kd -= Shift;
+#endif
+    r = xs + kd * NegLn2hiN + kd * NegLn2loN;
+    /* 2^(k/N) ~= scale * (1 + tail).  */
+    idx = 2 * (ki % N);
+    top = ki << (52 - EXP_TABLE_BITS);
+    v_lookup2_f64((const double *) T, idx, 1, &tail, &scale);
+    sbits = (v_u64_t) scale + top;
+    /* exp(x) = 2^(k/N) * exp(r) ~= scale + scale * (tail + exp(r) - 1).  */
+    r2 = r * r;
+#if EXP_POLY_ORDER == 4
+    tmp = tail + r + r2 * C2 + r * r2 * (C3 + r * C4);
+#elif EXP_POLY_ORDER == 5
+    tmp = tail + r + r2 * (C2 + r * C3) + r2 * r2 * (C4 + r * C5);
+#elif EXP_POLY_ORDER == 6
+    tmp = tail + r + r2 * (0.5 + r * C3) + r2 * r2 * (C4 + r * C5 + r2 * C6);
+#endif
+    scale = (v_f64_t) sbits;
+    y = scale + scale * tmp;
+    y = v_sel_f64(tiny, WANT_ROUNDING ? 1.0 + x : v_f64(1.0), y);
+
+    if (unlikely(v_any_s64(special)))
+        return v_call_f64(exp, x, y, special);
+    return y;
+}
+
+#endif /* V_TEMPLATE */
@@ -0,0 +1,93 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef V_TEMPLATE
+
+#include "v_math.h"
+
+#if V_FLOAT_MATH
+#define V_TEMPLATE "v_exp2f.c"
+#include "v_instance.h"
+#endif
+
+#else
+
+/* Vector exp2f, see sf_exp2.c for the algorithm */
+
+#define N (1 << EXP2F_TABLE_BITS)
+#define T __exp2f_data.tab
+#define C __exp2f_data.poly
+#define SHIFT __exp2f_data.shift_scaled
+
+static ALWAYS_INLINE V_ATTR v_f64_t
+V_FN(v_exp2f_half)(v_f64_t xd)
+{
+    v_u64_t ki, t;
+    v_f64_t kd, z, r, r2, y, s;
+
+    /* x = k/N + r with r in [-1/(2N), 1/(2N)] and int k */
+    kd = xd + SHIFT;
+    ki = (v_u64_t) kd;
+    kd -= SHIFT;
+    r = xd - kd;
+
+    /* exp2(x) = 2^(k/N) * 2^r ~= s * (C0*r^3 + C1*r^2 + C2*r + 1) */
+    t = (ki << (52 - EXP2F_TABLE_BITS)) + v_lookup_u64(T, ki % N);
+    s = (v_f64_t) t;
+    z = C[0] * r + C[1];
+    r2 = r * r;
+    y = C[2] * r + 1.0;
+    y = z * r2 + y;
+    return y * s;
+}
+
+V_ATTR v_f32_t
+V_NAME_F1(exp2f)(v_f32_t x)
+{
+    v_s32_t special;
+    v_f32_t xs, y;
+
+    /* |x| >= 128 or x is nan */
+    special = ~v_lt_u32((v_u32_t) x & 0x7fffffff, 0x43000000);
+    xs = v_sel_f32(special, v_f32(0.0f), x);
+    y = v_join_f32(V_FN(v_exp2f_half)(v_half_f64(xs, 0)),
+                   V_FN(v_exp2f_half)(v_half_f64(xs, 1)));
+
+    if (unlikely(v_any_s32(special)))
+        return v_call_f32(exp2f, x, y, special);
+    return y;
+}
+
+#endif /* V_TEMPLATE */
@@ -0,0 +1,108 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Compile V_TEMPLATE once for each vector width of the target.
+ *
+ * V_NF and V_ND are the number of float and double lanes; V_ATTR
+ * selects the instruction set for the functions of that width.
+ *
+ * V_AVX2 is set where the AVX2 integer and gather instructions can
+ * be used, which AVX-512 includes.
+ */
+
+#if defined(__x86_64__)
+
+#define V_ISA   b
+#define V_AVX2  0
+#define V_BITS  128
+#define V_NF    4
+#define V_ND    2
+#define V_ATTR  __attribute__((__target__("sse2")))
+#include "v_types.h"
+#include V_TEMPLATE
+#undef V_ISA
+#undef V_AVX2
+#undef V_BITS
+#undef V_NF
+#undef V_ND
+#undef V_ATTR
+
+#define V_ISA   c
+#define V_AVX2  0
+#define V_BITS  256
+#define V_NF    8
+#define V_ND    4
+#define V_ATTR  __attribute__((__target__("avx")))
+#include "v_types.h"
+#include V_TEMPLATE
+#undef V_ISA
+#undef V_AVX2
+#undef V_BITS
+#undef V_NF
+#undef V_ND
+#undef V_ATTR
+
+#define V_ISA   d
+#define V_AVX2  1
+#define V_BITS  256
+#define V_NF    8
+#define V_ND    4
+#define V_ATTR  __attribute__((__target__("avx2")))
+#include "v_types.h"
+#include V_TEMPLATE
+#undef V_ISA
+#undef V_AVX2
+#undef V_BITS
+#undef V_NF
+#undef V_ND
+#undef V_ATTR
+
+#define V_ISA   e
+#define V_AVX2  1
+#define V_BITS  512
+#define V_NF    16
+#define V_ND    8
+#define V_ATTR  __attribute__((__target__("avx512f")))
+#include "v_types.h"
+#include V_TEMPLATE
+#undef V_ISA
+#undef V_AVX2
+#undef V_BITS
+#undef V_NF
+#undef V_ND
+#undef V_ATTR
+
+#endif
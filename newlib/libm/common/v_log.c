@@ -0,0 +1,152 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef V_TEMPLATE
+
+#include "v_math.h"
+
+#if V_DOUBLE_MATH
+#define V_TEMPLATE "v_log.c"
+#include "v_instance.h"
+#endif
+
+#else
+
+/*
+ * Vector log, see log.c for the algorithm. Only the polynomial
+ * orders configured in math_config.h are handled here. Zero,
+ * negative, subnormal, inf and nan arguments use the scalar code.
+ */
+
+#if LOG_POLY1_ORDER != 12 || LOG_POLY_ORDER != 6 || LOG_TABLE_BITS != 7
+#error vector log needs updating for the log.c configuration
+#endif
+
+#define T __log_data.tab
+#define T2 __log_data.tab2
+#define B __log_data.poly1
+#define A __log_data.poly
+#define Ln2hi __log_data.ln2hi
+#define Ln2lo __log_data.ln2lo
+#define N (1 << LOG_TABLE_BITS)
+#define OFF 0x3fe6000000000000
+#define LO asuint64 (1.0 - 0x1p-4)
+#define HI asuint64 (1.0 + 0x1.09p-4)
+
+/* Close to 1.0 inputs, worst-case error is around 0.507 ULP */
+static ALWAYS_INLINE V_ATTR v_f64_t
+V_FN(v_log_near1)(v_f64_t x)
+{
+    v_f64_t w, r, r2, r3, y, hi, lo, rhi, rlo;
+
+    r = x - 1.0;
+    r2 = r * r;
+    r3 = r * r2;
+    y = r3 * (B[1] + r * B[2] + r2 * B[3]
+              + r3 * (B[4] + r * B[5] + r2 * B[6]
+                      + r3 * (B[7] + r * B[8] + r2 * B[9] + r3 * B[10])));
+    w = r * 0x1p27;
+    rhi = r + w - w;
+    rlo = r - rhi;
+    w = rhi * rhi * B[0]; /* B[0] == -0.5.  */
+    hi = r + w;
+    lo = r - hi + w;
+    lo += B[0] * rlo * (rhi + r);
+    y += lo;
+    y += hi;
+#if WANT_ROUNDING
+    /* Fix sign of zero with downward rounding when x==1.  */
+    y = v_sel_f64(x == 1.0, v_f64(0.0), y);
+#endif
+    return y;
+}
+
+V_ATTR v_f64_t
+V_NAME_D1(log)(v_f64_t x)
+{
+    v_f64_t z, r, r2, y, invc, logc, kd, w, hi, lo;
+    v_u64_t ix, iz, tmp, i;
+    v_s64_t special, near1;
+#if !_HAVE_FAST_FMA
+    v_f64_t chi, clo;
+#endif
+
+    ix = (v_u64_t) x;
+    /* ix - LO < HI - LO; the low halves of LO and HI are zero */
+    near1 = v_lt_u64((ix - LO) >> 32, (HI - LO) >> 32);
+    /* x < 0x1p-1022 or inf or nan */
+    special = ~v_lt_u64(((ix >> 48) - 0x0010) & 0xffff, 0x7ff0 - 0x0010);
+    ix = (v_u64_t) v_sel_f64(special, v_f64(1.0), x);
+
+    /* x = 2^k z; where z is in range [OFF,2*OFF) and exact.
+       The range is split into N subintervals.
+       The ith subinterval contains z and c is near its center.  */
+    tmp = ix - OFF;
+    i = (tmp >> (52 - LOG_TABLE_BITS)) % N;
+    iz = ix - (tmp & 0xfffULL << 52);
+    V_LOOKUP2(T, i, invc, &invc, &logc);
+#if !_HAVE_FAST_FMA
+    V_LOOKUP2(T2, i, chi, &chi, &clo);
+#endif
+    z = (v_f64_t) iz;
+
+    /* log(x) = log1p(z/c-1) + log(c) + k*Ln2.  */
+    /* r ~= z/c - 1, |r| < 1/(2*N).  */
+#if _HAVE_FAST_FMA
+    r = v_fma_f64(z, invc, v_f64(-1.0));
+#else
+    r = (z - chi - clo) * invc;
+#endif
+    /* k = tmp >> 52 with an arithmetic shift; sign extend and convert
+       it by hand as there are no vector instructions for either.  */
+    kd = (v_f64_t) ((tmp >> 52 ^ 0x800) + asuint64(0x1.8p52)) - (0x1.8p52 + 0x800);
+
+    /* hi + lo = r + log(c) + k*Ln2.  */
+    w = kd * Ln2hi + logc;
+    hi = w + r;
+    lo = w - hi + r + kd * Ln2lo;
+
+    /* log(x) = lo + (log1p(r) - r) + hi.  */
+    r2 = r * r;
+    y = lo + r2 * A[0] + r * r2 * (A[1] + r * A[2] + r2 * (A[3] + r * A[4])) + hi;
+
+    if (unlikely(v_any_s64(near1)))
+        y = v_sel_f64(near1, V_FN(v_log_near1)((v_f64_t) ix), y);
+    if (unlikely(v_any_s64(special)))
+        return v_call_f64(log, x, y, special);
+    return y;
+}
+
+#endif /* V_TEMPLATE */
@@ -0,0 +1,110 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef V_TEMPLATE
+
+#include "v_math.h"
+
+#if V_FLOAT_MATH
+#define V_TEMPLATE "v_logf.c"
+#include "v_instance.h"
+#endif
+
+#else
+
+/* Vector logf, see sf_log.c for the algorithm */
+
+#define T __logf_data.tab
+#define A __logf_data.poly
+#define Ln2 __logf_data.ln2
+#define N (1 << LOGF_TABLE_BITS)
+#define OFF 0x3f330000
+
+static ALWAYS_INLINE V_ATTR v_f64_t
+V_FN(v_logf_half)(v_f64_t z, v_f64_t k, v_u64_t i)
+{
+    v_f64_t r, r2, y, y0, invc, logc;
+
+    V_LOOKUP2(T, i, invc, &invc, &logc);
+
+    /* log(x) = log1p(z/c-1) + log(c) + k*Ln2 */
+    r = z * invc - 1.0;
+    y0 = logc + k * Ln2;
+
+    /* Pipelined polynomial evaluation to approximate log1p(r).  */
+    r2 = r * r;
+    y = A[1] * r + A[2];
+    y = A[0] * r2 + y;
+    return y * r2 + (y0 + r);
+}
+
+V_ATTR v_f32_t
+V_NAME_F1(logf)(v_f32_t x)
+{
+    v_u32_t ix, iz, tmp, i;
+    v_s32_t special, k;
+    v_f32_t z, ret;
+
+    /* x < 0x1p-126 or inf or nan */
+    ix = (v_u32_t) x;
+    special = ~v_lt_u32(ix - 0x00800000, 0x7f800000 - 0x00800000);
+    ix = (v_u32_t) v_sel_f32(special, v_f32(1.0f), x);
+
+    /* x = 2^k z; where z is in range [OFF,2*OFF] and exact.
+       The range is split into N subintervals.
+       The ith subinterval contains z and c is near its center.  */
+    tmp = ix - OFF;
+    i = (tmp >> (23 - LOGF_TABLE_BITS)) % N;
+    k = (v_s32_t) tmp >> 23; /* arithmetic shift */
+    iz = ix - (tmp & (uint32_t) 0x1ff << 23);
+    z = (v_f32_t) iz;
+
+    ret = v_join_f32(V_FN(v_logf_half)(v_half_f64(z, 0),
+                                       v_half_f64_s32(k, 0),
+                                       v_half_u64(i, 0)),
+                     V_FN(v_logf_half)(v_half_f64(z, 1),
+                                       v_half_f64_s32(k, 1),
+                                       v_half_u64(i, 1)));
+#if WANT_ROUNDING
+    /* Fix sign of zero with downward rounding when x==1.  */
+    ret = v_sel_f32((v_f32_t) ix == 1.0f, v_f32(0.0f), ret);
+#endif
+
+    if (unlikely(v_any_s32(special)))
+        return v_call_f32(logf, x, ret, special);
+    return ret;
+}
+
+#endif /* V_TEMPLATE */
@@ -0,0 +1,153 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _V_MATH_H_
+#define _V_MATH_H_
+
+#include <stdint.h>
+#include <math.h>
+#ifdef __x86_64__
+#include <immintrin.h>
+#endif
+#include "fdlibm.h"
+#include "math_config.h"
+
+/*
+ * Vector variants of the math functions, following the vector
+ * function ABI used by GCC and clang for '#pragma omp declare simd'
+ * and '__attribute__((simd))' (the same ABI as glibc libmvec):
+ *
+ *	_ZGV<isa>N<lanes>v_<name>	one argument
+ *	_ZGV<isa>N<lanes>vv_<name>	two arguments
+ *
+ * with isa 'b' (SSE2, 128 bits), 'c' (AVX, 256 bits), 'd' (AVX2,
+ * 256 bits) and 'e' (AVX512F, 512 bits). Only x86_64 is handled; the
+ * AdvSIMD and SVE variants of aarch64 are not provided.
+ *
+ * Each function is written once with the generic vector extensions
+ * and instantiated for every width: the source file defines
+ * V_TEMPLATE as its own name and includes v_instance.h, which sets
+ * up the types and names for each width (v_types.h) and includes
+ * V_TEMPLATE again to compile the body.
+ *
+ * The bodies evaluate the scalar algorithm on all lanes with the
+ * same tables, so results match the scalar functions. Lanes which
+ * the scalar code handles out of line (overflow, underflow, NaN,
+ * large arguments and so on) are replaced with a harmless value for
+ * the vector code and then recomputed by calling the scalar
+ * function, which takes care of errno and exceptions.
+ */
+
+#if defined(__x86_64__) && \
+    (defined(__clang__) || __GNUC__ >= 9)
+#define HAVE_VECTOR_MATH 1
+#else
+#define HAVE_VECTOR_MATH 0
+#endif
+
+#define V_FLOAT_MATH    (HAVE_VECTOR_MATH && !__OBSOLETE_MATH_FLOAT)
+#define V_DOUBLE_MATH   (HAVE_VECTOR_MATH && !__OBSOLETE_MATH_DOUBLE)
+
+/*
+ * Helpers pass the wider vectors around only when inlined, so the
+ * ABI of those is not a concern.
+ */
+#ifndef __clang__
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+
+/*
+ * Put in front of loops over the lanes doing table lookups. Fully
+ * unrolled, the lookups are assembled into a vector in registers;
+ * otherwise compilers may vectorize the loop in pieces through
+ * memory, which is much slower.
+ */
+#define V_UNROLL        _Pragma("GCC unroll 16")
+
+/* Lanes of field f of the table entries tab[i] into a, and of the
+   field after it into b */
+#define V_LOOKUP2(tab, i, f, a, b) \
+    v_lookup2_f64(&(tab)[0].f, i, sizeof((tab)[0]) / sizeof(double), a, b)
+
+#define _V_CAT(a, b)    a ## b
+#define V_CAT(a, b)     _V_CAT(a, b)
+
+/* Exported vector names, one and two arguments */
+#define __V_ZGV(isa, n, args, f)        _ZGV ## isa ## N ## n ## args ## _ ## f
+#define _V_ZGV(isa, n, args, f)         __V_ZGV(isa, n, args, f)
+#define V_NAME_F1(f)    _V_ZGV(V_ISA, V_NF, v, f)
+#define V_NAME_F2(f)    _V_ZGV(V_ISA, V_NF, vv, f)
+#define V_NAME_D1(f)    _V_ZGV(V_ISA, V_ND, v, f)
+#define V_NAME_D2(f)    _V_ZGV(V_ISA, V_ND, vv, f)
+
+/* Per-width names for types and local helpers */
+#define V_FN(f)         V_CAT(V_CAT(f, _), V_CAT(V_ISA, V_BITS))
+
+/* Lanes of float, and half as many lanes of float */
+#define v_f32_t         V_FN(vf32)
+#define v_u32_t         V_FN(vu32)
+#define v_s32_t         V_FN(vs32)
+#define v_f32h_t        V_FN(vf32h)
+#define v_u32h_t        V_FN(vu32h)
+#define v_s32h_t        V_FN(vs32h)
+
+/* Lanes of double */
+#define v_f64_t         V_FN(vf64)
+#define v_u64_t         V_FN(vu64)
+#define v_s64_t         V_FN(vs64)
+
+#define v_f32           V_FN(v_f32)
+#define v_f64           V_FN(v_f64)
+#define v_lt_u32        V_FN(v_lt_u32)
+#define v_lt_u64        V_FN(v_lt_u64)
+#define v_any_s32       V_FN(v_any_s32)
+#define v_any_s64       V_FN(v_any_s64)
+#define v_sel_f32       V_FN(v_sel_f32)
+#define v_sel_f64       V_FN(v_sel_f64)
+#define v_half          V_FN(v_half)
+#define v_half_f64      V_FN(v_half_f64)
+#define v_half_f64_s32  V_FN(v_half_f64_s32)
+#define v_half_u64      V_FN(v_half_u64)
+#define v_join_f32      V_FN(v_join_f32)
+#define v_join_s32      V_FN(v_join_s32)
+#define v_lookup_u64    V_FN(v_lookup_u64)
+#define v_lookup_f64    V_FN(v_lookup_f64)
+#define v_lookup2_f64   V_FN(v_lookup2_f64)
+#define v_fma_f64       V_FN(v_fma_f64)
+#define v_call_f32      V_FN(v_call_f32)
+#define v_call2_f32     V_FN(v_call2_f32)
+#define v_call_f64      V_FN(v_call_f64)
+
+#endif /* _V_MATH_H_ */
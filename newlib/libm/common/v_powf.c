@@ -0,0 +1,142 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef V_TEMPLATE
+
+#include "v_math.h"
+
+#if V_FLOAT_MATH
+#define V_TEMPLATE "v_powf.c"
+#include "v_instance.h"
+#endif
+
+#else
+
+/*
+ * Vector powf, see sf_pow.c for the algorithm. Negative x and
+ * results which overflow or underflow are left to the scalar code.
+ */
+
+#define N (1 << POWF_LOG2_TABLE_BITS)
+#define T __powf_log2_data.tab
+#define A __powf_log2_data.poly
+#define OFF 0x3f330000
+#define EN (1 << EXP2F_TABLE_BITS)
+#define ET __exp2f_data.tab
+#define C __exp2f_data.poly
+#define SHIFT __exp2f_data.shift_scaled
+
+/*
+ * One half of the lanes: z, k and i come from x as in log2f. Lanes
+ * where y*log2(x) is too large are set in *over and computed with
+ * ylogx = 0 instead.
+ */
+static ALWAYS_INLINE V_ATTR v_f64_t
+V_FN(v_powf_half)(v_f64_t z, v_f64_t k, v_u64_t i, v_f64_t yd, v_s64_t *over)
+{
+    v_f64_t r, r2, r4, p, q, y0, invc, logc, logx, ylogx, kd, s;
+    v_u64_t ki, t;
+
+    V_LOOKUP2(T, i, invc, &invc, &logc);
+    r = z * invc - 1.0;
+    y0 = logc + k;
+
+    /* Pipelined polynomial evaluation to approximate log1p(r)/ln2.  */
+    r2 = r * r;
+    logx = A[0] * r + A[1];
+    p = A[2] * r + A[3];
+    r4 = r2 * r2;
+    q = A[4] * r + y0;
+    q = p * r2 + q;
+    logx = logx * r4 + q;
+    yd = yd * logx;
+
+    /* |y*log(x)| >= 126, the result may overflow or underflow */
+    *over = ~v_lt_u64((v_u64_t) yd >> 47 & 0xffff,
+                      asuint64(126.0 * POWF_SCALE) >> 47);
+    ylogx = v_sel_f64(*over, v_f64(0.0), yd);
+
+    /* exp2(x) = 2^(k/N) * 2^r ~= s * (C0*r^3 + C1*r^2 + C2*r + 1) */
+    kd = ylogx + SHIFT;
+    ki = (v_u64_t) kd;
+    kd -= SHIFT;
+    r = ylogx - kd;
+    t = (ki << (52 - EXP2F_TABLE_BITS)) + v_lookup_u64(ET, ki % EN);
+    s = (v_f64_t) t;
+    z = C[0] * r + C[1];
+    r2 = r * r;
+    p = C[2] * r + 1.0;
+    return (z * r2 + p) * s;
+}
+
+V_ATTR v_f32_t
+V_NAME_F2(powf)(v_f32_t x, v_f32_t y)
+{
+    v_u32_t ix, iy, iz, top, tmp, i;
+    v_s32_t special, k;
+    v_s64_t over0, over1;
+    v_f64_t lo, hi;
+    v_f32_t z, ys;
+
+    /* Either (x < 0x1p-126 or inf or nan) or (y is 0 or inf or nan) */
+    ix = (v_u32_t) x;
+    iy = (v_u32_t) y;
+    special = ~(v_lt_u32(ix - 0x00800000, 0x7f800000 - 0x00800000) &
+                v_lt_u32(2 * iy - 1, 2u * 0x7f800000 - 1));
+    ix = (v_u32_t) v_sel_f32(special, v_f32(1.0f), x);
+    ys = v_sel_f32(special, v_f32(1.0f), y);
+
+    /* log2(x) = log1p(z/c-1)/ln2 + log2(c) + k */
+    tmp = ix - OFF;
+    i = (tmp >> (23 - POWF_LOG2_TABLE_BITS)) % N;
+    top = tmp & 0xff800000;
+    iz = ix - top;
+    k = (v_s32_t) top >> (23 - POWF_SCALE_BITS); /* arithmetic shift */
+    z = (v_f32_t) iz;
+
+    lo = V_FN(v_powf_half)(v_half_f64(z, 0),
+                           v_half_f64_s32(k, 0),
+                           v_half_u64(i, 0), v_half_f64(ys, 0), &over0);
+    hi = V_FN(v_powf_half)(v_half_f64(z, 1),
+                           v_half_f64_s32(k, 1),
+                           v_half_u64(i, 1), v_half_f64(ys, 1), &over1);
+
+    special |= v_join_s32(over0, over1);
+    if (unlikely(v_any_s32(special)))
+        return v_call2_f32(powf, x, y, v_join_f32(lo, hi), special);
+    return v_join_f32(lo, hi);
+}
+
+#endif /* V_TEMPLATE */
@@ -0,0 +1,133 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef V_TEMPLATE
+
+#include "v_math.h"
+
+#if V_FLOAT_MATH
+#include "sincosf.h"
+#define V_TEMPLATE "v_sincosf.c"
+#include "v_instance.h"
+#endif
+
+#else
+
+/*
+ * Vector sinf and cosf, see sinf.c, cosf.c and sincosf.h for the
+ * algorithm. Arguments beyond the reach of reduce_fast (|x| >= 120)
+ * and subnormals, which need an underflow, use the scalar code.
+ */
+
+static ALWAYS_INLINE V_ATTR v_f64_t
+V_FN(v_sincosf_half)(v_f64_t x, int cosine)
+{
+    const sincos_t *p = &__sincosf_table[0];
+    v_f64_t x2, x3, x4, x6, x7, r, s, c, s1, c1, c2, sin, cos;
+    v_s64_t odd;
+    v_u64_t n, neg;
+
+    /* Fast range reduction using single multiply-subtract */
+    r = x * p->hpi_inv;
+    r = __builtin_convertvector(
+        (__builtin_convertvector(r, v_s32h_t) + 0x800000) >> 24, v_f64_t);
+    x = x - r * p->hpi;
+    /* Only the low bits of n are needed; take them from the
+       mantissa instead of widening the integers.  */
+    n = (v_u64_t) (r + 0x1.8p52);
+
+    /* The result is negated in quadrants 2 and 3 (1 and 2 for the
+       cosine).  The scalar code negates x for the sine and uses the
+       negated cosine polynomial instead, which gives the same bits as
+       flipping the sign of the result.  The mask is made by negating
+       a single bit as SSE2 has no 64-bit compares.  */
+    neg = (n + cosine) << 62 & 0x8000000000000000;
+    odd = (v_s64_t) -((n ^ cosine) & 1);
+    x2 = x * x;
+
+    /* Sine polynomial */
+    x3 = x * x2;
+    s1 = p->s2 + x2 * p->s3;
+    x7 = x3 * x2;
+    s = x + x3 * p->s1;
+    sin = s + x7 * s1;
+
+    /* Cosine polynomial */
+    x4 = x2 * x2;
+    c2 = p->c3 + x2 * p->c4;
+    c1 = p->c0 + x2 * p->c1;
+    x6 = x4 * x2;
+    c = c1 + x4 * p->c2;
+    cos = c + x6 * c2;
+
+    return (v_f64_t) ((v_u64_t) v_sel_f64(odd, cos, sin) ^ neg);
+}
+
+static ALWAYS_INLINE V_ATTR v_f32_t
+V_FN(v_sincosf)(v_f32_t y, int cosine)
+{
+    v_s32_t special, tiny;
+    v_u32_t iy;
+    v_f32_t x, ret;
+
+    /* |y| >= 120, inf or nan, or subnormal */
+    iy = (v_u32_t) y & 0x7fffffff;
+    special = ~v_lt_u32(iy, 0x42f00000) | v_lt_u32(iy - 1, 0x007fffff);
+    /* |y| < 0x1p-12, the result is y or 1 */
+    tiny = v_lt_u32(iy, 0x39800000);
+    x = v_sel_f32(special | tiny, v_f32(0.0f), y);
+
+    ret = v_join_f32(V_FN(v_sincosf_half)(v_half_f64(x, 0), cosine),
+                     V_FN(v_sincosf_half)(v_half_f64(x, 1), cosine));
+    ret = v_sel_f32(tiny, cosine ? v_f32(1.0f) : y, ret);
+
+    if (unlikely(v_any_s32(special)))
+        return v_call_f32(cosine ? cosf : sinf, y, ret, special);
+    return ret;
+}
+
+V_ATTR v_f32_t
+V_NAME_F1(sinf)(v_f32_t y)
+{
+    return V_FN(v_sincosf)(y, 0);
+}
+
+V_ATTR v_f32_t
+V_NAME_F1(cosf)(v_f32_t y)
+{
+    return V_FN(v_sincosf)(y, 1);
+}
+
+#endif /* V_TEMPLATE */
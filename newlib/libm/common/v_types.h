@@ -0,0 +1,375 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Types and helpers for one vector width, included by v_instance.h
+ * once per width with V_ISA, V_BITS, V_NF, V_ND and V_ATTR set.
+ *
+ * The float functions evaluate in double like the scalar code. A
+ * vector of double with as many lanes as the float vector is twice
+ * the native width, which compilers split poorly, so they work on
+ * each half of the float lanes as a native vector of double instead.
+ */
+
+typedef float    v_f32_t  __attribute__((__vector_size__(V_NF * 4)));
+typedef uint32_t v_u32_t  __attribute__((__vector_size__(V_NF * 4)));
+typedef int32_t  v_s32_t  __attribute__((__vector_size__(V_NF * 4)));
+typedef double   v_f64_t  __attribute__((__vector_size__(V_ND * 8)));
+typedef uint64_t v_u64_t  __attribute__((__vector_size__(V_ND * 8)));
+typedef int64_t  v_s64_t  __attribute__((__vector_size__(V_ND * 8)));
+
+/* Half of the float lanes */
+typedef float    v_f32h_t __attribute__((__vector_size__(V_ND * 4)));
+typedef uint32_t v_u32h_t __attribute__((__vector_size__(V_ND * 4)));
+typedef int32_t  v_s32h_t __attribute__((__vector_size__(V_ND * 4)));
+
+/*
+ * Splat through the integer types; with -frounding-math, 0 + c
+ * can't be folded to c and would be computed at run time.
+ */
+static ALWAYS_INLINE V_ATTR v_f32_t
+v_f32(float c)
+{
+    return (v_f32_t) ((v_u32_t) { 0 } + asuint(c));
+}
+
+static ALWAYS_INLINE V_ATTR v_f64_t
+v_f64(double c)
+{
+    return (v_f64_t) ((v_u64_t) { 0 } + asuint64(c));
+}
+
+/*
+ * The helpers which move lanes around use the intrinsics: written
+ * with the generic vector extensions, compilers split them into
+ * pieces or pass the vectors through memory.
+ */
+
+/* Whether any lane of the mask is set */
+static ALWAYS_INLINE V_ATTR int
+v_any_s32(v_s32_t m)
+{
+#if V_BITS == 128
+    return _mm_movemask_ps((__m128) m) != 0;
+#elif V_BITS == 256
+    return _mm256_movemask_ps((__m256) m) != 0;
+#else
+    return _mm512_test_epi32_mask((__m512i) m, (__m512i) m) != 0;
+#endif
+}
+
+static ALWAYS_INLINE V_ATTR int
+v_any_s64(v_s64_t m)
+{
+#if V_BITS == 128
+    return _mm_movemask_pd((__m128d) m) != 0;
+#elif V_BITS == 256
+    return _mm256_movemask_pd((__m256d) m) != 0;
+#else
+    return _mm512_test_epi64_mask((__m512i) m, (__m512i) m) != 0;
+#endif
+}
+
+static ALWAYS_INLINE V_ATTR v_f32_t
+v_sel_f32(v_s32_t m, v_f32_t a, v_f32_t b)
+{
+    return (v_f32_t) (((v_s32_t) a & m) | ((v_s32_t) b & ~m));
+}
+
+static ALWAYS_INLINE V_ATTR v_f64_t
+v_sel_f64(v_s64_t m, v_f64_t a, v_f64_t b)
+{
+    return (v_f64_t) (((v_s64_t) a & m) | ((v_s64_t) b & ~m));
+}
+
+/* Half h of the float lanes, as bits */
+#if V_BITS == 128
+static ALWAYS_INLINE V_ATTR __m128i
+v_half(v_s32_t x, int h)
+{
+    return h ? _mm_unpackhi_epi64((__m128i) x, (__m128i) x) : (__m128i) x;
+}
+#elif V_BITS == 256
+static ALWAYS_INLINE V_ATTR __m128i
+v_half(v_s32_t x, int h)
+{
+    return h ? _mm256_extractf128_si256((__m256i) x, 1) :
+        _mm256_castsi256_si128((__m256i) x);
+}
+#else
+static ALWAYS_INLINE V_ATTR __m256i
+v_half(v_s32_t x, int h)
+{
+    return h ? _mm512_extracti64x4_epi64((__m512i) x, 1) :
+        _mm512_castsi512_si256((__m512i) x);
+}
+#endif
+
+/*
+ * Lanes where a < b. x86 only has signed compares of 32-bit lanes;
+ * AVX has no 256-bit integer compares at all, and compilers compare
+ * each lane on its own instead of splitting those in two.
+ */
+static ALWAYS_INLINE V_ATTR v_s32_t
+v_lt_u32(v_u32_t a, uint32_t b)
+{
+    v_s32_t s = (v_s32_t) (a ^ 0x80000000);
+    int32_t c = (int32_t) (b ^ 0x80000000);
+#if V_BITS == 256 && !V_AVX2
+    __m128i cv = _mm_set1_epi32(c);
+
+    return (v_s32_t) _mm256_insertf128_si256(
+        _mm256_castsi128_si256(_mm_cmplt_epi32(v_half(s, 0), cv)),
+        _mm_cmplt_epi32(v_half(s, 1), cv), 1);
+#else
+    return s < c;
+#endif
+}
+
+/*
+ * Lanes where a < b, both below 2^63. SSE2 has no 64-bit compares,
+ * so it takes the sign of the difference instead.
+ */
+static ALWAYS_INLINE V_ATTR v_s64_t
+v_lt_u64(v_u64_t a, uint64_t b)
+{
+#if V_BITS == 128
+    return (v_s64_t) -((a - b) >> 63);
+#elif V_BITS == 256 && !V_AVX2
+    __m128i cv = _mm_set1_epi64x((int64_t) b);
+
+    return (v_s64_t) _mm256_insertf128_si256(
+        _mm256_castsi128_si256(_mm_cmpgt_epi64(cv, v_half((v_s32_t) a, 0))),
+        _mm_cmpgt_epi64(cv, v_half((v_s32_t) a, 1)), 1);
+#else
+    return (v_s64_t) a < (int64_t) b;
+#endif
+}
+
+/* Lanes of half h of x, widened to double or 64 bits */
+static ALWAYS_INLINE V_ATTR v_f64_t
+v_half_f64(v_f32_t x, int h)
+{
+#if V_BITS == 128
+    return (v_f64_t) _mm_cvtps_pd((__m128) v_half((v_s32_t) x, h));
+#elif V_BITS == 256
+    return (v_f64_t) _mm256_cvtps_pd((__m128) v_half((v_s32_t) x, h));
+#else
+    return (v_f64_t) _mm512_cvtps_pd((__m256) v_half((v_s32_t) x, h));
+#endif
+}
+
+static ALWAYS_INLINE V_ATTR v_f64_t
+v_half_f64_s32(v_s32_t x, int h)
+{
+#if V_BITS == 128
+    return (v_f64_t) _mm_cvtepi32_pd(v_half(x, h));
+#elif V_BITS == 256
+    return (v_f64_t) _mm256_cvtepi32_pd(v_half(x, h));
+#else
+    return (v_f64_t) _mm512_cvtepi32_pd(v_half(x, h));
+#endif
+}
+
+static ALWAYS_INLINE V_ATTR v_u64_t
+v_half_u64(v_u32_t x, int h)
+{
+#if V_BITS == 128
+    __m128i z = _mm_setzero_si128();
+
+    return (v_u64_t) (h ? _mm_unpackhi_epi32((__m128i) x, z) :
+                      _mm_unpacklo_epi32((__m128i) x, z));
+#elif V_BITS == 256 && V_AVX2
+    return (v_u64_t) _mm256_cvtepu32_epi64(v_half((v_s32_t) x, h));
+#elif V_BITS == 256
+    __m128i l = v_half((v_s32_t) x, h), z = _mm_setzero_si128();
+
+    return (v_u64_t) _mm256_insertf128_si256(
+        _mm256_castsi128_si256(_mm_unpacklo_epi32(l, z)),
+        _mm_unpackhi_epi32(l, z), 1);
+#else
+    return (v_u64_t) _mm512_cvtepu32_epi64(v_half((v_s32_t) x, h));
+#endif
+}
+
+/* Round both halves to float and put them back together */
+static ALWAYS_INLINE V_ATTR v_f32_t
+v_join_f32(v_f64_t lo, v_f64_t hi)
+{
+#if V_BITS == 128
+    return (v_f32_t) _mm_movelh_ps(_mm_cvtpd_ps((__m128d) lo),
+                                   _mm_cvtpd_ps((__m128d) hi));
+#elif V_BITS == 256
+    return (v_f32_t) _mm256_insertf128_ps(
+        _mm256_castps128_ps256(_mm256_cvtpd_ps((__m256d) lo)),
+        _mm256_cvtpd_ps((__m256d) hi), 1);
+#else
+    return (v_f32_t) _mm512_insertf64x4(
+        _mm512_castpd256_pd512((__m256d) _mm512_cvtpd_ps((__m512d) lo)),
+        (__m256d) _mm512_cvtpd_ps((__m512d) hi), 1);
+#endif
+}
+
+/* Narrow two masks of 64-bit lanes to one of 32-bit lanes */
+static ALWAYS_INLINE V_ATTR v_s32_t
+v_join_s32(v_s64_t lo, v_s64_t hi)
+{
+#if V_BITS == 128
+    return (v_s32_t) _mm_shuffle_ps((__m128) lo, (__m128) hi,
+                                    _MM_SHUFFLE(2, 0, 2, 0));
+#elif V_BITS == 256
+    __m128 l = _mm_shuffle_ps(_mm256_castps256_ps128((__m256) lo),
+                              _mm256_extractf128_ps((__m256) lo, 1),
+                              _MM_SHUFFLE(2, 0, 2, 0));
+    __m128 h = _mm_shuffle_ps(_mm256_castps256_ps128((__m256) hi),
+                              _mm256_extractf128_ps((__m256) hi, 1),
+                              _MM_SHUFFLE(2, 0, 2, 0));
+
+    return (v_s32_t) _mm256_insertf128_ps(_mm256_castps128_ps256(l), h, 1);
+#else
+    return (v_s32_t) _mm512_inserti64x4(
+        _mm512_castsi256_si512(_mm512_cvtepi64_epi32((__m512i) lo)),
+        _mm512_cvtepi64_epi32((__m512i) hi), 1);
+#endif
+}
+
+/*
+ * Table lookups, tab[i * stride] in each lane. AVX2 and AVX-512
+ * gather the lanes with one instruction, SSE2 and AVX load them one
+ * at a time.
+ */
+static ALWAYS_INLINE V_ATTR v_u64_t
+v_lookup_u64(const uint64_t *tab, v_u64_t i)
+{
+#if V_BITS == 256 && V_AVX2
+    return (v_u64_t) _mm256_i64gather_epi64((const long long *) tab,
+                                            (__m256i) i, 8);
+#elif V_BITS == 512
+    return (v_u64_t) _mm512_i64gather_epi64((__m512i) i, tab, 8);
+#else
+    v_u64_t r;
+
+    V_UNROLL
+    for (int l = 0; l < V_ND; l++)
+        r[l] = tab[i[l]];
+    return r;
+#endif
+}
+
+static ALWAYS_INLINE V_ATTR v_f64_t
+v_lookup_f64(const double *tab, v_u64_t i, int stride)
+{
+#if V_BITS == 256 && V_AVX2
+    return (v_f64_t) _mm256_i64gather_pd(tab, (__m256i) (i * stride), 8);
+#elif V_BITS == 512
+    return (v_f64_t) _mm512_i64gather_pd((__m512i) (i * stride), tab, 8);
+#else
+    v_f64_t r;
+
+    V_UNROLL
+    for (int l = 0; l < V_ND; l++)
+        r[l] = tab[i[l] * stride];
+    return r;
+#endif
+}
+
+/*
+ * Two lookups, tab[i * stride] into *a and tab[i * stride + 1] into
+ * *b. SSE2 and AVX load both values of a lane at once and sort them
+ * out with shuffles.
+ */
+static ALWAYS_INLINE V_ATTR void
+v_lookup2_f64(const double *tab, v_u64_t i, int stride,
+              v_f64_t *a, v_f64_t *b)
+{
+#if V_BITS == 128
+    __m128d p0 = _mm_loadu_pd(tab + i[0] * stride);
+    __m128d p1 = _mm_loadu_pd(tab + i[1] * stride);
+
+    *a = (v_f64_t) _mm_unpacklo_pd(p0, p1);
+    *b = (v_f64_t) _mm_unpackhi_pd(p0, p1);
+#elif V_BITS == 256 && !V_AVX2
+    __m256d p02 = _mm256_insertf128_pd(
+        _mm256_castpd128_pd256(_mm_loadu_pd(tab + i[0] * stride)),
+        _mm_loadu_pd(tab + i[2] * stride), 1);
+    __m256d p13 = _mm256_insertf128_pd(
+        _mm256_castpd128_pd256(_mm_loadu_pd(tab + i[1] * stride)),
+        _mm_loadu_pd(tab + i[3] * stride), 1);
+
+    *a = (v_f64_t) _mm256_unpacklo_pd(p02, p13);
+    *b = (v_f64_t) _mm256_unpackhi_pd(p02, p13);
+#else
+    *a = v_lookup_f64(tab, i, stride);
+    *b = v_lookup_f64(tab + 1, i, stride);
+#endif
+}
+
+#if _HAVE_FAST_FMA
+static ALWAYS_INLINE V_ATTR v_f64_t
+v_fma_f64(v_f64_t x, v_f64_t y, v_f64_t z)
+{
+    for (int i = 0; i < V_ND; i++)
+        x[i] = fma(x[i], y[i], z[i]);
+    return x;
+}
+#endif
+
+/* Recompute the lanes selected by m with the scalar function */
+static __inline__ NOINLINE V_ATTR v_f32_t
+v_call_f32(float (*f)(float), v_f32_t x, v_f32_t y, v_s32_t m)
+{
+    for (int i = 0; i < V_NF; i++)
+        if (m[i])
+            y[i] = f(x[i]);
+    return y;
+}
+
+static __inline__ NOINLINE V_ATTR v_f32_t
+v_call2_f32(float (*f)(float, float), v_f32_t x1, v_f32_t x2, v_f32_t y, v_s32_t m)
+{
+    for (int i = 0; i < V_NF; i++)
+        if (m[i])
+            y[i] = f(x1[i], x2[i]);
+    return y;
+}
+
+static __inline__ NOINLINE V_ATTR v_f64_t
+v_call_f64(double (*f)(double), v_f64_t x, v_f64_t y, v_s64_t m)
+{
+    for (int i = 0; i < V_ND; i++)
+        if (m[i])
+            y[i] = f(x[i]);
+    return y;
+}
@@ -13,9 +13,12 @@
 /*
  * fmodl(x,y)
  * Return x mod y in exact arithmetic
- * Method: shift and subtract
+ * Method: shift and subtract, or integer remainder of the significands
+ * reducing many bits per step where __int128 is available
  */
 
+#include "fmod.h"
+
 
 
 static const long double one = 1.0L, Zero[] = {0.0L, -0.0L,};
@@ -23,8 +26,8 @@ static const long double one = 1.0L, Zero[] = {0.0L, -0.0L,};
 long double
 fmodl(long double x, long double y)
 {
-	int64_t n,hx,hy,hz,ix,iy,sx,i;
-	u_int64_t lx,ly,lz;
+	int64_t n,hx,hy,ix,iy,sx,i;
+	u_int64_t lx,ly;
 
 	GET_LDOUBLE_WORDS64(hx,lx,x);
 	GET_LDOUBLE_WORDS64(hy,ly,y);
@@ -93,6 +96,19 @@ fmodl(long double x, long double y)
 
     /* fix point fmod */
 	n = ix - iy;
+#ifdef __SIZEOF_INT128__
+	{
+	    unsigned __int128 mx = ((unsigned __int128) hx << 64) | lx;
+	    unsigned __int128 my = ((unsigned __int128) hy << 64) | ly;
+
+	    mx = fmod_reduce128(mx, my, n);
+	    hx = (int64_t) (mx >> 64);
+	    lx = (u_int64_t) mx;
+	}
+#else
+	int64_t hz;
+	u_int64_t lz;
+
 	while(n--) {
 	    hz=hx-hy;lz=lx-ly; if(lx<ly) hz -= 1;
 	    if(hz<0){hx = hx+hx+(lx>>63); lx = lx+lx;}
@@ -104,6 +120,7 @@ fmodl(long double x, long double y)
 	}
 	hz=hx-hy;lz=lx-ly; if(lx<ly) hz -= 1;
 	if(hz>=0) {hx=hz;lx=lz;}
+#endif
 
     /* convert back to floating value and restore the sign */
 	if((hx|lx)==0)			/* return sign(x)*0 */
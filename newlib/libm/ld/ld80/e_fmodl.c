@@ -13,6 +13,8 @@
 
 
 
+#include "fmod.h"
+
 #define	BIAS (LDBL_MAX_EXP - 1)
 
 /*
@@ -37,7 +39,8 @@ static const long double one = 1.0l, Zero[] = {0.0l, -0.0l,};
 /*
  * fmodl(x,y)
  * Return x mod y in exact arithmetic
- * Method: shift and subtract
+ * Method: shift and subtract, or integer remainder of the significands
+ * reducing many bits per step where __int128 is available
  *
  * Assumptions:
  * - The low part of the mantissa fits in a manl_t exactly.
@@ -51,9 +54,9 @@ fmodl(long double x, long double y)
 		long double e;
 		struct ieee_ext bits;
 	} ux, uy;
-	int64_t hx,hz;	/* We need a carry bit even if LDBL_MANH_SIZE is 32. */
+	int64_t hx;	/* We need a carry bit even if LDBL_MANH_SIZE is 32. */
 	uint32_t hy;
-	uint32_t lx,ly,lz;
+	uint32_t lx,ly;
 	int ix,iy,n,sx;
 
 	ux.e = x;
@@ -107,6 +110,19 @@ fmodl(long double x, long double y)
     /* fix point fmod */
 	n = ix - iy;
 
+#ifdef __SIZEOF_INT128__
+	{
+	    unsigned __int128 mx = ((unsigned __int128) hx << (MANL_SHIFT + 1)) | lx;
+	    unsigned __int128 my = ((unsigned __int128) hy << (MANL_SHIFT + 1)) | ly;
+
+	    mx = fmod_reduce128(mx, my, n);
+	    hx = (int64_t) (mx >> (MANL_SHIFT + 1));
+	    lx = (uint32_t) mx;
+	}
+#else
+	int64_t hz;
+	uint32_t lz;
+
 	while(n--) {
 	    hz=hx-hy;lz=lx-ly; if(lx<ly) hz -= 1;
 	    if(hz<0){hx = hx+hx+(lx>>MANL_SHIFT); lx = lx+lx;}
@@ -118,6 +134,7 @@ fmodl(long double x, long double y)
 	}
 	hz=hx-hy;lz=lx-ly; if(lx<ly) hz -= 1;
 	if(hz>=0) {hx=hz;lx=lz;}
+#endif
 
     /* convert back to floating value and restore the sign */
 	if((hx|lx)==0)			/* return sign(x)*0 */
@@ -43,6 +43,8 @@
  */
 
 #include "fdlibm.h"
+#include "math_config.h"
+#if __OBSOLETE_MATH_DOUBLE
 
 #ifdef _NEED_FLOAT64
 
@@ -90,3 +92,6 @@ __strong_reference(_NAME_64(cos), _NAME_64(_cos));
 _MATH_ALIAS_d_d(cos)
 
 #endif /* _NEED_FLOAT64 */
+#else
+#include "../common/cos.c"
+#endif /* __OBSOLETE_MATH_DOUBLE */
@@ -14,22 +14,23 @@
 /*
  * fmod(x,y)
  * Return x mod y in exact arithmetic
- * Method: shift and subtract
+ * Method: integer remainder of the significands, reducing as many
+ * bits of the exponent difference per step as a 64-bit word allows
  */
 
 #include "fdlibm.h"
+#include "fmod.h"
 
 #ifdef _NEED_FLOAT64
 
-static const __float64
-    one = _F_64(1.0),
-    Zero[] = { _F_64(0.0), _F_64(-0.0) };
+static const __float64 Zero[] = { _F_64(0.0), _F_64(-0.0) };
 
 __float64
 fmod64(__float64 x, __float64 y)
 {
-    __int32_t n, hx, hy, hz, ix, iy, sx, i;
-    __uint32_t lx, ly, lz;
+    __uint32_t hx, hy, lx, ly, sx;
+    __uint64_t mx, my;
+    int ex, ey, n;
 
     EXTRACT_WORDS(hx, lx, x);
     EXTRACT_WORDS(hy, ly, y);
@@ -47,115 +48,43 @@ fmod64(__float64 x, __float64 y)
     if ((hy | ly) == 0) /* y=0, domain error */
         return __math_invalid(y);
 
-    if (hx <= hy) {
-        if ((hx < hy) || (lx < ly))
+    mx = ((__uint64_t)hx << 32) | lx;
+    my = ((__uint64_t)hy << 32) | ly;
+    if (mx <= my) {
+        if (mx < my)
             return x; /* |x|<|y| return x */
-        if (lx == ly)
-            return Zero[(__uint32_t)sx >> 31]; /* |x|=|y| return x*0*/
+        return Zero[sx >> 31]; /* |x|=|y| return x*0*/
     }
 
-    /* determine ix = ilogb(x) */
-    if (hx < 0x00100000) { /* subnormal x */
-        if (hx == 0) {
-            for (ix = -1043, i = lx; i > 0; i <<= 1)
-                ix -= 1;
-        } else {
-            for (ix = -1022, i = (hx << 11); i > 0; i <<= 1)
-                ix -= 1;
-        }
-    } else
-        ix = (hx >> 20) - 1023;
-
-    /* determine iy = ilogb(y) */
-    if (hy < 0x00100000) { /* subnormal y */
-        if (hy == 0) {
-            for (iy = -1043, i = ly; i > 0; i <<= 1)
-                iy -= 1;
-        } else {
-            for (iy = -1022, i = (hy << 11); i > 0; i <<= 1)
-                iy -= 1;
-        }
-    } else
-        iy = (hy >> 20) - 1023;
-
-    /* set up {hx,lx}, {hy,ly} and align y to x */
-    if (ix >= -1022)
-        hx = 0x00100000 | (0x000fffff & hx);
-    else { /* subnormal x, shift x to normal */
-        n = -1022 - ix;
-        if (n <= 31) {
-            hx = (hx << n) | (lx >> (32 - n));
-            lx <<= n;
-        } else {
-            hx = lx << (n - 32);
-            lx = 0;
-        }
-    }
-    if (iy >= -1022)
-        hy = 0x00100000 | (0x000fffff & hy);
-    else { /* subnormal y, shift y to normal */
-        n = -1022 - iy;
-        if (n <= 31) {
-            hy = (hy << n) | (ly >> (32 - n));
-            ly <<= n;
-        } else {
-            hy = ly << (n - 32);
-            ly = 0;
-        }
-    }
-
-    /* fix point fmod */
-    n = ix - iy;
-    while (n--) {
-        hz = hx - hy;
-        lz = lx - ly;
-        if (lx < ly)
-            hz -= 1;
-        if (hz < 0) {
-            hx = hx + hx + (lx >> 31);
-            lx = lx + lx;
-        } else {
-            if ((hz | lz) == 0) /* return sign(x)*0 */
-                return Zero[(__uint32_t)sx >> 31];
-            hx = hz + hz + (lz >> 31);
-            lx = lz + lz;
-        }
-    }
-    hz = hx - hy;
-    lz = lx - ly;
-    if (lx < ly)
-        hz -= 1;
-    if (hz >= 0) {
-        hx = hz;
-        lx = lz;
-    }
+    /*
+     * |x| = mx * 2^(ex - 1075), |y| = my * 2^(ey - 1075), with
+     * subnormals taking the exponent of the smallest normal
+     */
+    ex = hx >> 20;
+    ey = hy >> 20;
+    mx &= 0x000fffffffffffffULL;
+    my &= 0x000fffffffffffffULL;
+    if (ex)
+        mx |= 0x0010000000000000ULL;
+    else
+        ex = 1;
+    if (ey)
+        my |= 0x0010000000000000ULL;
+    else
+        ey = 1;
+
+    mx = fmod_reduce64(mx, my, ex - ey, NULL);
 
     /* convert back to floating value and restore the sign */
-    if ((hx | lx) == 0) /* return sign(x)*0 */
-        return Zero[(__uint32_t)sx >> 31];
-    while (hx < 0x00100000) { /* normalize x */
-        hx = hx + hx + (lx >> 31);
-        lx = lx + lx;
-        iy -= 1;
-    }
-    if (iy >= -1022) { /* normalize output */
-        hx = ((hx - 0x00100000) | ((iy + 1023) << 20));
-        INSERT_WORDS(x, hx | sx, lx);
-    } else { /* subnormal output */
-        n = -1022 - iy;
-        if (n <= 20) {
-            lx = (lx >> n) | ((__uint32_t)hx << (32 - n));
-            hx >>= n;
-        } else if (n <= 31) {
-            lx = (hx << (32 - n)) | (lx >> n);
-            hx = sx;
-        } else {
-            lx = hx >> (n - 32);
-            hx = sx;
-        }
-        INSERT_WORDS(x, hx | sx, lx);
-        x *= one; /* create necessary signal */
-    }
+    if (mx == 0) /* return sign(x)*0 */
+        return Zero[sx >> 31];
+
+    /* normalize, leaving results below the smallest normal subnormal */
+    n = __builtin_clzll(mx) - 11;
+    if (n > ey - 1)
+        n = ey - 1;
+    mx = (mx << n) + ((__uint64_t)(ey - 1 - n) << 52);
+    INSERT_WORDS(x, (__uint32_t)(mx >> 32) | sx, (__uint32_t)mx);
     return x; /* exact output */
 }
 
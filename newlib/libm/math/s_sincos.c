@@ -3,6 +3,8 @@
    sin and cos. */
 
 #include "fdlibm.h"
+#include "math_config.h"
+#if __OBSOLETE_MATH_DOUBLE
 #include <errno.h>
 #include <math.h>
 
@@ -18,3 +20,6 @@ sincos64(__float64 x, __float64 *sinx, __float64 *cosx)
 _MATH_ALIAS_v_dDD(sincos)
 
 #endif /* _NEED_FLOAT64 */
+#else
+#include "../common/sincos.c"
+#endif /* __OBSOLETE_MATH_DOUBLE */
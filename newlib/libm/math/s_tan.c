@@ -70,6 +70,8 @@ PORTABILITY
  */
 
 #include "fdlibm.h"
+#include "math_config.h"
+#if __OBSOLETE_MATH_DOUBLE
 
 #ifdef _NEED_FLOAT64
 
@@ -102,3 +104,6 @@ tan64(__float64 x)
 _MATH_ALIAS_d_d(tan)
 
 #endif /* _NEED_FLOAT64 */
+#else
+#include "../common/tan.c"
+#endif /* __OBSOLETE_MATH_DOUBLE */
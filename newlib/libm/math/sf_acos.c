@@ -14,6 +14,7 @@
  */
 
 #include "fdlibm.h"
+#if __OBSOLETE_MATH_FLOAT
 
 static const float one = 1.0000000000e+00, /* 0x3F800000 */
     pi = 3.1415925026e+00, /* 0x40490fda */
@@ -78,3 +79,7 @@ acosf(float x)
 }
 
 _MATH_ALIAS_f_f(acos)
+
+#else
+#include "../common/acosf.c"
+#endif /* __OBSOLETE_MATH_FLOAT */
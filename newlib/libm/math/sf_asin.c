@@ -14,6 +14,7 @@
  */
 
 #include "fdlibm.h"
+#if __OBSOLETE_MATH_FLOAT
 
 static const float one = 1.0000000000e+00, /* 0x3F800000 */
     huge = 1.000e+30, pio2_hi = 1.57079637050628662109375f,
@@ -83,3 +84,7 @@ asinf(float x)
 }
 
 _MATH_ALIAS_f_f(asin)
+
+#else
+#include "../common/asinf.c"
+#endif /* __OBSOLETE_MATH_FLOAT */
@@ -15,6 +15,7 @@
  */
 
 #include "fdlibm.h"
+#if __OBSOLETE_MATH_FLOAT
 
 static const float tiny = 1.0e-30, zero = 0.0,
                    pi_o_4 = 7.8539818525e-01, /* 0x3f490fdb */
@@ -109,3 +110,7 @@ atan2f(float y, float x)
 }
 
 _MATH_ALIAS_f_ff(atan2)
+
+#else
+#include "../common/atan2f.c"
+#endif /* __OBSOLETE_MATH_FLOAT */
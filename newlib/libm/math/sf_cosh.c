@@ -14,6 +14,7 @@
  */
 
 #include "fdlibm.h"
+#if __OBSOLETE_MATH_FLOAT
 #include "math_config.h"
 
 #ifdef __v810__
@@ -68,3 +69,7 @@ coshf(float x)
 }
 
 _MATH_ALIAS_f_f(cosh)
+
+#else
+#include "../common/coshf.c"
+#endif /* __OBSOLETE_MATH_FLOAT */
@@ -16,12 +16,14 @@
 /*
  * fmodf(x,y)
  * Return x mod y in exact arithmetic
- * Method: shift and subtract
+ * Method: integer remainder of the significands, reducing as many
+ * bits of the exponent difference per step as a 32-bit word allows
  */
 
 #include "fdlibm.h"
+#include "fmod.h"
 
-static const float one = 1.0, Zero[] = {
+static const float Zero[] = {
     0.0,
     -0.0,
 };
@@ -29,7 +31,8 @@ static const float one = 1.0, Zero[] = {
 float
 fmodf(float x, float y)
 {
-    __int32_t n, hx, hy, hz, ix, iy, sx, i;
+    __uint32_t hx, hy, sx;
+    int ex, ey, n;
 
     GET_FLOAT_WORD(hx, x);
     GET_FLOAT_WORD(hy, y);
@@ -50,73 +53,37 @@ fmodf(float x, float y)
     if (hx < hy)
         return x; /* |x|<|y| return x */
     if (hx == hy)
-        return Zero[(__uint32_t)sx >> 31]; /* |x|=|y| return x*0*/
-
-    /* Note: y cannot be zero if we reach here. */
-
-    /* determine ix = ilogb(x) */
-    if (FLT_UWORD_IS_SUBNORMAL(hx)) { /* subnormal x */
-        for (ix = -126, i = (hx << 8); i > 0; i <<= 1)
-            ix -= 1;
-    } else
-        ix = (hx >> 23) - 127;
-
-    /* determine iy = ilogb(y) */
-    if (FLT_UWORD_IS_SUBNORMAL(hy)) { /* subnormal y */
-        for (iy = -126, i = (hy << 8); i >= 0; i <<= 1)
-            iy -= 1;
-    } else
-        iy = (hy >> 23) - 127;
-
-    /* set up {hx,lx}, {hy,ly} and align y to x */
-    if (ix >= -126)
-        hx = 0x00800000 | (0x007fffff & hx);
-    else { /* subnormal x, shift x to normal */
-        n = -126 - ix;
-        hx = hx << n;
-    }
-    if (iy >= -126)
-        hy = 0x00800000 | (0x007fffff & hy);
-    else { /* subnormal y, shift y to normal */
-        n = -126 - iy;
-        hy = hy << n;
-    }
-
-    /* fix point fmod */
-    n = ix - iy;
-    while (n--) {
-        hz = hx - hy;
-        if (hz < 0) {
-            hx = hx + hx;
-        } else {
-            if (hz == 0) /* return sign(x)*0 */
-                return Zero[(__uint32_t)sx >> 31];
-            hx = hz + hz;
-        }
-    }
-    hz = hx - hy;
-    if (hz >= 0) {
-        hx = hz;
-    }
+        return Zero[sx >> 31]; /* |x|=|y| return x*0*/
+
+    /*
+     * |x| = mx * 2^(ex - 150), |y| = my * 2^(ey - 150), with
+     * subnormals taking the exponent of the smallest normal
+     */
+    ex = hx >> 23;
+    ey = hy >> 23;
+    hx &= 0x007fffff;
+    hy &= 0x007fffff;
+    if (ex)
+        hx |= 0x00800000;
+    else
+        ex = 1;
+    if (ey)
+        hy |= 0x00800000;
+    else
+        ey = 1;
+
+    hx = fmod_reduce32(hx, hy, ex - ey, NULL);
 
     /* convert back to floating value and restore the sign */
     if (hx == 0) /* return sign(x)*0 */
-        return Zero[(__uint32_t)sx >> 31];
-    while (hx < 0x00800000) { /* normalize x */
-        hx = hx + hx;
-        iy -= 1;
-    }
-    if (iy >= -126) { /* normalize output */
-        hx = ((hx - 0x00800000) | ((iy + 127) << 23));
-        SET_FLOAT_WORD(x, hx | sx);
-    } else { /* subnormal output */
-        /* If denormals are not supported, this code will generate a
-	       zero representation.  */
-        n = -126 - iy;
-        hx >>= n;
-        SET_FLOAT_WORD(x, hx | sx);
-        x *= one; /* create necessary signal */
-    }
+        return Zero[sx >> 31];
+
+    /* normalize, leaving results below the smallest normal subnormal */
+    n = fmod_clz32(hx) - 8;
+    if (n > ey - 1)
+        n = ey - 1;
+    hx = (hx << n) + ((__uint32_t)(ey - 1 - n) << 23);
+    SET_FLOAT_WORD(x, hx | sx);
     return x; /* exact output */
 }
 
@@ -14,6 +14,7 @@
  */
 
 #include "fdlibm.h"
+#if __OBSOLETE_MATH_FLOAT
 
 static const float one = 1.0, shuge = 1.0e37;
 
@@ -60,3 +61,7 @@ sinhf(float x)
 }
 
 _MATH_ALIAS_f_f(sinh)
+
+#else
+#include "../common/sinhf.c"
+#endif /* __OBSOLETE_MATH_FLOAT */
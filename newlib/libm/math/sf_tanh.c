@@ -14,6 +14,7 @@
  */
 
 #include "fdlibm.h"
+#if __OBSOLETE_MATH_FLOAT
 
 static const volatile float one = 1.0, two = 2.0, tiny = 1.0e-30;
 
@@ -53,3 +54,7 @@ tanhf(float x)
 }
 
 _MATH_ALIAS_f_f(tanh)
+
+#else
+#include "../common/tanhf.c"
+#endif /* __OBSOLETE_MATH_FLOAT */
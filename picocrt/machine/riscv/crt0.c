@@ -146,6 +146,13 @@ _trap(void)
                 "or	t0, t1, t0\n"
                 "csrw	mstatus, t0\n"
                 "csrwi	fcsr, 0");
+#endif
+#ifdef __riscv_vector
+        /* Enable the vector unit, the string functions use it */
+	__asm__("csrr	t0, mstatus\n"
+                "li	t1, 512\n"     	// 1 << 9 = 512
+                "or	t0, t1, t0\n"
+                "csrw	mstatus, t0");
 #endif
         __asm__("j      _ctrap");
 }
@@ -180,6 +187,13 @@ _start(void)
                 "csrw	mstatus, t0\n"
                 "csrwi	fcsr, 0");
 #endif
+#ifdef __riscv_vector
+        /* Enable the vector unit, the string functions use it */
+	__asm__("csrr	t0, mstatus\n"
+                "li	t1, 512\n"     	// 1 << 9 = 512
+                "or	t0, t1, t0\n"
+                "csrw	mstatus, t0");
+#endif
 #ifdef CRT0_SEMIHOST
         __asm__("la     t0, _trap");
         __asm__("csrw   mtvec, t0");
@@ -0,0 +1,175 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * QEMU TCG plugin counting executed instructions by translation
+ * block. When the guest exits, it writes one line per block start
+ * address,
+ *
+ *	0x<address> <instructions executed>
+ *
+ * to the file named by the 'outfile' argument, or to the plugin log
+ * if none was given. scripts/insn-count maps the addresses to
+ * functions.
+ *
+ * Build with:
+ *
+ *	cc -shared -fPIC -I<qemu include dir> $(pkg-config --cflags glib-2.0) \
+ *		-o insn-count-plugin.so insn-count-plugin.c
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <glib.h>
+#include <qemu-plugin.h>
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_version = QEMU_PLUGIN_VERSION;
+
+struct block_count {
+    uint64_t    vaddr;
+    uint64_t    insns;
+};
+
+/* Each translation of a block knows its size and where to count */
+struct block_trans {
+    struct block_count  *count;
+    size_t              n_insns;
+};
+
+static GHashTable *blocks;
+static GMutex lock;
+static char *outfile;
+
+static void
+vcpu_tb_exec(unsigned int cpu_index, void *udata)
+{
+    struct block_trans *trans = udata;
+
+    (void) cpu_index;
+    __atomic_fetch_add(&trans->count->insns, trans->n_insns, __ATOMIC_RELAXED);
+}
+
+static void
+vcpu_tb_trans(qemu_plugin_id_t id, struct qemu_plugin_tb *tb)
+{
+    uint64_t vaddr = qemu_plugin_tb_vaddr(tb);
+    struct block_count *count;
+    struct block_trans *trans;
+
+    (void) id;
+    g_mutex_lock(&lock);
+    count = g_hash_table_lookup(blocks, &vaddr);
+    if (!count) {
+        count = g_new0(struct block_count, 1);
+        count->vaddr = vaddr;
+        g_hash_table_insert(blocks, &count->vaddr, count);
+    }
+    g_mutex_unlock(&lock);
+
+    trans = g_new(struct block_trans, 1);
+    trans->count = count;
+    trans->n_insns = qemu_plugin_tb_n_insns(tb);
+    qemu_plugin_register_vcpu_tb_exec_cb(tb, vcpu_tb_exec,
+                                         QEMU_PLUGIN_CB_NO_REGS, trans);
+}
+
+static void
+write_block(gpointer key, gpointer value, gpointer user_data)
+{
+    struct block_count *count = value;
+    FILE *f = user_data;
+
+    (void) key;
+    if (count->insns)
+        fprintf(f, "0x%" PRIx64 " %" PRIu64 "\n", count->vaddr, count->insns);
+}
+
+static void
+plugin_exit(qemu_plugin_id_t id, void *p)
+{
+    (void) id;
+    (void) p;
+    g_mutex_lock(&lock);
+    if (outfile) {
+        FILE *f = fopen(outfile, "w");
+
+        if (f) {
+            g_hash_table_foreach(blocks, write_block, f);
+            fclose(f);
+        } else {
+            qemu_plugin_outs("insn-count: cannot create output file\n");
+        }
+    } else {
+        GString *report = g_string_new(NULL);
+        GHashTableIter iter;
+        gpointer value;
+
+        g_hash_table_iter_init(&iter, blocks);
+        while (g_hash_table_iter_next(&iter, NULL, &value)) {
+            struct block_count *count = value;
+
+            if (count->insns)
+                g_string_append_printf(report, "0x%" PRIx64 " %" PRIu64 "\n",
+                                       count->vaddr, count->insns);
+        }
+        qemu_plugin_outs(report->str);
+        g_string_free(report, TRUE);
+    }
+    g_mutex_unlock(&lock);
+}
+
+QEMU_PLUGIN_EXPORT int
+qemu_plugin_install(qemu_plugin_id_t id, const qemu_info_t *info,
+                    int argc, char **argv)
+{
+    int i;
+
+    (void) info;
+    for (i = 0; i < argc; i++) {
+        if (strncmp(argv[i], "outfile=", 8) == 0) {
+            outfile = g_strdup(argv[i] + 8);
+        } else {
+            fprintf(stderr, "insn-count: unknown argument %s\n", argv[i]);
+            return -1;
+        }
+    }
+
+    blocks = g_hash_table_new(g_int64_hash, g_int64_equal);
+    qemu_plugin_register_vcpu_tb_trans_cb(id, vcpu_tb_trans);
+    qemu_plugin_register_atexit_cb(id, plugin_exit, NULL);
+    return 0;
+}
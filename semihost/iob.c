@@ -33,16 +33,87 @@
  * OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
-#include <semihost.h>
+#include "semihost-private.h"
+#include <stdio-bufio.h>
 
-static FILE __stdio = FDEV_SETUP_STREAM(sys_semihost_putc, sys_semihost_getc, NULL, _FDEV_SETUP_RW);
+/*
+ * Console I/O goes through the host ":tt" handles opened by
+ * _map_stdio, a buffer at a time, instead of trapping to the host
+ * for every character. stdout is line buffered and flushed at exit.
+ * stderr has a one byte buffer, so it is written through right away
+ * and nothing is lost if the program dies before exit.
+ */
 
-#ifdef __strong_reference
-#define STDIO_ALIAS(x) __strong_reference(stdin, x);
-#else
-#define STDIO_ALIAS(x) FILE *const x = &__stdio;
+#ifndef SEMIHOST_BUFSIZ
+#define SEMIHOST_BUFSIZ 128
 #endif
 
-FILE *const stdin = &__stdio;
-STDIO_ALIAS(stdout);
-STDIO_ALIAS(stderr);
+static ssize_t
+semihost_iob_read(int fd, void *buf, size_t count)
+{
+	int hfd = _map_stdio(fd);
+
+	if (hfd < 0) {
+		int c;
+
+		if (count == 0)
+			return 0;
+		c = sys_semihost_getc(stdin);
+		if (c == EOF)
+			return 0;
+		*(char *) buf = (char) c;
+		return 1;
+	}
+	return (ssize_t) (count - sys_semihost_read(hfd, buf, count));
+}
+
+static ssize_t
+semihost_iob_write(int fd, const void *buf, size_t count)
+{
+	int hfd = _map_stdio(fd);
+	size_t i;
+
+	/* Fall back to one character at a time without a console handle */
+	if (hfd < 0) {
+		for (i = 0; i < count; i++)
+			sys_semihost_putc(((const char *) buf)[i], stdout);
+		return (ssize_t) count;
+	}
+	return (ssize_t) (count - sys_semihost_write(hfd, buf, count));
+}
+
+static char read_buf[SEMIHOST_BUFSIZ];
+static char write_buf[SEMIHOST_BUFSIZ];
+static char err_buf[1];
+
+static struct __file_bufio __stdin = FDEV_SETUP_BUFIO(0, read_buf, SEMIHOST_BUFSIZ,
+						      semihost_iob_read, semihost_iob_write,
+						      NULL, NULL, __SRD, 0);
+static struct __file_bufio __stdout = FDEV_SETUP_BUFIO(1, write_buf, SEMIHOST_BUFSIZ,
+						       semihost_iob_read, semihost_iob_write,
+						       NULL, NULL, __SWR, __BLBF);
+static struct __file_bufio __stderr = FDEV_SETUP_BUFIO(2, err_buf, sizeof(err_buf),
+						       semihost_iob_read, semihost_iob_write,
+						       NULL, NULL, __SWR, 0);
+
+FILE *const stdin = &__stdin.xfile.cfile.file;
+FILE *const stdout = &__stdout.xfile.cfile.file;
+FILE *const stderr = &__stderr.xfile.cfile.file;
+
+__attribute__((constructor))
+static void semihost_iob_init(void)
+{
+	__bufio_lock_init(stdin);
+	__bufio_lock_init(stdout);
+	__bufio_lock_init(stderr);
+}
+
+/*
+ * Add a destructor function to get stdout flushed on
+ * exit
+ */
+__attribute__((destructor (101)))
+static void semihost_iob_exit(void)
+{
+	fflush(stdout);
+}
@@ -48,6 +48,12 @@ opal_call(void *r3, void *r4, void *r5, int call_r6, void *base_r7, void *entry_
 int
 opal_console_write(int terminal, size_t len, const char *base);
 
+int
+opal_console_write_all(int terminal, size_t len, const char *base);
+
+int
+opal_poll_events(uint64_t *outstanding_event_mask);
+
 void _ATTRIBUTE((__noreturn__))
 opal_cec_power_down(uint64_t request);
 
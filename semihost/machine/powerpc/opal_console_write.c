@@ -40,3 +40,39 @@ opal_console_write(int terminal, size_t len, const char *base)
 {
     return opal_call((void *) (intptr_t) terminal, (void *) &len, (void *) base, OPAL_CONSOLE_WRITE, __opal_base, __opal_entry);
 }
+
+/*
+ * Give up after this many consecutive attempts which don't move any
+ * data, so a wedged console can't hang the caller forever
+ */
+#define OPAL_CONSOLE_RETRIES    1000
+
+/*
+ * OPAL may accept only part of the buffer, or report that the
+ * console is busy; keep going until everything has been written.
+ * Poll for events between retries so that firmware gets a chance
+ * to drain the console buffer.
+ */
+int
+opal_console_write_all(int terminal, size_t len, const char *base)
+{
+    int retries = 0;
+
+    while (len) {
+        size_t this = len;
+        int ret = opal_call((void *) (intptr_t) terminal, (void *) &this, (void *) base, OPAL_CONSOLE_WRITE, __opal_base, __opal_entry);
+
+        if (ret == OPAL_SUCCESS && this > 0) {
+            base += this;
+            len -= this;
+            retries = 0;
+            continue;
+        }
+        if (ret != OPAL_SUCCESS && ret != OPAL_BUSY && ret != OPAL_BUSY_EVENT)
+            return ret;
+        if (++retries >= OPAL_CONSOLE_RETRIES)
+            return ret == OPAL_SUCCESS ? OPAL_HARDWARE : ret;
+        opal_poll_events(NULL);
+    }
+    return OPAL_SUCCESS;
+}
@@ -36,16 +36,18 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h>
+#include <stdio-bufio.h>
 
-#include "opal.h"
+/*
+ * stdout is line buffered and handed to write() a buffer at a time;
+ * it is flushed on newline and at exit. stderr has a one byte buffer,
+ * so it is written through right away and nothing is lost if the
+ * program dies before exit.
+ */
 
-static int
-powerpc_putc(char c, FILE *file)
-{
-        opal_console_write(OPAL_TERMINAL_DEFAULT, 1, &c);
-	(void) file;
-	return (unsigned char) c;
-}
+#ifndef CONSOLE_BUFSIZ
+#define CONSOLE_BUFSIZ 128
+#endif
 
 static int
 powerpc_getc(FILE *file)
@@ -54,14 +56,34 @@ powerpc_getc(FILE *file)
 	return EOF;
 }
 
-static FILE __stdio = FDEV_SETUP_STREAM(powerpc_putc, powerpc_getc, NULL, _FDEV_SETUP_RW);
+static char write_buf[CONSOLE_BUFSIZ];
+static char err_buf[1];
 
-#ifdef __strong_reference
-#define STDIO_ALIAS(x) __strong_reference(stdin, x);
-#else
-#define STDIO_ALIAS(x) FILE *const x = &__stdio;
-#endif
+static FILE __stdin = FDEV_SETUP_STREAM(NULL, powerpc_getc, NULL, _FDEV_SETUP_READ);
+static struct __file_bufio __stdout = FDEV_SETUP_BUFIO(1, write_buf, CONSOLE_BUFSIZ,
+						       read, write, NULL, NULL,
+						       __SWR, __BLBF);
+static struct __file_bufio __stderr = FDEV_SETUP_BUFIO(2, err_buf, sizeof(err_buf),
+						       read, write, NULL, NULL,
+						       __SWR, 0);
 
-FILE *const stdin = &__stdio;
-STDIO_ALIAS(stdout);
-STDIO_ALIAS(stderr);
+FILE *const stdin = &__stdin;
+FILE *const stdout = &__stdout.xfile.cfile.file;
+FILE *const stderr = &__stderr.xfile.cfile.file;
+
+__attribute__((constructor))
+static void powerpc_io_init(void)
+{
+	__bufio_lock_init(stdout);
+	__bufio_lock_init(stderr);
+}
+
+/*
+ * Add a destructor function to get stdout flushed on
+ * exit
+ */
+__attribute__((destructor (101)))
+static void powerpc_io_exit(void)
+{
+	fflush(stdout);
+}
@@ -54,7 +54,8 @@ ssize_t
 write(int fd, const void *buf, size_t count)
 {
         (void) fd;
-        opal_console_write(0, count, buf);
+        if (opal_console_write_all(OPAL_TERMINAL_DEFAULT, count, buf) != OPAL_SUCCESS)
+                return -1;
 	return count;
 }
 
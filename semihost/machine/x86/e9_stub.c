@@ -56,9 +56,8 @@ write(int fd, const void *buf, size_t count)
 	size_t c = count;
 
         (void) fd;
-	while (c--) {
-		__asm__("out %%al, $0xe9" : : "a" ((int) *b++));
-	}
+	/* Send the whole buffer with a single string I/O instruction */
+	__asm__ volatile("rep outsb" : "+S" (b), "+c" (c) : "d" ((uint16_t) 0xe9) : "memory");
 	return count;
 }
 
@@ -46,6 +46,11 @@
 #define _LOCK_T intptr_t*
 
 intptr_t __lock___libc_recursive_mutex;
+intptr_t __lock___malloc_recursive_mutex;
+intptr_t __lock___atexit_recursive_mutex;
+intptr_t __lock___arc4random_mutex;
+intptr_t __lock___env_mutex;
+intptr_t __lock___tz_mutex;
 
 #define MAX_LOCKS 32
 
@@ -121,13 +126,27 @@ void __retarget_lock_release_recursive(_LOCK_T lock)
         --(*lock);
 }
 
+/* Acquire shared lock, tracking readers as negative counts */
+void __retarget_lock_acquire_shared(_LOCK_T lock)
+{
+        assert(*lock <= 0);
+        --(*lock);
+}
+
+/* Release shared lock */
+void __retarget_lock_release_shared(_LOCK_T lock)
+{
+        assert(*lock < 0);
+        ++(*lock);
+}
+
 #ifdef _PICO_EXIT
-#define LIBC_LOCK_EXIT_COUNT 0
+#define ATEXIT_LOCK_EXIT_COUNT 0
 #else
 /*
- * Legacy onexit handler holds libc lock while calling hooks
+ * Legacy onexit handler holds atexit lock while calling hooks
  */
-#define LIBC_LOCK_EXIT_COUNT 1
+#define ATEXIT_LOCK_EXIT_COUNT 1
 #endif
 
 static void lock_validate(int ret, void *arg)
@@ -138,7 +157,12 @@ static void lock_validate(int ret, void *arg)
         for (i = 0; i < MAX_LOCKS; i++)
                 assert(locks[i] == 0);
 
-        assert(__lock___libc_recursive_mutex == LIBC_LOCK_EXIT_COUNT);
+        assert(__lock___libc_recursive_mutex == 0);
+        assert(__lock___malloc_recursive_mutex == 0);
+        assert(__lock___atexit_recursive_mutex == ATEXIT_LOCK_EXIT_COUNT);
+        assert(__lock___arc4random_mutex == 0);
+        assert(__lock___env_mutex == 0);
+        assert(__lock___tz_mutex == 0);
 }
 
 __attribute__((constructor))
@@ -136,6 +136,55 @@ main(void)
 		}
 	}
 
+#if defined(_NANO_MALLOC) || (defined(_MALLOC_TCACHE) && defined(PICOLIBC_TLS))
+	/* a double free must not hand the block out twice */
+	{
+		void *volatile dup = malloc(16);
+		void *a, *b;
+
+		if (dup) {
+			free(dup);
+			free(dup);
+			a = malloc(16);
+			b = malloc(16);
+			if (a && a == b) {
+				printf("double free returned %p twice\n", a);
+				result++;
+			}
+			free(a);
+			free(b);
+		}
+	}
+#endif
+
+#if defined(_NANO_MALLOC) && !defined(_NANO_MALLOC_BINS) && defined(_MALLOC_TCACHE) && defined(PICOLIBC_TLS)
+	/*
+	 * Flushing the cache, as an exiting thread must, hands cached
+	 * blocks back to the heap. The heap then returns the lowest free
+	 * block instead of the cache returning the last one freed.
+	 */
+	{
+		void *a = malloc(16);
+		void *c = malloc(16);
+		void *p;
+
+		if (a && c) {
+			void *lo = a < c ? a : c;
+			void *hi = a < c ? c : a;
+
+			free(lo);
+			free(hi);
+			__malloc_tcache_flush();
+			p = malloc(16);
+			if ((uintptr_t) p > (uintptr_t) lo) {
+				printf("tcache flush left %p cached\n", p);
+				result++;
+			}
+			free(p);
+		}
+	}
+#endif
+
 	malloc_stats();
 
 	return result;
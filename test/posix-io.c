@@ -59,6 +59,26 @@ test_cmp(FILE *f, const char *t)
 	}
         return 0;
 }
+
+static int
+test_cmp_unlocked(FILE *f, const char *t)
+{
+        int c;
+        int ret = 0;
+
+        flockfile(f);
+	while ((c = getc_unlocked(f)) != EOF) {
+		if ((char) c != *t) {
+			printf("read incorrect byte %c != %c\n", c, *t);
+			ret = 1;
+                        break;
+		}
+		t++;
+	}
+        funlockfile(f);
+        return ret;
+}
+
 int
 main(void)
 {
@@ -103,9 +123,118 @@ main(void)
 		return 1;
 	}
 
+        /* Block read must pick up a pushed-back character first */
+        int c = getc(f);
+        if (ungetc(c, f) != c) {
+                printf("ungetc failed\n");
+                return 1;
+        }
+        char buf[sizeof(test_string)];
+        size_t got = fread(buf, 1, sizeof(buf), f);
+        if (got != strlen(test_string) || memcmp(buf, test_string, got) != 0) {
+                printf("fread returned %zu bytes, expected %zu\n", got, strlen(test_string));
+                return 1;
+        }
+        if (!feof(f)) {
+                printf("short fread did not set EOF\n");
+                return 1;
+        }
+
+        rewind(f);
         if (test_cmp(f, test_string))
                 return 1;
 
+        rewind(f);
+        if (test_cmp_unlocked(f, test_string))
+                return 1;
+
+        if (fclose(f) != 0) {
+                printf("fclose failed\n");
+                return 1;
+        }
+
+#ifdef TINY_STDIO
+        /* Use a tiny buffer so that lines span several refills */
+        f = fopen(file_name, "r");
+        if (!f || setvbuf(f, NULL, _IOFBF, 4) != 0) {
+                printf("failed to reopen \"%s\" for reading\n", file_name);
+                return 1;
+        }
+
+        char *line = NULL;
+        size_t n = 0;
+        ssize_t r = getdelim(&line, &n, ',', f);
+        if (r != 6 || strcmp(line, "hello,") != 0) {
+                printf("getdelim returned %zd \"%s\"\n", r, line);
+                return 1;
+        }
+        r = getline(&line, &n, f);
+        if (r != 7 || strcmp(line, test_string + 6) != 0) {
+                printf("getline returned %zd \"%s\"\n", r, line);
+                return 1;
+        }
+        if (getline(&line, &n, f) != -1 || !feof(f)) {
+                printf("getline did not hit EOF\n");
+                return 1;
+        }
+        free(line);
+        fclose(f);
+#endif
+
+        /*
+         * Large transfers around a small buffer, starting unaligned so
+         * that both the buffered and direct paths are used
+         */
+        static char big[1000], back[sizeof(big)];
+        size_t i;
+        for (i = 0; i < sizeof(big); i++)
+                big[i] = (char) (i * 7 + 1);
+
+        f = fopen(file_name, "w+");
+        if (!f || setvbuf(f, NULL, _IOFBF, 16) != 0) {
+                printf("failed to reopen \"%s\" for writing\n", file_name);
+                return 1;
+        }
+        if (putc(big[0], f) != (unsigned char) big[0] ||
+            fwrite(big + 1, 1, sizeof(big) - 1, f) != sizeof(big) - 1) {
+                printf("large fwrite failed\n");
+                return 1;
+        }
+        rewind(f);
+        if (getc(f) != (unsigned char) big[0] ||
+            fread(back + 1, 1, sizeof(back) - 1, f) != sizeof(back) - 1 ||
+            memcmp(back + 1, big + 1, sizeof(big) - 1) != 0) {
+                printf("large fread failed\n");
+                return 1;
+        }
+        if (fseek(f, 3, SEEK_SET) != 0 || fread(back, 1, 40, f) != 40 ||
+            memcmp(back, big + 3, 40) != 0 || ftell(f) != 43) {
+                printf("fread after seek failed\n");
+                return 1;
+        }
+        /* Short seeks back and forth within the buffered data */
+        if (fseek(f, -5, SEEK_CUR) != 0 || getc(f) != (unsigned char) big[38] ||
+            fseek(f, 2, SEEK_CUR) != 0 || getc(f) != (unsigned char) big[41] ||
+            ftell(f) != 42) {
+                printf("seek within buffer failed\n");
+                return 1;
+        }
+        /*
+         * A direct read after draining the buffer must not leave stale
+         * data behind for a following relative seek to land in
+         */
+        rewind(f);
+        if (getc(f) != (unsigned char) big[0] ||
+            fread(back, 1, 15, f) != 15 ||
+            fread(back, 1, 32, f) != 32 ||
+            memcmp(back, big + 16, 32) != 0 ||
+            fseek(f, -8, SEEK_CUR) != 0 ||
+            getc(f) != (unsigned char) big[40]) {
+                printf("seek after direct read failed\n");
+                return 1;
+        }
+        fclose(f);
+
 	printf("success\n");
         exit(0);
 }
@@ -0,0 +1,203 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LONG_LINE   1000
+
+static int
+check_getline(void)
+{
+    static char input[LONG_LINE + 64];
+    char *line = NULL;
+    size_t n = 0;
+    ssize_t r;
+    FILE *f;
+    int ret = 0;
+    int i;
+
+    /* a short line, a long one, a delimited field and no final newline */
+    strcpy(input, "first\n");
+    for (i = 0; i < LONG_LINE; i++)
+        input[6 + i] = 'a' + i % 26;
+    strcpy(input + 6 + LONG_LINE, "\nfield:last");
+
+    f = fmemopen(input, strlen(input), "r");
+    if (!f) {
+        printf("fmemopen failed\n");
+        return 1;
+    }
+
+    r = getline(&line, &n, f);
+    if (r != 6 || strcmp(line, "first\n") != 0) {
+        printf("getline first: %zd '%s'\n", r, line);
+        ret++;
+    }
+
+    /* ungetc'd characters must come first */
+    ungetc(getc(f), f);
+    r = getline(&line, &n, f);
+    if (r != LONG_LINE + 1 || memcmp(line, input + 6, LONG_LINE + 1) != 0 ||
+        line[r] != '\0' || n <= (size_t) r) {
+        printf("getline long: %zd\n", r);
+        ret++;
+    }
+
+    r = getdelim(&line, &n, ':', f);
+    if (r != 6 || strcmp(line, "field:") != 0) {
+        printf("getdelim: %zd '%s'\n", r, line);
+        ret++;
+    }
+
+    r = getline(&line, &n, f);
+    if (r != 4 || strcmp(line, "last") != 0) {
+        printf("getline last: %zd '%s'\n", r, line);
+        ret++;
+    }
+
+    r = getline(&line, &n, f);
+    if (r != -1) {
+        printf("getline at EOF: %zd\n", r);
+        ret++;
+    }
+
+    fclose(f);
+    free(line);
+    return ret;
+}
+
+static int
+check_memstream(void)
+{
+    char *buf = NULL;
+    size_t size = 0;
+    FILE *f;
+    int ret = 0;
+    int i;
+
+    f = open_memstream(&buf, &size);
+    if (!f) {
+        printf("open_memstream failed\n");
+        return 1;
+    }
+
+    fflush(f);
+    if (!buf || size != 0 || buf[0] != '\0') {
+        printf("empty memstream: size %zu\n", size);
+        ret++;
+    }
+
+    /* Enough output to grow the buffer several times */
+    for (i = 0; i < 1000; i++)
+        fprintf(f, "%03d,", i % 1000);
+    fwrite("end", 1, 3, f);
+    fflush(f);
+    if (size != 4003 || strlen(buf) != 4003 ||
+        strncmp(buf, "000,001,", 8) != 0 || strcmp(buf + 3996, "999,end") != 0) {
+        printf("memstream contents: size %zu\n", size);
+        ret++;
+    }
+
+    /* Size follows the position; data after it is kept */
+    fseek(f, 4, SEEK_SET);
+    fputs("xyz", f);
+    fflush(f);
+    if (size != 7 || strncmp(buf, "000,xyz,002", 11) != 0) {
+        printf("memstream after seek: size %zu\n", size);
+        ret++;
+    }
+
+    /* Seeking past the end fills the gap with zeros */
+    fseek(f, 0, SEEK_END);
+    fseek(f, 2, SEEK_CUR);
+    putc('!', f);
+    fclose(f);
+    if (size != 4006 || buf[4003] != '\0' || buf[4004] != '\0' ||
+        buf[4005] != '!' || buf[4006] != '\0') {
+        printf("memstream after close: size %zu\n", size);
+        ret++;
+    }
+    free(buf);
+    return ret;
+}
+
+static int
+check_wmemstream(void)
+{
+    static const char expect[] = "wide 42 stream";
+    wchar_t *buf = NULL;
+    size_t size = 0;
+    size_t i;
+    FILE *f;
+    int ret = 0;
+
+    /* Declared by <stdio.h> alone */
+    f = open_wmemstream(&buf, &size);
+    if (!f) {
+        printf("open_wmemstream failed\n");
+        return 1;
+    }
+
+    /* Sizes count wide characters, not bytes */
+    fprintf(f, "wide %d stream", 42);
+    fclose(f);
+    if (!buf || size != sizeof(expect) - 1) {
+        printf("wmemstream size %zu\n", size);
+        ret++;
+    } else {
+        for (i = 0; i <= size; i++)
+            if (buf[i] != (wchar_t) (unsigned char) expect[i]) {
+                printf("wmemstream contents differ at %zu\n", i);
+                ret++;
+                break;
+            }
+    }
+    free(buf);
+    return ret;
+}
+
+int
+main(void)
+{
+    int ret = 0;
+
+    ret += check_getline();
+    ret += check_memstream();
+    ret += check_wmemstream();
+    return ret != 0;
+}
@@ -0,0 +1,141 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _GNU_SOURCE
+#include <search.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NKEYS   2000
+
+static char keys[NKEYS][8];
+
+static int
+check_all(struct hsearch_data *htab, int count, const char *phase)
+{
+    ENTRY item, *found;
+    int i, ret = 0;
+
+    for (i = 0; i < NKEYS; i++) {
+        item.key = keys[i];
+        item.data = NULL;
+        found = NULL;
+        if (i < count) {
+            if (!hsearch_r(item, FIND, &found, htab) || !found ||
+                strcmp(found->key, keys[i]) != 0 ||
+                found->data != (void *) &keys[i]) {
+                printf("%s: find %s failed\n", phase, keys[i]);
+                ret++;
+            }
+        } else if (hsearch_r(item, FIND, &found, htab) || found) {
+            printf("%s: found %s before insertion\n", phase, keys[i]);
+            ret++;
+        }
+    }
+    return ret;
+}
+
+int
+main(void)
+{
+    struct hsearch_data htab;
+    ENTRY item, *found;
+    int i, ret = 0;
+
+    for (i = 0; i < NKEYS; i++)
+        snprintf(keys[i], sizeof(keys[i]), "k%d", i);
+
+    /* Start small so that the table has to grow several times */
+    memset(&htab, 0, sizeof(htab));
+    if (!hcreate_r(4, &htab)) {
+        printf("hcreate_r failed\n");
+        return 1;
+    }
+
+    for (i = 0; i < NKEYS; i++) {
+        item.key = keys[i];
+        item.data = &keys[i];
+        if (!hsearch_r(item, ENTER, &found, &htab) || !found ||
+            found->key != keys[i]) {
+            printf("enter %s failed\n", keys[i]);
+            return 1;
+        }
+        if (i % 97 == 0)
+            ret += check_all(&htab, i + 1, "insert");
+    }
+    ret += check_all(&htab, NKEYS, "full");
+
+    /* Entering an existing key returns the original entry */
+    for (i = 0; i < NKEYS; i++) {
+        char copy[sizeof(keys[i])];
+
+        strcpy(copy, keys[i]);
+        item.key = copy;
+        item.data = NULL;
+        if (!hsearch_r(item, ENTER, &found, &htab) || !found ||
+            found->key != keys[i]) {
+            printf("re-enter %s failed\n", keys[i]);
+            ret++;
+        }
+    }
+
+    hdestroy_r(&htab);
+
+    /* The non-reentrant interface shares the same table code */
+    if (!hcreate(NKEYS)) {
+        printf("hcreate failed\n");
+        return 1;
+    }
+    for (i = 0; i < NKEYS; i++) {
+        item.key = keys[i];
+        item.data = &keys[i];
+        if (!hsearch(item, ENTER)) {
+            printf("hsearch enter %s failed\n", keys[i]);
+            ret++;
+        }
+    }
+    for (i = 0; i < NKEYS; i++) {
+        item.key = keys[i];
+        found = hsearch(item, FIND);
+        if (!found || found->data != (void *) &keys[i]) {
+            printf("hsearch find %s failed\n", keys[i]);
+            ret++;
+        }
+    }
+    hdestroy();
+
+    return ret != 0;
+}
@@ -0,0 +1,236 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Compare the string and memory functions against simple byte-at-a-time
+ * versions over random contents, lengths and alignments, including
+ * strings ending right before a page boundary. Where the system can
+ * map an inaccessible page, those strings end right before it, so
+ * reading past the end of a string faults.
+ */
+
+#include <string.h>
+#include <stdio.h>
+#include <stdint.h>
+
+#ifdef __has_include
+#if __has_include(<sys/mman.h>)
+#include <sys/mman.h>
+#include <unistd.h>
+#define HAVE_GUARD_PAGE
+#endif
+#endif
+
+#define PAGE	4096
+#define BUF	(PAGE + 512)
+
+static unsigned char bufa[BUF] __attribute__((aligned(PAGE)));
+static unsigned char bufb[BUF] __attribute__((aligned(PAGE)));
+static unsigned char *enda, *endb;
+static unsigned char bufc[BUF] __attribute__((aligned(PAGE)));
+static unsigned char bufd[BUF];
+
+static uint32_t seed = 1;
+
+static unsigned
+rnd(void)
+{
+    seed = seed * 1103515245 + 12345;
+    return seed >> 8;
+}
+
+static int
+sign(int x)
+{
+    return (x > 0) - (x < 0);
+}
+
+static int errors;
+
+#define check(cond, ...) do {                   \
+        if (!(cond)) {                          \
+            printf(__VA_ARGS__);                \
+            printf("\n");                       \
+            errors++;                           \
+        }                                       \
+    } while(0)
+
+/* Fill 'n' bytes at 'a' with a small alphabet so matches are common */
+static void
+fill(unsigned char *a, size_t n, int alpha)
+{
+    size_t i;
+
+    for (i = 0; i < n; i++)
+        a[i] = 1 + rnd() % alpha + (rnd() % 50 == 0 ? 200 : 0);
+    a[n] = 0;
+}
+
+/*
+ * Return the end of a page followed by an inaccessible one, falling
+ * back to the end of the first page of 'buf'
+ */
+static unsigned char *
+page_end(unsigned char *buf)
+{
+#ifdef HAVE_GUARD_PAGE
+    size_t page = (size_t) sysconf(_SC_PAGESIZE);
+    unsigned char *map = mmap(NULL, 2 * page, PROT_READ | PROT_WRITE,
+                              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (map != MAP_FAILED && mprotect(map + page, page, PROT_NONE) == 0)
+        return map + page;
+#endif
+    return buf + PAGE;
+}
+
+static void
+test_one(int iter)
+{
+    size_t n = rnd() % (iter & 1 ? 300 : 40);
+    size_t oa = rnd() % 64, ob = rnd() % 64;
+    unsigned char *a, *b, *want_chr, *want_rchr, *want_mem;
+    size_t i, max, len, so, sn, s0, d0;
+    int alpha = 1 + rnd() % 4;
+    int c, want;
+
+    /* Place the strings so that they end at a page boundary */
+    a = bufa + oa;
+    b = bufb + ob;
+    if ((iter & 7) == 0)
+        a = enda - (n + 1 + rnd() % 3);
+    if ((iter & 7) == 1)
+        b = endb - (n + 1 + rnd() % 3);
+    fill(a, n, alpha);
+    memcpy(b, a, n + 1);
+    if (n && rnd() % 2)
+        b[rnd() % n] ^= 1 + rnd() % 3;
+    if (n && rnd() % 8 == 0)
+        b[rnd() % n] = 0;
+    c = rnd() % 6 == 0 ? 0 : 1 + rnd() % (alpha + 1);
+
+    check(strlen((char *) a) == n, "strlen(%zu) got %zu", n, strlen((char *) a));
+
+    max = rnd() % (n + 40);
+    check(strnlen((char *) a, max) == (n < max ? n : max), "strnlen(%zu, %zu)", n, max);
+
+    want_chr = want_rchr = NULL;
+    for (i = 0; i <= n; i++)
+        if (a[i] == (unsigned char) c) {
+            if (!want_chr)
+                want_chr = a + i;
+            want_rchr = a + i;
+        }
+    check((unsigned char *) strchr((char *) a, c) == want_chr, "strchr(%zu, %d)", n, c);
+    check((unsigned char *) strrchr((char *) a, c) == want_rchr, "strrchr(%zu, %d)", n, c);
+
+    len = rnd() % (n + 2);
+    want_mem = NULL;
+    for (i = 0; i < len; i++)
+        if (a[i] == (unsigned char) c) {
+            want_mem = a + i;
+            break;
+        }
+    check(memchr(a, c, len) == want_mem, "memchr(%zu, %d)", len, c);
+
+    for (i = 0; a[i] == b[i] && a[i]; i++)
+        ;
+    want = a[i] - b[i];
+    check(sign(strcmp((char *) a, (char *) b)) == sign(want), "strcmp(%zu) at %zu", n, i);
+
+    len = rnd() % (n + 3);
+    want = 0;
+    for (i = 0; i < len; i++)
+        if (a[i] != b[i] || !a[i]) {
+            want = a[i] - b[i];
+            break;
+        }
+    check(sign(strncmp((char *) a, (char *) b, len)) == sign(want), "strncmp(%zu, %zu)", n, len);
+
+    if (len > n + 1)
+        len = n + 1;
+    want = 0;
+    for (i = 0; i < len; i++)
+        if (a[i] != b[i]) {
+            want = a[i] - b[i];
+            break;
+        }
+    check(sign(memcmp(a, b, len)) == sign(want), "memcmp(%zu)", len);
+
+    so = rnd() % 64;
+    sn = rnd() % 600;
+    memset(bufc, 0xaa, 700);
+    memset(bufc + so, c, sn);
+    for (i = 0; i < 700; i++)
+        if (bufc[i] != (i >= so && i < so + sn ? (unsigned char) c : 0xaa)) {
+            check(0, "memset(%zu, %zu) at %zu", so, sn, i);
+            break;
+        }
+
+    memset(bufc, 0xaa, 700);
+    memcpy(bufc + so, a, n);
+    for (i = 0; i < 700; i++)
+        if (bufc[i] != (i >= so && i < so + n ? a[i - so] : 0xaa)) {
+            check(0, "memcpy(%zu, %zu) at %zu", so, n, i);
+            break;
+        }
+
+    for (i = 0; i < 1000; i++)
+        bufc[i] = bufd[i] = rnd();
+    s0 = rnd() % 400;
+    d0 = rnd() % 400;
+    len = rnd() % 500;
+    memmove(bufc + d0, bufc + s0, len);
+    memcpy(bufd + 2000, bufd + s0, len);
+    memcpy(bufd + d0, bufd + 2000, len);
+    for (i = 0; i < 1000; i++)
+        if (bufc[i] != bufd[i]) {
+            check(0, "memmove(%zu, %zu, %zu) at %zu", d0, s0, len, i);
+            break;
+        }
+}
+
+int
+main(void)
+{
+    int iter;
+
+    enda = page_end(bufa);
+    endb = page_end(bufb);
+    for (iter = 0; iter < 20000 && errors < 20; iter++)
+        test_one(iter);
+    printf("%d errors\n", errors);
+    return errors != 0;
+}
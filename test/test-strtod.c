@@ -98,6 +98,57 @@ struct {
 
 #define NTESTS (sizeof(tests)/sizeof(tests[0]))
 
+#if (defined(TINY_STDIO) && defined(_IO_FLOAT_EXACT)) || !defined(__PICOLIBC__)
+/*
+ * Decimal strings with more digits than fit in 64 bits, at or next to
+ * the point half way between two values. The digits past the first
+ * 19 decide the rounding.
+ */
+
+/* Half way between 0 and the smallest subnormal double, 2**-1075 */
+#define HALF_MIN_SUBNORMAL "2.4703282292062327208828439643411068618252990130716238221279" \
+    "2841250337753635104375932649918180817996189898282347722858865463328355" \
+    "1779698981993873980053909390631503565951557022639229085839244910518443" \
+    "5931802849936536152500319370457678249219365623669863658480757001585769" \
+    "2699037063119282795585513329278343384093519780155312465972635795746227" \
+    "6646527282722005637400648549997709659947045402082816622623785739345073" \
+    "6339007967761930577506740176324673600968951340535537458516661134223766" \
+    "6786041621596804619144672918403005300575308490487653917113865916462395" \
+    "2491262365388187963623937328042389101867234849766823508986338858792562" \
+    "8302755995657524455507255189313690836254779186948667994968324049705821" \
+    "028513185451396213837722826145437693412532098591327667236328125"
+
+/* Half way between DBL_MAX and 2**1024, 2**1024 - 2**970, without the final '2' */
+#define HALF_DBL_MAX_PREFIX "17976931348623158079372897140530341507993413271003782693617" \
+    "3778980444968292764750946649017977587207096330286416692887910946555547" \
+    "8519404026306574886715058206819089020007083836762738548458177115317644" \
+    "7573027006985557136695962284291481986083493647529271907416844436551070" \
+    "434271155969950809304288017790417449779"
+
+struct {
+    char        *string;
+    double      dvalue;
+    float       fvalue;
+} long_tests[] = {
+    { "595013765328797505e-142@", 0x1.4238d4ec9fb54p-413, 0.0f },
+    { "8252101302205947951e126@", 0x1.525badab8d508p+481, (float) INFINITY },
+    { "54688115206e-1@", 0x1.45f771009999ap+32, 0x1.45f772p+32f },
+    { "1.20585440430969459413e+1@", 0x1.81df97c1cf439p+3, 0x1.81df98p+3f },
+    { "9007199254740993@", 0x1p+53, 0x1p+53f },
+    { "9007199254740993.0000000000000000000000001@", 0x1.0000000000001p+53, 0x1p+53f },
+    { "9007199254740992.99999999999999999999999@", 0x1p+53, 0x1p+53f },
+    { "16777217@", 0x1.000001p+24, 0x1p+24f },
+    { "16777217.00000000000000000000001@", 0x1.000001p+24, 0x1.000002p+24f },
+    { "16777216.9999999999999999999999@", 0x1.000001p+24, 0x1p+24f },
+    { HALF_MIN_SUBNORMAL "e-324@", 0.0, 0.0f },
+    { HALF_MIN_SUBNORMAL "1e-324@", 0x1p-1074, 0.0f },
+    { HALF_DBL_MAX_PREFIX "2@", (double) INFINITY, (float) INFINITY },
+    { HALF_DBL_MAX_PREFIX "1.99999999999999999999999@", 0x1.fffffffffffffp+1023, (float) INFINITY },
+};
+
+#define NLONG_TESTS (sizeof(long_tests)/sizeof(long_tests[0]))
+#endif
+
 int main(void)
 {
     int i;
@@ -146,5 +197,21 @@ int main(void)
         }
 #endif
     }
+#ifdef NLONG_TESTS
+    for (i = 0; i < (int) NLONG_TESTS; i++) {
+        d = strtod(long_tests[i].string, &end);
+        if (d != long_tests[i].dvalue || *end != '@') {
+            printf("strtod(\"%s\"): got %a want %a end \"%s\"\n", long_tests[i].string,
+                   d, long_tests[i].dvalue, end);
+            ret = 1;
+        }
+        f = strtof(long_tests[i].string, &end);
+        if (f != long_tests[i].fvalue || *end != '@') {
+            printf("strtof(\"%s\"): got %a want %a end \"%s\"\n", long_tests[i].string,
+                   (double) f, (double) long_tests[i].fvalue, end);
+            ret = 1;
+        }
+    }
+#endif
     return ret;
 }
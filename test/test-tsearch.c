@@ -0,0 +1,163 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _GNU_SOURCE
+#include <search.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define NKEYS   4096
+
+/* An AVL tree of NKEYS nodes is never deeper than this */
+#define MAX_LEVEL 17
+
+static int keys[NKEYS];
+static int walk_count, walk_last, walk_max_level, walk_order_bad;
+
+static int
+compar(const void *a, const void *b)
+{
+    int x = *(const int *) a, y = *(const int *) b;
+
+    return (x > y) - (x < y);
+}
+
+static void
+walk(const void *node, VISIT visit, int level)
+{
+    int key = **(int * const *) node;
+
+    if (level > walk_max_level)
+        walk_max_level = level;
+    if (visit == postorder || visit == leaf) {
+        if (walk_count && key <= walk_last)
+            walk_order_bad++;
+        walk_last = key;
+        walk_count++;
+    }
+}
+
+static int
+check_tree(void *root, const char *phase, int count)
+{
+    int ret = 0;
+
+    walk_count = walk_last = walk_max_level = walk_order_bad = 0;
+    twalk(root, walk);
+    if (walk_count != count) {
+        printf("%s: walked %d nodes, expected %d\n", phase, walk_count, count);
+        ret++;
+    }
+    if (walk_order_bad) {
+        printf("%s: %d nodes out of order\n", phase, walk_order_bad);
+        ret++;
+    }
+    if (walk_max_level > MAX_LEVEL) {
+        printf("%s: tree depth %d exceeds %d\n", phase, walk_max_level, MAX_LEVEL);
+        ret++;
+    }
+    return ret;
+}
+
+static void
+free_key(void *key)
+{
+    (void) key;
+}
+
+int
+main(void)
+{
+    void *root = NULL;
+    void *node;
+    int i, count;
+    int ret = 0;
+
+    /* Sorted insertion is the worst case for an unbalanced tree */
+    for (i = 0; i < NKEYS; i++) {
+        keys[i] = i;
+        node = tsearch(&keys[i], &root, compar);
+        if (!node || *(int **) node != &keys[i]) {
+            printf("tsearch %d failed\n", i);
+            return 1;
+        }
+    }
+    ret += check_tree(root, "insert", NKEYS);
+
+    /* Searching for an existing key must return the existing node */
+    for (i = 0; i < NKEYS; i++) {
+        int key = i;
+
+        node = tfind(&key, &root, compar);
+        if (!node || *(int **) node != &keys[i]) {
+            printf("tfind %d failed\n", i);
+            ret++;
+        }
+        if (tsearch(&key, &root, compar) != node) {
+            printf("tsearch %d found a different node\n", i);
+            ret++;
+        }
+    }
+
+    /* Delete the lower half and every odd key */
+    count = NKEYS;
+    for (i = 0; i < NKEYS; i++) {
+        if (i >= NKEYS / 2 && (i & 1) == 0)
+            continue;
+        if (!tdelete(&keys[i], &root, compar)) {
+            printf("tdelete %d failed\n", i);
+            ret++;
+        }
+        count--;
+    }
+    ret += check_tree(root, "delete", count);
+
+    for (i = 0; i < NKEYS; i++) {
+        int present = i >= NKEYS / 2 && (i & 1) == 0;
+
+        node = tfind(&keys[i], &root, compar);
+        if ((node != NULL) != present) {
+            printf("tfind %d after delete: got %p\n", i, node);
+            ret++;
+        }
+        if (!present && tdelete(&keys[i], &root, compar)) {
+            printf("tdelete %d succeeded twice\n", i);
+            ret++;
+        }
+    }
+
+    tdestroy(root, free_key);
+    return ret != 0;
+}
@@ -0,0 +1,318 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Check the vector variants of the math functions, which compilers
+ * call from vectorized loops, against the scalar functions. The
+ * vector code may contract to fma where the scalar code doesn't, so
+ * results are allowed to differ by one ulp.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__x86_64__) && \
+    (defined(__clang__) || __GNUC__ >= 9) && \
+    (!__OBSOLETE_MATH_FLOAT || !__OBSOLETE_MATH_DOUBLE)
+
+#include <cpuid.h>
+
+#define NTEST   1024
+
+static float fx[NTEST], fy[NTEST];
+static double dx[NTEST];
+
+static const float fspecial[] = {
+    0.0f, -0.0f, 1.0f, -1.0f, 0.5f, 2.0f, INFINITY, -INFINITY, NAN,
+    0x1p-149f, -0x1p-149f, 0x1p-126f, 0x1.fffffep127f, 0x1p-20f,
+    0x1p-12f, 1.0000001f, 0.99999994f, 3.14159265f, 88.72f, 88.73f,
+    -103.9f, 127.9f, 128.0f, -150.0f, 119.9f, 120.0f, 1e30f,
+};
+
+static const double dspecial[] = {
+    0.0, -0.0, 1.0, -1.0, 0.5, 2.0, INFINITY, -INFINITY, NAN,
+    0x1p-1074, -0x1p-1074, 0x1p-1022, 0x1.fffffffffffffp1023, 0x1p-60,
+    0x1p-53, 1.0000000000000002, 0.9999999999999999, 1.06, 0.94,
+    709.7, 709.8, -745.1, -708.4, 511.9, 512.0, 1e300,
+};
+
+static uint32_t seed = 1;
+
+static uint32_t
+rnd(void)
+{
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) | (seed << 16);
+}
+
+static void
+fill(void)
+{
+    int nf = sizeof(fspecial) / sizeof(fspecial[0]);
+    int nd = sizeof(dspecial) / sizeof(dspecial[0]);
+    int i;
+
+    for (i = 0; i < NTEST; i++) {
+        uint32_t u = rnd();
+        uint64_t v = ((uint64_t) rnd() << 32) | rnd();
+
+        /* special values, any bits, and a range most functions care about */
+        switch (i % 3) {
+        case 0:
+            fx[i] = fspecial[(i / 3) % nf];
+            dx[i] = dspecial[(i / 3) % nd];
+            break;
+        case 1:
+            memcpy(&fx[i], &u, sizeof(fx[i]));
+            memcpy(&dx[i], &v, sizeof(dx[i]));
+            break;
+        default:
+            fx[i] = (int32_t) u * 0x1p-31f * 100.0f;
+            dx[i] = (int64_t) v * 0x1p-63 * 800.0;
+            break;
+        }
+        fy[i] = (int32_t) rnd() * 0x1p-31f * 20.0f;
+        if (i % 5 == 0)
+            fy[i] = (float) (int) fy[i];
+    }
+}
+
+static int errors;
+
+static int
+close_f(float a, float b)
+{
+    int32_t ia, ib;
+
+    if (isnan(a) || isnan(b))
+        return isnan(a) && isnan(b);
+    memcpy(&ia, &a, sizeof(ia));
+    memcpy(&ib, &b, sizeof(ib));
+    if ((ia ^ ib) < 0)
+        return 0;
+    return ia - ib <= 1 && ib - ia <= 1;
+}
+
+static int
+close_d(double a, double b)
+{
+    int64_t ia, ib;
+
+    if (isnan(a) || isnan(b))
+        return isnan(a) && isnan(b);
+    memcpy(&ia, &a, sizeof(ia));
+    memcpy(&ib, &b, sizeof(ib));
+    if ((ia ^ ib) < 0)
+        return 0;
+    return ia - ib <= 1 && ib - ia <= 1;
+}
+
+static void
+check_f(const char *name, float x, float y, float got, float want)
+{
+    uint32_t ux, uy, ug, uw;
+
+    if (close_f(got, want))
+        return;
+    memcpy(&ux, &x, 4);
+    memcpy(&uy, &y, 4);
+    memcpy(&ug, &got, 4);
+    memcpy(&uw, &want, 4);
+    printf("%s(%08lx, %08lx) = %08lx want %08lx\n", name,
+           (unsigned long) ux, (unsigned long) uy,
+           (unsigned long) ug, (unsigned long) uw);
+    errors++;
+}
+
+static void
+check_d(const char *name, double x, double got, double want)
+{
+    uint64_t ux, ug, uw;
+
+    if (close_d(got, want))
+        return;
+    memcpy(&ux, &x, 8);
+    memcpy(&ug, &got, 8);
+    memcpy(&uw, &want, 8);
+    printf("%s(%016llx) = %016llx want %016llx\n", name,
+           (unsigned long long) ux, (unsigned long long) ug,
+           (unsigned long long) uw);
+    errors++;
+}
+
+#define VNAME(isa, n, args, f)  _ZGV ## isa ## N ## n ## args ## _ ## f
+
+/* Test one float function of one argument for one vector width */
+#define TEST_F1(isa, n, vf, f) do {                                     \
+        for (int i = 0; i < NTEST; i += n) {                            \
+            vf x, y;                                                    \
+            for (int l = 0; l < n; l++)                                 \
+                x[l] = fx[i + l];                                       \
+            y = VNAME(isa, n, v, f)(x);                                 \
+            for (int l = 0; l < n; l++)                                 \
+                check_f(#isa #n " " #f, x[l], 0, y[l], f(x[l]));        \
+        }                                                               \
+    } while (0)
+
+#define TEST_POWF(isa, n, vf) do {                                      \
+        for (int i = 0; i < NTEST; i += n) {                            \
+            vf x, y, r;                                                 \
+            for (int l = 0; l < n; l++) {                               \
+                x[l] = (i & 64) ? fx[i + l] : fabsf(fx[i + l]);         \
+                y[l] = fy[i + l];                                       \
+            }                                                           \
+            r = VNAME(isa, n, vv, powf)(x, y);                          \
+            for (int l = 0; l < n; l++)                                 \
+                check_f(#isa #n " powf", x[l], y[l], r[l],              \
+                        powf(x[l], y[l]));                              \
+        }                                                               \
+    } while (0)
+
+#define TEST_D1(isa, n, vd, f) do {                                     \
+        for (int i = 0; i < NTEST; i += n) {                            \
+            vd x, y;                                                    \
+            for (int l = 0; l < n; l++)                                 \
+                x[l] = dx[i + l];                                       \
+            y = VNAME(isa, n, v, f)(x);                                 \
+            for (int l = 0; l < n; l++)                                 \
+                check_d(#isa #n " " #f, x[l], y[l], f(x[l]));           \
+        }                                                               \
+    } while (0)
+
+#if !__OBSOLETE_MATH_FLOAT
+#define DECL_FLOAT(isa, n, vf, attr)                    \
+    attr vf VNAME(isa, n, v, sinf)(vf);                 \
+    attr vf VNAME(isa, n, v, cosf)(vf);                 \
+    attr vf VNAME(isa, n, v, expf)(vf);                 \
+    attr vf VNAME(isa, n, v, exp2f)(vf);                \
+    attr vf VNAME(isa, n, v, logf)(vf);                 \
+    attr vf VNAME(isa, n, v, log2f)(vf);                \
+    attr vf VNAME(isa, n, vv, powf)(vf, vf);
+#define TEST_FLOAT(isa, n, vf) do {                     \
+        TEST_F1(isa, n, vf, sinf);                      \
+        TEST_F1(isa, n, vf, cosf);                      \
+        TEST_F1(isa, n, vf, expf);                      \
+        TEST_F1(isa, n, vf, exp2f);                     \
+        TEST_F1(isa, n, vf, logf);                      \
+        TEST_F1(isa, n, vf, log2f);                     \
+        TEST_POWF(isa, n, vf);                          \
+    } while (0)
+#else
+#define DECL_FLOAT(isa, n, vf, attr)
+#define TEST_FLOAT(isa, n, vf)
+#endif
+
+#if !__OBSOLETE_MATH_DOUBLE
+#define DECL_DOUBLE(isa, n, vd, attr)                   \
+    attr vd VNAME(isa, n, v, exp)(vd);                  \
+    attr vd VNAME(isa, n, v, log)(vd);
+#define TEST_DOUBLE(isa, n, vd) do {                    \
+        TEST_D1(isa, n, vd, exp);                       \
+        TEST_D1(isa, n, vd, log);                       \
+    } while (0)
+#else
+#define DECL_DOUBLE(isa, n, vd, attr)
+#define TEST_DOUBLE(isa, n, vd)
+#endif
+
+typedef float vf4 __attribute__((__vector_size__(16)));
+typedef float vf8 __attribute__((__vector_size__(32)));
+typedef float vf16 __attribute__((__vector_size__(64)));
+typedef double vd2 __attribute__((__vector_size__(16)));
+typedef double vd4 __attribute__((__vector_size__(32)));
+typedef double vd8 __attribute__((__vector_size__(64)));
+
+#define SSE2    __attribute__((__target__("sse2")))
+#define AVX     __attribute__((__target__("avx")))
+#define AVX2    __attribute__((__target__("avx2")))
+#define AVX512F __attribute__((__target__("avx512f")))
+
+DECL_FLOAT(b, 4, vf4, SSE2)
+DECL_DOUBLE(b, 2, vd2, SSE2)
+DECL_FLOAT(c, 8, vf8, AVX)
+DECL_DOUBLE(c, 4, vd4, AVX)
+DECL_FLOAT(d, 8, vf8, AVX2)
+DECL_DOUBLE(d, 4, vd4, AVX2)
+DECL_FLOAT(e, 16, vf16, AVX512F)
+DECL_DOUBLE(e, 8, vd8, AVX512F)
+
+static SSE2 void test_b(void) { TEST_FLOAT(b, 4, vf4); TEST_DOUBLE(b, 2, vd2); }
+static AVX void test_c(void) { TEST_FLOAT(c, 8, vf8); TEST_DOUBLE(c, 4, vd4); }
+static AVX2 void test_d(void) { TEST_FLOAT(d, 8, vf8); TEST_DOUBLE(d, 4, vd4); }
+static AVX512F void test_e(void) { TEST_FLOAT(e, 16, vf16); TEST_DOUBLE(e, 8, vd8); }
+
+static void
+test_all(void)
+{
+    unsigned int a, b, c, d, lo, hi;
+
+    test_b();
+
+    /* The wider variants need both the cpu and the OS to support them */
+    if (!__get_cpuid(1, &a, &b, &c, &d) || !(c & bit_OSXSAVE) || !(c & bit_AVX))
+        return;
+    __asm__("xgetbv" : "=a" (lo), "=d" (hi) : "c" (0));
+    if ((lo & 0x06) != 0x06)
+        return;
+    test_c();
+    if (!__get_cpuid_count(7, 0, &a, &b, &c, &d))
+        return;
+    if (b & bit_AVX2)
+        test_d();
+    if ((b & bit_AVX512F) && (lo & 0xe6) == 0xe6)
+        test_e();
+}
+
+int
+main(void)
+{
+    fill();
+    test_all();
+    printf("%d errors\n", errors);
+    return errors != 0;
+}
+
+#else
+
+int
+main(void)
+{
+    printf("no vector math functions\n");
+    return 77;
+}
+
+#endif
@@ -144,13 +144,18 @@
     result |= test(__LINE__, "3.14      ", "%-*.*f", 10, 2, 3.14159265);
 # if !(defined(TINY_STDIO) && !defined(_IO_FLOAT_EXACT))
 #  ifndef LOW_FLOAT
-#   ifdef TINY_STDIO
+#   if defined(TINY_STDIO) && !defined(_IO_FLOAT_RYU_PRINTF)
 #    define SQRT2_60 "1414213562373095000000000000000000000000000000000000000000000.000"
 #   else
 #    define SQRT2_60 "1414213562373095053224405813183213153460812619236586568024064.000"
 #   endif
     result |= test(__LINE__, SQRT2_60, "%.3f", 1.4142135623730950e60);
 #  endif
+#  ifdef _IO_FLOAT_RYU_PRINTF
+    result |= test(__LINE__, "0.1000000000000000055511151231257827021181583404541015625", "%.55f", 0.1);
+    result |= test(__LINE__, "4.9406564584124654417656879286822137236505980e-324", "%.43e", 4.9406564584124654e-324);
+    result |= test(__LINE__, "9.99999999999999916114e+22", "%.20e", 1e23);
+#  endif
 # endif
 #endif
     /* 64: anti-test */